@@ -0,0 +1,170 @@
+// -------------------------------------------------------------------
+// File			:	AnimationTest - TestSuite
+//
+// Description	:	Test for the AnimationClip and AnimationSampler from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+static UINT NextRandom(UINT& State)
+{
+	State = State * 1664525u + 1013904223u;
+	return State >> 8;
+}
+
+static float RandomFloat(UINT& State, const float Min, const float Max)
+{
+	return Min + (Max - Min) * (float)NextRandom(State) / 16777216.0f;
+}
+
+// Angle between 2 Rotations
+static float RotationError(const Quat& a, const Quat& b)
+{
+	return 2.0f * acosf(XMMin(fabsf(Quat::Dot(a, b)), 1.0f));
+}
+
+bool AnimationTest()
+{
+	UINT State = 815;
+
+	// Quaternion-Keys : 15 Bit per Component, the largest one rebuilt
+	for (int i = 0; i < 1000; i++)
+	{
+		const Vector4 Axis(RandomFloat(State, -1.0f, 1.0f), RandomFloat(State, -1.0f, 1.0f), RandomFloat(State, 0.1f, 1.0f), 0.0f);
+		const Quat q = Quat::RotationAxis(Axis, RandomFloat(State, -XM_PI, XM_PI));
+
+		PackedKey Key;
+		AnimationClip::PackQuat(q, Key);
+
+		assert(RotationError(Quat(AnimationClip::UnpackQuat(Key)), q) < 2e-4f);
+	}
+
+	// Vector-Keys : 16 Bit in the Range
+	const XMVECTOR RangeMin = XMVectorSet(-2.0f, 0.0f, 10.0f, 0.0f);
+	const XMVECTOR RangeExtent = XMVectorSet(4.0f, 1.0f, 0.5f, 0.0f);
+
+	for (int i = 0; i < 1000; i++)
+	{
+		const XMVECTOR v = XMVectorMultiplyAdd(XMVectorSet(RandomFloat(State, 0.0f, 1.0f), RandomFloat(State, 0.0f, 1.0f), RandomFloat(State, 0.0f, 1.0f), 0.0f), RangeExtent, RangeMin);
+
+		PackedKey Key;
+		AnimationClip::PackVector(v, RangeMin, RangeExtent, Key);
+
+		assert(XMVector3LessOrEqual(XMVectorAbs(XMVectorSubtract(AnimationClip::UnpackVector(Key, RangeMin, RangeExtent), v)), XMVectorScale(RangeExtent, 1.0f / 65535.0f)));
+	}
+
+	// Clip of 6 Bones (more than one SIMD-Block) with smooth Motion
+	const UINT NumBones = 6;
+	const UINT NumFrames = 90;
+	const float SampleRate = 30.0f;
+
+	std::vector<Quat> Rotations(NumBones * NumFrames);
+	std::vector<Vector4> Translations(NumBones * NumFrames);
+
+	for (UINT f = 0; f < NumFrames; f++)
+	{
+		for (UINT b = 0; b < NumBones; b++)
+		{
+			const float t = (float)f / SampleRate;
+
+			// Bone 0 stands still
+			Rotations[f * NumBones + b] = Quat::RotationAxis(Vector4(1.0f, (float)b, 0.5f, 0.0f), (b == 0) ? 0.3f : sinf(t * (float)b) * 1.5f);
+			Translations[f * NumBones + b] = Vector4((float)b, (b == 0) ? 0.0f : 0.5f * sinf(2.0f * t), 0.25f * t, 0.0f);
+		}
+	}
+
+	AnimationClip Clip;
+	assert(Clip.Build(NumBones, NumFrames, SampleRate, Rotations.data(), Translations.data()));
+
+	assert(Clip.GetNumBones() == NumBones);
+	assert(Clip.GetNumFrames() == NumFrames);
+	assert(fabsf(Clip.GetDuration() - (float)(NumFrames - 1) / SampleRate) < 1e-5f);
+
+	// constant Tracks have one Key, the others fewer Keys than Frames
+	assert(Clip.GetTrack(AnimationClip::CHANNEL_ROTATION, 0).NumKeys == 1);
+	assert(Clip.GetTrack(AnimationClip::CHANNEL_SCALE, 3).NumKeys == 1);
+	assert(Clip.GetNumKeys(AnimationClip::CHANNEL_SCALE) == NumBones);
+	assert(Clip.GetNumKeys(AnimationClip::CHANNEL_ROTATION) < NumBones * NumFrames);
+	assert(Clip.GetMemorySize() < NumBones * NumFrames * (sizeof(Quat) + sizeof(Vector4)));
+
+	// sampled Poses within the Tolerances (plus the Quantisation)
+	AnimationSampler Sampler;
+	Sampler.Bind(&Clip);
+
+	std::vector<Matrix> Matrices(NumBones);
+	std::vector<Affine3x4> Palette(NumBones);
+
+	for (UINT f = 0; f < NumFrames; f++)
+	{
+		const float Time = (float)f / SampleRate;
+
+		Sampler.Sample(Time);
+
+		for (UINT b = 0; b < NumBones; b++)
+		{
+			const Vector4& t = Translations[f * NumBones + b];
+
+			assert(RotationError(Sampler.GetRotations().Get(b), Rotations[f * NumBones + b]) < 0.002f);
+			assert(fabsf(Sampler.GetTranslations(0)[b] - t.GetX()) < 0.002f);
+			assert(fabsf(Sampler.GetTranslations(1)[b] - t.GetY()) < 0.002f);
+			assert(fabsf(Sampler.GetTranslations(2)[b] - t.GetZ()) < 0.002f);
+			assert(fabsf(Sampler.GetScales(0)[b] - 1.0f) < 1e-3f);
+		}
+
+		// Matrices : Rotation, then Translation - the Palette holds their Columns
+		Sampler.Sample(Time, Matrices.data());
+		Sampler.Sample(Time, Palette.data());
+
+		for (UINT b = 0; b < NumBones; b++)
+		{
+			const Matrix R = Matrix::RotationQuaternion(Sampler.GetRotations().Get(b));
+
+			for (int r = 0; r < 3; r++)
+			{
+				for (int c = 0; c < 3; c++)
+					assert(fabsf(Matrices[b](r, c) - R(r, c)) < 1e-3f);
+			}
+
+			assert(fabsf(Matrices[b](3, 0) - Sampler.GetTranslations(0)[b]) < 1e-5f);
+			assert(fabsf(Matrices[b](3, 2) - Sampler.GetTranslations(2)[b]) < 1e-5f);
+			assert(fabsf(Matrices[b](3, 3) - 1.0f) < 1e-6f);
+
+			for (int c = 0; c < 3; c++)
+			{
+				assert(fabsf(Palette[b].Row[c].x - Matrices[b](0, c)) < 1e-5f);
+				assert(fabsf(Palette[b].Row[c].y - Matrices[b](1, c)) < 1e-5f);
+				assert(fabsf(Palette[b].Row[c].z - Matrices[b](2, c)) < 1e-5f);
+				assert(fabsf(Palette[b].Row[c].w - Matrices[b](3, c)) < 1e-5f);
+			}
+		}
+	}
+
+	// Time is clamped, jumping back restarts the Cursors
+	Sampler.Sample(100.0f);
+	assert(RotationError(Sampler.GetRotations().Get(3), Rotations[(NumFrames - 1) * NumBones + 3]) < 0.002f);
+
+	Sampler.Sample(-1.0f);
+	assert(RotationError(Sampler.GetRotations().Get(3), Rotations[3]) < 0.002f);
+
+	// invalid Input
+	AnimationClip Empty;
+	assert(!Empty.Build(0, NumFrames, SampleRate, Rotations.data(), Translations.data()));
+
+	// Ready and return
+	return true;
+
+}
@@ -0,0 +1,99 @@
+// -------------------------------------------------------------------
+// File			:	BSPTreeTest - TestSuite
+//
+// Description	:	Test for BSPTree from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+// Polygon is qualified : wingdi.h (windows.h) declares the Function ::Polygon
+
+// Quad around Center spanned by u and v, the Normal is Cross(u, v)
+static TurboMath::Polygon MakeQuad(const Vector4& Center, const Vector4& u, const Vector4& v)
+{
+	const Vector4 Points[4] = { Center - u - v, Center + u - v, Center + u + v, Center - u + v };
+	return TurboMath::Polygon(Points, 4);
+}
+
+bool BSPTreeTest()
+{
+	// closed Room [0, 10]^3, the Normals point inside (empty Space)
+	const Vector4 x(5.0f, 0.0f, 0.0f, 0.0f), y(0.0f, 5.0f, 0.0f, 0.0f), z(0.0f, 0.0f, 5.0f, 0.0f);
+
+	const TurboMath::Polygon Room[6] =
+	{
+		MakeQuad(Vector4(5.0f, 5.0f, 0.0f, 1.0f), x, y),
+		MakeQuad(Vector4(5.0f, 5.0f, 10.0f, 1.0f), y, x),
+		MakeQuad(Vector4(0.0f, 5.0f, 5.0f, 1.0f), y, z),
+		MakeQuad(Vector4(10.0f, 5.0f, 5.0f, 1.0f), z, y),
+		MakeQuad(Vector4(5.0f, 0.0f, 5.0f, 1.0f), z, x),
+		MakeQuad(Vector4(5.0f, 10.0f, 5.0f, 1.0f), x, z),
+	};
+
+	BSPTree Tree;
+	assert(Tree.IsEmpty());
+	assert(!Tree.IsPointSolid(Vector4(5.0f, 5.0f, 5.0f, 1.0f)));
+
+	Tree.Build(Room, 6);
+	assert(!Tree.IsEmpty());
+	assert(Tree.GetNumSplits() == 0);
+	assert(Tree.GetNumPolygons() == 6);
+
+	// Point-Queries
+	assert(!Tree.IsPointSolid(Vector4(5.0f, 5.0f, 5.0f, 1.0f)));
+	assert(!Tree.IsPointSolid(Vector4(0.5f, 9.5f, 0.5f, 1.0f)));
+	assert(Tree.IsPointSolid(Vector4(-1.0f, 5.0f, 5.0f, 1.0f)));
+	assert(Tree.IsPointSolid(Vector4(5.0f, 5.0f, 11.0f, 1.0f)));
+
+	// Ray-Queries
+	float Dist = 0.0f;
+	Vector4 Normal;
+
+	assert(Tree.IntersectRay(Ray(Vector4(5.0f, 5.0f, 5.0f, 1.0f), Vector4(1.0f, 0.0f, 0.0f, 0.0f)), &Dist, &Normal));
+	assert(fabsf(Dist - 5.0f) < 1e-4f);
+	assert(XMVector3NearEqual(Normal, XMVectorSet(-1.0f, 0.0f, 0.0f, 0.0f), XMVectorReplicate(1e-5f)));
+
+	assert(Tree.IntersectRay(Ray(Vector4(5.0f, 2.0f, 5.0f, 1.0f), Vector4(0.0f, -1.0f, 0.0f, 0.0f)), &Dist, &Normal));
+	assert(fabsf(Dist - 2.0f) < 1e-4f);
+	assert(XMVector3NearEqual(Normal, XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f), XMVectorReplicate(1e-5f)));
+
+	assert(!Tree.IntersectRay(Ray(Vector4(5.0f, 5.0f, 5.0f, 1.0f), Vector4(1.0f, 0.0f, 0.0f, 0.0f)), &Dist, nullptr, 4.0f));
+
+	// starting inside the solid Space
+	assert(Tree.IntersectRay(Ray(Vector4(-5.0f, 5.0f, 5.0f, 1.0f), Vector4(1.0f, 0.0f, 0.0f, 0.0f)), &Dist, &Normal));
+	assert(Dist == 0.0f);
+
+	// Traversal visits every Polygon once
+	UINT	NumVisited = 0;
+	float	Area = 0.0f;
+
+	Tree.TraverseFrontToBack(Vector4(5.0f, 5.0f, 5.0f, 1.0f), [&](const TurboMath::Polygon& Poly)
+	{
+		NumVisited++;
+		Area += Poly.GetArea();
+	});
+
+	assert(NumVisited == 6);
+	assert(fabsf(Area - 600.0f) < 1e-2f);
+
+	Tree.Clear();
+	assert(Tree.IsEmpty());
+
+	// Ready and return
+	return true;
+
+}
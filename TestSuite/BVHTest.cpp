@@ -0,0 +1,174 @@
+// -------------------------------------------------------------------
+// File			:	BVHTest - TestSuite
+//
+// Description	:	Test for BVH and ParallelFor from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+#include <algorithm>
+
+using namespace TurboMath;
+
+// deterministic Values in [0, 1)
+static float NextRandom(UINT& State)
+{
+	State = State * 1664525u + 1013904223u;
+	return (float)(State >> 8) / 16777216.0f;
+}
+
+static bool Overlap(const AABB& a, const AABB& b)
+{
+	return XMVector3LessOrEqual(a.GetMinExtents(), b.GetMaxExtents()) && XMVector3LessOrEqual(b.GetMinExtents(), a.GetMaxExtents());
+}
+
+bool BVHTest()
+{
+	// ParallelFor : every Element exactly once, nested Calls
+	std::vector<UINT> Counter(100000, 0);
+	ParallelFor((UINT)Counter.size(), 1000, [&](const UINT Begin, const UINT End)
+	{
+		for (UINT i = Begin; i < End; i++) Counter[i]++;
+	});
+	assert(std::count(Counter.begin(), Counter.end(), 1u) == (int)Counter.size());
+
+	std::atomic<UINT> Nested(0);
+	ParallelFor(16, 1, [&](const UINT Begin, const UINT End)
+	{
+		for (UINT i = Begin; i < End; i++)
+			ParallelFor(1000, 100, [&](const UINT b, const UINT e) { Nested += e - b; });
+	});
+	assert(Nested == 16000);
+
+	// random Boxes
+	const UINT Count = 2000;
+	std::vector<AABB, AAllocator<AABB> > Boxes(Count);
+	UINT Seed = 12345;
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		const Vector4 c(NextRandom(Seed) * 100.0f, NextRandom(Seed) * 100.0f, NextRandom(Seed) * 100.0f, 1.0f);
+		const Vector4 e(NextRandom(Seed) + 0.1f, NextRandom(Seed) + 0.1f, NextRandom(Seed) + 0.1f, 0.0f);
+
+		Boxes[i].Set(c, e);
+	}
+
+	for (UINT Bits = 0; Bits < 2; Bits++)
+	{
+		BVH Tree;
+		Tree.BuildLinear(Boxes.data(), Count, Bits == 1);
+
+		assert(!Tree.IsEmpty());
+		assert(Tree.GetNumPrimitives() == Count);
+
+		// Box-Query against Brute-Force
+		AABB Query;
+		Query.Set(Vector4(50.0f, 50.0f, 50.0f, 1.0f), Vector4(10.0f, 20.0f, 5.0f, 0.0f));
+
+		std::vector<UINT> Found, Expected;
+		Tree.QueryAABB(Query, Found);
+
+		for (UINT i = 0; i < Count; i++)
+			if (Overlap(Boxes[i], Query)) Expected.push_back(i);
+
+		std::sort(Found.begin(), Found.end());
+		assert(Found == Expected);
+
+		// Sphere-Query against Brute-Force
+		Sphere S;
+		S.Set(Vector4(30.0f, 60.0f, 40.0f, 1.0f), 12.0f);
+
+		Found.clear();
+		Expected.clear();
+		Tree.QuerySphere(S, Found);
+
+		for (UINT i = 0; i < Count; i++)
+			if (Boxes[i].DistanceSq(S.GetCenter()) <= 144.0f) Expected.push_back(i);
+
+		std::sort(Found.begin(), Found.end());
+		assert(Found == Expected);
+	}
+
+	// Refit and Optimize after moving the Boxes
+	{
+		BVH Tree;
+		Tree.BuildLinear(Boxes.data(), Count);
+		assert(fabsf(Tree.GetQualityRatio() - 1.0f) < 1e-4f);
+		assert(!Tree.NeedsRebuild());
+
+		for (UINT i = 0; i < Count; i++)
+			Boxes[i].Move(Vector4((i & 1) ? 30.0f : -30.0f, 0.0f, 0.0f, 0.0f));
+
+		Tree.Refit(Boxes.data());
+
+		const float CostRefit = Tree.ComputeSAHCost();
+		Tree.Optimize(4);
+		assert(Tree.ComputeSAHCost() <= CostRefit * 1.0001f);
+
+		AABB Query;
+		Query.Set(Vector4(40.0f, 50.0f, 50.0f, 1.0f), Vector4(15.0f, 15.0f, 15.0f, 0.0f));
+
+		std::vector<UINT> Found, Expected;
+		Tree.QueryAABB(Query, Found);
+
+		for (UINT i = 0; i < Count; i++)
+			if (Overlap(Boxes[i], Query)) Expected.push_back(i);
+
+		std::sort(Found.begin(), Found.end());
+		assert(Found == Expected);
+
+		// the Root encloses all Boxes
+		const AABB Bounds = Tree.GetBounds();
+		for (UINT i = 0; i < Count; i++)
+		{
+			assert(XMVector3LessOrEqual(Bounds.GetMinExtents(), Boxes[i].GetMinExtents()));
+			assert(XMVector3LessOrEqual(Boxes[i].GetMaxExtents(), Bounds.GetMaxExtents()));
+		}
+	}
+
+	// Ray-Query over a Mesh against the Brute-Force Mesh-Query
+	TriangleMesh Mesh;
+
+	for (UINT t = 0; t < 500; t++)
+	{
+		const Vector4 p(NextRandom(Seed) * 20.0f, NextRandom(Seed) * 20.0f, NextRandom(Seed) * 20.0f, 1.0f);
+		const Vector4 a(NextRandom(Seed), NextRandom(Seed), NextRandom(Seed), 0.0f);
+		const Vector4 b(NextRandom(Seed), NextRandom(Seed), NextRandom(Seed), 0.0f);
+
+		Mesh.AddTriangle(Triangle(p, p + a, p + b));
+	}
+
+	Mesh.BuildTriangleData();
+
+	BVH MeshTree;
+	MeshTree.BuildLinear(Mesh);
+
+	for (UINT r = 0; r < 100; r++)
+	{
+		const Vector4 Org(NextRandom(Seed) * 20.0f, NextRandom(Seed) * 20.0f, -5.0f, 1.0f);
+		const Ray theRay(Org, Vector4(NextRandom(Seed) - 0.5f, NextRandom(Seed) - 0.5f, 1.0f, 0.0f));
+
+		RayHit HitTree, HitBrute;
+		const bool bTree = MeshTree.IntersectRay(theRay, Mesh, HitTree);
+		const bool bBrute = Mesh.IntersectRay(theRay, HitBrute);
+
+		// the Tree tests its single-Triangle Leafs scalar, the Brute-Force batched : same Hit up to the Rounding of the Division
+		assert(bTree == bBrute);
+		assert(!bTree || fabsf(HitTree.Distance - HitBrute.Distance) <= 1e-5f * HitBrute.Distance);
+	}
+
+	// Ready and return
+	return true;
+
+}
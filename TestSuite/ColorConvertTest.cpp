@@ -0,0 +1,131 @@
+// -------------------------------------------------------------------
+// File			:	ColorConvertTest - TestSuite
+//
+// Description	:	Test for the Color-Conversion-Kernels from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+static UINT NextRandom(UINT& State)
+{
+	State = State * 1664525u + 1013904223u;
+	return State >> 8;
+}
+
+// exact sRGB-Curves
+static float SRGBToLinearRef(const float c)
+{
+	return (c <= 0.04045f) ? c / 12.92f : powf((c + 0.055f) / 1.055f, 2.4f);
+}
+
+static float LinearToSRGBRef(const float c)
+{
+	return (c <= 0.0031308f) ? c * 12.92f : 1.055f * powf(c, 1.0f / 2.4f) - 0.055f;
+}
+
+bool ColorConvertTest()
+{
+	// more Pixels than one Chunk of ParallelFor, every Byte-Value in every Channel
+	const UINT Count = 2 * ColorConvert::CHUNK_SIZE + 77;
+	UINT State = 99;
+
+	std::vector<uint32_t> Pixels(Count), Packed(Count);
+	std::vector<Color> Colors(Count);
+
+	for (UINT i = 0; i < Count; i++)
+		Pixels[i] = (i < 256) ? (i | ((255 - i) << 8) | (((i * 7) & 0xFF) << 16) | (((i * 13) & 0xFF) << 24)) : (NextRandom(State) ^ (NextRandom(State) << 16));
+
+	// 8 Bit <-> Float : exact round trip
+	ColorConvert::RGBA8ToFloat(Pixels.data(), Colors.data(), Count);
+	ColorConvert::FloatToRGBA8(Colors.data(), Packed.data(), Count);
+
+	for (UINT i = 0; i < Count; i++)
+		assert(Packed[i] == Pixels[i]);
+
+	assert(fabsf(Colors[255].GetR() - 1.0f) < 1e-6f);
+
+	// sRGB 8 Bit <-> linear : exact Table, Encode within the 8 Bit Step
+	ColorConvert::SRGB8ToLinear(Pixels.data(), Colors.data(), Count);
+
+	for (UINT i = 0; i < 256; i++)
+	{
+		assert(fabsf(Colors[i].GetR() - SRGBToLinearRef((float)i / 255.0f)) < 1e-6f);
+		assert(fabsf(Colors[i].GetA() - (float)(Pixels[i] >> 24) / 255.0f) < 1e-6f);
+	}
+
+	ColorConvert::LinearToSRGB8(Colors.data(), Packed.data(), Count);
+
+	for (UINT i = 0; i < Count; i++)
+		assert(Packed[i] == Pixels[i]);
+
+	// Float-Curves : the Bounds of the fitted Approximations
+	for (UINT i = 0; i <= 1000; i++)
+	{
+		const float c = (float)i / 1000.0f;
+
+		const float Linear = XMVectorGetX(ColorConvert::SRGBToLinear(XMVectorReplicate(c)));
+		const float SRGB = XMVectorGetX(ColorConvert::LinearToSRGB(XMVectorReplicate(c)));
+
+		assert(fabsf(Linear - SRGBToLinearRef(c)) <= 4e-4f * SRGBToLinearRef(c) + 1e-7f);
+		assert(fabsf(SRGB - LinearToSRGBRef(c)) <= 0.01f / 255.0f);
+	}
+
+	// Alpha is not converted, in place works
+	std::vector<Color> Gamma(Count);
+	ColorConvert::RGBA8ToFloat(Pixels.data(), Gamma.data(), Count);
+	ColorConvert::SRGBToLinear(Gamma.data(), Gamma.data(), Count);
+
+	for (UINT i = 0; i < Count; i += 97)
+	{
+		assert(fabsf(Gamma[i].GetR() - Colors[i].GetR()) <= 4e-4f * Colors[i].GetR() + 1e-7f);
+		assert(Gamma[i].GetA() == Colors[i].GetA());
+	}
+
+	// Premultiply and back (RGB = 0 for Alpha = 0)
+	ColorConvert::RGBA8ToFloat(Pixels.data(), Colors.data(), Count);
+	ColorConvert::Premultiply(Colors.data(), Gamma.data(), Count);
+	ColorConvert::Unpremultiply(Gamma.data(), Gamma.data(), Count);
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		if (Colors[i].GetA() > 0.0f)
+			assert(XMVector4NearEqual(Gamma[i], Colors[i], XMVectorReplicate(1e-5f)));
+		else
+			assert(XMVector4Equal(Gamma[i], XMVectorZero()));
+	}
+
+	// 16 and 32 Bit Formats
+	const Color Pack[3] = { Color(1.0f, 1.0f, 1.0f, 1.0f), Color(1.0f, 0.0f, 0.0f, 1.0f), Color(0.0f, 0.0f, 1.0f, 0.0f) };
+	uint16_t Short[3];
+	uint32_t Long[3];
+
+	ColorConvert::PackRGB565(Pack, Short, 3);
+	assert(Short[0] == 0xFFFF && Short[1] == 0xF800 && Short[2] == 0x001F);
+
+	ColorConvert::PackRGB555(Pack, Short, 3);
+	assert(Short[0] == 0x7FFF && Short[1] == 0x7C00 && Short[2] == 0x001F);
+
+	ColorConvert::PackARGB4444(Pack, Short, 3);
+	assert(Short[0] == 0xFFFF && Short[1] == 0xFF00 && Short[2] == 0x000F);
+
+	ColorConvert::PackR10G10B10A2(Pack, Long, 3);
+	assert(Long[0] == 0xFFFFFFFF && Long[1] == 0xC00003FF && Long[2] == 0x3FF00000);
+
+	// Ready and return
+	return true;
+
+}
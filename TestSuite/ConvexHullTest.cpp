@@ -0,0 +1,179 @@
+// -------------------------------------------------------------------
+// File			:	ConvexHullTest - TestSuite
+//
+// Description	:	Test for the ConvexHull from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+static UINT NextRandom(UINT& State)
+{
+	State = State * 1664525u + 1013904223u;
+	return State >> 8;
+}
+
+static float RandomFloat(UINT& State, const float Min, const float Max)
+{
+	return Min + (Max - Min) * (float)NextRandom(State) / 16777216.0f;
+}
+
+// Twins and Loops of the Half-Edges, Euler-Characteristic
+static bool IsConsistent(const ConvexHull& Hull)
+{
+	const HullHalfEdge* pEdges = Hull.GetEdges();
+	const HullFace* pFaces = Hull.GetFaces();
+
+	UINT NumEdges = 0;
+
+	for (UINT f = 0; f < Hull.GetNumFaces(); f++)
+	{
+		UINT Edge = pFaces[f].Edge;
+
+		for (UINT k = 0; k < pFaces[f].NumEdges; k++)
+		{
+			const HullHalfEdge& Twin = pEdges[pEdges[Edge].Twin];
+
+			if (pEdges[Edge].Face != f || pEdges[Twin.Twin].Face != f || Twin.Face == f)
+				return false;
+
+			// the Twin starts at the End of the Edge
+			if (Twin.Vertex != pEdges[pEdges[Edge].Next].Vertex)
+				return false;
+
+			Edge = pEdges[Edge].Next;
+			NumEdges++;
+		}
+
+		if (Edge != pFaces[f].Edge)
+			return false;
+	}
+
+	return NumEdges == Hull.GetNumEdges() &&
+		   (int)Hull.GetNumVertices() - (int)Hull.GetNumEdges() / 2 + (int)Hull.GetNumFaces() == 2;
+}
+
+bool ConvexHullTest()
+{
+	ConvexHull Hull;
+	std::vector<Vector4> Points;
+	UINT State = 4711;
+
+	// Cube with Points on the Faces, on the Edges and inside : 6 Quads
+	for (int i = 0; i < 8; i++)
+		Points.push_back(Vector4((i & 1) ? 1.0f : -1.0f, (i & 2) ? 1.0f : -1.0f, (i & 4) ? 1.0f : -1.0f, 1.0f));
+
+	for (int i = 0; i < 200; i++)
+	{
+		const float a = RandomFloat(State, -1.0f, 1.0f);
+		const float b = RandomFloat(State, -1.0f, 1.0f);
+
+		Points.push_back(Vector4(a, b, (i & 1) ? 1.0f : -1.0f, 1.0f));
+		Points.push_back(Vector4((i & 1) ? 1.0f : -1.0f, a, b, 1.0f));
+		Points.push_back(Vector4(a, 1.0f, 1.0f, 1.0f));
+		Points.push_back(Vector4(a * 0.9f, b * 0.9f, RandomFloat(State, -0.9f, 0.9f), 1.0f));
+	}
+
+	assert(Hull.Build(Points.data(), (UINT)Points.size()));
+	assert(!Hull.IsFlat());
+	assert(Hull.GetNumFaces() == 6);
+	assert(Hull.GetNumVertices() == 8);
+	assert(Hull.GetNumEdges() == 24);
+	assert(IsConsistent(Hull));
+	assert(fabsf(Hull.GetVolume() - 8.0f) < 1e-3f);
+
+	for (UINT f = 0; f < Hull.GetNumFaces(); f++)
+		assert(Hull.GetFaces()[f].NumEdges == 4);
+
+	for (const Vector4& p : Points)
+		assert(Hull.IsInside(p));
+
+	assert(!Hull.IsInside(Vector4(1.1f, 0.0f, 0.0f, 1.0f)));
+	assert(!Hull.IsInside(Vector4(0.0f, 0.0f, -1.1f, 1.0f)));
+
+	// Prism with Duplicates : 2 Caps and n Quads, no Vertices on the straight Edges
+	for (UINT n = 3; n < 12; n++)
+	{
+		Points.clear();
+
+		for (UINT i = 0; i < n; i++)
+		{
+			const float Angle = XM_2PI * (float)i / (float)n;
+
+			for (int h = 0; h < 3; h++)
+				Points.push_back(Vector4(cosf(Angle), sinf(Angle), 0.5f * (float)h - 0.5f, 1.0f));
+		}
+
+		for (UINT i = 0; i < 20; i++)
+			Points.push_back(Points[NextRandom(State) % Points.size()]);
+
+		assert(Hull.Build(Points.data(), (UINT)Points.size()));
+		assert(Hull.GetNumFaces() == n + 2);
+		assert(Hull.GetNumVertices() == 2 * n);
+		assert(IsConsistent(Hull));
+	}
+
+	// random Points in a Sphere
+	Points.clear();
+
+	for (int i = 0; i < 2000; i++)
+	{
+		const Vector4 p(RandomFloat(State, -1.0f, 1.0f), RandomFloat(State, -1.0f, 1.0f), RandomFloat(State, -1.0f, 1.0f), 1.0f);
+
+		if (XMVectorGetX(XMVector3LengthSq(p)) <= 1.0f)
+			Points.push_back(p);
+	}
+
+	assert(Hull.Build(Points.data(), (UINT)Points.size()));
+	assert(IsConsistent(Hull));
+
+	for (const Vector4& p : Points)
+		assert(Hull.IsInside(p));
+
+	// flat Hull : a Rectangle in z = 0.5
+	Points.clear();
+
+	for (int i = 0; i < 100; i++)
+		Points.push_back(Vector4(RandomFloat(State, -2.0f, 2.0f), RandomFloat(State, -1.0f, 1.0f), 0.5f, 1.0f));
+
+	Points.push_back(Vector4(-2.0f, -1.0f, 0.5f, 1.0f));
+	Points.push_back(Vector4(2.0f, -1.0f, 0.5f, 1.0f));
+	Points.push_back(Vector4(2.0f, 1.0f, 0.5f, 1.0f));
+	Points.push_back(Vector4(-2.0f, 1.0f, 0.5f, 1.0f));
+
+	assert(Hull.Build(Points.data(), (UINT)Points.size()));
+	assert(Hull.IsFlat());
+	assert(Hull.GetNumFaces() == 2);
+	assert(Hull.GetNumVertices() == 4);
+
+	assert(Hull.IsInside(Vector4(0.0f, 0.0f, 0.5f, 1.0f)));
+	assert(Hull.IsInside(Vector4(2.0f, 1.0f, 0.5f, 1.0f)));
+	assert(!Hull.IsInside(Vector4(3.0f, 0.0f, 0.5f, 1.0f)));
+	assert(!Hull.IsInside(Vector4(-2.1f, 0.0f, 0.5f, 1.0f)));
+	assert(!Hull.IsInside(Vector4(0.0f, 0.0f, 0.6f, 1.0f)));
+
+	// degenerated : all Points on a Line
+	Points.clear();
+
+	for (int i = 0; i < 10; i++)
+		Points.push_back(Vector4((float)i, 2.0f * (float)i, 0.0f, 1.0f));
+
+	assert(!Hull.Build(Points.data(), (UINT)Points.size()));
+
+	// Ready and return
+	return true;
+
+}
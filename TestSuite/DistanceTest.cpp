@@ -0,0 +1,116 @@
+// -------------------------------------------------------------------
+// File			:	DistanceTest - TestSuite
+//
+// Description	:	Test for the Distance-Functions from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+// deterministic Values in [0, 1)
+static float NextRandom(UINT& State)
+{
+	State = State * 1664525u + 1013904223u;
+	return (float)(State >> 8) / 16777216.0f;
+}
+
+static float DistSq(FXMVECTOR a, FXMVECTOR b)
+{
+	return XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(a, b)));
+}
+
+// SoA and scalar Code may round differently
+static bool NearEqual(FXMVECTOR a, FXMVECTOR b)
+{
+	return DistSq(a, b) <= 1e-6f;
+}
+
+bool DistanceTest()
+{
+	UINT Seed = 4711;
+
+	// 7 Points : a full Block and a Tail of 3
+	const UINT Count = 7;
+	Vector4 Points[Count];
+
+	for (UINT i = 0; i < Count; i++)
+		Points[i] = Vector4(NextRandom(Seed) * 20.0f - 10.0f, NextRandom(Seed) * 20.0f - 10.0f, NextRandom(Seed) * 20.0f - 10.0f, (float)i);
+
+	Vector4 Closest[Count];
+	float Dist[Count];
+
+	// Triangle : every Voronoi-Region against the scalar Version
+	const Triangle Tri(Vector4(0.0f, 0.0f, 0.0f, 1.0f), Vector4(4.0f, 0.0f, 0.0f, 1.0f), Vector4(0.0f, 4.0f, 1.0f, 1.0f));
+
+	ClosestPointOnTriangleArray(Points, Count, Tri, Closest, Dist);
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		const XMVECTOR Expected = ClosestPointOnTriangle(Points[i], Tri.GetVector1(), Tri.GetVector2(), Tri.GetVector3());
+
+		assert(NearEqual(Closest[i], Expected));
+		assert(fabsf(Dist[i] - DistSq(Points[i], Expected)) <= 1e-3f);
+		assert(Closest[i].GetW() == (float)i);
+	}
+
+	// AABB : exact Clamp
+	AABB Box;
+	Box.SetMinMaxExtents(Vector4(-3.0f, -2.0f, -1.0f, 0.0f), Vector4(1.0f, 4.0f, 2.0f, 0.0f));
+
+	ClosestPointOnAABBArray(Points, Count, Box, Closest, nullptr);
+
+	for (UINT i = 0; i < Count; i++)
+		assert(NearEqual(Closest[i], ClosestPointOnAABB(Points[i], Box.GetMinExtents(), Box.GetMaxExtents())));
+
+	// OBB
+	const OBB Oriented(Vector4(1.0f, 2.0f, 3.0f, 1.0f), Vector4(2.0f, 1.0f, 3.0f, 0.0f), Quat::MakeFromEuler(0.3f, 1.1f, -0.7f));
+
+	ClosestPointOnOBBArray(Points, Count, Oriented, Closest, Dist);
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		const XMVECTOR Expected = ClosestPointOnOBB(Points[i], Oriented.GetCenter(), Oriented.GetExtents(), Oriented.GetOrientation().Get());
+
+		assert(NearEqual(Closest[i], Expected));
+		assert(fabsf(Dist[i] - DistSq(Points[i], Expected)) <= 1e-3f);
+	}
+
+	// NearestTriangle : the lowest Index of equal Triangles wins
+	const UINT NumTriangles = 9;
+	Triangle Triangles[NumTriangles];
+
+	for (UINT i = 0; i < NumTriangles; i++)
+	{
+		const Vector4 Offset((float)i * 10.0f, 0.0f, 0.0f, 0.0f);
+		Triangles[i] = Triangle(Tri.GetVector1() + Offset, Tri.GetVector2() + Offset, Tri.GetVector3() + Offset);
+	}
+
+	Triangles[8] = Triangles[5];
+	Triangles[6] = Triangles[5];
+
+	Vector4 Nearest;
+	float NearestDist;
+
+	assert(NearestTriangle(XMVectorSet(51.0f, 1.0f, 3.0f, 1.0f), Triangles, NumTriangles, &Nearest, &NearestDist) == 5);
+	assert(NearEqual(Nearest, ClosestPointOnTriangle(XMVectorSet(51.0f, 1.0f, 3.0f, 1.0f), Triangles[5].GetVector1(), Triangles[5].GetVector2(), Triangles[5].GetVector3())));
+	assert(NearestTriangle(XMVectorSet(-20.0f, 0.0f, 0.0f, 1.0f), Triangles, NumTriangles) == 0);
+	assert(NearestTriangle(XMVectorSet(200.0f, 0.0f, 0.0f, 1.0f), Triangles, NumTriangles) == 7);
+	assert(NearestTriangle(XMVectorZero(), Triangles, 0, nullptr, &NearestDist) == 0xFFFFFFFF);
+
+	// Ready and return
+	return true;
+
+}
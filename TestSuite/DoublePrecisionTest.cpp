@@ -0,0 +1,70 @@
+// -------------------------------------------------------------------
+// File			:	DoublePrecisionTest - TestSuite
+//
+// Description	:	Test for Vector3d / Matrixd / CameraRelative from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+static bool NearEqual3d(const Vector3d& a, const Vector3d& b)
+{
+	return Vector3d::Distance(a, b) < 1e-6;
+}
+
+bool DoublePrecisionTest()
+{
+	// far from the Origin, Floats would lose the Centimeters here
+	const Vector3d Origin(1.0e7, -2.5e6, 3.0e7);
+	const Vector3d p = Origin + Vector3d(0.25, -0.5, 1.75);
+
+	// Vector3d
+	assert(Vector3d(1.0, 2.0, 3.0) + Vector3d(1.0, 1.0, 1.0) == Vector3d(2.0, 3.0, 4.0));
+	assert(Vector3d::Dot(Vector3d(1.0, 0.0, 0.0), Vector3d(0.0, 1.0, 0.0)) == 0.0);
+	assert(Vector3d::Cross(Vector3d(1.0, 0.0, 0.0), Vector3d(0.0, 1.0, 0.0)) == Vector3d(0.0, 0.0, 1.0));
+	assert(Vector3d::Lerp(Vector3d(), Vector3d(2.0, 4.0, 6.0), 0.5) == Vector3d(1.0, 2.0, 3.0));
+
+	// Matrixd
+	const Matrix r = Matrix::RotationYawPitchRoll(0.3f, -0.2f, 0.7f);
+	const Matrixd World(r, Origin);
+	const Vector3d q = Matrixd::TransformCoord(Vector3d(1.0, 2.0, 3.0), World);
+
+	assert(NearEqual3d(Matrixd::TransformCoord(q, Matrixd::InverseAffine(World)), Vector3d(1.0, 2.0, 3.0)));
+	assert(NearEqual3d((World * Matrixd::Translation(-Origin)).GetTranslation(), Vector3d()));
+	assert(Matrixd::Transpose(Matrixd::Transpose(World)) == World);
+
+	// CameraRelative
+	const CameraRelative Rel(Origin);
+	const Vector4 f = Rel.ToRelative(p);
+
+	assert(f.GetX() == 0.25f && f.GetY() == -0.5f && f.GetZ() == 1.75f && f.GetW() == 1.0f);
+	assert(Rel.ToWorld(f) == p);
+
+	const Matrix m = Rel.ToRelative(World);
+	assert(XMVector4Equal(m.GetRow3(), XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f)));
+
+	// Arrays
+	const Vector3d In[3] = { Origin, p, Origin - Vector3d(1.0, 1.0, 1.0) };
+	Vector4 Out[3];
+
+	Rel.ToRelative(In, Out, 3);
+	assert(XMVector4Equal(Out[1], f));
+	assert(XMVector4Equal(Out[2], XMVectorSet(-1.0f, -1.0f, -1.0f, 1.0f)));
+
+	// Ready and return
+	return true;
+
+}
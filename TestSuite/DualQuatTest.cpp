@@ -0,0 +1,100 @@
+// -------------------------------------------------------------------
+// File			:	DualQuatTest - TestSuite
+//
+// Description	:	Test for DualQuat from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+static bool NearEqual(FXMVECTOR a, FXMVECTOR b)
+{
+	return XMVector3NearEqual(a, b, XMVectorReplicate(1e-4f));
+}
+
+bool DualQuatTest()
+{
+	const Quat r1 = Quat::RotationAxis(Vector4(1.0f, 2.0f, 3.0f, 0.0f), 0.7f);
+	const Quat r2 = Quat::RotationAxis(Vector4(-1.0f, 0.0f, 2.0f, 0.0f), 1.9f);
+	const Vector4 t1(1.0f, -2.0f, 3.0f, 0.0f);
+	const Vector4 t2(0.5f, 4.0f, -1.0f, 0.0f);
+	const Vector4 p(0.3f, -0.7f, 2.0f, 1.0f);
+
+	// Identity
+	DualQuat dq;
+	assert(dq == DualQuat::Identity());
+	assert(NearEqual(dq.TransformPoint(p), p));
+
+	// Rotation and Translation
+	const DualQuat a(r1, t1);
+	const DualQuat b(r2, t2);
+
+	assert(NearEqual(a.GetTranslation(), t1));
+	assert(NearEqual(a.TransformPoint(p), Matrix::Transform(p, a.GetMatrix())));
+
+	// Matrix round trip
+	const DualQuat c(a.GetMatrix());
+	assert(NearEqual(c.TransformPoint(p), a.TransformPoint(p)));
+
+	// Multiply : a, then b
+	const DualQuat ab = a * b;
+	assert(NearEqual(ab.TransformPoint(p), b.TransformPoint(a.TransformPoint(p))));
+	assert(NearEqual(ab.TransformPoint(p), Matrix::Transform(p, a.GetMatrix() * b.GetMatrix())));
+
+	// Inverse
+	assert(NearEqual(DualQuat::Inverse(a).TransformPoint(a.TransformPoint(p)), p));
+
+	// ScLerp
+	assert(NearEqual(DualQuat::ScLerp(a, b, 0.0f).TransformPoint(p), a.TransformPoint(p)));
+	assert(NearEqual(DualQuat::ScLerp(a, b, 1.0f).TransformPoint(p), b.TransformPoint(p)));
+
+	// ScLerp-Midpoint of a Screw along z : half the Rotation and half the Translation
+	const DualQuat Screw(Quat::RotationAxis(Vector4(0.0f, 0.0f, 1.0f, 0.0f), XM_PIDIV2), Vector4(0.0f, 0.0f, 2.0f, 0.0f));
+	const DualQuat HalfScrew = DualQuat::ScLerp(DualQuat::Identity(), Screw, 0.5f);
+
+	assert(NearEqual(HalfScrew.GetTranslation(), XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f)));
+	assert(NearEqual(HalfScrew.TransformPoint(Vector4(1.0f, 0.0f, 0.0f, 1.0f)), XMVectorSet(0.70710678f, 0.70710678f, 1.0f, 0.0f)));
+
+	// general Midpoint : the same Screw-Step from a to the Midpoint and from the Midpoint to b
+	const DualQuat Mid = DualQuat::ScLerp(a, b, 0.5f);
+	const DualQuat Step0 = Mid * DualQuat::Inverse(a);
+	const DualQuat Step1 = b * DualQuat::Inverse(Mid);
+
+	assert(NearEqual(Step0.TransformPoint(p), Step1.TransformPoint(p)));
+	assert(NearEqual(Step0.TransformPoint(t1), Step1.TransformPoint(t1)));
+	assert(NearEqual((Step0 * Step0).TransformPoint(p), (b * DualQuat::Inverse(a)).TransformPoint(p)));
+
+	// DLB
+	const DualQuat Bones[2] = { a, b };
+	const float Weights[2] = { 1.0f, 0.0f };
+	assert(NearEqual(DualQuat::DLB(Bones, Weights, 2).TransformPoint(p), a.TransformPoint(p)));
+
+	// Skinning
+	const UINT Indices[4] = { 1, 0, 0, 1 };
+	const float SkinWeights[4] = { 1.0f, 0.0f, 0.5f, 0.5f };
+	const Vector4 Positions[2] = { p, p };
+	Vector4 Skinned[2];
+
+	DualQuat::SkinArray(Bones, Indices, SkinWeights, 2, 2, Positions, Skinned);
+	assert(NearEqual(Skinned[0], b.TransformPoint(p)));
+
+	const float HalfWeights[2] = { 0.5f, 0.5f };
+	assert(NearEqual(Skinned[1], DualQuat::DLB(Bones, HalfWeights, 2).TransformPoint(p)));
+
+	// Ready and return
+	return true;
+
+}
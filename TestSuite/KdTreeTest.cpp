@@ -0,0 +1,134 @@
+// -------------------------------------------------------------------
+// File			:	KdTreeTest - TestSuite
+//
+// Description	:	Test for KdTree from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+#include <algorithm>
+
+using namespace TurboMath;
+
+// deterministic Values in [0, 1)
+static float NextRandom(UINT& State)
+{
+	State = State * 1664525u + 1013904223u;
+	return (float)(State >> 8) / 16777216.0f;
+}
+
+static float DistSq(FXMVECTOR a, FXMVECTOR b)
+{
+	return XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(a, b)));
+}
+
+// the Tree may sum the Squares in another Order
+static bool NearEqual(const float a, const float b)
+{
+	return fabsf(a - b) <= 1e-4f * XMMax(1.0f, b);
+}
+
+bool KdTreeTest()
+{
+	KdTree Tree;
+	assert(Tree.IsEmpty());
+	assert(Tree.Nearest(XMVectorZero()) == KdTree::INVALID_INDEX);
+
+	const UINT Count = 3000;
+	std::vector<Vector4, AAllocator<Vector4> > Points(Count);
+	UINT Seed = 1234;
+
+	for (UINT i = 0; i < Count; i++)
+		Points[i] = Vector4(NextRandom(Seed) * 100.0f, NextRandom(Seed) * 100.0f, NextRandom(Seed) * 100.0f, 1.0f);
+
+	Tree.Build(Points.data(), Count);
+	assert(Tree.GetNumPoints() == Count);
+	assert(Tree.GetNumLeafs() * KdTree::DEFAULT_LEAF_SIZE >= Count);
+
+	const UINT NumQueries = 200;
+	const UINT k = 5;
+
+	std::vector<Vector4, AAllocator<Vector4> > Queries(NumQueries);
+	for (UINT q = 0; q < NumQueries; q++)
+		Queries[q] = Vector4(NextRandom(Seed) * 110.0f - 5.0f, NextRandom(Seed) * 110.0f - 5.0f, NextRandom(Seed) * 110.0f - 5.0f, 1.0f);
+
+	std::vector<UINT>	BatchNearest(NumQueries), BatchK(NumQueries * k);
+	std::vector<float>	BatchDist(NumQueries), BatchKDist(NumQueries * k);
+
+	Tree.NearestBatch(Queries.data(), NumQueries, BatchNearest.data(), BatchDist.data());
+	Tree.KNearestBatch(Queries.data(), NumQueries, k, BatchK.data(), BatchKDist.data());
+
+	std::vector<float> Brute(Count);
+
+	for (UINT q = 0; q < NumQueries; q++)
+	{
+		const XMVECTOR Pos = Queries[q];
+
+		for (UINT i = 0; i < Count; i++)
+			Brute[i] = DistSq(Pos, Points[i]);
+
+		std::vector<float> SortedBrute(Brute);
+		std::sort(SortedBrute.begin(), SortedBrute.end());
+
+		// Nearest
+		float Dist = 0.0f;
+		const UINT Index = Tree.Nearest(Pos, &Dist);
+
+		assert(Index < Count);
+		assert(NearEqual(Dist, SortedBrute[0]) && NearEqual(Brute[Index], Dist));
+		assert(BatchNearest[q] < Count && NearEqual(BatchDist[q], SortedBrute[0]));
+
+		// no Point closer than the Bound
+		assert(Tree.Nearest(Pos, nullptr, SortedBrute[0] * 0.5f) == KdTree::INVALID_INDEX);
+
+		// k-Nearest, sorted by Distance
+		UINT	KIndices[k];
+		float	KDist[k];
+
+		assert(Tree.KNearest(Pos, k, KIndices, KDist) == k);
+
+		for (UINT j = 0; j < k; j++)
+		{
+			assert(NearEqual(KDist[j], SortedBrute[j]));
+			assert(NearEqual(Brute[KIndices[j]], KDist[j]));
+			assert(NearEqual(BatchKDist[q * k + j], SortedBrute[j]));
+		}
+
+		// Radius-Search
+		const float Radius = 8.0f;
+		std::vector<UINT> Found, Expected;
+
+		Tree.RadiusSearch(Pos, Radius, Found);
+
+		for (UINT i = 0; i < Count; i++)
+			if (Brute[i] <= Radius * Radius) Expected.push_back(i);
+
+		std::sort(Found.begin(), Found.end());
+		assert(Found == Expected);
+	}
+
+	// more Neighbours wanted than Points
+	Tree.Build(Points.data(), 3);
+
+	UINT	KIndices[k];
+	float	KDist[k];
+	assert(Tree.KNearest(XMVectorZero(), k, KIndices, KDist) == 3);
+
+	Tree.Clear();
+	assert(Tree.IsEmpty());
+
+	// Ready and return
+	return true;
+
+}
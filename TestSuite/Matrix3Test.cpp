@@ -0,0 +1,75 @@
+// -------------------------------------------------------------------
+// File			:	Matrix3Test - TestSuite
+//
+// Description	:	Test for Matrix3 from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+static bool NearEqual3(FXMVECTOR a, FXMVECTOR b)
+{
+	return XMVector3NearEqual(a, b, XMVectorReplicate(1e-4f));
+}
+
+bool Matrix3Test()
+{
+	const Quat q = Quat::RotationAxis(Vector4(1.0f, 2.0f, 3.0f, 0.0f), 0.7f);
+	const Matrix m = Matrix::RotationQuaternion(q) * Matrix::Scaling(2.0f, 0.5f, 3.0f) * Matrix::Translation(1.0f, -2.0f, 3.0f);
+	const Vector4 v(0.3f, -0.7f, 2.0f, 0.0f);
+
+	// Identity
+	const Matrix3 id;
+	assert(id == Matrix3::Identity());
+	assert(NearEqual3(id.Transform(v), v));
+
+	// Quat and Matrix
+	const Matrix3 r(q);
+	assert(NearEqual3(r.Transform(v), Matrix::Transform(v, Matrix::RotationQuaternion(q))));
+	assert(NearEqual3(Matrix3(r.GetQuat()).Transform(v), r.Transform(v)));
+	assert(XMVectorGetW(r.GetRow0()) == 0.0f && XMVectorGetW(r.GetRow1()) == 0.0f && XMVectorGetW(r.GetRow2()) == 0.0f);
+
+	const Matrix3 a(m);
+	assert(NearEqual3(a.Transform(v), Matrix::Transform(v, m)));
+	assert(fabsf(a.Determinant() - 3.0f) < 1e-3f);
+
+	// Multiply
+	const Matrix3 ar = a * r;
+	assert(NearEqual3(ar.Transform(v), r.Transform(a.Transform(v))));
+
+	// Transpose and Inverse
+	assert(NearEqual3(Matrix3::Transpose(r).Transform(r.Transform(v)), v));
+	assert(NearEqual3(Matrix3::Inverse(a).Transform(a.Transform(v)), v));
+
+	// Normal-Matrix
+	const Matrix it = Matrix::Transpose(Matrix::Inverse(m));
+	assert(NearEqual3(Matrix3::InverseTranspose(m).Transform(v), Matrix::Transform(v, it)));
+
+	// OBB
+	const OBB Box(Vector4(0.0f, 0.0f, 0.0f, 1.0f), Vector4(1.0f, 1.0f, 1.0f, 0.0f), q);
+	assert(NearEqual3(Matrix3(Box).Transform(v), r.Transform(v)));
+
+	// Arrays
+	const Vector3 In[3] = { Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(0.3f, -0.7f, 2.0f) };
+	Vector3 Out[3];
+
+	a.TransformArray(In, Out, 3);
+	assert(NearEqual3(XMLoadFloat3(&static_cast<const XMFLOAT3&>(Out[2])), a.Transform(v)));
+
+	// Ready and return
+	return true;
+
+}
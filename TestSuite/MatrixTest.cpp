@@ -28,6 +28,48 @@ bool MatrixTest()
 	Matrix mat2 = mat1;
 	const Matrix mat3(mat1);
 
+	// Arrays (odd Count for the Tail after the Pairs)
+	const XMVECTOR Eps = XMVectorReplicate(1e-4f);
+	const UINT Count = 5;
+
+	Matrix m0[Count], m1[Count], Out[Count];
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		const float f = (float)i;
+
+		m0[i] = Matrix::RotationYawPitchRoll(0.3f * f, 0.1f + f, -0.7f) * Matrix::Scaling(1.0f + f, 2.0f, 0.5f) * Matrix::Translation(f, -2.0f, 3.0f);
+		m1[i] = Matrix::RotationAxis(Vector4(1.0f, 2.0f, f, 0.0f), 0.4f * f) * Matrix::Translation(-1.0f, f, 0.5f);
+	}
+
+	Matrix::MultiplyArray(m0, m1, Out, Count);
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		const Matrix m = Matrix::Multiply(m0[i], m1[i]);
+
+		assert(XMVector4NearEqual(Out[i].GetRow0(), m.GetRow0(), Eps) && XMVector4NearEqual(Out[i].GetRow3(), m.GetRow3(), Eps));
+	}
+
+	Matrix::InverseArray(m0, Out, Count, true);
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		const Matrix m = Matrix::Inverse(m0[i]);
+
+		assert(XMVector4NearEqual(Out[i].GetRow1(), m.GetRow1(), Eps) && XMVector4NearEqual(Out[i].GetRow3(), m.GetRow3(), Eps));
+	}
+
+	Matrix::InverseTransposeArray(m0, Out, Count);
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		const Matrix m = Matrix::Transpose(Matrix::Inverse(m0[i]));
+
+		assert(XMVector3NearEqual(Out[i].GetRow0(), m.GetRow0(), Eps) && XMVector3NearEqual(Out[i].GetRow2(), m.GetRow2(), Eps));
+		assert(XMVector4Equal(Out[i].GetRow3(), g_XMIdentityR3));
+	}
+
 	// Ready and return
 	return true;
 
@@ -0,0 +1,81 @@
+// -------------------------------------------------------------------
+// File			:	MovementSystemTest - TestSuite
+//
+// Description	:	Test for MovementSystem from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+static bool NearEqual3(FXMVECTOR a, FXMVECTOR b)
+{
+	return XMVector3NearEqual(a, b, XMVectorReplicate(1e-3f));
+}
+
+bool MovementSystemTest()
+{
+	MovementSystem System;
+
+	// Thrust only
+	const UINT Obj = System.AddObject(Vector4(1.0f, 2.0f, 3.0f, 1.0f));
+	System.SetThrust(Obj, 2.0f);
+	System.Update(1.0f);
+
+	assert(NearEqual3(System.GetPos(Obj), XMVectorSet(1.0f, 2.0f, 5.0f, 0.0f)));
+	assert(NearEqual3(System.GetDir(Obj), g_XMIdentityR2));
+
+	// a registered Controller moves like a stand-alone one
+	MovementControllerFree Reference, Registered;
+
+	Reference.SetRotationSpeed(0.3f, 0.5f, -0.2f);
+	Reference.SetThrust(3.0f);
+	Registered.SetRotationSpeed(0.3f, 0.5f, -0.2f);
+	Registered.SetThrust(3.0f);
+
+	System.Register(&Registered);
+	assert(System.IsRegistered(&Registered));
+	assert(!System.IsRegistered(&Reference));
+	assert(System.GetNumControllers() == 1);
+
+	for (UINT i = 0; i < 10; i++)
+	{
+		Reference.Update(0.1f);
+		System.Update(0.1f);
+	}
+
+	assert(NearEqual3(Registered.GetPos(), Reference.GetPos()));
+	assert(NearEqual3(Registered.GetDir(), Reference.GetDir()));
+	assert(NearEqual3(Registered.GetUp(), Reference.GetUp()));
+
+	// Unregister : the Object stays, but does not move anymore
+	assert(System.Unregister(&Registered));
+	assert(!System.Unregister(&Registered));
+	assert(!System.IsRegistered(&Registered));
+	assert(System.GetNumControllers() == 0);
+	assert(System.GetNumObjects() == 2);
+
+	const Vector4 Pos = System.GetPos(1);
+	System.Update(1.0f);
+	assert(NearEqual3(System.GetPos(1), Pos));
+	assert(NearEqual3(Registered.GetPos(), Reference.GetPos()));
+
+	System.Clear();
+	assert(System.GetNumObjects() == 0);
+
+	// Ready and return
+	return true;
+
+}
@@ -0,0 +1,83 @@
+// -------------------------------------------------------------------
+// File			:	MultiViewCullerTest - TestSuite
+//
+// Description	:	Test for MultiViewCuller from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+// View as Box [Min, Max] (Outside = positive Side of the Planes)
+static UINT AddBoxView(MultiViewCuller& Culler, const float x0, const float x1, const float y0, const float y1, const float z0, const float z1)
+{
+	return Culler.AddView(	Plane(-1.0f, 0.0f, 0.0f, x0), Plane(1.0f, 0.0f, 0.0f, -x1),
+							Plane(0.0f, -1.0f, 0.0f, y0), Plane(0.0f, 1.0f, 0.0f, -y1),
+							Plane(0.0f, 0.0f, -1.0f, z0), Plane(0.0f, 0.0f, 1.0f, -z1));
+}
+
+bool MultiViewCullerTest()
+{
+	MultiViewCuller Culler;
+
+	assert(AddBoxView(Culler, 0.0f, 10.0f, 0.0f, 10.0f, 0.0f, 10.0f) == 0);
+	assert(AddBoxView(Culler, 5.0f, 15.0f, 0.0f, 10.0f, 0.0f, 10.0f) == 1);
+
+	// a View with only 4 Planes (open in z)
+	const Plane Slab[4] = { Plane(-1.0f, 0.0f, 0.0f, 20.0f), Plane(1.0f, 0.0f, 0.0f, -30.0f), Plane(0.0f, -1.0f, 0.0f, 0.0f), Plane(0.0f, 1.0f, 0.0f, -10.0f) };
+	assert(Culler.AddView(Slab, 4) == 2);
+	assert(Culler.GetNumViews() == 3);
+
+	const Vector4 Centers[5] =
+	{
+		Vector4(2.0f, 5.0f, 5.0f, 1.0f),		// View 0
+		Vector4(7.0f, 5.0f, 5.0f, 1.0f),		// View 0 and 1
+		Vector4(25.0f, 5.0f, 100.0f, 1.0f),		// View 2
+		Vector4(50.0f, 50.0f, 50.0f, 1.0f),		// none
+		Vector4(10.5f, 5.0f, 5.0f, 1.0f),		// View 0 and 1 (crossing the Border)
+	};
+
+	const UINT Expected[5] = { 1, 3, 4, 0, 3 };
+
+	AABB	Boxes[5];
+	Sphere	Spheres[5];
+	UINT	BoxMask[5], SphereMask[5];
+
+	for (UINT i = 0; i < 5; i++)
+	{
+		Boxes[i].Set(Centers[i], Vector4(1.0f, 1.0f, 1.0f, 0.0f));
+		Spheres[i].Set(Centers[i], 1.0f);
+	}
+
+	Culler.CullAABBs(Boxes, 5, BoxMask);
+	Culler.CullSpheres(Spheres, 5, SphereMask);
+
+	for (UINT i = 0; i < 5; i++)
+	{
+		assert(BoxMask[i] == Expected[i]);
+		assert(SphereMask[i] == Expected[i]);
+		assert(Culler.CullAABB(Boxes[i]) == Expected[i]);
+		assert(Culler.CullSphere(Spheres[i]) == Expected[i]);
+	}
+
+	// no Views -> nothing visible
+	Culler.Reset();
+	assert(Culler.GetNumViews() == 0);
+	assert(Culler.CullAABB(Boxes[0]) == 0);
+
+	// Ready and return
+	return true;
+
+}
@@ -0,0 +1,189 @@
+// -------------------------------------------------------------------
+// File			:	NoiseTest - TestSuite
+//
+// Description	:	Test for the SIMD Noise from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+static UINT NextRandom(UINT& State)
+{
+	State = State * 1664525u + 1013904223u;
+	return State >> 8;
+}
+
+static float RandomFloat(UINT& State, const float Min, const float Max)
+{
+	return Min + (Max - Min) * (float)NextRandom(State) / 16777216.0f;
+}
+
+static XMVECTOR RandomLanes(UINT& State, const float Min, const float Max)
+{
+	const float x = RandomFloat(State, Min, Max);
+	const float y = RandomFloat(State, Min, Max);
+	const float z = RandomFloat(State, Min, Max);
+	const float w = RandomFloat(State, Min, Max);
+
+	return XMVectorSet(x, y, z, w);
+}
+
+// all Basis-Functions of 1 .. 4 Dimensions
+static const UINT NumFunctions = 10;
+
+static XMVECTOR EvaluateFunction(const UINT Function, FXMVECTOR x, FXMVECTOR y, FXMVECTOR z, GXMVECTOR w, const UINT Seed)
+{
+	switch (Function)
+	{
+		case 0: return Noise::Value2(x, y, Seed);
+		case 1: return Noise::Value3(x, y, z, Seed);
+		case 2: return Noise::Perlin1(x, Seed);
+		case 3: return Noise::Perlin2(x, y, Seed);
+		case 4: return Noise::Perlin3(x, y, z, Seed);
+		case 5: return Noise::Perlin4(x, y, z, w, Seed);
+		case 6: return Noise::Simplex1(x, Seed);
+		case 7: return Noise::Simplex2(x, y, Seed);
+		case 8: return Noise::Simplex3(x, y, z, Seed);
+		default: return Noise::Simplex4(x, y, z, w, Seed);
+	}
+}
+
+static bool InRange(FXMVECTOR n)
+{
+	XMFLOAT4 r;
+	XMStoreFloat4(&r, n);
+
+	// also false for NaN
+	return (r.x >= -1.0f && r.x <= 1.0f) && (r.y >= -1.0f && r.y <= 1.0f) && (r.z >= -1.0f && r.z <= 1.0f) && (r.w >= -1.0f && r.w <= 1.0f);
+}
+
+bool NoiseTest()
+{
+	UINT State = 4711;
+
+	for (UINT f = 0; f < NumFunctions; f++)
+	{
+		XMVECTOR MaxAbs = g_XMZero;
+		UINT NumDifferent = 0;
+
+		for (UINT i = 0; i < 2000; i++)
+		{
+			const XMVECTOR x = RandomLanes(State, -100.0f, 100.0f);
+			const XMVECTOR y = RandomLanes(State, -100.0f, 100.0f);
+			const XMVECTOR z = RandomLanes(State, -100.0f, 100.0f);
+			const XMVECTOR w = RandomLanes(State, -100.0f, 100.0f);
+
+			// Range
+			const XMVECTOR n = EvaluateFunction(f, x, y, z, w, 1337);
+
+			assert(InRange(n));
+
+			MaxAbs = XMVectorMax(MaxAbs, XMVectorAbs(n));
+
+			// deterministic : the same Seed gives the same Noise, another Seed not
+			assert(XMVector4Equal(n, EvaluateFunction(f, x, y, z, w, 1337)));
+
+			NumDifferent += XMVector4Equal(n, EvaluateFunction(f, x, y, z, w, 1338)) ? 0 : 1;
+
+			// continuous : a small Step gives a small Change
+			const XMVECTOR d = XMVectorReplicate(1e-3f);
+			const XMVECTOR m = EvaluateFunction(f, XMVectorAdd(x, d), XMVectorAdd(y, d), XMVectorAdd(z, d), XMVectorAdd(w, d), 1337);
+
+			assert(XMVector4LessOrEqual(XMVectorAbs(XMVectorSubtract(m, n)), XMVectorReplicate(0.05f)));
+		}
+
+		// the Range is used, not only a small Part of it
+		assert(XMVectorGetX(MaxAbs) > 0.4f);
+		assert(NumDifferent > 1900);
+	}
+
+	// large Coordinates : no Overflow of the Lattice, still finite and in the Range
+	const XMVECTOR Large = XMVectorSet(3.0e9f, -5.0e12f, 1.0e30f, -2147483648.0f);
+	const XMVECTOR Offset = XMVectorReplicate(0.37f);
+
+	for (UINT f = 0; f < NumFunctions; f++)
+	{
+		assert(InRange(EvaluateFunction(f, Large, Large, Large, Large, 1)));
+		assert(InRange(EvaluateFunction(f, XMVectorAdd(Large, Offset), Large, Large, Large, 1)));
+	}
+
+	// the Lattice wraps with the Period 2^32 : 2^31 and -2^31 are the same Point
+	const XMVECTOR Plus = XMVectorReplicate(2147483648.0f);
+	const XMVECTOR Minus = XMVectorReplicate(-2147483648.0f);
+
+	assert(XMVector4Equal(Noise::Value2(Plus, g_XMZero, 3), Noise::Value2(Minus, g_XMZero, 3)));
+
+	// Bulk-Evaluation : the Grids give the same as the Points (Step and Origin exact in float)
+	Noise::Params theParams;
+	theParams.Octaves = 3;
+	theParams.Frequency = 0.5f;
+
+	const UINT Width = 37, Height = 11, Depth = 5;
+	const float x0 = -3.5f, y0 = 1.25f, z0 = 7.0f, Step = 0.125f;
+	const UINT Count = Width * Height * Depth;
+
+	std::vector<float> X(Count), Y(Count), Z(Count), Points(Count), Grid(Count);
+
+	for (UINT k = 0; k < Depth; k++)
+	{
+		for (UINT j = 0; j < Height; j++)
+		{
+			for (UINT i = 0; i < Width; i++)
+			{
+				const UINT Index = (k * Height + j) * Width + i;
+
+				X[Index] = x0 + (float)i * Step;
+				Y[Index] = y0 + (float)j * Step;
+				Z[Index] = z0 + (float)k * Step;
+			}
+		}
+	}
+
+	for (UINT Type = 0; Type < 2; Type++)
+	{
+		theParams.theFractal = (Type == 0) ? Noise::FRACTAL_FBM : Noise::FRACTAL_RIDGED;
+
+		for (UINT b = 0; b < 3; b++)
+		{
+			theParams.theBasis = (Noise::Basis)b;
+
+			// 3D
+			Noise::Evaluate(theParams, X.data(), Y.data(), Z.data(), Points.data(), Count);
+			Noise::EvaluateGrid3D(theParams, x0, y0, z0, Step, Width, Height, Depth, Grid.data());
+
+			for (UINT i = 0; i < Count; i++)
+			{
+				assert(Points[i] == Grid[i]);
+				assert(Points[i] >= -1.0f && Points[i] <= 1.0f);
+			}
+
+			// 2D : the first Slice
+			Noise::Evaluate(theParams, X.data(), Y.data(), nullptr, Points.data(), Width * Height);
+			Noise::EvaluateGrid2D(theParams, x0, y0, Step, Width, Height, Grid.data());
+
+			for (UINT i = 0; i < Width * Height; i++)
+				assert(Points[i] == Grid[i]);
+		}
+	}
+
+	// empty Grids
+	Noise::EvaluateGrid2D(theParams, x0, y0, Step, 0, Height, nullptr);
+	Noise::EvaluateGrid3D(theParams, x0, y0, z0, Step, Width, Height, 0, nullptr);
+
+	// Ready and return
+	return true;
+
+}
@@ -0,0 +1,146 @@
+// -------------------------------------------------------------------
+// File			:	PackedTypesTest - TestSuite
+//
+// Description	:	Test for the packed Storage-Types from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+static UINT NextRandom(UINT& State)
+{
+	State = State * 1664525u + 1013904223u;
+	return State >> 8;
+}
+
+static float RandomFloat(UINT& State, const float Min, const float Max)
+{
+	return Min + (Max - Min) * (float)NextRandom(State) / 16777216.0f;
+}
+
+static bool NearEqual(FXMVECTOR a, FXMVECTOR b, const float Epsilon)
+{
+	return XMVector4NearEqual(a, b, XMVectorReplicate(Epsilon));
+}
+
+bool PackedTypesTest()
+{
+	// not a Multiple of 4 : the Rest uses the single Functions
+	const UINT Count = 103;
+	UINT State = 2020;
+
+	std::vector<Vector4> Vectors(Count), Decoded(Count);
+
+	for (UINT i = 0; i < Count; i++)
+		Vectors[i] = XMVectorSet(RandomFloat(State, -1.0f, 1.0f), RandomFloat(State, -1.0f, 1.0f), RandomFloat(State, -1.0f, 1.0f), RandomFloat(State, 0.0f, 1.0f));
+
+	// Half4 : 11 Bit Mantissa
+	std::vector<Half4> Halfs(Count);
+	Packing::EncodeHalf4(Vectors.data(), Halfs.data(), Count);
+	Packing::DecodeHalf4(Halfs.data(), Decoded.data(), Count);
+
+	for (UINT i = 0; i < Count; i++)
+		assert(NearEqual(Decoded[i], Vectors[i], 1.0f / 1024.0f));
+
+	// SNorm16 : the same Bits as XMStoreShortN4
+	std::vector<SNorm16x4> Shorts(Count);
+	Packing::EncodeSNorm16(Vectors.data(), Shorts.data(), Count);
+	Packing::DecodeSNorm16(Shorts.data(), Decoded.data(), Count);
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		SNorm16x4 Single;
+		PackedVector::XMStoreShortN4(&Single, Vectors[i]);
+
+		assert(Single.v == Shorts[i].v);
+		assert(NearEqual(Decoded[i], Vectors[i], 1.0f / 32767.0f));
+	}
+
+	// XDecN4 : 10 Bit for x, y, z and 2 Bit for w
+	std::vector<XDecN4> Decs(Count);
+	Packing::EncodeXDecN4(Vectors.data(), Decs.data(), Count);
+	Packing::DecodeXDecN4(Decs.data(), Decoded.data(), Count);
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		XDecN4 Single;
+		PackedVector::XMStoreXDecN4(&Single, Vectors[i]);
+
+		assert(Single.v == Decs[i].v);
+		assert(XMVector3NearEqual(Decoded[i], Vectors[i], XMVectorReplicate(1.0f / 511.0f)));
+		assert(fabsf(XMVectorGetW(Decoded[i]) - XMVectorGetW(Vectors[i])) <= 1.0f / 6.0f + 1e-5f);
+	}
+
+	// Octahedral Normals, with the Poles and the folded lower Hemisphere
+	std::vector<Vector3> Normals(Count), DecodedNormals(Count);
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		const XMVECTOR n = XMVector3Normalize(XMVectorSet(RandomFloat(State, -1.0f, 1.0f), RandomFloat(State, -1.0f, 1.0f), RandomFloat(State, -1.0f, 1.0f), 0.0f));
+
+		XMFLOAT3& f = Normals[i];
+		XMStoreFloat3(&f, n);
+	}
+
+	XMFLOAT3& North = Normals[0];
+	XMFLOAT3& South = Normals[1];
+	North = XMFLOAT3(0.0f, 0.0f, 1.0f);
+	South = XMFLOAT3(0.0f, 0.0f, -1.0f);
+
+	std::vector<OctNormal> Octs(Count);
+	Packing::EncodeOctahedral(Normals.data(), Octs.data(), Count);
+	Packing::DecodeOctahedral(Octs.data(), DecodedNormals.data(), Count);
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		const XMFLOAT3& f = Normals[i];
+		const XMFLOAT3& d = DecodedNormals[i];
+
+		const OctNormal Single = Packing::EncodeOctahedral(XMLoadFloat3(&f));
+
+		assert(Single.x == Octs[i].x && Single.y == Octs[i].y);
+		assert(XMVector3NearEqual(XMLoadFloat3(&d), XMLoadFloat3(&f), XMVectorReplicate(1e-4f)));
+	}
+
+	// Quaternions : "smallest three" with 10 Bit, the same Bits as EncodeQuat
+	std::vector<Quat> Quats(Count), DecodedQuats(Count);
+
+	for (UINT i = 0; i < Count; i++)
+		Quats[i] = Quat::RotationAxis(Vector4(RandomFloat(State, -1.0f, 1.0f), RandomFloat(State, -1.0f, 1.0f), RandomFloat(State, 0.1f, 1.0f), 0.0f), RandomFloat(State, -XM_PI, XM_PI));
+
+	// Identity and a negative largest Component
+	Quats[0] = Quat::Identity();
+	Quats[1] = Quat(0.0f, -1.0f, 0.0f, 0.0f);
+
+	std::vector<PackedQuat> Packed(Count);
+	Packing::EncodeQuats(Quats.data(), Packed.data(), Count);
+	Packing::DecodeQuats(Packed.data(), DecodedQuats.data(), Count);
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		assert(Packing::EncodeQuat(Quats[i].Get()).v == Packed[i].v);
+		assert(NearEqual(Packing::DecodeQuat(Packed[i]), DecodedQuats[i].Get(), 1e-6f));
+
+		// q and -q are the same Rotation
+		assert(fabsf(Quat::Dot(DecodedQuats[i], Quats[i])) > 1.0f - 1e-5f);
+	}
+
+	assert(NearEqual(DecodedQuats[0].Get(), g_XMIdentityR3, 1e-3f));
+
+	// Ready and return
+	return true;
+
+}
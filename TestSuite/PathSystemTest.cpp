@@ -0,0 +1,105 @@
+// -------------------------------------------------------------------
+// File			:	PathSystemTest - TestSuite
+//
+// Description	:	Test for PathSystem from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+static bool NearEqual3(FXMVECTOR a, FXMVECTOR b)
+{
+	return XMVector3NearEqual(a, b, XMVectorReplicate(1e-4f));
+}
+
+bool PathSystemTest()
+{
+	// closed Rectangle 10 x 2, Length 24
+	Vector4 Corners[4] = { Vector4(0.0f, 0.0f, 0.0f, 1.0f), Vector4(10.0f, 0.0f, 0.0f, 1.0f), Vector4(10.0f, 2.0f, 0.0f, 1.0f), Vector4(0.0f, 2.0f, 0.0f, 1.0f) };
+
+	PathSystem System;
+
+	const UINT Linear = System.AddPath(Corners, 4, false);
+	const UINT Curved = System.AddPath(Corners, 4, true);
+
+	assert(System.GetNumPaths() == 2);
+	assert(fabsf(System.GetPathLength(Linear) - 24.0f) < 1e-3f);
+	assert(System.GetPathLength(Curved) > 0.0f);
+
+	const UINT f0 = System.AddFollower(Linear, 0.25f);
+	const UINT f1 = System.AddFollower(Linear, 0.0f, 0.625f);
+	const UINT f2 = System.AddFollower(Linear, 1.0f, 0.75f);
+	const UINT f3 = System.AddFollower(Linear, 1.0f, 0.5f);
+	const UINT f4 = System.AddFollower(Curved, 0.0f);
+
+	System.SetFollowerActive(f3, false);
+	assert(!System.IsFollowerActive(f3) && System.IsFollowerActive(f0));
+	assert(System.GetNumFollowers() == 5);
+
+	System.Update(0.5f);
+
+	// Time 0.125 -> 3 Units along the first Side
+	assert(fabsf(System.GetFollowerTime(f0) - 0.125f) < 1e-5f);
+	assert(NearEqual3(System.GetPosition(f0), XMVectorSet(3.0f, 0.0f, 0.0f, 0.0f)));
+	assert(NearEqual3(System.GetLookAt(f0), g_XMIdentityR0));
+
+	// standing at Time 0.625 -> 15 Units, on the Way back
+	assert(NearEqual3(System.GetPosition(f1), XMVectorSet(7.0f, 2.0f, 0.0f, 0.0f)));
+	assert(NearEqual3(System.GetLookAt(f1), XMVectorSet(-1.0f, 0.0f, 0.0f, 0.0f)));
+
+	// wraps around to Time 0.25
+	assert(fabsf(System.GetFollowerTime(f2) - 0.25f) < 1e-5f);
+	assert(NearEqual3(System.GetPosition(f2), XMVectorSet(6.0f, 0.0f, 0.0f, 0.0f)));
+
+	// inactive Followers keep their Time
+	assert(System.GetFollowerTime(f3) == 0.5f);
+
+	// the Curve passes through the Points
+	assert(NearEqual3(System.GetPosition(f4), Corners[0]));
+
+	// Raw Streams
+	assert(System.GetPositionsX()[f0] == System.GetPosition(f0).GetX());
+	assert(System.GetLookAtsY()[f1] == System.GetLookAt(f1).GetY());
+
+	// same Positions as a straight WayPoints-List
+	WayPoints Path;
+
+	for (UINT i = 0; i < 4; i++)
+	{
+		PathPoint Point;
+		Point.SetPoint(Corners[i]);
+		Path.AddPathPoint(Point);
+	}
+
+	Path.SetSpeed(1.0f);
+
+	const UINT f5 = System.AddFollower(System.AddPath(Path), 1.0f);
+
+	for (UINT i = 0; i < 7; i++)
+	{
+		Path.Update(0.1f);
+		System.Update(0.1f);
+
+		assert(NearEqual3(System.GetPosition(f5), Path.GetPosition()));
+	}
+
+	System.Clear();
+	assert(System.GetNumPaths() == 0 && System.GetNumFollowers() == 0);
+
+	// Ready and return
+	return true;
+
+}
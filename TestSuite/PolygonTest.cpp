@@ -0,0 +1,78 @@
+// -------------------------------------------------------------------
+// File			:	PolygonTest - TestSuite
+//
+// Description	:	Test for Polygon from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+// Polygon is qualified : wingdi.h (windows.h) declares the Function ::Polygon
+
+bool PolygonTest()
+{
+	// Square 4 x 4 in the xy-Plane, counter-clockwise seen from +z
+	const Vector4 Square[4] = { Vector4(0.0f, 0.0f, 0.0f, 1.0f), Vector4(4.0f, 0.0f, 0.0f, 1.0f), Vector4(4.0f, 4.0f, 0.0f, 1.0f), Vector4(0.0f, 4.0f, 0.0f, 1.0f) };
+
+	const TurboMath::Polygon Poly(Square, 4);
+
+	assert(Poly.IsValid());
+	assert(Poly.GetNumPoints() == 4);
+	assert(fabsf(Poly.GetArea() - 16.0f) < 1e-4f);
+	assert(XMVector3NearEqual(Poly.GetCenter(), XMVectorSet(2.0f, 2.0f, 0.0f, 0.0f), XMVectorReplicate(1e-5f)));
+	assert(XMVector4NearEqual(Poly.GetPlane().Get(), XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f), XMVectorReplicate(1e-5f)));
+
+	// Classification
+	assert(Poly.Classify(Plane(1.0f, 0.0f, 0.0f, -10.0f)) == BACK);
+	assert(Poly.Classify(Plane(1.0f, 0.0f, 0.0f, 10.0f)) == FRONT);
+	assert(Poly.Classify(Plane(0.0f, 0.0f, 1.0f, 0.0f)) == PLANAR);
+	assert(Poly.Classify(Plane(1.0f, 0.0f, 0.0f, -2.0f)) == CLIPPED);
+
+	// Split at x = 1 : both Parts together cover the Square
+	TurboMath::Polygon Front, Back;
+	assert(Poly.Split(Plane(1.0f, 0.0f, 0.0f, -1.0f), &Front, &Back) == CLIPPED);
+	assert(fabsf(Front.GetArea() - 12.0f) < 1e-4f);
+	assert(fabsf(Back.GetArea() - 4.0f) < 1e-4f);
+
+	for (UINT i = 0; i < Front.GetNumPoints(); i++) assert(Front.GetPoint(i).GetX() >= 1.0f - 1e-5f);
+	for (UINT i = 0; i < Back.GetNumPoints(); i++) assert(Back.GetPoint(i).GetX() <= 1.0f + 1e-5f);
+
+	// Clip keeps the negative Side : the Triangle x + y <= 4
+	TurboMath::Polygon Clipped(Poly);
+	assert(Clipped.Clip(Plane(TURBOMATH_SQRT_1OVER2, TURBOMATH_SQRT_1OVER2, 0.0f, -4.0f * TURBOMATH_SQRT_1OVER2)));
+	assert(fabsf(Clipped.GetArea() - 8.0f) < 1e-3f);
+
+	// nothing left
+	assert(!Clipped.Clip(Plane(1.0f, 0.0f, 0.0f, 10.0f)));
+
+	// large Polygon on the Heap : Circle with 64 Points
+	TurboMath::Polygon Circle;
+
+	for (UINT i = 0; i < 64; i++)
+	{
+		const float a = XM_2PI * (float)i / 64.0f;
+		Circle.AddPoint(Vector4(cosf(a), sinf(a), 1.0f, 1.0f));
+	}
+
+	assert(Circle.GetNumPoints() == 64);
+	assert(fabsf(Circle.GetArea() - 0.5f * 64.0f * sinf(XM_2PI / 64.0f)) < 1e-3f);
+	assert(Circle.Clip(Plane(0.0f, 1.0f, 0.0f, 0.0f)));
+	assert(fabsf(Circle.GetArea() - 0.25f * 64.0f * sinf(XM_2PI / 64.0f)) < 1e-3f);
+
+	// Ready and return
+	return true;
+
+}
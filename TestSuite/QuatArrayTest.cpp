@@ -0,0 +1,158 @@
+// -------------------------------------------------------------------
+// File			:	QuatArrayTest - TestSuite
+//
+// Description	:	Test for the QuatArray-Kernels from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+static UINT NextRandom(UINT& State)
+{
+	State = State * 1664525u + 1013904223u;
+	return State >> 8;
+}
+
+static float RandomFloat(UINT& State, const float Min, const float Max)
+{
+	return Min + (Max - Min) * (float)NextRandom(State) / 16777216.0f;
+}
+
+static Quat RandomRotation(UINT& State)
+{
+	const Vector4 Axis(RandomFloat(State, -1.0f, 1.0f), RandomFloat(State, -1.0f, 1.0f), RandomFloat(State, -1.0f, 1.0f) + 2.0f, 0.0f);
+
+	return Quat::RotationAxis(Axis, RandomFloat(State, -XM_PI, XM_PI));
+}
+
+static bool NearEqualQuat(const Quat& a, const Quat& b, const float Epsilon = 1e-4f)
+{
+	return	fabsf(a.X() - b.X()) < Epsilon && fabsf(a.Y() - b.Y()) < Epsilon &&
+			fabsf(a.Z() - b.Z()) < Epsilon && fabsf(a.W() - b.W()) < Epsilon;
+}
+
+bool QuatArrayTest()
+{
+	// not a Multiple of the Padding : the Tail is handled by the Identity-Padding
+	const UINT Count = 37;
+	UINT State = 1234;
+
+	std::vector<Quat> Q0(Count), Q1(Count), Q2(Count), Q3(Count);
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		Q0[i] = RandomRotation(State);
+		Q1[i] = RandomRotation(State);
+		Q2[i] = RandomRotation(State);
+		Q3[i] = RandomRotation(State);
+	}
+
+	QuatArray A, B, Out;
+	A.Load(Q0.data(), Count);
+	B.Load(Q1.data(), Count);
+
+	assert(A.GetCount() == Count);
+
+	// Load / Store / Set / Get
+	std::vector<Quat> Stored(Count);
+	A.Store(Stored.data());
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		assert(Stored[i] == Q0[i]);
+		assert(A.Get(i) == Q0[i]);
+	}
+
+	// Multiply
+	QuatArray::Multiply(A, B, Out);
+	assert(Out.GetCount() == Count);
+
+	for (UINT i = 0; i < Count; i++)
+		assert(NearEqualQuat(Out.Get(i), Quat::Multiply(Q0[i], Q1[i])));
+
+	// Normalize in place
+	QuatArray Scaled(Count);
+
+	for (UINT i = 0; i < Count; i++)
+		Scaled.Set(i, Quat(Q0[i].X() * 3.0f, Q0[i].Y() * 3.0f, Q0[i].Z() * 3.0f, Q0[i].W() * 3.0f));
+
+	QuatArray::Normalize(Scaled, Scaled);
+
+	// exact Square-Root and Divide on every Path : unit Length to the last Bits
+	for (UINT i = 0; i < Count; i++)
+	{
+		assert(NearEqualQuat(Scaled.Get(i), Q0[i]));
+		assert(fabsf(Quat::Dot(Scaled.Get(i), Scaled.Get(i)) - 1.0f) < 1e-6f);
+	}
+
+	// Slerp and NLerp
+	for (int s = 0; s <= 4; s++)
+	{
+		const float t = 0.25f * (float)s;
+
+		QuatArray::Slerp(A, B, t, Out);
+
+		for (UINT i = 0; i < Count; i++)
+			assert(NearEqualQuat(Out.Get(i), Quat::Slerp(Q0[i], Q1[i], t)));
+
+		// Angle-Error < 1e-3 Radians : |cos(Error / 2)| > 1 - 2e-7 (and Float-Rounding)
+		QuatArray::NLerp(A, B, t, Out);
+
+		for (UINT i = 0; i < Count; i++)
+		{
+			assert(fabsf(Quat::Dot(Out.Get(i), Quat::Slerp(Q0[i], Q1[i], t))) > 1.0f - 1e-5f);
+			assert(fabsf(Quat::Dot(Out.Get(i), Out.Get(i)) - 1.0f) < 1e-6f);
+		}
+	}
+
+	// Squad with the Control-Points of SquadSetup
+	std::vector<Quat> CA(Count), CB(Count), CC(Count);
+
+	for (UINT i = 0; i < Count; i++)
+		Quat::SquadSetup(Q0[i], Q1[i], Q2[i], Q3[i], CA[i], CB[i], CC[i]);
+
+	QuatArray P1, PA, PB, PC;
+	P1.Load(Q1.data(), Count);
+	PA.Load(CA.data(), Count);
+	PB.Load(CB.data(), Count);
+	PC.Load(CC.data(), Count);
+
+	QuatArray::Squad(P1, PA, PB, PC, 0.3f, Out);
+
+	for (UINT i = 0; i < Count; i++)
+		assert(fabsf(Quat::Dot(Out.Get(i), Quat::Squad(Q1[i], CA[i], CB[i], CC[i], 0.3f))) > 1.0f - 1e-4f);
+
+	// Matrices
+	std::vector<Matrix> Matrices(Count);
+	A.ToMatrices(Matrices.data());
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		const Matrix m = Matrix::RotationQuaternion(Q0[i]);
+
+		for (int k = 0; k < 16; k++)
+			assert(fabsf(Matrices[i][k] - m[k]) < 1e-4f);
+	}
+
+	// Resize keeps the Quaternions and adds Identities
+	A.Resize(Count + 3);
+	assert(A.Get(Count - 1) == Q0[Count - 1]);
+	assert(A.Get(Count + 2) == Quat::Identity());
+
+	// Ready and return
+	return true;
+
+}
@@ -0,0 +1,65 @@
+// -------------------------------------------------------------------
+// File			:	QuatTest - TestSuite
+//
+// Description	:	Test for Quat from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+static bool NearEqualQuat(const Quat& a, const Quat& b)
+{
+	return	fabsf(a.X() - b.X()) < 1e-5f && fabsf(a.Y() - b.Y()) < 1e-5f &&
+			fabsf(a.Z() - b.Z()) < 1e-5f && fabsf(a.W() - b.W()) < 1e-5f;
+}
+
+static bool NearEqual3(FXMVECTOR a, FXMVECTOR b)
+{
+	return XMVector3NearEqual(a, b, XMVectorReplicate(1e-5f));
+}
+
+bool QuatTest()
+{
+	// MakeFromEuler : no Rotation gives the Identity, single Angles rotate around one Axis
+	assert(NearEqualQuat(Quat::MakeFromEuler(0.0f, 0.0f, 0.0f), Quat(0.0f, 0.0f, 0.0f, 1.0f)));
+	assert(NearEqualQuat(Quat::MakeFromEuler(0.7f, 0.0f, 0.0f), Quat::RotationAxis(Vector4(1.0f, 0.0f, 0.0f, 0.0f), 0.7f)));
+	assert(NearEqualQuat(Quat::MakeFromEuler(0.0f, 0.7f, 0.0f), Quat::RotationAxis(Vector4(0.0f, 1.0f, 0.0f, 0.0f), 0.7f)));
+	assert(NearEqualQuat(Quat::MakeFromEuler(0.0f, 0.0f, 0.7f), Quat::RotationAxis(Vector4(0.0f, 0.0f, 1.0f, 0.0f), 0.7f)));
+
+	// MovementControllerFree : no Rotation keeps the Axes, Thrust moves along the Direction
+	MovementControllerFree Ctrl;
+	Ctrl.SetThrust(2.0f);
+	Ctrl.Update(1.0f);
+
+	assert(NearEqual3(Ctrl.GetPos(), XMVectorSet(0.0f, 0.0f, 2.0f, 0.0f)));
+	assert(NearEqual3(Ctrl.GetRight(), g_XMIdentityR0));
+	assert(NearEqual3(Ctrl.GetUp(), g_XMIdentityR1));
+	assert(NearEqual3(Ctrl.GetDir(), g_XMIdentityR2));
+
+	// Yaw only : the Up-Axis stays, the Direction turns in the xz-Plane
+	Ctrl.SetThrust(0.0f);
+	Ctrl.SetRotationSpeed(0.0f, XM_PIDIV2, 0.0f);
+	Ctrl.Update(1.0f);
+
+	assert(NearEqual3(Ctrl.GetUp(), g_XMIdentityR1));
+	assert(fabsf(Ctrl.GetDir().GetY()) < 1e-5f);
+	assert(fabsf(Ctrl.GetDir().GetZ()) < 1e-5f);
+	assert(fabsf(fabsf(Ctrl.GetDir().GetX()) - 1.0f) < 1e-5f);
+
+	// Ready and return
+	return true;
+
+}
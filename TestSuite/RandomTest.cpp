@@ -0,0 +1,221 @@
+// -------------------------------------------------------------------
+// File			:	RandomTest - TestSuite
+//
+// Description	:	Test for the RandomGenerator from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+// scalar SplitMix64
+static uint64_t SplitMix64(uint64_t& x)
+{
+	uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+// scalar xoshiro128+ of one Lane, seeded like RandomGenerator::SetSeed
+struct ReferenceLane
+{
+	uint32_t s[4];
+
+	ReferenceLane(const uint64_t Seed, const UINT Stream, const UINT Lane)
+	{
+		uint64_t x = Seed;
+		x = SplitMix64(x) + (uint64_t)Stream * 0xD1B54A32D192ED03ull;
+
+		for (UINT l = 0; l <= Lane; l++)
+		{
+			const uint64_t z0 = SplitMix64(x);
+			const uint64_t z1 = SplitMix64(x);
+
+			s[0] = (uint32_t)z0;
+			s[1] = (uint32_t)(z0 >> 32);
+			s[2] = (uint32_t)z1;
+			s[3] = (uint32_t)(z1 >> 32);
+		}
+	}
+
+	uint32_t Next()
+	{
+		const uint32_t Result = s[0] + s[3];
+		const uint32_t t = s[1] << 9;
+
+		s[2] ^= s[0];
+		s[3] ^= s[1];
+		s[1] ^= s[2];
+		s[0] ^= s[3];
+		s[2] ^= t;
+		s[3] = (s[3] << 11) | (s[3] >> 21);
+
+		return Result;
+	}
+};
+
+bool RandomTest()
+{
+	// the Lanes are 4 xoshiro128+ Generators
+	RandomGenerator Gen(4711, 3);
+	ReferenceLane Lanes[4] = { ReferenceLane(4711, 3, 0), ReferenceLane(4711, 3, 1), ReferenceLane(4711, 3, 2), ReferenceLane(4711, 3, 3) };
+
+	for (int i = 0; i < 100; i++)
+	{
+		XMUINT4 u;
+		XMStoreUInt4(&u, Gen.NextUInt());
+
+		assert(u.x == Lanes[0].Next());
+		assert(u.y == Lanes[1].Next());
+		assert(u.z == Lanes[2].Next());
+		assert(u.w == Lanes[3].Next());
+	}
+
+	// deterministic : the same Seed and Stream give the same Sequence, another Stream not
+	const UINT Count = 10001;
+	std::vector<float> a(Count), b(Count), c(Count);
+
+	Gen.SetSeed(42, 0);
+	Gen.FillUniform(a.data(), Count);
+
+	RandomGenerator Same(42, 0);
+	Same.FillUniform(b.data(), Count);
+
+	RandomGenerator Other(42, 1);
+	Other.FillUniform(c.data(), Count);
+
+	UINT NumEqual = 0;
+	double Sum = 0.0;
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		assert(a[i] == b[i]);
+		assert(a[i] >= 0.0f && a[i] < 1.0f);
+
+		NumEqual += (a[i] == c[i]) ? 1 : 0;
+		Sum += a[i];
+	}
+
+	assert(NumEqual < 10);
+	assert(fabs(Sum / Count - 0.5) < 0.01);
+
+	// Range
+	Gen.FillUniform(a.data(), Count, -3.0f, 5.0f);
+
+	for (UINT i = 0; i < Count; i++)
+		assert(a[i] >= -3.0f && a[i] < 5.0f);
+
+	// Directions
+	std::vector<Vector4> v(Count);
+	const Vector4 Normal(0.0f, 1.0f, 0.0f, 0.0f);
+
+	Gen.FillUnitVectors(v.data(), Count);
+
+	XMVECTOR Mean = XMVectorZero();
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		assert(fabsf(XMVectorGetX(XMVector3Length(v[i])) - 1.0f) < 1e-4f);
+		assert(XMVectorGetW(v[i]) == 0.0f);
+
+		Mean = XMVectorAdd(Mean, v[i]);
+	}
+
+	assert(XMVectorGetX(XMVector3Length(Mean)) < 0.05f * Count);
+
+	Gen.FillHemisphere(Normal, v.data(), Count);
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		assert(fabsf(XMVectorGetX(XMVector3Length(v[i])) - 1.0f) < 1e-4f);
+		assert(v[i].GetY() >= -1e-6f);
+	}
+
+	// cosine-weighted : E[cos] = 2/3
+	Gen.FillCosineHemisphere(Normal, v.data(), Count);
+
+	Sum = 0.0;
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		assert(fabsf(XMVectorGetX(XMVector3Length(v[i])) - 1.0f) < 1e-4f);
+		assert(v[i].GetY() >= -1e-6f);
+
+		Sum += v[i].GetY();
+	}
+
+	assert(fabs(Sum / Count - 2.0 / 3.0) < 0.01);
+
+	// Points
+	const AABB Box(Vector4(1.0f, 2.0f, 3.0f, 1.0f), Vector4(1.0f, 0.5f, 2.0f, 0.0f));
+	Gen.FillPoints(Box, v.data(), Count);
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		assert(XMVector3InBounds(XMVectorSubtract(v[i], XMVectorSet(1.0f, 2.0f, 3.0f, 0.0f)), XMVectorSet(1.0f, 0.5f, 2.0f, 0.0f)));
+		assert(XMVectorGetW(v[i]) == 1.0f);
+	}
+
+	Sphere Ball;
+	Ball.Set(Vector4(-1.0f, 0.0f, 4.0f, 1.0f), 2.0f);
+	Gen.FillPoints(Ball, v.data(), Count);
+
+	for (UINT i = 0; i < Count; i++)
+		assert(XMVectorGetX(XMVector3Length(XMVectorSubtract(v[i], XMVectorSet(-1.0f, 0.0f, 4.0f, 1.0f)))) <= 2.0f + 1e-4f);
+
+	const Triangle Tri(Vector4(0.0f, 0.0f, 0.0f, 1.0f), Vector4(1.0f, 0.0f, 0.0f, 1.0f), Vector4(0.0f, 1.0f, 0.0f, 1.0f));
+	Gen.FillPoints(Tri, v.data(), Count);
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		assert(v[i].GetX() >= -1e-6f && v[i].GetY() >= -1e-6f);
+		assert(v[i].GetX() + v[i].GetY() <= 1.0f + 1e-5f);
+		assert(fabsf(v[i].GetZ()) < 1e-6f);
+	}
+
+	// Rotations
+	std::vector<Quat> q(Count);
+	Gen.FillQuats(q.data(), Count);
+
+	for (UINT i = 0; i < Count; i++)
+		assert(fabsf(Quat::Dot(q[i], q[i]) - 1.0f) < 1e-4f);
+
+	// Colors with fixed and random Alpha
+	std::vector<Color> Colors(Count);
+	Gen.FillColors(Colors.data(), Count, 0.5f);
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		assert(Colors[i].GetR() >= 0.0f && Colors[i].GetR() < 1.0f);
+		assert(Colors[i].GetA() == 0.5f);
+	}
+
+	Gen.FillColors(Colors.data(), Count, -1.0f);
+
+	Sum = 0.0;
+
+	for (UINT i = 0; i < Count; i++)
+	{
+		assert(Colors[i].GetA() >= 0.0f && Colors[i].GetA() < 1.0f);
+		Sum += Colors[i].GetA();
+	}
+
+	assert(fabs(Sum / Count - 0.5) < 0.02);
+
+	// Ready and return
+	return true;
+
+}
@@ -0,0 +1,137 @@
+// -------------------------------------------------------------------
+// File			:	SpatialHashGridTest - TestSuite
+//
+// Description	:	Test for SpatialHashGrid from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+#include <algorithm>
+
+using namespace TurboMath;
+
+// deterministic Values in [0, 1)
+static float NextRandom(UINT& State)
+{
+	State = State * 1664525u + 1013904223u;
+	return (float)(State >> 8) / 16777216.0f;
+}
+
+bool SpatialHashGridTest()
+{
+	const UINT Count = 20000;
+	std::vector<Vector4, AAllocator<Vector4> > Points(Count);
+	UINT Seed = 4711;
+
+	for (UINT i = 0; i < Count; i++)
+		Points[i] = Vector4(NextRandom(Seed) * 100.0f - 50.0f, NextRandom(Seed) * 100.0f - 50.0f, NextRandom(Seed) * 20.0f, 1.0f);
+
+	SpatialHashGrid Grid;
+	Grid.Build(Points.data(), Count, 2.0f);
+	assert(Grid.GetNumPoints() == Count);
+
+	// every Point sorted exactly once, the same Order on every Build
+	std::vector<UINT> Sorted(Grid.GetSortedIndices(), Grid.GetSortedIndices() + Count);
+	std::vector<UINT> Check(Sorted);
+	std::sort(Check.begin(), Check.end());
+
+	for (UINT i = 0; i < Count; i++)
+		assert(Check[i] == i);
+
+	Grid.Build(Points.data(), Count, 2.0f);
+	assert(std::equal(Sorted.begin(), Sorted.end(), Grid.GetSortedIndices()));
+
+	for (UINT i = 0; i < Count; i++)
+		assert(Grid.GetSortedX()[i] == Points[Sorted[i]].GetX());
+
+	// Queries against Brute-Force, small and large (many Cells)
+	const float Radii[3] = { 1.5f, 7.0f, 60.0f };
+
+	for (UINT q = 0; q < 30; q++)
+	{
+		const Vector4 Center(NextRandom(Seed) * 100.0f - 50.0f, NextRandom(Seed) * 100.0f - 50.0f, NextRandom(Seed) * 20.0f, 1.0f);
+		const float r = Radii[q % 3];
+
+		Sphere S;
+		S.Set(Center, r);
+
+		std::vector<UINT> Found, Expected;
+		Grid.QuerySphere(S, Found);
+
+		for (UINT i = 0; i < Count; i++)
+			if (XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(Points[i], Center))) <= r * r) Expected.push_back(i);
+
+		std::sort(Found.begin(), Found.end());
+		assert(Found == Expected);
+
+		AABB Box;
+		Box.Set(Center, Vector4(r, 0.5f * r, r, 0.0f));
+
+		Found.clear();
+		Expected.clear();
+		Grid.QueryAABB(Box, Found);
+
+		for (UINT i = 0; i < Count; i++)
+			if (XMVector3LessOrEqual(Box.GetMinExtents(), Points[i]) && XMVector3LessOrEqual(Points[i], Box.GetMaxExtents())) Expected.push_back(i);
+
+		std::sort(Found.begin(), Found.end());
+		assert(Found == Expected);
+
+		// the Spans do not overlap
+		std::vector<IndexSpan> Spans;
+		Grid.QueryAABB(Box, Spans);
+		std::sort(Spans.begin(), Spans.end(), [](const IndexSpan& a, const IndexSpan& b) { return a.Begin < b.Begin; });
+
+		for (size_t i = 1; i < Spans.size(); i++)
+			assert(Spans[i - 1].End <= Spans[i].Begin);
+	}
+
+	// a huge Box finds every Point once, a Box away from the Points nothing
+	AABB Huge;
+	Huge.Set(Vector4(0.0f, 0.0f, 0.0f, 1.0f), Vector4(1.0e6f, 1.0e6f, 1.0e6f, 0.0f));
+
+	std::vector<UINT> Found;
+	assert(Grid.QueryAABB(Huge, Found) == Count);
+
+	AABB Away;
+	Away.Set(Vector4(500.0f, 0.0f, 0.0f, 1.0f), Vector4(10.0f, 10.0f, 10.0f, 0.0f));
+	assert(Grid.QueryAABB(Away, Found) == 0);
+
+	// sparse Points far apart : a Query over ~1e15 Cells walks the Buckets, Coordinates
+	// beyond the int-Range share the Border-Cells and are still found
+	const Vector4 Sparse[4] = { Vector4(-1.0e5f, -1.0e5f, -1.0e5f, 1.0f), Vector4(1.0e5f, 1.0e5f, 1.0e5f, 1.0f),
+								Vector4(1.0e20f, 0.0f, 0.0f, 1.0f), Vector4(0.0f, -3.0e12f, 0.0f, 1.0f) };
+
+	Grid.Build(Sparse, 4, 0.5f);
+
+	AABB All;
+	All.Set(Vector4(0.0f, 0.0f, 0.0f, 1.0f), Vector4(1.0e21f, 1.0e21f, 1.0e21f, 0.0f));
+
+	Found.clear();
+	assert(Grid.QueryAABB(All, Found) == 4);
+
+	AABB Far;
+	Far.Set(Vector4(1.0e20f, 0.0f, 0.0f, 1.0f), Vector4(1.0f, 1.0f, 1.0f, 0.0f));
+
+	Found.clear();
+	assert(Grid.QueryAABB(Far, Found) == 1 && Found[0] == 2);
+
+	Grid.Clear();
+	assert(Grid.GetNumPoints() == 0);
+	assert(Grid.QueryAABB(Huge, Found) == 0);
+
+	// Ready and return
+	return true;
+
+}
@@ -0,0 +1,125 @@
+// -------------------------------------------------------------------
+// File			:	SweepTest - TestSuite
+//
+// Description	:	Test for the Sweep-Functions from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+static bool NearEqual(const float a, const float b, const float Epsilon = 1e-4f)
+{
+	return fabsf(a - b) <= Epsilon;
+}
+
+static bool NearEqual(FXMVECTOR a, FXMVECTOR b)
+{
+	return XMVector3NearEqual(a, b, XMVectorReplicate(1e-4f));
+}
+
+bool SweepTest()
+{
+	SweepHit Hit;
+	Sphere Ball;
+
+	// Sphere against Plane y = 0 : touches after 4 of 10 Units
+	Ball.Set(Vector4(0.0f, 5.0f, 0.0f, 1.0f), 1.0f);
+	const Plane Ground(0.0f, 1.0f, 0.0f, 0.0f);
+
+	assert(SweepSpherePlane(Ball, Vector4(0.0f, -10.0f, 0.0f, 0.0f), Ground, &Hit));
+	assert(NearEqual(Hit.Time, 0.4f));
+	assert(NearEqual(Hit.Normal, XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f)));
+	assert(NearEqual(Hit.Point, XMVectorZero()));
+
+	assert(!SweepSpherePlane(Ball, Vector4(0.0f, -2.0f, 0.0f, 0.0f), Ground));
+	assert(!SweepSpherePlane(Ball, Vector4(0.0f, 10.0f, 0.0f, 0.0f), Ground));
+
+	// 2 Spheres
+	Sphere Other;
+	Ball.Set(Vector4(0.0f, 0.0f, 0.0f, 1.0f), 1.0f);
+	Other.Set(Vector4(5.0f, 0.0f, 0.0f, 1.0f), 1.0f);
+
+	assert(SweepSphereSphere(Ball, Vector4(10.0f, 0.0f, 0.0f, 0.0f), Other, Vector4(0.0f, 0.0f, 0.0f, 0.0f), &Hit));
+	assert(NearEqual(Hit.Time, 0.3f));
+	assert(NearEqual(Hit.Normal, XMVectorSet(-1.0f, 0.0f, 0.0f, 0.0f)));
+
+	// both move towards each other : half the Time
+	assert(SweepSphereSphere(Ball, Vector4(10.0f, 0.0f, 0.0f, 0.0f), Other, Vector4(-10.0f, 0.0f, 0.0f, 0.0f), &Hit));
+	assert(NearEqual(Hit.Time, 0.15f));
+
+	assert(!SweepSphereSphere(Ball, Vector4(0.0f, 10.0f, 0.0f, 0.0f), Other, Vector4(0.0f, 0.0f, 0.0f, 0.0f)));
+
+	// overlapping at the Start
+	assert(SweepSphereSphere(Ball, Vector4(1.0f, 0.0f, 0.0f, 0.0f), Ball, Vector4(0.0f, 0.0f, 0.0f, 0.0f), &Hit));
+	assert(Hit.Time == 0.0f);
+
+	// Sphere against Triangle : the Face, then a Vertex
+	const Triangle Tri(Vector4(-5.0f, -5.0f, 0.0f, 1.0f), Vector4(5.0f, -5.0f, 0.0f, 1.0f), Vector4(0.0f, 5.0f, 0.0f, 1.0f));
+
+	Ball.Set(Vector4(0.2f, 0.2f, 5.0f, 1.0f), 1.0f);
+	assert(SweepSphereTriangle(Ball, Vector4(0.0f, 0.0f, -10.0f, 0.0f), Tri, &Hit));
+	assert(NearEqual(Hit.Time, 0.4f));
+	assert(NearEqual(Hit.Normal, XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f)));
+	assert(NearEqual(Hit.Point, XMVectorSet(0.2f, 0.2f, 0.0f, 0.0f)));
+
+	Ball.Set(Vector4(7.0f, -5.0f, 0.0f, 1.0f), 1.0f);
+	assert(SweepSphereTriangle(Ball, Vector4(-10.0f, 0.0f, 0.0f, 0.0f), Tri, &Hit));
+	assert(NearEqual(Hit.Time, 0.1f));
+	assert(NearEqual(Hit.Normal, XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f)));
+
+	// passes beside the Triangle
+	Ball.Set(Vector4(0.0f, 0.0f, 5.0f, 1.0f), 1.0f);
+	assert(!SweepSphereTriangle(Ball, Vector4(10.0f, 0.0f, 0.0f, 0.0f), Tri));
+
+	// Sphere against Box
+	const AABB Box(Vector4(0.0f, 0.0f, 0.0f, 1.0f), Vector4(1.0f, 1.0f, 1.0f, 0.0f));
+
+	Ball.Set(Vector4(-5.0f, 0.0f, 0.0f, 1.0f), 1.0f);
+	assert(SweepSphereAABB(Ball, Vector4(10.0f, 0.0f, 0.0f, 0.0f), Box, &Hit));
+	assert(NearEqual(Hit.Time, 0.3f));
+	assert(NearEqual(Hit.Normal, XMVectorSet(-1.0f, 0.0f, 0.0f, 0.0f)));
+
+	assert(!SweepSphereAABB(Ball, Vector4(0.0f, 10.0f, 0.0f, 0.0f), Box));
+
+	// 2 Boxes
+	const AABB BoxB(Vector4(5.0f, 0.0f, 0.0f, 1.0f), Vector4(1.0f, 1.0f, 1.0f, 0.0f));
+
+	assert(SweepAABBAABB(Box, Vector4(10.0f, 0.0f, 0.0f, 0.0f), BoxB, Vector4(0.0f, 0.0f, 0.0f, 0.0f), &Hit));
+	assert(NearEqual(Hit.Time, 0.3f));
+	assert(!SweepAABBAABB(Box, Vector4(0.0f, 10.0f, 0.0f, 0.0f), BoxB, Vector4(0.0f, 0.0f, 0.0f, 0.0f)));
+
+	// 2 OBBs : Conservative Advancement stops within the Tolerance before the Contact
+	const Vector4 Extents(1.0f, 1.0f, 1.0f, 0.0f);
+	const OBB StartA(Vector4(0.0f, 0.0f, 0.0f, 1.0f), Extents, Quat::Identity());
+	const OBB EndA(Vector4(10.0f, 0.0f, 0.0f, 1.0f), Extents, Quat::Identity());
+	const OBB StartB(Vector4(5.0f, 0.0f, 0.0f, 1.0f), Extents, Quat::Identity());
+
+	assert(SweepOBBOBB(StartA, EndA, StartB, StartB, &Hit));
+	assert(Hit.Time <= 0.3f + 1e-4f && Hit.Time >= 0.29f);
+
+	const OBB AboveA(Vector4(0.0f, 10.0f, 0.0f, 1.0f), Extents, Quat::Identity());
+	assert(!SweepOBBOBB(StartA, AboveA, StartB, StartB));
+
+	// near Miss : A slides past B with a Gap of twice the Tolerance, the Advancement
+	// only creeps forward, running out of Iterations is no Contact
+	const OBB PassA0(Vector4(0.0f, 2.002f, 0.0f, 1.0f), Extents, Quat::Identity());
+	const OBB PassA1(Vector4(10.0f, 2.002f, 0.0f, 1.0f), Extents, Quat::Identity());
+	assert(!SweepOBBOBB(PassA0, PassA1, StartB, StartB, &Hit));
+
+	// Ready and return
+	return true;
+
+}
@@ -32,8 +32,31 @@ bool Point4Test();
 bool Vector2Test();
 bool Vector3Test();
 bool Vector4Test();
+bool QuatTest();
 
 bool MatrixTest();
+bool Matrix3Test();
+bool DoublePrecisionTest();
+bool DualQuatTest();
+bool NoiseTest();
+bool RandomTest();
+bool ColorConvertTest();
+bool PackedTypesTest();
+bool AnimationTest();
+bool QuatArrayTest();
+bool ConvexHullTest();
+bool SweepTest();
+bool DistanceTest();
+bool KdTreeTest();
+bool SpatialHashGridTest();
+bool PathSystemTest();
+bool WayPointsTest();
+bool MovementSystemTest();
+bool BSPTreeTest();
+bool PolygonTest();
+bool MultiViewCullerTest();
+bool BVHTest();
+bool TriangleMeshTest();
 
 int _tmain(int argc, _TCHAR* argv[])
 {
@@ -58,9 +81,78 @@ int _tmain(int argc, _TCHAR* argv[])
 	// Next Test - Vector4
 	Vector4Test();
 
+	// Next Test - Quat
+	QuatTest();
+
 	// Next Test - Matrix
 	MatrixTest();
 
+	// Next Test - Matrix3
+	Matrix3Test();
+
+	// Next Test - DoublePrecision
+	DoublePrecisionTest();
+
+	// Next Test - DualQuat
+	DualQuatTest();
+
+	// Next Test - TriangleMesh
+	TriangleMeshTest();
+
+	// Next Test - BVH
+	BVHTest();
+
+	// Next Test - MultiViewCuller
+	MultiViewCullerTest();
+
+	// Next Test - Polygon
+	PolygonTest();
+
+	// Next Test - BSPTree
+	BSPTreeTest();
+
+	// Next Test - MovementSystem
+	MovementSystemTest();
+
+	// Next Test - WayPoints
+	WayPointsTest();
+
+	// Next Test - PathSystem
+	PathSystemTest();
+
+	// Next Test - SpatialHashGrid
+	SpatialHashGridTest();
+
+	// Next Test - KdTree
+	KdTreeTest();
+
+	// Next Test - Distance
+	DistanceTest();
+
+	// Next Test - Sweep
+	SweepTest();
+
+	// Next Test - ConvexHull
+	ConvexHullTest();
+
+	// Next Test - QuatArray
+	QuatArrayTest();
+
+	// Next Test - Animation
+	AnimationTest();
+
+	// Next Test - PackedTypes
+	PackedTypesTest();
+
+	// Next Test - ColorConvert
+	ColorConvertTest();
+
+	// Next Test - Random
+	RandomTest();
+
+	// Next Test - Noise
+	NoiseTest();
+
 	// Ready
 	return 0;
 }
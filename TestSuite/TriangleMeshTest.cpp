@@ -0,0 +1,134 @@
+// -------------------------------------------------------------------
+// File			:	TriangleMeshTest - TestSuite
+//
+// Description	:	Test for TriangleMesh from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+static bool NearEqual3(FXMVECTOR a, FXMVECTOR b)
+{
+	return XMVector3NearEqual(a, b, XMVectorReplicate(1e-4f));
+}
+
+// 4 x 4 Grid of Quads in the xy-Plane (z = 0), 32 Triangles facing +z
+static void BuildGrid(TriangleMesh& Mesh)
+{
+	Mesh.Clear();
+
+	for (UINT y = 0; y <= 4; y++)
+		for (UINT x = 0; x <= 4; x++)
+			Mesh.AddVertex(Vector4((float)x, (float)y, 0.0f, 1.0f));
+
+	for (UINT y = 0; y < 4; y++)
+	{
+		for (UINT x = 0; x < 4; x++)
+		{
+			const UINT i = y * 5 + x;
+
+			Mesh.AddTriangle(i, i + 1, i + 6, y * 4 + x);
+			Mesh.AddTriangle(i, i + 6, i + 5, y * 4 + x);
+		}
+	}
+}
+
+bool TriangleMeshTest()
+{
+	TriangleMesh Mesh;
+	BuildGrid(Mesh);
+
+	assert(Mesh.GetNumVertices() == 25);
+	assert(Mesh.GetNumTriangles() == 32);
+	assert(Mesh.GetUserData(7) == 3);
+
+	// Bounds
+	const AABB Box = Mesh.GetAABB();
+	assert(NearEqual3(Box.GetMinExtents(), XMVectorSet(0.0f, 0.0f, 0.0f, 0.0f)));
+	assert(NearEqual3(Box.GetMaxExtents(), XMVectorSet(4.0f, 4.0f, 0.0f, 0.0f)));
+
+	// Normals
+	Mesh.ComputeFaceNormals();
+	Mesh.ComputeVertexNormals();
+	assert(Mesh.HasFaceNormals() && Mesh.HasVertexNormals());
+
+	for (UINT t = 0; t < Mesh.GetNumTriangles(); t++)
+		assert(NearEqual3(Mesh.GetFaceNormal(t), g_XMIdentityR2));
+
+	assert(NearEqual3(Mesh.GetVertexNormal(12), g_XMIdentityR2));
+
+	// Transform (Positions and Normals)
+	Mesh.Transform(Matrix::RotationAxis(Vector4(1.0f, 0.0f, 0.0f, 0.0f), XM_PI) * Matrix::Translation(1.0f, 2.0f, 3.0f));
+	assert(NearEqual3(Mesh.GetVertex(6), XMVectorSet(2.0f, 1.0f, 3.0f, 0.0f)));
+	assert(NearEqual3(Mesh.GetVertexNormal(6), XMVectorSet(0.0f, 0.0f, -1.0f, 0.0f)));
+	assert(NearEqual3(Mesh.GetFaceNormal(0), XMVectorSet(0.0f, 0.0f, -1.0f, 0.0f)));
+
+	// SetVertex releases the derived Data
+	BuildGrid(Mesh);
+	Mesh.ComputeVertexNormals();
+	Mesh.BuildTriangleData();
+	assert(Mesh.HasVertexNormals() && Mesh.HasTriangleData());
+
+	Mesh.SetVertex(12, Vector4(2.0f, 2.0f, 1.0f, 1.0f));
+	assert(!Mesh.HasVertexNormals() && !Mesh.HasTriangleData());
+	assert(NearEqual3(Mesh.GetAABB().GetMaxExtents(), XMVectorSet(4.0f, 4.0f, 1.0f, 0.0f)));
+
+	// Triangle-AABBs
+	AABB Boxes[32];
+	Mesh.ComputeTriangleAABBs(Boxes);
+	assert(NearEqual3(Boxes[31].GetMinExtents(), XMVectorSet(3.0f, 3.0f, 0.0f, 0.0f)));
+	assert(NearEqual3(Boxes[31].GetMaxExtents(), XMVectorSet(4.0f, 4.0f, 0.0f, 0.0f)));
+
+	// Ray-Queries, exactly on a shared Edge and a shared Vertex (no Miss)
+	BuildGrid(Mesh);
+	Mesh.BuildTriangleData();
+
+	const Vector4 Down(0.0f, 0.0f, -1.0f, 0.0f);
+	RayHit Hit;
+
+	assert(Mesh.IntersectRay(Ray(Vector4(1.5f, 1.5f, 5.0f, 1.0f), Down), Hit));
+	assert(fabsf(Hit.Distance - 5.0f) < 1e-5f);
+	assert(Hit.TriIndex == 10 || Hit.TriIndex == 11);
+
+	assert(Mesh.IntersectRay(Ray(Vector4(2.0f, 2.0f, 5.0f, 1.0f), Down), Hit));
+	assert(fabsf(Hit.Distance - 5.0f) < 1e-5f);
+
+	assert(Mesh.IntersectRay(Ray(Vector4(2.25f, 0.0f, 5.0f, 1.0f), Down), Hit));
+	assert(Hit.TriIndex == 4);
+
+	// Barycentrics
+	assert(Mesh.IntersectRay(Ray(Vector4(0.75f, 0.25f, 1.0f, 1.0f), Down), Hit));
+	assert(Hit.TriIndex == 0 && fabsf(Hit.U - 0.5f) < 1e-5f && fabsf(Hit.V - 0.25f) < 1e-5f);
+
+	// Misses : outside, behind the Origin and beyond MaxDist
+	assert(!Mesh.IntersectRay(Ray(Vector4(4.5f, 1.0f, 5.0f, 1.0f), Down), Hit));
+	assert(!Mesh.IntersectRay(Ray(Vector4(1.5f, 1.5f, -1.0f, 1.0f), Down), Hit));
+	assert(!Mesh.IntersectRay(Ray(Vector4(1.5f, 1.5f, 5.0f, 1.0f), Down), Hit, 4.0f));
+
+	// Range of Triangles
+	const WatertightRay R(Ray(Vector4(1.5f, 1.5f, 5.0f, 1.0f), Down));
+	Hit.Distance = FLT_MAX;
+	assert(!Mesh.IntersectRay(R, 12, 20, Hit));
+	assert(Mesh.IntersectRay(R, 11, 1, Hit) && Hit.TriIndex == 11);
+
+	// empty Mesh
+	TriangleMesh Empty;
+	assert(!Empty.IntersectRay(Ray(Vector4(0.0f, 0.0f, 5.0f, 1.0f), Down), Hit));
+
+	// Ready and return
+	return true;
+
+}
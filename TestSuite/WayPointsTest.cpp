@@ -0,0 +1,100 @@
+// -------------------------------------------------------------------
+// File			:	WayPointsTest - TestSuite
+//
+// Description	:	Test for WayPoints from TurboMath
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2012 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+
+#include "stdafx.h"
+#include "..\TurboMath\TurboMath.h"
+#include <assert.h>
+#include <windows.h>
+
+using namespace TurboMath;
+
+static bool NearEqual3(FXMVECTOR a, FXMVECTOR b)
+{
+	return XMVector3NearEqual(a, b, XMVectorReplicate(1e-4f));
+}
+
+bool WayPointsTest()
+{
+	// closed Rectangle 10 x 2, Length 24
+	WayPoints Path;
+	Vector4 Corners[4] = { Vector4(0.0f, 0.0f, 0.0f, 1.0f), Vector4(10.0f, 0.0f, 0.0f, 1.0f), Vector4(10.0f, 2.0f, 0.0f, 1.0f), Vector4(0.0f, 2.0f, 0.0f, 1.0f) };
+
+	for (UINT i = 0; i < 4; i++)
+	{
+		PathPoint Point;
+		Point.SetPoint(Corners[i]);
+		Path.AddPathPoint(Point);
+	}
+
+	assert(Path.GetNumPathPoints() == 4);
+	assert(fabsf(Path.GetPathLength() - 24.0f) < 1e-4f);
+
+	// Start- / Move-Times follow the Segment-Lengths
+	assert(fabsf(Path.GetPathPoint(1).GetStartTime() - 10.0f / 24.0f) < 1e-5f);
+	assert(fabsf(Path.GetPathPoint(1).GetMoveTime() - 2.0f / 24.0f) < 1e-5f);
+	assert(fabsf(Path.GetPathPoint(3).GetStartTime() - 22.0f / 24.0f) < 1e-5f);
+
+	// constant Speed : the Path-Time is a Part of the Length
+	Path.SetSpeed(1.0f);
+
+	assert(Path.Update(0.125f));
+	assert(NearEqual3(Path.GetPosition(), XMVectorSet(3.0f, 0.0f, 0.0f, 0.0f)));
+
+	assert(Path.Update(0.375f));
+	assert(NearEqual3(Path.GetPosition(), XMVectorSet(10.0f, 2.0f, 0.0f, 0.0f)));
+
+	assert(Path.Update(0.25f));
+	assert(NearEqual3(Path.GetPosition(), XMVectorSet(4.0f, 2.0f, 0.0f, 0.0f)));
+
+	// small Steps move the same Distance on a straight Part
+	Path.Restart();
+	Vector4 Prev = Vector4(0.0f, 0.0f, 0.0f, 1.0f);
+
+	for (UINT i = 0; i < 40; i++)
+	{
+		Path.Update(0.01f);
+		assert(fabsf(XMVectorGetX(XMVector3Length(XMVectorSubtract(Path.GetPosition(), Prev))) - 0.24f) < 1e-3f);
+		Prev = Path.GetPosition();
+	}
+
+	// constant Time per Segment
+	Path.SetConstantSpeed(false);
+	Path.Restart();
+
+	assert(Path.Update(0.125f));
+	assert(NearEqual3(Path.GetPosition(), XMVectorSet(5.0f, 0.0f, 0.0f, 0.0f)));
+
+	assert(Path.Update(0.25f));
+	assert(NearEqual3(Path.GetPosition(), XMVectorSet(10.0f, 1.0f, 0.0f, 0.0f)));
+
+	// Catmull-Rom passes through the Points
+	Path.SetConstantSpeed(true);
+	Path.SetPathTypePosition(WayPoints::PATH_CURVED);
+	Path.Restart();
+
+	assert(Path.GetPathLength() > 0.0f);
+	assert(fabsf(Path.GetPathPoint(0).GetStartTime()) < 1e-6f);
+
+	Path.Update(Path.GetPathPoint(2).GetStartTime());
+	assert(NearEqual3(Path.GetPosition(), Corners[2]));
+
+	// empty Path
+	Path.DeletePath();
+	assert(!Path.Update(0.1f));
+
+	// Ready and return
+	return true;
+
+}
@@ -88,6 +88,12 @@ namespace TurboMath
 		//-----------------------------------------------------------------------------
 		void 		XM_CALLCONV	Transform( const AABB* pIn,const float Scale, const Quat& Rotation, const Vector4& Translation );
 
+		//-----------------------------------------------------------------------------
+		// Closest point on (or in) the box and squared distance to a point.
+		//-----------------------------------------------------------------------------
+		const Vector4	XM_CALLCONV	ClosestPoint( const Vector4& Point) const noexcept;
+		const float	XM_CALLCONV	DistanceSq( const Vector4& Point) const noexcept;
+
 		//-----------------------------------------------------------------------------
 		// Intersection testing routines.
 		//-----------------------------------------------------------------------------
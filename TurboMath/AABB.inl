@@ -295,6 +295,24 @@ namespace TurboMath
 		return;
 	}
 
+	//-----------------------------------------------------------------------------
+	// Closest point on (or in) the box.
+	//-----------------------------------------------------------------------------
+	XM_INLINE  const Vector4 XM_CALLCONV	AABB::ClosestPoint( const Vector4& Point) const noexcept
+	{
+		return ClosestPointOnAABB( Point, GetMinExtents(), GetMaxExtents() );
+	}
+
+	//-----------------------------------------------------------------------------
+	// Squared distance of a point to the box (0 inside).
+	//-----------------------------------------------------------------------------
+	XM_INLINE  const float XM_CALLCONV	AABB::DistanceSq( const Vector4& Point) const noexcept
+	{
+		const XMVECTOR Closest = ClosestPointOnAABB( Point, GetMinExtents(), GetMaxExtents() );
+
+		return XMVectorGetX( XMVector3LengthSq( XMVectorSubtract(Point.GetRaw(), Closest) ) );
+	}
+
 	//-----------------------------------------------------------------------------
 	// Point in axis aligned box test.
 	//-----------------------------------------------------------------------------
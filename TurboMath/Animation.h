@@ -0,0 +1,241 @@
+// -------------------------------------------------------------------
+// File			:	Animation
+//
+// Project		:	TurboMath
+//
+// Description	:	compressed Animation-Clips and SIMD Skeleton-Sampler
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_ANIMATION_H_
+#define _TURBOMATH_ANIMATION_H_
+
+#include <vector>
+#include <algorithm>
+
+namespace TurboMath
+{
+
+	//-----------------------------------------------------------------------------
+	// compressed Key (6 Bytes) :
+	// Rotation	: "smallest three" - the 3 smallest Components with 15 Bit in
+	//			  [-1/sqrt(2), 1/sqrt(2)], the Index of the largest Component in
+	//			  Bit 15 of c[0] and c[1] (the largest is rebuilt from the Unit-Length)
+	// Vector	: 16 Bit per Component in the Range of its Track
+	//-----------------------------------------------------------------------------
+	struct PackedKey
+	{
+		uint16_t	c[3];
+	};
+
+	//-----------------------------------------------------------------------------
+	// transposed affine Matrix (3 Rows of 4 Floats) like a Skinning-Palette on
+	// the GPU : x' = dot(Row[0], (x, y, z, 1)) ...
+	//-----------------------------------------------------------------------------
+	struct Affine3x4
+	{
+		XMFLOAT4	Row[3];
+	};
+
+	//-----------------------------------------------------------------------------
+	// Animation-Clip of a Skeleton with one Rotation-, Translation- and Scale-
+	// Track per Bone. The Clip is built from uniform sampled Poses : every Track
+	// keeps only the Frames, which can't be interpolated from their Neighbours
+	// within a Tolerance (variable Key-Rate, constant Tracks have one Key).
+	// Key-Times are Frame-Numbers (16 Bit), Keys are packed to 6 Bytes.
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class AnimationClip
+	{
+	public:
+
+		typedef std::vector<float, AAllocator<float> >	FloatStream;
+
+		/// Tracks of a Bone
+		enum Channel
+		{
+			CHANNEL_ROTATION = 0,
+			CHANNEL_TRANSLATION,
+			CHANNEL_SCALE,
+
+			NUM_CHANNELS
+		};
+
+		/// Keys of one Track
+		struct Track
+		{
+			UINT	FirstKey;
+			UINT	NumKeys;
+		};
+
+		AnimationClip() noexcept;
+		~AnimationClip() noexcept;
+
+		/// remove the Clip
+		void				XM_CALLCONV Clear() noexcept;
+
+		//-----------------------------------------------------------------------------
+		// Build
+		//-----------------------------------------------------------------------------
+
+		/// build from NumFrames Poses of NumBones Bones (Frame-major : [Frame * NumBones + Bone]), pScales is optional
+		const bool			XM_CALLCONV Build(const UINT NumBones, const UINT NumFrames, const float SampleRate,
+											  const Quat* pRotations, const Vector4* pTranslations, const Vector4* pScales = nullptr,
+											  const float RotationTolerance = 0.001f, const float TranslationTolerance = 0.0005f, const float ScaleTolerance = 0.0005f);
+
+		//-----------------------------------------------------------------------------
+		// Access
+		//-----------------------------------------------------------------------------
+		const UINT			XM_CALLCONV GetNumBones() const noexcept				{ return m_NumBones; }
+		const UINT			XM_CALLCONV GetNumFrames() const noexcept				{ return m_NumFrames; }
+		const float			XM_CALLCONV GetSampleRate() const noexcept				{ return m_SampleRate; }
+		const float			XM_CALLCONV GetDuration() const noexcept;
+
+		/// Number of Keys of a Channel (all Bones)
+		const UINT			XM_CALLCONV GetNumKeys(const Channel theChannel) const noexcept	{ return (UINT)m_Keys[theChannel].size(); }
+
+		/// Memory of the compressed Data in Bytes
+		const size_t		XM_CALLCONV GetMemorySize() const noexcept;
+
+		const Track&		XM_CALLCONV GetTrack(const Channel theChannel, const UINT Bone) const noexcept	{ return m_Tracks[theChannel * m_NumBones + Bone]; }
+		const uint16_t*		XM_CALLCONV GetKeyTimes(const Channel theChannel) const noexcept	{ return m_KeyTimes[theChannel].data(); }
+		const PackedKey*	XM_CALLCONV GetKeys(const Channel theChannel) const noexcept		{ return m_Keys[theChannel].data(); }
+
+		/// Range of the Vector-Tracks as SoA-Streams (padded to a Multiple of 4)
+		const float*		XM_CALLCONV GetRangeMin(const Channel theChannel, const UINT Axis) const noexcept		{ return m_RangeMin[theChannel][Axis].data(); }
+		const float*		XM_CALLCONV GetRangeExtent(const Channel theChannel, const UINT Axis) const noexcept	{ return m_RangeExtent[theChannel][Axis].data(); }
+
+		//-----------------------------------------------------------------------------
+		// Key-Compression
+		//-----------------------------------------------------------------------------
+		static void			XM_CALLCONV PackQuat(FXMVECTOR q, PackedKey& Key) noexcept;
+		static XMVECTOR		XM_CALLCONV UnpackQuat(const PackedKey& Key) noexcept;
+
+		static void			XM_CALLCONV PackVector(FXMVECTOR v, FXMVECTOR RangeMin, FXMVECTOR RangeExtent, PackedKey& Key) noexcept;
+		static XMVECTOR		XM_CALLCONV UnpackVector(const PackedKey& Key, FXMVECTOR RangeMin, FXMVECTOR RangeExtent) noexcept;
+
+		/// Scale of the Rotation-Components : a = (c - ROTATION_ZERO) * ROTATION_SCALE
+		static constexpr UINT	ROTATION_ZERO = 16383;
+		static constexpr float	ROTATION_SCALE = 0.70710678f / 16383.0f;
+
+	protected:
+
+		/// Frames of a Track, which are needed as Keys
+		template <class ErrorFunc>
+		void				XM_CALLCONV ReduceKeys(const UINT NumFrames, const ErrorFunc& Error, const float Tolerance, std::vector<UINT>& Frames) const;
+
+		UINT				m_NumBones;
+		UINT				m_NumFrames;
+		float				m_SampleRate;
+
+		std::vector<Track>		m_Tracks;							// [Channel * NumBones + Bone]
+		std::vector<uint16_t>	m_KeyTimes[NUM_CHANNELS];			// Frame of each Key
+		std::vector<PackedKey>	m_Keys[NUM_CHANNELS];
+		FloatStream				m_RangeMin[NUM_CHANNELS][3];		// Translation and Scale only
+		FloatStream				m_RangeExtent[NUM_CHANNELS][3];
+	};
+
+	//-----------------------------------------------------------------------------
+	// Sampler of one playing Instance of a Clip. Each Track has a Cursor on its
+	// last Key, so playing forward finds the Keys in O(1) (jumps back use a
+	// binary Search). Sampling first gathers the raw Keys of all Bones into
+	// SoA-Streams, then one SIMD-Pass decodes 4 Bones per Instruction, blends
+	// the Keys (normalized Lerp for the Rotations) and writes the local Pose,
+	// Matrices or an affine Palette.
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class AnimationSampler
+	{
+	public:
+
+		typedef std::vector<float, AAllocator<float> >	FloatStream;
+		typedef std::vector<UINT, AAllocator<UINT> >	UIntStream;
+
+		AnimationSampler() noexcept;
+		~AnimationSampler() noexcept;
+
+		/// bind the Sampler to a Clip (the Clip must stay alive)
+		void				XM_CALLCONV Bind(const AnimationClip* pClip);
+
+		/// set all Cursors back to the Start
+		void				XM_CALLCONV Reset() noexcept;
+
+		/// get the Clip
+		const AnimationClip* XM_CALLCONV GetClip() const noexcept				{ return m_pClip; }
+
+		//-----------------------------------------------------------------------------
+		// Sampling (Time in Seconds, clamped to the Clip)
+		//-----------------------------------------------------------------------------
+
+		/// local Pose into the SoA-Streams (for Blending with QuatArray)
+		void				XM_CALLCONV Sample(const float Time);
+
+		/// local Matrices of all Bones
+		void				XM_CALLCONV Sample(const float Time, Matrix* pMatrices);
+
+		/// local affine Palette of all Bones
+		void				XM_CALLCONV Sample(const float Time, Affine3x4* pPalette);
+
+		/// local Pose of the last Sample(Time)
+		const QuatArray&	XM_CALLCONV GetRotations() const noexcept				{ return m_Rotations; }
+		const float*		XM_CALLCONV GetTranslations(const UINT Axis) const noexcept	{ return m_Translations[Axis].data(); }
+		const float*		XM_CALLCONV GetScales(const UINT Axis) const noexcept		{ return m_Scales[Axis].data(); }
+
+		/// Model-Space from local Matrices (Parents before their Children, -1 for Roots)
+		static void			XM_CALLCONV LocalToModel(const Matrix* pLocal, const int* pParents, const UINT NumBones, Matrix* pModel) noexcept;
+
+	protected:
+
+		/// 4 Bones of a decoded Pose
+		struct PoseLanes
+		{
+			XMVECTOR	qx, qy, qz, qw;
+			XMVECTOR	tx, ty, tz;
+			XMVECTOR	sx, sy, sz;
+		};
+
+		/// Key before the Frame (uses and moves the Cursor)
+		const UINT			XM_CALLCONV FindKey(const AnimationClip::Channel theChannel, const UINT Bone, const float Frame) noexcept;
+
+		/// gather the Keys around the Time of all Bones into the Streams
+		void				XM_CALLCONV Gather(const float Time) noexcept;
+
+		/// decode and blend the 4 Bones at Index i
+		const PoseLanes		XM_CALLCONV DecodeLanes(const UINT i) const noexcept;
+
+		/// Elements of the affine Matrices (Row 0..3, Column 0..2) of 4 Bones
+		static void			XM_CALLCONV ComposeElements(const PoseLanes& Pose, XMVECTOR Elements[4][3]) noexcept;
+
+		const AnimationClip*	m_pClip;
+		UINT					m_NumPadded;
+
+		std::vector<UINT>		m_Cursors;					// [Channel * NumBones + Bone]
+
+		// gathered raw Keys (A = before, B = after the Time)
+		UIntStream				m_RotA[4], m_RotB[4];		// 3 Components + Index of the largest
+		UIntStream				m_VecA[2][3], m_VecB[2][3];	// Translation, Scale
+		FloatStream				m_Alpha[AnimationClip::NUM_CHANNELS];
+
+		// local Pose
+		QuatArray				m_Rotations;
+		FloatStream				m_Translations[3];
+		FloatStream				m_Scales[3];
+	};
+
+}; // end of namespace
+
+#endif
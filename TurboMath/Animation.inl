@@ -0,0 +1,748 @@
+// -------------------------------------------------------------------
+// File			:	Animation
+//
+// Project		:	TurboMath
+//
+// Description	:	compressed Animation-Clips and SIMD Skeleton-Sampler
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+namespace TurboMath
+{
+	//------------------------------------------------------------------------------
+	XM_INLINE AnimationClip::AnimationClip() noexcept
+		: m_NumBones(0)
+		, m_NumFrames(0)
+		, m_SampleRate(0.0f)
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE AnimationClip::~AnimationClip() noexcept
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV AnimationClip::Clear() noexcept
+	{
+		m_Tracks.clear();
+
+		for (UINT ch = 0; ch < NUM_CHANNELS; ch++)
+		{
+			m_KeyTimes[ch].clear();
+			m_Keys[ch].clear();
+
+			for (UINT Axis = 0; Axis < 3; Axis++)
+			{
+				m_RangeMin[ch][Axis].clear();
+				m_RangeExtent[ch][Axis].clear();
+			}
+		}
+
+		m_NumBones = 0;
+		m_NumFrames = 0;
+		m_SampleRate = 0.0f;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const float XM_CALLCONV AnimationClip::GetDuration() const noexcept
+	{
+		return (m_NumFrames > 1) ? (float)(m_NumFrames - 1) / m_SampleRate : 0.0f;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const size_t XM_CALLCONV AnimationClip::GetMemorySize() const noexcept
+	{
+		size_t Size = m_Tracks.size() * sizeof(Track);
+
+		for (UINT ch = 0; ch < NUM_CHANNELS; ch++)
+		{
+			Size += m_KeyTimes[ch].size() * sizeof(uint16_t);
+			Size += m_Keys[ch].size() * sizeof(PackedKey);
+
+			for (UINT Axis = 0; Axis < 3; Axis++)
+				Size += (m_RangeMin[ch][Axis].size() + m_RangeExtent[ch][Axis].size()) * sizeof(float);
+		}
+
+		return Size;
+	}
+
+	//------------------------------------------------------------------------------
+	// Key-Compression
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV AnimationClip::PackQuat(FXMVECTOR q, PackedKey& Key) noexcept
+	{
+		CACHE_ALIGN(16) float f[4];
+
+		XMStoreFloat4A((XMFLOAT4A*)f, q);
+
+		UINT Largest = 0;
+
+		for (UINT k = 1; k < 4; k++)
+		{
+			if (fabsf(f[k]) > fabsf(f[Largest]))
+				Largest = k;
+		}
+
+		// q and -q are the same Rotation : the largest Component is always positive
+		const float Sign = (f[Largest] < 0.0f) ? -1.0f : 1.0f;
+
+		UINT c[3];
+		UINT n = 0;
+
+		for (UINT k = 0; k < 4; k++)
+		{
+			if (k == Largest)
+				continue;
+
+			const int Value = (int)floorf(f[k] * Sign / ROTATION_SCALE + 0.5f) + (int)ROTATION_ZERO;
+
+			c[n++] = (UINT)XMMax(0, XMMin(Value, (int)(2 * ROTATION_ZERO)));
+		}
+
+		Key.c[0] = (uint16_t)(c[0] | ((Largest & 1) << 15));
+		Key.c[1] = (uint16_t)(c[1] | ((Largest >> 1) << 15));
+		Key.c[2] = (uint16_t)c[2];
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV AnimationClip::UnpackQuat(const PackedKey& Key) noexcept
+	{
+		const UINT Largest = (Key.c[0] >> 15) | ((Key.c[1] >> 15) << 1);
+
+		const float a[3] =
+		{
+			((float)(Key.c[0] & 0x7FFF) - (float)ROTATION_ZERO) * ROTATION_SCALE,
+			((float)(Key.c[1] & 0x7FFF) - (float)ROTATION_ZERO) * ROTATION_SCALE,
+			((float)(Key.c[2] & 0x7FFF) - (float)ROTATION_ZERO) * ROTATION_SCALE
+		};
+
+		float f[4];
+		UINT n = 0;
+
+		for (UINT k = 0; k < 4; k++)
+		{
+			if (k != Largest)
+				f[k] = a[n++];
+		}
+
+		f[Largest] = sqrtf(XMMax(0.0f, 1.0f - a[0] * a[0] - a[1] * a[1] - a[2] * a[2]));
+
+		return XMVectorSet(f[0], f[1], f[2], f[3]);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV AnimationClip::PackVector(FXMVECTOR v, FXMVECTOR RangeMin, FXMVECTOR RangeExtent, PackedKey& Key) noexcept
+	{
+		CACHE_ALIGN(16) float f[4];
+		CACHE_ALIGN(16) float Min[4];
+		CACHE_ALIGN(16) float Extent[4];
+
+		XMStoreFloat4A((XMFLOAT4A*)f, v);
+		XMStoreFloat4A((XMFLOAT4A*)Min, RangeMin);
+		XMStoreFloat4A((XMFLOAT4A*)Extent, RangeExtent);
+
+		for (UINT k = 0; k < 3; k++)
+		{
+			const float Value = (Extent[k] > 0.0f) ? (f[k] - Min[k]) / Extent[k] * 65535.0f + 0.5f : 0.0f;
+
+			Key.c[k] = (uint16_t)XMMax(0.0f, XMMin(Value, 65535.0f));
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV AnimationClip::UnpackVector(const PackedKey& Key, FXMVECTOR RangeMin, FXMVECTOR RangeExtent) noexcept
+	{
+		const XMVECTOR c = XMVectorSet((float)Key.c[0], (float)Key.c[1], (float)Key.c[2], 0.0f);
+
+		return XMVectorMultiplyAdd(c, XMVectorScale(RangeExtent, 1.0f / 65535.0f), RangeMin);
+	}
+
+	//------------------------------------------------------------------------------
+	// Greedy : a Segment grows as long as all Frames inside can be interpolated
+	// from its End-Frames, Error(a, b, f) is the Error of Frame f interpolated
+	// between the Keys a and b (a == b : the Value of a).
+	//------------------------------------------------------------------------------
+	template <class ErrorFunc>
+	XM_INLINE void XM_CALLCONV AnimationClip::ReduceKeys(const UINT NumFrames, const ErrorFunc& Error, const float Tolerance, std::vector<UINT>& Frames) const
+	{
+		Frames.clear();
+		Frames.push_back(0);
+
+		if (NumFrames == 1)
+			return;
+
+		// constant Track
+		bool bConstant = true;
+
+		for (UINT f = 1; f < NumFrames && bConstant; f++)
+			bConstant = Error(0, 0, f) <= Tolerance;
+
+		if (bConstant)
+			return;
+
+		UINT Start = 0;
+
+		for (UINT End = 2; End < NumFrames; End++)
+		{
+			bool bFits = true;
+
+			for (UINT f = Start + 1; f < End && bFits; f++)
+				bFits = Error(Start, End, f) <= Tolerance;
+
+			if (!bFits)
+			{
+				Start = End - 1;
+				Frames.push_back(Start);
+			}
+		}
+
+		Frames.push_back(NumFrames - 1);
+	}
+
+	//------------------------------------------------------------------------------
+	// Build
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV AnimationClip::Build(const UINT NumBones, const UINT NumFrames, const float SampleRate,
+														  const Quat* pRotations, const Vector4* pTranslations, const Vector4* pScales,
+														  const float RotationTolerance, const float TranslationTolerance, const float ScaleTolerance)
+	{
+		Clear();
+
+		if (NumBones == 0 || NumFrames == 0 || NumFrames > 65536 || SampleRate <= 0.0f || pRotations == nullptr)
+			return false;
+
+		m_NumBones = NumBones;
+		m_NumFrames = NumFrames;
+		m_SampleRate = SampleRate;
+
+		const UINT NumPadded = (NumBones + 3) & ~3u;
+
+		m_Tracks.resize(NUM_CHANNELS * NumBones);
+
+		for (UINT ch = CHANNEL_TRANSLATION; ch < NUM_CHANNELS; ch++)
+		{
+			for (UINT Axis = 0; Axis < 3; Axis++)
+			{
+				m_RangeMin[ch][Axis].assign(NumPadded, 0.0f);
+				m_RangeExtent[ch][Axis].assign(NumPadded, 0.0f);
+			}
+		}
+
+		std::vector<UINT> Frames;
+
+		for (UINT Bone = 0; Bone < NumBones; Bone++)
+		{
+			//------------------------------------------------------------------------------
+			// Rotation : Error is the Angle to the normalized Lerp on the shorter Arc
+			//------------------------------------------------------------------------------
+			auto Rotation = [&](const UINT f)
+			{
+				return XMQuaternionNormalize(pRotations[f * NumBones + Bone].Get());
+			};
+
+			auto RotationError = [&](const UINT a, const UINT b, const UINT f)
+			{
+				const XMVECTOR q0 = Rotation(a);
+				XMVECTOR q1 = Rotation(b);
+
+				if (XMVectorGetX(XMQuaternionDot(q0, q1)) < 0.0f)
+					q1 = XMVectorNegate(q1);
+
+				const float Alpha = (b > a) ? (float)(f - a) / (float)(b - a) : 0.0f;
+				const XMVECTOR q = XMQuaternionNormalize(XMVectorLerp(q0, q1, Alpha));
+				const float Dot = fabsf(XMVectorGetX(XMQuaternionDot(q, Rotation(f))));
+
+				return 2.0f * acosf(XMMin(Dot, 1.0f));
+			};
+
+			ReduceKeys(NumFrames, RotationError, RotationTolerance, Frames);
+
+			Track& RotTrack = m_Tracks[CHANNEL_ROTATION * NumBones + Bone];
+
+			RotTrack.FirstKey = (UINT)m_Keys[CHANNEL_ROTATION].size();
+			RotTrack.NumKeys = (UINT)Frames.size();
+
+			for (const UINT f : Frames)
+			{
+				PackedKey Key;
+
+				PackQuat(Rotation(f), Key);
+
+				m_KeyTimes[CHANNEL_ROTATION].push_back((uint16_t)f);
+				m_Keys[CHANNEL_ROTATION].push_back(Key);
+			}
+
+			//------------------------------------------------------------------------------
+			// Translation and Scale : Error is the Distance to the Lerp
+			//------------------------------------------------------------------------------
+			for (UINT ch = CHANNEL_TRANSLATION; ch < NUM_CHANNELS; ch++)
+			{
+				const Vector4* pSource = (ch == CHANNEL_TRANSLATION) ? pTranslations : pScales;
+				const XMVECTOR Default = (ch == CHANNEL_TRANSLATION) ? XMVectorZero() : XMVectorSplatOne();
+				const float Tolerance = (ch == CHANNEL_TRANSLATION) ? TranslationTolerance : ScaleTolerance;
+
+				auto Value = [&](const UINT f)
+				{
+					return (pSource != nullptr) ? XMVectorSetW(pSource[f * NumBones + Bone], 0.0f) : Default;
+				};
+
+				auto VectorError = [&](const UINT a, const UINT b, const UINT f)
+				{
+					const float Alpha = (b > a) ? (float)(f - a) / (float)(b - a) : 0.0f;
+
+					return XMVectorGetX(XMVector3Length(XMVectorSubtract(XMVectorLerp(Value(a), Value(b), Alpha), Value(f))));
+				};
+
+				XMVECTOR vMin = Value(0);
+				XMVECTOR vMax = vMin;
+
+				for (UINT f = 1; f < NumFrames; f++)
+				{
+					vMin = XMVectorMin(vMin, Value(f));
+					vMax = XMVectorMax(vMax, Value(f));
+				}
+
+				const XMVECTOR vExtent = XMVectorSubtract(vMax, vMin);
+
+				m_RangeMin[ch][0][Bone] = XMVectorGetX(vMin);
+				m_RangeMin[ch][1][Bone] = XMVectorGetY(vMin);
+				m_RangeMin[ch][2][Bone] = XMVectorGetZ(vMin);
+				m_RangeExtent[ch][0][Bone] = XMVectorGetX(vExtent);
+				m_RangeExtent[ch][1][Bone] = XMVectorGetY(vExtent);
+				m_RangeExtent[ch][2][Bone] = XMVectorGetZ(vExtent);
+
+				ReduceKeys(NumFrames, VectorError, Tolerance, Frames);
+
+				Track& VecTrack = m_Tracks[ch * NumBones + Bone];
+
+				VecTrack.FirstKey = (UINT)m_Keys[ch].size();
+				VecTrack.NumKeys = (UINT)Frames.size();
+
+				for (const UINT f : Frames)
+				{
+					PackedKey Key;
+
+					PackVector(Value(f), vMin, vExtent, Key);
+
+					m_KeyTimes[ch].push_back((uint16_t)f);
+					m_Keys[ch].push_back(Key);
+				}
+			}
+		}
+
+		return true;
+	}
+
+	//------------------------------------------------------------------------------
+	// AnimationSampler
+	//------------------------------------------------------------------------------
+	XM_INLINE AnimationSampler::AnimationSampler() noexcept
+		: m_pClip(nullptr)
+		, m_NumPadded(0)
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE AnimationSampler::~AnimationSampler() noexcept
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV AnimationSampler::Bind(const AnimationClip* pClip)
+	{
+		assert(pClip != nullptr);
+
+		m_pClip = pClip;
+
+		const UINT NumBones = pClip->GetNumBones();
+
+		m_NumPadded = (NumBones + 3) & ~3u;
+		m_Cursors.assign(AnimationClip::NUM_CHANNELS * NumBones, 0);
+
+		// the padded Lanes decode to Identity
+		for (UINT k = 0; k < 3; k++)
+		{
+			m_RotA[k].assign(m_NumPadded, (UINT)AnimationClip::ROTATION_ZERO);
+			m_RotB[k].assign(m_NumPadded, (UINT)AnimationClip::ROTATION_ZERO);
+		}
+
+		m_RotA[3].assign(m_NumPadded, 3);
+		m_RotB[3].assign(m_NumPadded, 3);
+
+		for (UINT v = 0; v < 2; v++)
+		{
+			for (UINT Axis = 0; Axis < 3; Axis++)
+			{
+				m_VecA[v][Axis].assign(m_NumPadded, 0);
+				m_VecB[v][Axis].assign(m_NumPadded, 0);
+			}
+		}
+
+		for (UINT ch = 0; ch < AnimationClip::NUM_CHANNELS; ch++)
+			m_Alpha[ch].assign(m_NumPadded, 0.0f);
+
+		m_Rotations.Resize(NumBones);
+
+		for (UINT Axis = 0; Axis < 3; Axis++)
+		{
+			m_Translations[Axis].assign(m_NumPadded, 0.0f);
+			m_Scales[Axis].assign(m_NumPadded, 1.0f);
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV AnimationSampler::Reset() noexcept
+	{
+		std::fill(m_Cursors.begin(), m_Cursors.end(), 0);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV AnimationSampler::FindKey(const AnimationClip::Channel theChannel, const UINT Bone, const float Frame) noexcept
+	{
+		const AnimationClip::Track& theTrack = m_pClip->GetTrack(theChannel, Bone);
+
+		if (theTrack.NumKeys == 1)
+			return 0;
+
+		const uint16_t* pTimes = m_pClip->GetKeyTimes(theChannel) + theTrack.FirstKey;
+		UINT& Cursor = m_Cursors[theChannel * m_pClip->GetNumBones() + Bone];
+		UINT k = Cursor;
+
+		// jump back : binary Search
+		if (k + 1 >= theTrack.NumKeys || (float)pTimes[k] > Frame)
+		{
+			const uint16_t* pNext = std::upper_bound(pTimes, pTimes + theTrack.NumKeys, Frame, [](const float f, const uint16_t t) { return f < (float)t; });
+
+			k = (pNext > pTimes) ? (UINT)(pNext - pTimes) - 1 : 0;
+			k = XMMin(k, theTrack.NumKeys - 2);
+		}
+
+		// playing forward : the next Keys
+		while (k + 2 < theTrack.NumKeys && (float)pTimes[k + 1] <= Frame)
+			k++;
+
+		Cursor = k;
+
+		return k;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV AnimationSampler::Gather(const float Time) noexcept
+	{
+		assert(m_pClip != nullptr);
+
+		const AnimationClip& Clip = *m_pClip;
+		const UINT NumBones = Clip.GetNumBones();
+		const float Frame = XMMax(0.0f, XMMin(Time * Clip.GetSampleRate(), (float)(Clip.GetNumFrames() - 1)));
+
+		// Keys around the Frame and the Blend-Factor between them
+		auto Locate = [&](const AnimationClip::Channel theChannel, const UINT Bone, const PackedKey*& pA, const PackedKey*& pB)
+		{
+			const AnimationClip::Track& theTrack = Clip.GetTrack(theChannel, Bone);
+			const uint16_t* pTimes = Clip.GetKeyTimes(theChannel) + theTrack.FirstKey;
+			const PackedKey* pKeys = Clip.GetKeys(theChannel) + theTrack.FirstKey;
+
+			const UINT a = FindKey(theChannel, Bone, Frame);
+			const UINT b = XMMin(a + 1, theTrack.NumKeys - 1);
+
+			pA = &pKeys[a];
+			pB = &pKeys[b];
+
+			if (b == a)
+				return 0.0f;
+
+			return XMMax(0.0f, XMMin((Frame - (float)pTimes[a]) / (float)(pTimes[b] - pTimes[a]), 1.0f));
+		};
+
+		const PackedKey* pA;
+		const PackedKey* pB;
+
+		for (UINT Bone = 0; Bone < NumBones; Bone++)
+		{
+			m_Alpha[AnimationClip::CHANNEL_ROTATION][Bone] = Locate(AnimationClip::CHANNEL_ROTATION, Bone, pA, pB);
+
+			for (UINT k = 0; k < 3; k++)
+			{
+				m_RotA[k][Bone] = pA->c[k] & 0x7FFF;
+				m_RotB[k][Bone] = pB->c[k] & 0x7FFF;
+			}
+
+			m_RotA[3][Bone] = (pA->c[0] >> 15) | ((pA->c[1] >> 15) << 1);
+			m_RotB[3][Bone] = (pB->c[0] >> 15) | ((pB->c[1] >> 15) << 1);
+
+			for (UINT v = 0; v < 2; v++)
+			{
+				const AnimationClip::Channel theChannel = (AnimationClip::Channel)(AnimationClip::CHANNEL_TRANSLATION + v);
+
+				m_Alpha[theChannel][Bone] = Locate(theChannel, Bone, pA, pB);
+
+				for (UINT Axis = 0; Axis < 3; Axis++)
+				{
+					m_VecA[v][Axis][Bone] = pA->c[Axis];
+					m_VecB[v][Axis][Bone] = pB->c[Axis];
+				}
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	// "smallest three" : the largest Component is rebuilt from the Unit-Length
+	// and moved to its Place with Select-Masks of the Index
+	//------------------------------------------------------------------------------
+	XM_INLINE const AnimationSampler::PoseLanes XM_CALLCONV AnimationSampler::DecodeLanes(const UINT i) const noexcept
+	{
+		const XMVECTOR One = XMVectorSplatOne();
+		const XMVECTOR RotZero = XMVectorReplicate((float)AnimationClip::ROTATION_ZERO);
+		const XMVECTOR RotScale = XMVectorReplicate(AnimationClip::ROTATION_SCALE);
+
+		auto DecodeQuat = [&](const UIntStream* pStreams, XMVECTOR& x, XMVECTOR& y, XMVECTOR& z, XMVECTOR& w)
+		{
+			const XMVECTOR a0 = XMVectorMultiply(XMVectorSubtract(XMConvertVectorUIntToFloat(XMLoadInt4(&pStreams[0][i]), 0), RotZero), RotScale);
+			const XMVECTOR a1 = XMVectorMultiply(XMVectorSubtract(XMConvertVectorUIntToFloat(XMLoadInt4(&pStreams[1][i]), 0), RotZero), RotScale);
+			const XMVECTOR a2 = XMVectorMultiply(XMVectorSubtract(XMConvertVectorUIntToFloat(XMLoadInt4(&pStreams[2][i]), 0), RotZero), RotScale);
+
+			const XMVECTOR LenSq = XMVectorMultiplyAdd(a0, a0, XMVectorMultiplyAdd(a1, a1, XMVectorMultiply(a2, a2)));
+			const XMVECTOR d = XMVectorSqrt(XMVectorMax(XMVectorSubtract(One, LenSq), XMVectorZero()));
+
+			const XMVECTOR Index = XMLoadInt4(&pStreams[3][i]);
+			const XMVECTOR m0 = XMVectorEqualInt(Index, XMVectorZero());
+			const XMVECTOR m1 = XMVectorEqualInt(Index, XMVectorReplicateInt(1));
+			const XMVECTOR m2 = XMVectorEqualInt(Index, XMVectorReplicateInt(2));
+			const XMVECTOR m3 = XMVectorEqualInt(Index, XMVectorReplicateInt(3));
+
+			x = XMVectorSelect(a0, d, m0);
+			y = XMVectorSelect(XMVectorSelect(a1, d, m1), a0, m0);
+			z = XMVectorSelect(XMVectorSelect(a2, d, m2), a1, XMVectorOrInt(m0, m1));
+			w = XMVectorSelect(a2, d, m3);
+		};
+
+		PoseLanes Pose;
+
+		// Rotation : normalized Lerp on the shorter Arc
+		{
+			XMVECTOR ax, ay, az, aw, bx, by, bz, bw;
+
+			DecodeQuat(m_RotA, ax, ay, az, aw);
+			DecodeQuat(m_RotB, bx, by, bz, bw);
+
+			const XMVECTOR Dot = XMVectorMultiplyAdd(ax, bx, XMVectorMultiplyAdd(ay, by, XMVectorMultiplyAdd(az, bz, XMVectorMultiply(aw, bw))));
+			const XMVECTOR Alpha = XMVectorXorInt(XMLoadFloat4((const XMFLOAT4*)&m_Alpha[AnimationClip::CHANNEL_ROTATION][i]), XMVectorAndInt(Dot, XMVectorSplatSignMask()));
+			const XMVECTOR Beta = XMVectorSubtract(One, XMVectorAbs(Alpha));
+
+			const XMVECTOR x = XMVectorMultiplyAdd(bx, Alpha, XMVectorMultiply(ax, Beta));
+			const XMVECTOR y = XMVectorMultiplyAdd(by, Alpha, XMVectorMultiply(ay, Beta));
+			const XMVECTOR z = XMVectorMultiplyAdd(bz, Alpha, XMVectorMultiply(az, Beta));
+			const XMVECTOR w = XMVectorMultiplyAdd(bw, Alpha, XMVectorMultiply(aw, Beta));
+
+			const XMVECTOR InvLen = XMVectorReciprocalSqrt(XMVectorMultiplyAdd(x, x, XMVectorMultiplyAdd(y, y, XMVectorMultiplyAdd(z, z, XMVectorMultiply(w, w)))));
+
+			Pose.qx = XMVectorMultiply(x, InvLen);
+			Pose.qy = XMVectorMultiply(y, InvLen);
+			Pose.qz = XMVectorMultiply(z, InvLen);
+			Pose.qw = XMVectorMultiply(w, InvLen);
+		}
+
+		// Translation and Scale : Lerp in the Range of the Track
+		XMVECTOR Vectors[2][3];
+
+		for (UINT v = 0; v < 2; v++)
+		{
+			const AnimationClip::Channel theChannel = (AnimationClip::Channel)(AnimationClip::CHANNEL_TRANSLATION + v);
+			const XMVECTOR Alpha = XMLoadFloat4((const XMFLOAT4*)&m_Alpha[theChannel][i]);
+
+			for (UINT Axis = 0; Axis < 3; Axis++)
+			{
+				const XMVECTOR Min = XMLoadFloat4((const XMFLOAT4*)(m_pClip->GetRangeMin(theChannel, Axis) + i));
+				const XMVECTOR Scale = XMVectorScale(XMLoadFloat4((const XMFLOAT4*)(m_pClip->GetRangeExtent(theChannel, Axis) + i)), 1.0f / 65535.0f);
+
+				const XMVECTOR a = XMVectorMultiplyAdd(XMConvertVectorUIntToFloat(XMLoadInt4(&m_VecA[v][Axis][i]), 0), Scale, Min);
+				const XMVECTOR b = XMVectorMultiplyAdd(XMConvertVectorUIntToFloat(XMLoadInt4(&m_VecB[v][Axis][i]), 0), Scale, Min);
+
+				Vectors[v][Axis] = XMVectorMultiplyAdd(XMVectorSubtract(b, a), Alpha, a);
+			}
+		}
+
+		Pose.tx = Vectors[0][0];
+		Pose.ty = Vectors[0][1];
+		Pose.tz = Vectors[0][2];
+		Pose.sx = Vectors[1][0];
+		Pose.sy = Vectors[1][1];
+		Pose.sz = Vectors[1][2];
+
+		return Pose;
+	}
+
+	//------------------------------------------------------------------------------
+	// Scale * Rotation * Translation (like XMMatrixAffineTransformation)
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV AnimationSampler::ComposeElements(const PoseLanes& Pose, XMVECTOR Elements[4][3]) noexcept
+	{
+		const XMVECTOR One = XMVectorSplatOne();
+
+		const XMVECTOR x2 = XMVectorAdd(Pose.qx, Pose.qx);
+		const XMVECTOR y2 = XMVectorAdd(Pose.qy, Pose.qy);
+		const XMVECTOR z2 = XMVectorAdd(Pose.qz, Pose.qz);
+
+		const XMVECTOR xx = XMVectorMultiply(Pose.qx, x2), yy = XMVectorMultiply(Pose.qy, y2), zz = XMVectorMultiply(Pose.qz, z2);
+		const XMVECTOR xy = XMVectorMultiply(Pose.qx, y2), xz = XMVectorMultiply(Pose.qx, z2), yz = XMVectorMultiply(Pose.qy, z2);
+		const XMVECTOR wx = XMVectorMultiply(Pose.qw, x2), wy = XMVectorMultiply(Pose.qw, y2), wz = XMVectorMultiply(Pose.qw, z2);
+
+		Elements[0][0] = XMVectorMultiply(XMVectorSubtract(XMVectorSubtract(One, yy), zz), Pose.sx);
+		Elements[0][1] = XMVectorMultiply(XMVectorAdd(xy, wz), Pose.sx);
+		Elements[0][2] = XMVectorMultiply(XMVectorSubtract(xz, wy), Pose.sx);
+
+		Elements[1][0] = XMVectorMultiply(XMVectorSubtract(xy, wz), Pose.sy);
+		Elements[1][1] = XMVectorMultiply(XMVectorSubtract(XMVectorSubtract(One, xx), zz), Pose.sy);
+		Elements[1][2] = XMVectorMultiply(XMVectorAdd(yz, wx), Pose.sy);
+
+		Elements[2][0] = XMVectorMultiply(XMVectorAdd(xz, wy), Pose.sz);
+		Elements[2][1] = XMVectorMultiply(XMVectorSubtract(yz, wx), Pose.sz);
+		Elements[2][2] = XMVectorMultiply(XMVectorSubtract(XMVectorSubtract(One, xx), yy), Pose.sz);
+
+		Elements[3][0] = Pose.tx;
+		Elements[3][1] = Pose.ty;
+		Elements[3][2] = Pose.tz;
+	}
+
+	//------------------------------------------------------------------------------
+	// Sampling
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV AnimationSampler::Sample(const float Time)
+	{
+		Gather(Time);
+
+		float* pQx = m_Rotations.GetX();
+		float* pQy = m_Rotations.GetY();
+		float* pQz = m_Rotations.GetZ();
+		float* pQw = m_Rotations.GetW();
+
+		for (UINT i = 0; i < m_NumPadded; i += 4)
+		{
+			const PoseLanes Pose = DecodeLanes(i);
+
+			XMStoreFloat4((XMFLOAT4*)(pQx + i), Pose.qx);
+			XMStoreFloat4((XMFLOAT4*)(pQy + i), Pose.qy);
+			XMStoreFloat4((XMFLOAT4*)(pQz + i), Pose.qz);
+			XMStoreFloat4((XMFLOAT4*)(pQw + i), Pose.qw);
+
+			XMStoreFloat4((XMFLOAT4*)&m_Translations[0][i], Pose.tx);
+			XMStoreFloat4((XMFLOAT4*)&m_Translations[1][i], Pose.ty);
+			XMStoreFloat4((XMFLOAT4*)&m_Translations[2][i], Pose.tz);
+
+			XMStoreFloat4((XMFLOAT4*)&m_Scales[0][i], Pose.sx);
+			XMStoreFloat4((XMFLOAT4*)&m_Scales[1][i], Pose.sy);
+			XMStoreFloat4((XMFLOAT4*)&m_Scales[2][i], Pose.sz);
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV AnimationSampler::Sample(const float Time, Matrix* pMatrices)
+	{
+		assert(pMatrices != nullptr);
+
+		Gather(Time);
+
+		const UINT NumBones = m_pClip->GetNumBones();
+
+		for (UINT i = 0; i < NumBones; i += 4)
+		{
+			XMVECTOR Elements[4][3];
+
+			ComposeElements(DecodeLanes(i), Elements);
+
+			// Row r of the 4 Matrices
+			XMMATRIX Rows[4];
+
+			for (UINT r = 0; r < 4; r++)
+			{
+				Rows[r].r[0] = Elements[r][0];
+				Rows[r].r[1] = Elements[r][1];
+				Rows[r].r[2] = Elements[r][2];
+				Rows[r].r[3] = (r == 3) ? XMVectorSplatOne() : XMVectorZero();
+
+				Rows[r] = XMMatrixTranspose(Rows[r]);
+			}
+
+			const UINT NumLanes = XMMin(NumBones - i, 4u);
+
+			for (UINT l = 0; l < NumLanes; l++)
+			{
+				XMMATRIX M;
+
+				M.r[0] = Rows[0].r[l];
+				M.r[1] = Rows[1].r[l];
+				M.r[2] = Rows[2].r[l];
+				M.r[3] = Rows[3].r[l];
+
+				pMatrices[i + l] = M;
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV AnimationSampler::Sample(const float Time, Affine3x4* pPalette)
+	{
+		assert(pPalette != nullptr);
+
+		Gather(Time);
+
+		const UINT NumBones = m_pClip->GetNumBones();
+
+		for (UINT i = 0; i < NumBones; i += 4)
+		{
+			XMVECTOR Elements[4][3];
+
+			ComposeElements(DecodeLanes(i), Elements);
+
+			const UINT NumLanes = XMMin(NumBones - i, 4u);
+
+			// the Rows of the Palette are the Columns of the Matrices
+			for (UINT c = 0; c < 3; c++)
+			{
+				XMMATRIX Column;
+
+				Column.r[0] = Elements[0][c];
+				Column.r[1] = Elements[1][c];
+				Column.r[2] = Elements[2][c];
+				Column.r[3] = Elements[3][c];
+
+				Column = XMMatrixTranspose(Column);
+
+				for (UINT l = 0; l < NumLanes; l++)
+					XMStoreFloat4(&pPalette[i + l].Row[c], Column.r[l]);
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV AnimationSampler::LocalToModel(const Matrix* pLocal, const int* pParents, const UINT NumBones, Matrix* pModel) noexcept
+	{
+		assert(pLocal != nullptr && pParents != nullptr && pModel != nullptr);
+
+		for (UINT Bone = 0; Bone < NumBones; Bone++)
+		{
+			const int Parent = pParents[Bone];
+
+			assert(Parent < (int)Bone);
+
+			if (Parent < 0)
+				pModel[Bone] = pLocal[Bone];
+			else
+				pModel[Bone] = pLocal[Bone] * pModel[Parent];
+		}
+	}
+
+}// end of Namespace TurboMath
@@ -0,0 +1,149 @@
+// -------------------------------------------------------------------
+// File			:	BSPTree
+//
+// Project		:	TurboMath
+//
+// Description	:	Binary-Space-Partitioning-Tree over Polygons
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_BSPTREE_H_
+#define _TURBOMATH_BSPTREE_H_
+
+#include <vector>
+
+namespace TurboMath
+{
+
+	//-----------------------------------------------------------------------------
+	// Node of the BSP-Tree
+	// Front / Back are Node-Indices or EMPTY_LEAF / SOLID_LEAF, the Polygons
+	// lying in the Split-Plane are [FirstPolygon, FirstPolygon + NumPolygons)
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) struct BSPNode
+	{
+		XMFLOAT4	SplitPlane;
+		UINT		Front;
+		UINT		Back;
+		UINT		FirstPolygon;
+		UINT		NumPolygons;
+	};
+
+	//-----------------------------------------------------------------------------
+	// Node-based Solid-Leaf BSP-Tree. The Input is a closed Polygon-Soup with
+	// the Normals pointing into the empty Space (e.g. the Walls of a Level) :
+	// in front of a Plane without Child is empty Space, behind it is solid.
+	//
+	// Build() is meant for the offline Preprocessing : every Node takes the
+	// Plane of one of its Polygons, chosen by the classic Heuristic
+	// |Front - Back| + SplitWeight * Splits. Only MaxCandidates evenly sampled
+	// Polygons are tested per Node (scored in parallel), so large Levels still
+	// build in reasonable Time. The Nodes and Polygons are stored in flat Arrays.
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class BSPTree
+	{
+	public:
+
+		typedef std::vector<BSPNode, AAllocator<BSPNode> >	NodeArray;
+		typedef std::vector<Polygon, AAllocator<Polygon> >	PolygonArray;
+
+		/// Child-Index for empty Space
+		static constexpr UINT EMPTY_LEAF = 0xFFFFFFFF;
+
+		/// Child-Index for solid Space
+		static constexpr UINT SOLID_LEAF = 0xFFFFFFFE;
+
+		BSPTree() noexcept;
+		~BSPTree() noexcept;
+
+		/// remove all Nodes and Polygons
+		void			XM_CALLCONV Clear() noexcept;
+
+		/// is the Tree empty ?
+		const bool		XM_CALLCONV IsEmpty() const noexcept;
+
+		//-----------------------------------------------------------------------------
+		// Build
+		//-----------------------------------------------------------------------------
+
+		/// build the Tree from a Polygon-Soup (Polygons with less than 3 Points are ignored)
+		void			XM_CALLCONV Build(const Polygon* pPolygons, const UINT Count, const UINT MaxCandidates = 32, const float SplitWeight = 8.0f);
+
+		//-----------------------------------------------------------------------------
+		// Access
+		//-----------------------------------------------------------------------------
+
+		/// get Number of Nodes
+		const UINT		XM_CALLCONV GetNumNodes() const noexcept			{ return (UINT)m_Nodes.size(); }
+
+		/// get Number of Polygons (after the Splits)
+		const UINT		XM_CALLCONV GetNumPolygons() const noexcept			{ return (UINT)m_Polygons.size(); }
+
+		/// get Number of Polygons split during the Build
+		const UINT		XM_CALLCONV GetNumSplits() const noexcept			{ return m_NumSplits; }
+
+		/// get the Node-Array (Root = Node 0)
+		const BSPNode*	XM_CALLCONV GetNodes() const noexcept				{ return m_Nodes.data(); }
+
+		/// get a Polygon
+		const Polygon&	XM_CALLCONV GetPolygon(const UINT Index) const noexcept	{ return m_Polygons[Index]; }
+
+		/// is the Child-Index a Leaf ?
+		static const bool XM_CALLCONV IsLeaf(const UINT Child) noexcept	{ return Child >= SOLID_LEAF; }
+
+		//-----------------------------------------------------------------------------
+		// Queries
+		//-----------------------------------------------------------------------------
+
+		/// is the Point inside the solid Space ?
+		const bool		XM_CALLCONV IsPointSolid(const Vector4& Point) const noexcept;
+
+		/// first Hit of the Ray with the solid Space, pNormal gets the Normal of the hit Plane
+		const bool		XM_CALLCONV IntersectRay(const Ray& theRay, float* pDist, Vector4* pNormal = nullptr, const float MaxDist = FLT_MAX) const;
+
+		/// visit all Polygons sorted front to back as seen from Eye, Func(const Polygon&)
+		template <class VisitFunc>
+		void			XM_CALLCONV TraverseFrontToBack(const Vector4& Eye, const VisitFunc& Func) const;
+
+		/// visit all Polygons sorted front to back as seen from the Camera
+		template <class VisitFunc>
+		void			XM_CALLCONV TraverseFrontToBack(const Camera& theCamera, const VisitFunc& Func) const;
+
+	protected:
+
+		/// Score of a Split-Plane for the Polygons of the List (lower is better)
+		const float		XM_CALLCONV ScorePlane(const Plane& SplitPlane, const std::vector<UINT>& List, const float SplitWeight) const noexcept;
+
+		/// build a Node for the Polygons of the List, returns the Node-Index
+		const UINT		XM_CALLCONV BuildNode(std::vector<UINT>& List, const UINT MaxCandidates, const float SplitWeight);
+
+		/// recursive Part of TraverseFrontToBack
+		template <class VisitFunc>
+		void			XM_CALLCONV TraverseNode(const UINT Index, FXMVECTOR Eye, const VisitFunc& Func) const;
+
+		NodeArray		m_Nodes;			// Nodes, Root = 0
+		PolygonArray	m_Polygons;			// Polygons of the Nodes
+		PolygonArray	m_BuildPolygons;	// Polygons while building (Input + Fragments)
+		std::vector<Plane, AAllocator<Plane> > m_BuildPlanes;	// Plane of every Build-Polygon
+		UINT			m_NumSplits;		// Number of split Polygons
+	};
+
+}; // end of namespace
+
+#endif
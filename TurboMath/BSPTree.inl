@@ -0,0 +1,357 @@
+// -------------------------------------------------------------------
+// File			:	BSPTree
+//
+// Project		:	TurboMath
+//
+// Description	:	Binary-Space-Partitioning-Tree over Polygons
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+namespace TurboMath
+{
+	//------------------------------------------------------------------------------
+	XM_INLINE BSPTree::BSPTree() noexcept
+		: m_NumSplits(0)
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE BSPTree::~BSPTree() noexcept
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV BSPTree::Clear() noexcept
+	{
+		m_Nodes.clear();
+		m_Polygons.clear();
+		m_BuildPolygons.clear();
+		m_BuildPlanes.clear();
+		m_NumSplits = 0;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV BSPTree::IsEmpty() const noexcept
+	{
+		return m_Nodes.empty();
+	}
+
+	//------------------------------------------------------------------------------
+	// Build
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV BSPTree::Build(const Polygon* pPolygons, const UINT Count, const UINT MaxCandidates, const float SplitWeight)
+	{
+		assert(pPolygons != nullptr || Count == 0);
+
+		Clear();
+
+		m_BuildPolygons.reserve(Count * 2);
+		m_BuildPlanes.reserve(Count * 2);
+
+		std::vector<UINT> List;
+		List.reserve(Count);
+
+		for (UINT i = 0; i < Count; i++)
+		{
+			if (!pPolygons[i].IsValid())
+				continue;
+
+			List.push_back((UINT)m_BuildPolygons.size());
+			m_BuildPolygons.push_back(pPolygons[i]);
+			m_BuildPlanes.push_back(pPolygons[i].GetPlane());
+		}
+
+		if (!List.empty())
+		{
+			m_Polygons.reserve(List.size());
+			BuildNode(List, XMMax(MaxCandidates, 1u), SplitWeight);
+		}
+
+		// the Fragments are only needed while building
+		PolygonArray().swap(m_BuildPolygons);
+		std::vector<Plane, AAllocator<Plane> >().swap(m_BuildPlanes);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const float XM_CALLCONV BSPTree::ScorePlane(const Plane& SplitPlane, const std::vector<UINT>& List, const float SplitWeight) const noexcept
+	{
+		int NumFront = 0, NumBack = 0, NumSplits = 0;
+
+		for (const UINT Index : List)
+		{
+			switch (m_BuildPolygons[Index].Classify(SplitPlane))
+			{
+				case FRONT:		NumFront++;				break;
+				case BACK:		NumBack++;				break;
+				case CLIPPED:	NumFront++; NumBack++; NumSplits++; break;
+				default:								break;
+			}
+		}
+
+		return fabsf((float)(NumFront - NumBack)) + SplitWeight * (float)NumSplits;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV BSPTree::BuildNode(std::vector<UINT>& List, const UINT MaxCandidates, const float SplitWeight)
+	{
+		// score evenly sampled Candidates
+		const UINT NumCandidates = XMMin((UINT)List.size(), MaxCandidates);
+		const UINT Stride = (UINT)List.size() / NumCandidates;
+
+		std::vector<float> Scores(NumCandidates);
+
+		auto ScoreCandidates = [&](const UINT Begin, const UINT End)
+		{
+			for (UINT c = Begin; c < End; c++)
+				Scores[c] = ScorePlane(m_BuildPlanes[List[c * Stride]], List, SplitWeight);
+		};
+
+		if (List.size() * NumCandidates >= 65536)
+			ParallelFor(NumCandidates, 1, ScoreCandidates);
+		else
+			ScoreCandidates(0, NumCandidates);
+
+		UINT Best = 0;
+		for (UINT c = 1; c < NumCandidates; c++)
+		{
+			if (Scores[c] < Scores[Best])
+				Best = c;
+		}
+
+		const Plane SplitPlane = m_BuildPlanes[List[Best * Stride]];
+
+		// create the Node
+		const UINT NodeIndex = (UINT)m_Nodes.size();
+
+		BSPNode Node;
+		XMStoreFloat4(&Node.SplitPlane, SplitPlane.Get());
+		Node.Front = EMPTY_LEAF;
+		Node.Back = SOLID_LEAF;
+		Node.FirstPolygon = (UINT)m_Polygons.size();
+		Node.NumPolygons = 0;
+
+		m_Nodes.push_back(Node);
+
+		// distribute the Polygons
+		std::vector<UINT> FrontList, BackList;
+
+		for (const UINT Index : List)
+		{
+			switch (m_BuildPolygons[Index].Classify(SplitPlane))
+			{
+				case FRONT:
+					FrontList.push_back(Index);
+					break;
+
+				case BACK:
+					BackList.push_back(Index);
+					break;
+
+				case CLIPPED:
+				{
+					Polygon FrontPart, BackPart;
+					m_BuildPolygons[Index].Split(SplitPlane, &FrontPart, &BackPart);
+					m_NumSplits++;
+
+					const Plane PolyPlane = m_BuildPlanes[Index];
+
+					if (FrontPart.IsValid())
+					{
+						FrontList.push_back((UINT)m_BuildPolygons.size());
+						m_BuildPolygons.push_back(FrontPart);
+						m_BuildPlanes.push_back(PolyPlane);
+					}
+
+					if (BackPart.IsValid())
+					{
+						BackList.push_back((UINT)m_BuildPolygons.size());
+						m_BuildPolygons.push_back(BackPart);
+						m_BuildPlanes.push_back(PolyPlane);
+					}
+					break;
+				}
+
+				default:
+					// lies in the Split-Plane
+					m_Polygons.push_back(m_BuildPolygons[Index]);
+					break;
+			}
+		}
+
+		m_Nodes[NodeIndex].NumPolygons = (UINT)m_Polygons.size() - m_Nodes[NodeIndex].FirstPolygon;
+
+		// free the List before going down
+		std::vector<UINT>().swap(List);
+
+		if (!FrontList.empty())
+		{
+			const UINT Front = BuildNode(FrontList, MaxCandidates, SplitWeight);
+			m_Nodes[NodeIndex].Front = Front;
+		}
+
+		if (!BackList.empty())
+		{
+			const UINT Back = BuildNode(BackList, MaxCandidates, SplitWeight);
+			m_Nodes[NodeIndex].Back = Back;
+		}
+
+		return NodeIndex;
+	}
+
+	//------------------------------------------------------------------------------
+	// Queries
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV BSPTree::IsPointSolid(const Vector4& Point) const noexcept
+	{
+		if (m_Nodes.empty())
+			return false;
+
+		UINT Index = 0;
+
+		while (!IsLeaf(Index))
+		{
+			const BSPNode& Node = m_Nodes[Index];
+			const float d = XMVectorGetX(XMPlaneDotCoord(XMLoadFloat4(&Node.SplitPlane), Point));
+
+			Index = (d >= 0.0f) ? Node.Front : Node.Back;
+		}
+
+		return Index == SOLID_LEAF;
+	}
+
+	//------------------------------------------------------------------------------
+	// walks the Ray-Segment front to back through the Tree, splitting it at every
+	// Plane it crosses. The first Segment reaching a solid Leaf is the Hit.
+	XM_INLINE const bool XM_CALLCONV BSPTree::IntersectRay(const Ray& theRay, float* pDist, Vector4* pNormal, const float MaxDist) const
+	{
+		assert(pDist != nullptr);
+
+		if (m_Nodes.empty())
+			return false;
+
+		struct Segment
+		{
+			UINT	Node;
+			UINT	HitNode;	// Node whose Plane starts the Segment
+			float	tMin;
+			float	tMax;
+		};
+
+		const XMVECTOR Org = theRay.GetStartPoint();
+		const XMVECTOR Dir = theRay.GetDirection();
+
+		std::vector<Segment> Stack;
+		Stack.reserve(64);
+
+		Segment Cur = { 0, EMPTY_LEAF, 0.0f, MaxDist };
+
+		for (;;)
+		{
+			if (Cur.Node == SOLID_LEAF)
+			{
+				*pDist = Cur.tMin;
+
+				if (pNormal)
+				{
+					if (Cur.HitNode == EMPTY_LEAF)
+						*pNormal = XMVectorZero();	// Ray starts inside the solid Space
+					else
+						*pNormal = XMVectorAndInt(XMLoadFloat4(&m_Nodes[Cur.HitNode].SplitPlane), g_XMMask3);
+				}
+				return true;
+			}
+
+			if (Cur.Node == EMPTY_LEAF)
+			{
+				if (Stack.empty())
+					return false;
+
+				Cur = Stack.back();
+				Stack.pop_back();
+				continue;
+			}
+
+			const BSPNode& Node = m_Nodes[Cur.Node];
+			const XMVECTOR P = XMLoadFloat4(&Node.SplitPlane);
+
+			const float dStart = XMVectorGetX(XMPlaneDotCoord(P, Org));
+			const float Denom = XMVectorGetX(XMVector3Dot(P, Dir));
+
+			const float dMin = dStart + Cur.tMin * Denom;
+			const float dMax = dStart + Cur.tMax * Denom;
+
+			if (dMin >= 0.0f && dMax >= 0.0f)
+			{
+				Cur.Node = Node.Front;
+				continue;
+			}
+
+			if (dMin < 0.0f && dMax < 0.0f)
+			{
+				Cur.Node = Node.Back;
+				continue;
+			}
+
+			// the Segment crosses the Plane, near Side first
+			const float t = -dStart / Denom;
+
+			const UINT Near = (dMin >= 0.0f) ? Node.Front : Node.Back;
+			const UINT Far = (dMin >= 0.0f) ? Node.Back : Node.Front;
+
+			const Segment FarSegment = { Far, Cur.Node, t, Cur.tMax };
+			Stack.push_back(FarSegment);
+
+			Cur.Node = Near;
+			Cur.tMax = t;
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	template <class VisitFunc>
+	XM_INLINE void XM_CALLCONV BSPTree::TraverseFrontToBack(const Vector4& Eye, const VisitFunc& Func) const
+	{
+		if (!m_Nodes.empty())
+			TraverseNode(0, Eye, Func);
+	}
+
+	//------------------------------------------------------------------------------
+	template <class VisitFunc>
+	XM_INLINE void XM_CALLCONV BSPTree::TraverseFrontToBack(const Camera& theCamera, const VisitFunc& Func) const
+	{
+		TraverseFrontToBack(theCamera.GetPosition(), Func);
+	}
+
+	//------------------------------------------------------------------------------
+	template <class VisitFunc>
+	void XM_CALLCONV BSPTree::TraverseNode(const UINT Index, FXMVECTOR Eye, const VisitFunc& Func) const
+	{
+		const BSPNode& Node = m_Nodes[Index];
+		const float d = XMVectorGetX(XMPlaneDotCoord(XMLoadFloat4(&Node.SplitPlane), Eye));
+
+		// the Side of the Eye first, then the Plane, then the other Side
+		const UINT Near = (d >= 0.0f) ? Node.Front : Node.Back;
+		const UINT Far = (d >= 0.0f) ? Node.Back : Node.Front;
+
+		if (!IsLeaf(Near))
+			TraverseNode(Near, Eye, Func);
+
+		for (UINT i = 0; i < Node.NumPolygons; i++)
+			Func(m_Polygons[Node.FirstPolygon + i]);
+
+		if (!IsLeaf(Far))
+			TraverseNode(Far, Eye, Func);
+	}
+
+}// end of Namespace TurboMath
@@ -0,0 +1,262 @@
+// -------------------------------------------------------------------
+// File			:	BVH
+//
+// Project		:	TurboMath
+//
+// Description	:	Bounding-Volume-Hierarchy (flat AABB-Tree)
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_BVH_H_
+#define _TURBOMATH_BVH_H_
+
+#include <vector>
+
+namespace TurboMath
+{
+
+	//-----------------------------------------------------------------------------
+	// Node of the BVH (32 Byte, 2 Nodes per Cache-Line)
+	// Inner-Node	: Child0 / Child1 are the Indices of the Child-Nodes
+	// Leaf			: Child0 is the first Entry in the Primitive-Index-List,
+	//				  Child1 is the Number of Primitives | LEAF_FLAG
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) struct BVHNode
+	{
+		XMFLOAT3	BoxMin;
+		UINT		Child0;
+		XMFLOAT3	BoxMax;
+		UINT		Child1;
+	};
+
+	//-----------------------------------------------------------------------------
+	// Bounding-Volume-Hierarchy over a Set of AABBs in a flat Node-Array
+	// (Root = Node 0). The Leafs reference the Primitives by their Index into
+	// the Array of AABBs used for the Build.
+	//
+	// BuildLinear() builds a Linear-BVH (Karras : "Maximizing Parallelism in the
+	// Construction of BVHs, Octrees, and k-d Trees", HPG 2012) : the Primitives
+	// are sorted by the Morton-Code of their Center and the Hierarchy is emitted
+	// in O(n), every Step runs parallel. Fast enough for a Rebuild every Frame.
+	//
+	// For deformed Geometry Refit() updates the Boxes without a Rebuild and
+	// Optimize() limits the Degeneration by Tree-Rotations. GetQualityRatio()
+	// compares the SAH-Cost with the Cost after the Build, so a full Rebuild
+	// is only needed when NeedsRebuild() says so.
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class BVH
+	{
+	public:
+
+		typedef std::vector<BVHNode, AAllocator<BVHNode> >	NodeArray;
+
+		/// Flag in Child1 for Leaf-Nodes
+		static constexpr UINT LEAF_FLAG = 0x80000000;
+
+		/// Index for "no Node"
+		static constexpr UINT INVALID_NODE = 0xFFFFFFFF;
+
+		/// Entries of the Traversal-Stack kept on the Stack (deeper Trees spill to the Heap)
+		static constexpr UINT MAX_STACK = 128;
+
+		/// SAH-Costs for the Quality-Metric
+		static constexpr float SAH_TRAVERSAL_COST = 1.0f;
+		static constexpr float SAH_INTERSECT_COST = 1.0f;
+
+		BVH() noexcept;
+		~BVH() noexcept;
+
+		/// remove all Nodes
+		void			XM_CALLCONV Clear() noexcept;
+
+		/// is the Tree empty ?
+		const bool		XM_CALLCONV IsEmpty() const noexcept;
+
+		//-----------------------------------------------------------------------------
+		// Build
+		//-----------------------------------------------------------------------------
+
+		/// build a Linear-BVH from 30-Bit (or 63-Bit) Morton-Codes of the Box-Centers
+		void			XM_CALLCONV BuildLinear(const AABB* pBoxes, const UINT Count, const bool b64BitCodes = false);
+
+		/// build a Linear-BVH over the Triangles of a Mesh
+		void			XM_CALLCONV BuildLinear(const TriangleMesh& Mesh, const bool b64BitCodes = false);
+
+		//-----------------------------------------------------------------------------
+		// Update (for animated / deformed Geometry)
+		//-----------------------------------------------------------------------------
+
+		/// refit all Boxes bottom-up to new Primitive-Bounds (same Primitives as for the Build)
+		void			XM_CALLCONV Refit(const AABB* pBoxes);
+
+		/// refit to the deformed Triangles of a Mesh
+		void			XM_CALLCONV Refit(const TriangleMesh& Mesh);
+
+		/// improve the Tree by local Rotations (Kensler 2008), returns the Number of Rotations
+		const UINT		XM_CALLCONV Optimize(const UINT NumPasses = 1);
+
+		//-----------------------------------------------------------------------------
+		// Quality
+		//-----------------------------------------------------------------------------
+
+		/// SAH-Cost of the Tree (relative to the Surface of the Root)
+		const float		XM_CALLCONV ComputeSAHCost() const;
+
+		/// SAH-Cost now / SAH-Cost after the last Build (1.0 = as good as new)
+		const float		XM_CALLCONV GetQualityRatio() const;
+
+		/// has the Tree degenerated so much, that a Rebuild is cheaper than further Refits ?
+		const bool		XM_CALLCONV NeedsRebuild(const float MaxQualityRatio = 1.5f) const;
+
+		//-----------------------------------------------------------------------------
+		// Access
+		//-----------------------------------------------------------------------------
+
+		/// get the Bounds of the whole Tree
+		const AABB		XM_CALLCONV GetBounds() const noexcept;
+
+		/// get Number of Nodes
+		const UINT		XM_CALLCONV GetNumNodes() const noexcept			{ return (UINT)m_Nodes.size(); }
+
+		/// get Number of Primitives
+		const UINT		XM_CALLCONV GetNumPrimitives() const noexcept		{ return (UINT)m_PrimIndices.size(); }
+
+		/// get the Node-Array
+		const BVHNode*	XM_CALLCONV GetNodes() const noexcept				{ return m_Nodes.data(); }
+
+		/// get the Primitive-Index-List of the Leafs
+		const UINT*		XM_CALLCONV GetPrimitiveIndices() const noexcept	{ return m_PrimIndices.data(); }
+
+		/// is the Node a Leaf ?
+		static const bool XM_CALLCONV IsLeaf(const BVHNode& Node) noexcept	{ return (Node.Child1 & LEAF_FLAG) != 0; }
+
+		//-----------------------------------------------------------------------------
+		// Queries
+		//-----------------------------------------------------------------------------
+
+		/// append all Primitives overlapping the Box to Result, returns the Number found
+		const UINT		XM_CALLCONV QueryAABB(const AABB& Box, std::vector<UINT>& Result) const;
+
+		/// append all Primitives overlapping the Sphere to Result, returns the Number found
+		const UINT		XM_CALLCONV QuerySphere(const Sphere& theSphere, std::vector<UINT>& Result) const;
+
+		/// closest Ray-Hit, Func(PrimIndex, MaxDist) tests one Primitive and shrinks MaxDist on a Hit
+		template <class IntersectFunc>
+		const bool		XM_CALLCONV IntersectRay(const Ray& theRay, float& MaxDist, const IntersectFunc& Func) const;
+
+		/// closest Ray-Hit with a Mesh (the Tree must be built over the Triangles of the Mesh, scalar watertight Test per Leaf-Triangle)
+		const bool		XM_CALLCONV IntersectRay(const Ray& theRay, const TriangleMesh& Mesh, RayHit& Hit, const float MaxDist = FLT_MAX) const noexcept;
+
+	protected:
+
+		//-----------------------------------------------------------------------------
+		// LIFO for the Traversal : the first MAX_STACK Entries live on the Stack,
+		// the Rest on the Heap. A fresh Linear-BVH is at most ~96 Levels deep,
+		// but Optimize() can deepen degenerated Trees without Limit.
+		//-----------------------------------------------------------------------------
+		template <class T>
+		class TraversalStack
+		{
+		public:
+			TraversalStack() noexcept : m_Size(0)								{}
+
+			const bool	XM_CALLCONV IsEmpty() const noexcept					{ return m_Size == 0; }
+
+			void		XM_CALLCONV Push(const T& Entry)
+			{
+				if (m_Size < MAX_STACK)	m_Local[m_Size] = Entry;
+				else					m_Heap.push_back(Entry);
+
+				m_Size++;
+			}
+
+			const T		XM_CALLCONV Pop()
+			{
+				assert(m_Size > 0);
+
+				if (--m_Size < MAX_STACK) return m_Local[m_Size];
+
+				const T Entry = m_Heap.back();
+				m_Heap.pop_back();
+
+				return Entry;
+			}
+
+		protected:
+			T				m_Local[MAX_STACK];
+			std::vector<T>	m_Heap;
+			UINT			m_Size;
+		};
+
+		/// Node and Entry-Distance on the Ray-Traversal-Stack
+		struct NodeDist
+		{
+			UINT	Node;
+			float	Dist;
+		};
+
+		/// Morton-Code from 3 normalized Coordinates
+		static const UINT		XM_CALLCONV MortonCode30(const float x, const float y, const float z) noexcept;
+		static const uint64_t	XM_CALLCONV MortonCode63(const float x, const float y, const float z) noexcept;
+
+		/// count leading Zeros
+		static const int		XM_CALLCONV CountLeadingZeros(const UINT Value) noexcept;
+		static const int		XM_CALLCONV CountLeadingZeros(const uint64_t Value) noexcept;
+
+		/// parallel LSD-Radix-Sort of Key/Value-Pairs (8 Bit per Pass)
+		template <class Key>
+		static void				XM_CALLCONV RadixSort(std::vector<Key>& Keys, std::vector<UINT>& Values, const UINT NumBits);
+
+		/// Length of the common Prefix of 2 sorted Codes (Index as Tie-Breaker)
+		template <class Key>
+		static const int		XM_CALLCONV CommonPrefix(const Key* pCodes, const int Count, const int i, const int j) noexcept;
+
+		/// build Morton-Codes, sort them and emit the Hierarchy
+		template <class Key>
+		void					XM_CALLCONV BuildLinearCodes(const AABB* pBoxes, const UINT Count, FXMVECTOR SceneMin, FXMVECTOR SceneScale);
+
+		/// store a Box into a Node
+		static void				XM_CALLCONV SetNodeBounds(BVHNode& Node, FXMVECTOR vMin, FXMVECTOR vMax) noexcept;
+
+		/// Slab-Test of a Ray against a Node, returns the Entry-Distance or FLT_MAX
+		static const float		XM_CALLCONV IntersectNode(const BVHNode& Node, FXMVECTOR Org, FXMVECTOR InvDir, const float MaxDist) noexcept;
+
+		/// Surface-Area of a Box
+		static const float		XM_CALLCONV SurfaceArea(FXMVECTOR vMin, FXMVECTOR vMax) noexcept;
+
+		/// sort the Nodes by their Depth (for the parallel Refit)
+		void					XM_CALLCONV BuildLevels();
+
+		/// recompute the Box of one Node from its Children / Primitives
+		void					XM_CALLCONV UpdateNodeBounds(const UINT Index, const AABB* pBoxes) noexcept;
+
+		/// try the 4 Rotations of a Node, returns true if the Tree was changed
+		const bool				XM_CALLCONV RotateNode(const UINT Index) noexcept;
+
+		NodeArray				m_Nodes;			// Nodes, Root = 0
+		std::vector<UINT>		m_Parents;			// Parent of every Node
+		std::vector<UINT>		m_PrimIndices;		// Primitive-Indices referenced by the Leafs
+		std::vector<UINT>		m_LevelNodes;		// Nodes sorted by Depth (Root first)
+		std::vector<UINT>		m_LevelStart;		// first Entry of every Level in m_LevelNodes
+		float					m_BuildCost;		// SAH-Cost after the last Build
+	};
+
+}; // end of namespace
+
+#endif
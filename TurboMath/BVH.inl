@@ -0,0 +1,955 @@
+// -------------------------------------------------------------------
+// File			:	BVH.inl
+//
+// Project		:	TurboMath
+//
+// Description	:	Inline-Code for the BVH-Class
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+namespace TurboMath
+{
+
+	//------------------------------------------------------------------------------
+	XM_INLINE BVH::BVH() noexcept :
+	m_BuildCost(0.0f)
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE BVH::~BVH() noexcept
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV BVH::Clear() noexcept
+	{
+		m_Nodes.clear();
+		m_Parents.clear();
+		m_PrimIndices.clear();
+		m_LevelNodes.clear();
+		m_LevelStart.clear();
+
+		m_BuildCost = 0.0f;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV BVH::IsEmpty() const noexcept
+	{
+		return m_Nodes.empty();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const AABB XM_CALLCONV BVH::GetBounds() const noexcept
+	{
+		AABB Box;
+
+		if (IsEmpty())
+		{
+			Box.Reset();
+		}
+		else
+		{
+			Box.SetMinMaxExtents(XMLoadFloat3(&m_Nodes[0].BoxMin), XMLoadFloat3(&m_Nodes[0].BoxMax));
+		}
+
+		return Box;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV BVH::SetNodeBounds(BVHNode& Node, FXMVECTOR vMin, FXMVECTOR vMax) noexcept
+	{
+		XMStoreFloat3(&Node.BoxMin, vMin);
+		XMStoreFloat3(&Node.BoxMax, vMax);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV BVH::MortonCode30(const float x, const float y, const float z) noexcept
+	{
+		// 10 Bit per Axis
+		UINT v[3] = { (UINT)(x * 1023.0f), (UINT)(y * 1023.0f), (UINT)(z * 1023.0f) };
+
+		// insert 2 Zeros between the Bits
+		for (UINT i = 0; i < 3; i++)
+		{
+			v[i] = (v[i] * 0x00010001u) & 0xFF0000FFu;
+			v[i] = (v[i] * 0x00000101u) & 0x0F00F00Fu;
+			v[i] = (v[i] * 0x00000011u) & 0xC30C30C3u;
+			v[i] = (v[i] * 0x00000005u) & 0x49249249u;
+		}
+
+		return (v[0] << 2) | (v[1] << 1) | v[2];
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const uint64_t XM_CALLCONV BVH::MortonCode63(const float x, const float y, const float z) noexcept
+	{
+		// 21 Bit per Axis
+		uint64_t v[3] = { (uint64_t)(x * 2097151.0f), (uint64_t)(y * 2097151.0f), (uint64_t)(z * 2097151.0f) };
+
+		// insert 2 Zeros between the Bits
+		for (UINT i = 0; i < 3; i++)
+		{
+			v[i] &= 0x1FFFFFull;
+			v[i] = (v[i] | v[i] << 32) & 0x1F00000000FFFFull;
+			v[i] = (v[i] | v[i] << 16) & 0x1F0000FF0000FFull;
+			v[i] = (v[i] | v[i] << 8)  & 0x100F00F00F00F00Full;
+			v[i] = (v[i] | v[i] << 4)  & 0x10C30C30C30C30C3ull;
+			v[i] = (v[i] | v[i] << 2)  & 0x1249249249249249ull;
+		}
+
+		return (v[0] << 2) | (v[1] << 1) | v[2];
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const int XM_CALLCONV BVH::CountLeadingZeros(const UINT Value) noexcept
+	{
+#if defined(_MSC_VER)
+		unsigned long Index;
+		return _BitScanReverse(&Index, Value) ? 31 - (int)Index : 32;
+#else
+		return Value ? __builtin_clz(Value) : 32;
+#endif
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const int XM_CALLCONV BVH::CountLeadingZeros(const uint64_t Value) noexcept
+	{
+#if defined(_MSC_VER)
+		unsigned long Index;
+		return _BitScanReverse64(&Index, Value) ? 63 - (int)Index : 64;
+#else
+		return Value ? __builtin_clzll(Value) : 64;
+#endif
+	}
+
+	//------------------------------------------------------------------------------
+	template <class Key>
+	XM_INLINE void XM_CALLCONV BVH::RadixSort(std::vector<Key>& Keys, std::vector<UINT>& Values, const UINT NumBits)
+	{
+		const UINT Count = (UINT)Keys.size();
+
+		assert(Values.size() == Count);
+
+		// every Chunk is histogrammed and scattered by one Thread, Chunks keep
+		// their Order in the Prefix-Sum, so the Sort is stable
+		const UINT NumChunks = XMMax(1u, XMMin(GetNumParallelThreads() * 4, (Count + 4095) / 4096));
+		const UINT ChunkSize = (Count + NumChunks - 1) / NumChunks;
+
+		std::vector<Key>	TmpKeys(Count);
+		std::vector<UINT>	TmpValues(Count);
+		std::vector<UINT>	Histogram(NumChunks * 256);
+
+		Key*	pSrcKeys = Keys.data();
+		Key*	pDstKeys = TmpKeys.data();
+		UINT*	pSrcValues = Values.data();
+		UINT*	pDstValues = TmpValues.data();
+
+		for (UINT Shift = 0; Shift < NumBits; Shift += 8)
+		{
+			// Histogram per Chunk
+			ParallelFor(NumChunks, 1, [&](const UINT Begin, const UINT End)
+			{
+				for (UINT c = Begin; c < End; c++)
+				{
+					UINT* pHist = &Histogram[c * 256];
+
+					memset(pHist, 0, 256 * sizeof(UINT));
+
+					const UINT First = c * ChunkSize;
+					const UINT Last = XMMin(First + ChunkSize, Count);
+
+					for (UINT i = First; i < Last; i++)
+					{
+						pHist[(pSrcKeys[i] >> Shift) & 0xFF]++;
+					}
+				}
+			});
+
+			// exclusive Prefix-Sum (Digit major, Chunk minor)
+			bool bSkip = false;
+			UINT Sum = 0;
+
+			for (UINT d = 0; d < 256 && !bSkip; d++)
+			{
+				const UINT Start = Sum;
+
+				for (UINT c = 0; c < NumChunks; c++)
+				{
+					const UINT Num = Histogram[c * 256 + d];
+					Histogram[c * 256 + d] = Sum;
+					Sum += Num;
+				}
+
+				// all Keys have the same Digit -> nothing to do in this Pass
+				bSkip = (Sum - Start == Count);
+			}
+
+			if (bSkip) continue;
+
+			// Scatter
+			ParallelFor(NumChunks, 1, [&](const UINT Begin, const UINT End)
+			{
+				for (UINT c = Begin; c < End; c++)
+				{
+					UINT* pHist = &Histogram[c * 256];
+
+					const UINT First = c * ChunkSize;
+					const UINT Last = XMMin(First + ChunkSize, Count);
+
+					for (UINT i = First; i < Last; i++)
+					{
+						const UINT Dst = pHist[(pSrcKeys[i] >> Shift) & 0xFF]++;
+
+						pDstKeys[Dst] = pSrcKeys[i];
+						pDstValues[Dst] = pSrcValues[i];
+					}
+				}
+			});
+
+			std::swap(pSrcKeys, pDstKeys);
+			std::swap(pSrcValues, pDstValues);
+		}
+
+		// Result in the temporary Buffers ?
+		if (pSrcKeys != Keys.data())
+		{
+			Keys.swap(TmpKeys);
+			Values.swap(TmpValues);
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	template <class Key>
+	XM_INLINE const int XM_CALLCONV BVH::CommonPrefix(const Key* pCodes, const int Count, const int i, const int j) noexcept
+	{
+		if (j < 0 || j >= Count) return -1;
+
+		const Key a = pCodes[i];
+		const Key b = pCodes[j];
+
+		if (a != b) return CountLeadingZeros(a ^ b);
+
+		// equal Codes -> the Index is the Tie-Breaker
+		return (int)(sizeof(Key) * 8) + CountLeadingZeros((UINT)(i ^ j));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV BVH::BuildLinear(const AABB* pBoxes, const UINT Count, const bool b64BitCodes)
+	{
+		Clear();
+
+		if (Count == 0) return;
+
+		assert(pBoxes);
+		assert(Count < LEAF_FLAG);
+
+		// Bounds of the Centers (parallel Reduction)
+		const UINT ChunkSize = 16384;
+		const UINT NumChunks = (Count + ChunkSize - 1) / ChunkSize;
+
+		std::vector<XMFLOAT4A, AAllocator<XMFLOAT4A> > ChunkMin(NumChunks), ChunkMax(NumChunks);
+
+		ParallelFor(Count, ChunkSize, [&](const UINT Begin, const UINT End)
+		{
+			XMVECTOR vMin = pBoxes[Begin].GetCenter();
+			XMVECTOR vMax = vMin;
+
+			for (UINT i = Begin + 1; i < End; i++)
+			{
+				const XMVECTOR Center = pBoxes[i].GetCenter();
+
+				vMin = XMVectorMin(vMin, Center);
+				vMax = XMVectorMax(vMax, Center);
+			}
+
+			XMStoreFloat4A(&ChunkMin[Begin / ChunkSize], vMin);
+			XMStoreFloat4A(&ChunkMax[Begin / ChunkSize], vMax);
+		});
+
+		XMVECTOR SceneMin = XMLoadFloat4A(&ChunkMin[0]);
+		XMVECTOR SceneMax = XMLoadFloat4A(&ChunkMax[0]);
+
+		for (UINT c = 1; c < NumChunks; c++)
+		{
+			SceneMin = XMVectorMin(SceneMin, XMLoadFloat4A(&ChunkMin[c]));
+			SceneMax = XMVectorMax(SceneMax, XMLoadFloat4A(&ChunkMax[c]));
+		}
+
+		// Scale to [0..1], flat Axes get 0
+		const XMVECTOR Size = XMVectorSubtract(SceneMax, SceneMin);
+		const XMVECTOR SceneScale = XMVectorSelect(XMVectorReciprocal(Size), XMVectorZero(), XMVectorLessOrEqual(Size, g_XMEpsilon));
+
+		if (b64BitCodes)
+		{
+			BuildLinearCodes<uint64_t>(pBoxes, Count, SceneMin, SceneScale);
+		}
+		else
+		{
+			BuildLinearCodes<UINT>(pBoxes, Count, SceneMin, SceneScale);
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV BVH::BuildLinear(const TriangleMesh& Mesh, const bool b64BitCodes)
+	{
+		std::vector<AABB, AAllocator<AABB> > Boxes(Mesh.GetNumTriangles());
+
+		if (!Boxes.empty())
+		{
+			Mesh.ComputeTriangleAABBs(Boxes.data());
+		}
+
+		BuildLinear(Boxes.data(), (UINT)Boxes.size(), b64BitCodes);
+	}
+
+	//------------------------------------------------------------------------------
+	template <class Key>
+	XM_INLINE void XM_CALLCONV BVH::BuildLinearCodes(const AABB* pBoxes, const UINT Count, FXMVECTOR SceneMin, FXMVECTOR SceneScale)
+	{
+		const XMVECTOR Min = SceneMin;
+		const XMVECTOR Scale = SceneScale;
+
+		//--------------------------------------------------------------
+		// 1. Morton-Codes of the Centers
+		//--------------------------------------------------------------
+		std::vector<Key> Codes(Count);
+
+		m_PrimIndices.resize(Count);
+
+		ParallelFor(Count, 4096, [&](const UINT Begin, const UINT End)
+		{
+			XMFLOAT4A P;
+
+			for (UINT i = Begin; i < End; i++)
+			{
+				XMStoreFloat4A(&P, XMVectorSaturate(XMVectorMultiply(XMVectorSubtract(pBoxes[i].GetCenter(), Min), Scale)));
+
+				Codes[i] = (sizeof(Key) == 8) ? (Key)MortonCode63(P.x, P.y, P.z) : (Key)MortonCode30(P.x, P.y, P.z);
+
+				m_PrimIndices[i] = i;
+			}
+		});
+
+		//--------------------------------------------------------------
+		// 2. Sort
+		//--------------------------------------------------------------
+		RadixSort(Codes, m_PrimIndices, (sizeof(Key) == 8) ? 63 : 30);
+
+		//--------------------------------------------------------------
+		// 3. Hierarchy : Inner-Nodes [0, Count - 1), Leafs [Count - 1, 2 * Count - 1)
+		//--------------------------------------------------------------
+		const UINT NumInner = Count - 1;
+
+		m_Nodes.resize(2 * Count - 1);
+		m_Parents.assign(2 * Count - 1, INVALID_NODE);
+
+		const Key*	pCodes = Codes.data();
+		const int	n = (int)Count;
+
+		ParallelFor(NumInner, 1024, [&](const UINT Begin, const UINT End)
+		{
+			for (int i = (int)Begin; i < (int)End; i++)
+			{
+				// Direction of the Range
+				const int d = (CommonPrefix(pCodes, n, i, i + 1) - CommonPrefix(pCodes, n, i, i - 1)) >= 0 ? 1 : -1;
+
+				// upper Bound for the Length of the Range
+				const int MinPrefix = CommonPrefix(pCodes, n, i, i - d);
+
+				int MaxLength = 2;
+
+				while (CommonPrefix(pCodes, n, i, i + MaxLength * d) > MinPrefix)
+				{
+					MaxLength <<= 1;
+				}
+
+				// find the other End by binary Search
+				int Length = 0;
+
+				for (int t = MaxLength >> 1; t >= 1; t >>= 1)
+				{
+					if (CommonPrefix(pCodes, n, i, i + (Length + t) * d) > MinPrefix)
+					{
+						Length += t;
+					}
+				}
+
+				const int j = i + Length * d;
+
+				// find the Split-Position by binary Search
+				const int NodePrefix = CommonPrefix(pCodes, n, i, j);
+
+				int Split = 0;
+				int t = Length;
+
+				do
+				{
+					t = (t + 1) >> 1;
+
+					if (CommonPrefix(pCodes, n, i, i + (Split + t) * d) > NodePrefix)
+					{
+						Split += t;
+					}
+				}
+				while (t > 1);
+
+				const int Gamma = i + Split * d + XMMin(d, 0);
+
+				// Children
+				const UINT Left  = (XMMin(i, j) == Gamma)     ? NumInner + Gamma     : Gamma;
+				const UINT Right = (XMMax(i, j) == Gamma + 1) ? NumInner + Gamma + 1 : Gamma + 1;
+
+				m_Nodes[i].Child0 = Left;
+				m_Nodes[i].Child1 = Right;
+
+				m_Parents[Left] = i;
+				m_Parents[Right] = i;
+			}
+		});
+
+		//--------------------------------------------------------------
+		// 4. Bounds bottom-up : the second Thread arriving at a Node
+		//    computes its Box and continues with the Parent
+		//--------------------------------------------------------------
+		std::vector<std::atomic<UINT> > Visits(NumInner);
+
+		ParallelFor(Count, 1024, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT k = Begin; k < End; k++)
+			{
+				BVHNode& Leaf = m_Nodes[NumInner + k];
+
+				const AABB& Box = pBoxes[m_PrimIndices[k]];
+
+				Leaf.Child0 = k;
+				Leaf.Child1 = LEAF_FLAG | 1;
+
+				SetNodeBounds(Leaf, Box.GetMinExtents(), Box.GetMaxExtents());
+
+				UINT Parent = m_Parents[NumInner + k];
+
+				while (Parent != INVALID_NODE)
+				{
+					if (Visits[Parent].fetch_add(1, std::memory_order_acq_rel) == 0) break;
+
+					BVHNode& Node = m_Nodes[Parent];
+
+					const BVHNode& C0 = m_Nodes[Node.Child0];
+					const BVHNode& C1 = m_Nodes[Node.Child1];
+
+					SetNodeBounds(Node,	XMVectorMin(XMLoadFloat3(&C0.BoxMin), XMLoadFloat3(&C1.BoxMin)),
+										XMVectorMax(XMLoadFloat3(&C0.BoxMax), XMLoadFloat3(&C1.BoxMax)));
+
+					Parent = m_Parents[Parent];
+				}
+			}
+		});
+
+		// Reference for the Quality-Metric
+		m_BuildCost = ComputeSAHCost();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const float XM_CALLCONV BVH::SurfaceArea(FXMVECTOR vMin, FXMVECTOR vMax) noexcept
+	{
+		const XMVECTOR d = XMVectorMax(XMVectorSubtract(vMax, vMin), XMVectorZero());
+
+		// 2 * (dx * dy + dy * dz + dz * dx)
+		return 2.0f * XMVectorGetX(XMVector3Dot(d, XMVectorSwizzle<1, 2, 0, 3>(d)));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV BVH::BuildLevels()
+	{
+		// Breadth-First, so every Level is a continuous Range
+		m_LevelNodes.resize(m_Nodes.size());
+		m_LevelStart.clear();
+
+		if (IsEmpty()) return;
+
+		UINT Head = 0;
+		UINT Tail = 0;
+
+		m_LevelNodes[Tail++] = 0;
+
+		while (Head < Tail)
+		{
+			m_LevelStart.push_back(Head);
+
+			const UINT LevelEnd = Tail;
+
+			for (; Head < LevelEnd; Head++)
+			{
+				const BVHNode& Node = m_Nodes[m_LevelNodes[Head]];
+
+				if (!IsLeaf(Node))
+				{
+					m_LevelNodes[Tail++] = Node.Child0;
+					m_LevelNodes[Tail++] = Node.Child1;
+				}
+			}
+		}
+
+		m_LevelStart.push_back(Tail);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV BVH::UpdateNodeBounds(const UINT Index, const AABB* pBoxes) noexcept
+	{
+		BVHNode& Node = m_Nodes[Index];
+
+		XMVECTOR vMin, vMax;
+
+		if (IsLeaf(Node))
+		{
+			assert(pBoxes);
+
+			const UINT Num = Node.Child1 & ~LEAF_FLAG;
+
+			vMin = g_XMFltMax;
+			vMax = XMVectorNegate(g_XMFltMax);
+
+			for (UINT k = 0; k < Num; k++)
+			{
+				const AABB& Box = pBoxes[m_PrimIndices[Node.Child0 + k]];
+
+				vMin = XMVectorMin(vMin, Box.GetMinExtents());
+				vMax = XMVectorMax(vMax, Box.GetMaxExtents());
+			}
+		}
+		else
+		{
+			const BVHNode& C0 = m_Nodes[Node.Child0];
+			const BVHNode& C1 = m_Nodes[Node.Child1];
+
+			vMin = XMVectorMin(XMLoadFloat3(&C0.BoxMin), XMLoadFloat3(&C1.BoxMin));
+			vMax = XMVectorMax(XMLoadFloat3(&C0.BoxMax), XMLoadFloat3(&C1.BoxMax));
+		}
+
+		SetNodeBounds(Node, vMin, vMax);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV BVH::Refit(const AABB* pBoxes)
+	{
+		assert(pBoxes);
+
+		if (IsEmpty()) return;
+
+		if (m_LevelStart.empty())
+		{
+			BuildLevels();
+		}
+
+		// deepest Level first, all Nodes of one Level are independent
+		const int NumLevels = (int)m_LevelStart.size() - 1;
+
+		for (int l = NumLevels - 1; l >= 0; l--)
+		{
+			const UINT First = m_LevelStart[l];
+			const UINT Num = m_LevelStart[l + 1] - First;
+
+			ParallelFor(Num, 1024, [&](const UINT Begin, const UINT End)
+			{
+				for (UINT i = Begin; i < End; i++)
+				{
+					UpdateNodeBounds(m_LevelNodes[First + i], pBoxes);
+				}
+			});
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV BVH::Refit(const TriangleMesh& Mesh)
+	{
+		assert(Mesh.GetNumTriangles() == GetNumPrimitives());
+
+		std::vector<AABB, AAllocator<AABB> > Boxes(Mesh.GetNumTriangles());
+
+		if (Boxes.empty()) return;
+
+		Mesh.ComputeTriangleAABBs(Boxes.data());
+
+		Refit(Boxes.data());
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV BVH::RotateNode(const UINT Index) noexcept
+	{
+		BVHNode& Node = m_Nodes[Index];
+
+		if (IsLeaf(Node)) return false;
+
+		const UINT Kids[2] = { Node.Child0, Node.Child1 };
+
+		// Rotation : the Child Kids[1 - Side] is swapped with a Grandchild below Kids[Side]
+		float	BestGain = 0.0f;
+		int		BestSide = -1;
+		int		BestGrand = -1;
+
+		for (int Side = 0; Side < 2; Side++)
+		{
+			const BVHNode& Inner = m_Nodes[Kids[Side]];
+
+			if (IsLeaf(Inner)) continue;
+
+			const BVHNode& Other = m_Nodes[Kids[1 - Side]];
+
+			const float InnerArea = SurfaceArea(XMLoadFloat3(&Inner.BoxMin), XMLoadFloat3(&Inner.BoxMax));
+
+			const UINT Grand[2] = { Inner.Child0, Inner.Child1 };
+
+			for (int g = 0; g < 2; g++)
+			{
+				// the Inner Node keeps Grand[1 - g] and gets Other
+				const BVHNode& Keep = m_Nodes[Grand[1 - g]];
+
+				const float NewArea = SurfaceArea(	XMVectorMin(XMLoadFloat3(&Keep.BoxMin), XMLoadFloat3(&Other.BoxMin)),
+													XMVectorMax(XMLoadFloat3(&Keep.BoxMax), XMLoadFloat3(&Other.BoxMax)) );
+
+				const float Gain = InnerArea - NewArea;
+
+				if (Gain > BestGain)
+				{
+					BestGain = Gain;
+					BestSide = Side;
+					BestGrand = g;
+				}
+			}
+		}
+
+		// ignore tiny Gains, they only let the Tree oscillate
+		if (BestSide < 0 || BestGain <= 1e-5f * SurfaceArea(XMLoadFloat3(&Node.BoxMin), XMLoadFloat3(&Node.BoxMax))) return false;
+
+		const UINT InnerIndex = Kids[BestSide];
+		const UINT OtherIndex = Kids[1 - BestSide];
+
+		BVHNode& Inner = m_Nodes[InnerIndex];
+
+		UINT& GrandSlot = (BestGrand == 0) ? Inner.Child0 : Inner.Child1;
+		UINT& OtherSlot = (BestSide == 0) ? Node.Child1 : Node.Child0;
+
+		const UINT GrandIndex = GrandSlot;
+
+		// swap
+		OtherSlot = GrandIndex;
+		GrandSlot = OtherIndex;
+
+		m_Parents[GrandIndex] = Index;
+		m_Parents[OtherIndex] = InnerIndex;
+
+		// only the Box of the Inner Node changes
+		UpdateNodeBounds(InnerIndex, nullptr);
+
+		return true;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV BVH::Optimize(const UINT NumPasses)
+	{
+		if (IsEmpty()) return 0;
+
+		UINT NumRotations = 0;
+
+		for (UINT Pass = 0; Pass < NumPasses; Pass++)
+		{
+			if (m_LevelStart.empty())
+			{
+				BuildLevels();
+			}
+
+			UINT PassRotations = 0;
+
+			// bottom-up, so the Rotations of a Level see the improved Subtrees
+			for (int l = (int)m_LevelStart.size() - 2; l >= 0; l--)
+			{
+				for (UINT i = m_LevelStart[l]; i < m_LevelStart[l + 1]; i++)
+				{
+					if (RotateNode(m_LevelNodes[i])) PassRotations++;
+				}
+			}
+
+			if (PassRotations == 0) break;
+
+			NumRotations += PassRotations;
+
+			// the Depth of the Nodes has changed
+			m_LevelStart.clear();
+		}
+
+		return NumRotations;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const float XM_CALLCONV BVH::ComputeSAHCost() const
+	{
+		if (IsEmpty()) return 0.0f;
+
+		const float RootArea = SurfaceArea(XMLoadFloat3(&m_Nodes[0].BoxMin), XMLoadFloat3(&m_Nodes[0].BoxMax));
+
+		if (RootArea <= 0.0f) return 0.0f;
+
+		// parallel Sum over all Nodes
+		const UINT Count = GetNumNodes();
+		const UINT ChunkSize = 16384;
+		const UINT NumChunks = (Count + ChunkSize - 1) / ChunkSize;
+
+		std::vector<float> Partial(NumChunks);
+
+		ParallelFor(Count, ChunkSize, [&](const UINT Begin, const UINT End)
+		{
+			float Sum = 0.0f;
+
+			for (UINT i = Begin; i < End; i++)
+			{
+				const BVHNode& Node = m_Nodes[i];
+
+				const float Area = SurfaceArea(XMLoadFloat3(&Node.BoxMin), XMLoadFloat3(&Node.BoxMax));
+
+				if (IsLeaf(Node))
+				{
+					Sum += Area * SAH_INTERSECT_COST * (float)(Node.Child1 & ~LEAF_FLAG);
+				}
+				else
+				{
+					Sum += Area * SAH_TRAVERSAL_COST;
+				}
+			}
+
+			Partial[Begin / ChunkSize] = Sum;
+		});
+
+		float Cost = 0.0f;
+
+		for (UINT c = 0; c < NumChunks; c++)
+		{
+			Cost += Partial[c];
+		}
+
+		return Cost / RootArea;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const float XM_CALLCONV BVH::GetQualityRatio() const
+	{
+		if (m_BuildCost <= 0.0f) return 1.0f;
+
+		return ComputeSAHCost() / m_BuildCost;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV BVH::NeedsRebuild(const float MaxQualityRatio) const
+	{
+		return GetQualityRatio() > MaxQualityRatio;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV BVH::QueryAABB(const AABB& Box, std::vector<UINT>& Result) const
+	{
+		if (IsEmpty()) return 0;
+
+		const XMVECTOR QMin = Box.GetMinExtents();
+		const XMVECTOR QMax = Box.GetMaxExtents();
+
+		const size_t OldSize = Result.size();
+
+		TraversalStack<UINT> Stack;
+
+		Stack.Push(0);
+
+		while (!Stack.IsEmpty())
+		{
+			const BVHNode& Node = m_Nodes[Stack.Pop()];
+
+			// Overlap ?
+			if (!XMVector3LessOrEqual(XMLoadFloat3(&Node.BoxMin), QMax) || !XMVector3LessOrEqual(QMin, XMLoadFloat3(&Node.BoxMax))) continue;
+
+			if (IsLeaf(Node))
+			{
+				const UINT Num = Node.Child1 & ~LEAF_FLAG;
+
+				for (UINT k = 0; k < Num; k++)
+				{
+					Result.push_back(m_PrimIndices[Node.Child0 + k]);
+				}
+			}
+			else
+			{
+				Stack.Push(Node.Child1);
+				Stack.Push(Node.Child0);
+			}
+		}
+
+		return (UINT)(Result.size() - OldSize);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV BVH::QuerySphere(const Sphere& theSphere, std::vector<UINT>& Result) const
+	{
+		if (IsEmpty()) return 0;
+
+		const XMVECTOR Center = theSphere.GetCenter();
+		const XMVECTOR RadiusSq = XMVectorReplicate(theSphere.GetRadius() * theSphere.GetRadius());
+		const XMVECTOR Zero = XMVectorZero();
+
+		const size_t OldSize = Result.size();
+
+		TraversalStack<UINT> Stack;
+
+		Stack.Push(0);
+
+		while (!Stack.IsEmpty())
+		{
+			const BVHNode& Node = m_Nodes[Stack.Pop()];
+
+			// squared Distance from the Center to the Box
+			const XMVECTOR d = XMVectorAdd(	XMVectorMax(XMVectorSubtract(XMLoadFloat3(&Node.BoxMin), Center), Zero),
+											XMVectorMax(XMVectorSubtract(Center, XMLoadFloat3(&Node.BoxMax)), Zero));
+
+			if (XMVector3Greater(XMVector3LengthSq(d), RadiusSq)) continue;
+
+			if (IsLeaf(Node))
+			{
+				const UINT Num = Node.Child1 & ~LEAF_FLAG;
+
+				for (UINT k = 0; k < Num; k++)
+				{
+					Result.push_back(m_PrimIndices[Node.Child0 + k]);
+				}
+			}
+			else
+			{
+				Stack.Push(Node.Child1);
+				Stack.Push(Node.Child0);
+			}
+		}
+
+		return (UINT)(Result.size() - OldSize);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const float XM_CALLCONV BVH::IntersectNode(const BVHNode& Node, FXMVECTOR Org, FXMVECTOR InvDir, const float MaxDist) noexcept
+	{
+		const XMVECTOR t1 = XMVectorMultiply(XMVectorSubtract(XMLoadFloat3(&Node.BoxMin), Org), InvDir);
+		const XMVECTOR t2 = XMVectorMultiply(XMVectorSubtract(XMLoadFloat3(&Node.BoxMax), Org), InvDir);
+
+		const XMVECTOR tNear = XMVectorMin(t1, t2);
+		const XMVECTOR tFar = XMVectorMax(t1, t2);
+
+		const float Enter = XMMax(XMMax(XMVectorGetX(tNear), XMVectorGetY(tNear)), XMMax(XMVectorGetZ(tNear), 0.0f));
+		const float Exit = XMMin(XMMin(XMVectorGetX(tFar), XMVectorGetY(tFar)), XMMin(XMVectorGetZ(tFar), MaxDist));
+
+		return (Enter <= Exit) ? Enter : FLT_MAX;
+	}
+
+	//------------------------------------------------------------------------------
+	template <class IntersectFunc>
+	XM_INLINE const bool XM_CALLCONV BVH::IntersectRay(const Ray& theRay, float& MaxDist, const IntersectFunc& Func) const
+	{
+		if (IsEmpty()) return false;
+
+		const XMVECTOR Org = theRay.GetStartPoint();
+		const XMVECTOR InvDir = XMVectorReciprocal(theRay.GetDirection());
+
+		TraversalStack<NodeDist> Stack;
+
+		const float RootDist = IntersectNode(m_Nodes[0], Org, InvDir, MaxDist);
+
+		if (RootDist == FLT_MAX) return false;
+
+		Stack.Push({ 0, RootDist });
+
+		bool bHit = false;
+
+		while (!Stack.IsEmpty())
+		{
+			const NodeDist Entry = Stack.Pop();
+
+			// a closer Hit was found in the Meantime
+			if (Entry.Dist > MaxDist) continue;
+
+			const BVHNode& Node = m_Nodes[Entry.Node];
+
+			if (IsLeaf(Node))
+			{
+				const UINT Num = Node.Child1 & ~LEAF_FLAG;
+
+				for (UINT k = 0; k < Num; k++)
+				{
+					if (Func(m_PrimIndices[Node.Child0 + k], MaxDist)) bHit = true;
+				}
+
+				continue;
+			}
+
+			const float Dist0 = IntersectNode(m_Nodes[Node.Child0], Org, InvDir, MaxDist);
+			const float Dist1 = IntersectNode(m_Nodes[Node.Child1], Org, InvDir, MaxDist);
+
+			// push the farther Child first, so the closer one is visited first
+			if (Dist0 <= Dist1)
+			{
+				if (Dist1 != FLT_MAX) Stack.Push({ Node.Child1, Dist1 });
+				if (Dist0 != FLT_MAX) Stack.Push({ Node.Child0, Dist0 });
+			}
+			else
+			{
+				if (Dist0 != FLT_MAX) Stack.Push({ Node.Child0, Dist0 });
+				Stack.Push({ Node.Child1, Dist1 });
+			}
+		}
+
+		return bHit;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV BVH::IntersectRay(const Ray& theRay, const TriangleMesh& Mesh, RayHit& Hit, const float MaxDist) const noexcept
+	{
+		// the Shear of the Ray is computed once for all Triangles
+		const WatertightRay R(theRay);
+
+		Hit.Distance = MaxDist;
+		Hit.U = Hit.V = 0.0f;
+		Hit.TriIndex = (UINT)-1;
+
+		float Dist = MaxDist;
+
+		// one Triangle per Leaf : the scalar watertight Test, the batched Kernel would run 1 of 4 (8) Lanes
+		return IntersectRay(theRay, Dist, [&](const UINT Prim, float& CurDist) -> bool
+		{
+			UINT i0, i1, i2;
+			Mesh.GetTriangleIndices(Prim, i0, i1, i2);
+
+			float t, u, v;
+
+			if (!R.IntersectTriangle(Mesh.GetVertex(i0), Mesh.GetVertex(i1), Mesh.GetVertex(i2), CurDist, &t, &u, &v)) return false;
+
+			Hit.Distance = t;
+			Hit.U = u;
+			Hit.V = v;
+			Hit.TriIndex = Prim;
+
+			CurDist = t;
+
+			return true;
+		});
+	}
+
+}// end of Namespace TurboMath
@@ -0,0 +1,102 @@
+// -------------------------------------------------------------------
+// File			:	ColorConvert
+//
+// Project		:	TurboMath
+//
+// Description	:	Bulk Color-Conversion for Image-Buffers
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_COLORCONVERT_H_
+#define _TURBOMATH_COLORCONVERT_H_
+
+namespace TurboMath
+{
+	//-----------------------------------------------------------------------------
+	// Kernels for whole Image-Buffers (Count Pixels, split over all Cores with
+	// ParallelFor). 8 Bit Pixels are R8G8B8A8 (Red in the lowest Byte) like
+	// Color::R8G8B8A8. The sRGB-Curve needs no XMVectorPow : decoding 8 Bit
+	// uses an exact Table, the Float-Versions use fitted Approximations
+	// (Encode : < 0.01 of an 8 Bit Step, Decode : < 0.04% relative Error).
+	// Alpha is never gamma-converted. Input and Output may be the same Buffer.
+	//-----------------------------------------------------------------------------
+	class ColorConvert
+	{
+	public:
+
+		//-----------------------------------------------------------------------------
+		// single Colors
+		//-----------------------------------------------------------------------------
+
+		/// sRGB -> linear without pow
+		static XMVECTOR		XM_CALLCONV SRGBToLinear(FXMVECTOR c) noexcept;
+
+		/// linear -> sRGB without pow
+		static XMVECTOR		XM_CALLCONV LinearToSRGB(FXMVECTOR c) noexcept;
+
+		//-----------------------------------------------------------------------------
+		// 8 Bit <-> Float
+		//-----------------------------------------------------------------------------
+		static void			XM_CALLCONV RGBA8ToFloat(const uint32_t* pIn, Color* pOut, const UINT Count);
+		static void			XM_CALLCONV FloatToRGBA8(const Color* pIn, uint32_t* pOut, const UINT Count);
+
+		/// sRGB 8 Bit -> linear Float
+		static void			XM_CALLCONV SRGB8ToLinear(const uint32_t* pIn, Color* pOut, const UINT Count);
+
+		/// linear Float -> sRGB 8 Bit
+		static void			XM_CALLCONV LinearToSRGB8(const Color* pIn, uint32_t* pOut, const UINT Count);
+
+		//-----------------------------------------------------------------------------
+		// Float <-> Float
+		//-----------------------------------------------------------------------------
+		static void			XM_CALLCONV SRGBToLinear(const Color* pIn, Color* pOut, const UINT Count);
+		static void			XM_CALLCONV LinearToSRGB(const Color* pIn, Color* pOut, const UINT Count);
+
+		/// RGB * Alpha
+		static void			XM_CALLCONV Premultiply(const Color* pIn, Color* pOut, const UINT Count);
+
+		/// RGB / Alpha (RGB = 0 for Alpha = 0)
+		static void			XM_CALLCONV Unpremultiply(const Color* pIn, Color* pOut, const UINT Count);
+
+		//-----------------------------------------------------------------------------
+		// Packing (Layouts like Color::Pack_XXX, but rounded)
+		//-----------------------------------------------------------------------------
+		static void			XM_CALLCONV PackRGB565(const Color* pIn, uint16_t* pOut, const UINT Count);
+		static void			XM_CALLCONV PackRGB555(const Color* pIn, uint16_t* pOut, const UINT Count);
+		static void			XM_CALLCONV PackARGB4444(const Color* pIn, uint16_t* pOut, const UINT Count);
+		static void			XM_CALLCONV PackR10G10B10A2(const Color* pIn, uint32_t* pOut, const UINT Count);
+
+		/// Pixels per Job of ParallelFor
+		static constexpr UINT	CHUNK_SIZE = 16384;
+
+	protected:
+
+		/// sRGB 8 Bit -> linear (256 Entries)
+		static const float*	XM_CALLCONV GetSRGB8Table() noexcept;
+
+		/// saturated Color * Scale, rounded to Integers
+		static const XMUINT4 XM_CALLCONV Quantize(FXMVECTOR c, FXMVECTOR Scale) noexcept;
+
+		/// saturated Color as R8G8B8A8
+		static uint32_t		XM_CALLCONV ToRGBA8(FXMVECTOR c) noexcept;
+	};
+
+}; // end of namespace
+
+#endif
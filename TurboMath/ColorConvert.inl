@@ -0,0 +1,291 @@
+// -------------------------------------------------------------------
+// File			:	ColorConvert
+//
+// Project		:	TurboMath
+//
+// Description	:	Bulk Color-Conversion for Image-Buffers
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+namespace TurboMath
+{
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV ColorConvert::SRGBToLinear(FXMVECTOR c) noexcept
+	{
+		const XMVECTOR T = XMVectorSaturate(c);
+
+		// ((T + 0.055) / 1.055)^2.4 as Polynomial of 5th Degree (fitted on the relative Error)
+		XMVECTOR Result = XMVectorMultiplyAdd(T, XMVectorReplicate(0.11661333f), XMVectorReplicate(-0.3689996f));
+		Result = XMVectorMultiplyAdd(Result, T, XMVectorReplicate(0.710403f));
+		Result = XMVectorMultiplyAdd(Result, T, XMVectorReplicate(0.5075447f));
+		Result = XMVectorMultiplyAdd(Result, T, XMVectorReplicate(0.033923313f));
+		Result = XMVectorMultiplyAdd(Result, T, XMVectorReplicate(0.0008832708f));
+
+		Result = XMVectorSelect(Result, XMVectorScale(T, 1.0f / 12.92f), XMVectorLessOrEqual(T, XMVectorReplicate(0.04045f)));
+
+		return XMVectorSelect(c, Result, g_XMSelect1110);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV ColorConvert::LinearToSRGB(FXMVECTOR c) noexcept
+	{
+		const XMVECTOR T = XMVectorSaturate(c);
+
+		// 1.055 * T^(1/2.4) - 0.055 from T^(1/2), T^(1/4), T^(1/8) and T
+		const XMVECTOR s1 = XMVectorSqrt(T);
+		const XMVECTOR s2 = XMVectorSqrt(s1);
+		const XMVECTOR s3 = XMVectorSqrt(s2);
+
+		XMVECTOR Result = XMVectorMultiplyAdd(s1, XMVectorReplicate(0.65397924f), XMVectorReplicate(-0.0040645255f));
+		Result = XMVectorMultiplyAdd(s2, XMVectorReplicate(0.6887265f), Result);
+		Result = XMVectorMultiplyAdd(s3, XMVectorReplicate(-0.31848565f), Result);
+		Result = XMVectorMultiplyAdd(T, XMVectorReplicate(-0.020186882f), Result);
+
+		Result = XMVectorSelect(Result, XMVectorScale(T, 12.92f), XMVectorLess(T, XMVectorReplicate(0.0031308f)));
+
+		return XMVectorSelect(c, Result, g_XMSelect1110);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const float* XM_CALLCONV ColorConvert::GetSRGB8Table() noexcept
+	{
+		struct Table
+		{
+			float	Value[256];
+
+			Table() noexcept
+			{
+				for (UINT i = 0; i < 256; i++)
+				{
+					const float c = (float)i / 255.0f;
+
+					Value[i] = (c <= 0.04045f) ? c / 12.92f : powf((c + 0.055f) / 1.055f, 2.4f);
+				}
+			}
+		};
+
+		static const Table theTable;
+
+		return theTable.Value;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const XMUINT4 XM_CALLCONV ColorConvert::Quantize(FXMVECTOR c, FXMVECTOR Scale) noexcept
+	{
+		XMUINT4 q;
+
+		XMStoreUInt4(&q, _mm_castsi128_ps(_mm_cvtps_epi32(XMVectorMultiply(XMVectorSaturate(c), Scale))));
+
+		return q;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE uint32_t XM_CALLCONV ColorConvert::ToRGBA8(FXMVECTOR c) noexcept
+	{
+		__m128i i = _mm_cvtps_epi32(XMVectorMultiply(XMVectorSaturate(c), XMVectorReplicate(255.0f)));
+
+		i = _mm_packs_epi32(i, i);
+		i = _mm_packus_epi16(i, i);
+
+		return (uint32_t)_mm_cvtsi128_si32(i);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ColorConvert::RGBA8ToFloat(const uint32_t* pIn, Color* pOut, const UINT Count)
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		ParallelFor(Count, CHUNK_SIZE, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT i = Begin; i < End; i++)
+				pOut[i] = PackedVector::XMLoadUByteN4(reinterpret_cast<const PackedVector::XMUBYTEN4*>(&pIn[i]));
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ColorConvert::FloatToRGBA8(const Color* pIn, uint32_t* pOut, const UINT Count)
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		ParallelFor(Count, CHUNK_SIZE, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT i = Begin; i < End; i++)
+				pOut[i] = ToRGBA8(pIn[i]);
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ColorConvert::SRGB8ToLinear(const uint32_t* pIn, Color* pOut, const UINT Count)
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		const float* pTable = GetSRGB8Table();
+
+		ParallelFor(Count, CHUNK_SIZE, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT i = Begin; i < End; i++)
+			{
+				const uint32_t p = pIn[i];
+
+				pOut[i] = XMVectorSet(pTable[p & 0xFF], pTable[(p >> 8) & 0xFF], pTable[(p >> 16) & 0xFF], (float)(p >> 24) * (1.0f / 255.0f));
+			}
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ColorConvert::LinearToSRGB8(const Color* pIn, uint32_t* pOut, const UINT Count)
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		ParallelFor(Count, CHUNK_SIZE, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT i = Begin; i < End; i++)
+				pOut[i] = ToRGBA8(LinearToSRGB(pIn[i]));
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ColorConvert::SRGBToLinear(const Color* pIn, Color* pOut, const UINT Count)
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		ParallelFor(Count, CHUNK_SIZE, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT i = Begin; i < End; i++)
+				pOut[i] = SRGBToLinear(pIn[i]);
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ColorConvert::LinearToSRGB(const Color* pIn, Color* pOut, const UINT Count)
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		ParallelFor(Count, CHUNK_SIZE, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT i = Begin; i < End; i++)
+				pOut[i] = LinearToSRGB(pIn[i]);
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ColorConvert::Premultiply(const Color* pIn, Color* pOut, const UINT Count)
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		ParallelFor(Count, CHUNK_SIZE, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT i = Begin; i < End; i++)
+			{
+				const XMVECTOR c = pIn[i];
+
+				pOut[i] = XMVectorMultiply(c, XMVectorSelect(g_XMOne, XMVectorSplatW(c), g_XMSelect1110));
+			}
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ColorConvert::Unpremultiply(const Color* pIn, Color* pOut, const UINT Count)
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		ParallelFor(Count, CHUNK_SIZE, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT i = Begin; i < End; i++)
+			{
+				const XMVECTOR c = pIn[i];
+				const XMVECTOR a = XMVectorSplatW(c);
+
+				XMVECTOR Scale = XMVectorSelect(g_XMZero, XMVectorReciprocal(a), XMVectorGreater(a, g_XMZero));
+				Scale = XMVectorSelect(g_XMOne, Scale, g_XMSelect1110);
+
+				pOut[i] = XMVectorMultiply(c, Scale);
+			}
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ColorConvert::PackRGB565(const Color* pIn, uint16_t* pOut, const UINT Count)
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		const XMVECTOR Scale = XMVectorSet(31.0f, 63.0f, 31.0f, 0.0f);
+
+		ParallelFor(Count, CHUNK_SIZE, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT i = Begin; i < End; i++)
+			{
+				const XMUINT4 q = Quantize(pIn[i], Scale);
+
+				pOut[i] = (uint16_t)((q.x << 11) | (q.y << 5) | q.z);
+			}
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ColorConvert::PackRGB555(const Color* pIn, uint16_t* pOut, const UINT Count)
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		const XMVECTOR Scale = XMVectorSet(31.0f, 31.0f, 31.0f, 0.0f);
+
+		ParallelFor(Count, CHUNK_SIZE, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT i = Begin; i < End; i++)
+			{
+				const XMUINT4 q = Quantize(pIn[i], Scale);
+
+				pOut[i] = (uint16_t)((q.x << 10) | (q.y << 5) | q.z);
+			}
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ColorConvert::PackARGB4444(const Color* pIn, uint16_t* pOut, const UINT Count)
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		const XMVECTOR Scale = XMVectorReplicate(15.0f);
+
+		ParallelFor(Count, CHUNK_SIZE, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT i = Begin; i < End; i++)
+			{
+				const XMUINT4 q = Quantize(pIn[i], Scale);
+
+				pOut[i] = (uint16_t)((q.w << 12) | (q.x << 8) | (q.y << 4) | q.z);
+			}
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ColorConvert::PackR10G10B10A2(const Color* pIn, uint32_t* pOut, const UINT Count)
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		const XMVECTOR Scale = XMVectorSet(1023.0f, 1023.0f, 1023.0f, 3.0f);
+
+		ParallelFor(Count, CHUNK_SIZE, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT i = Begin; i < End; i++)
+			{
+				const XMUINT4 q = Quantize(pIn[i], Scale);
+
+				pOut[i] = (q.w << 30) | (q.z << 20) | (q.y << 10) | q.x;
+			}
+		});
+	}
+
+}// end of Namespace TurboMath
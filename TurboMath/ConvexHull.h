@@ -0,0 +1,228 @@
+// -------------------------------------------------------------------
+// File			:	ConvexHull
+//
+// Project		:	TurboMath
+//
+// Description	:	3D Convex Hull (Quickhull) as Half-Edge-Mesh
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_CONVEXHULL_H_
+#define _TURBOMATH_CONVEXHULL_H_
+
+#include <vector>
+#include <algorithm>
+
+namespace TurboMath
+{
+
+	//-----------------------------------------------------------------------------
+	// Half-Edge of the Hull : starts at Vertex, Next is the following Edge of
+	// the same Face (counter-clockwise seen from outside), Twin the opposite
+	// Edge of the neighbouring Face.
+	//-----------------------------------------------------------------------------
+	struct HullHalfEdge
+	{
+		UINT	Vertex;
+		UINT	Twin;
+		UINT	Next;
+		UINT	Face;
+	};
+
+	//-----------------------------------------------------------------------------
+	// Face of the Hull with its outward Plane (a, b, c, d) and its first Edge
+	//-----------------------------------------------------------------------------
+	struct HullFace
+	{
+		XMFLOAT4	Plane;
+		UINT		Edge;
+		UINT		NumEdges;
+	};
+
+	//-----------------------------------------------------------------------------
+	// Convex Hull of a Point-Set, built with Quickhull (Barber et al. 1996) :
+	// starting with a Tetrahedron of extreme Points, the farthest Point outside
+	// a Face is added, the Faces visible from it are removed and the Horizon is
+	// closed with new Faces, until no Point is outside.
+	//
+	// The Points are kept as SoA-Streams, the extreme- and farthest-Point-
+	// Searches and the Assignment of Points to Faces test 4 Points (or 4
+	// Planes) per Instruction. All Faces, Edges and Point-Lists live in
+	// Arrays, which are reserved once per Build and reused for the next Build.
+	//
+	// Points closer than the Epsilon to a Face count as inside, so coplanar
+	// Points don't create Sliver-Faces, and neighbouring Triangles within the
+	// Epsilon of one Plane are merged into one convex Polygon-Face (a Cube
+	// has 6 Quads, Points on its Edges are no Vertices). Completely flat Input
+	// gives a 2-sided Polygon (2 Faces), colinear Input or less than 3 Points
+	// no Hull.
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class ConvexHull
+	{
+	public:
+
+		typedef std::vector<float, AAllocator<float> >		FloatStream;
+		typedef std::vector<Vector4, AAllocator<Vector4> >	VertexArray;
+
+		/// Index for "none"
+		static constexpr UINT INVALID_INDEX = 0xFFFFFFFF;
+
+		ConvexHull() noexcept;
+		~ConvexHull() noexcept;
+
+		/// remove the Hull
+		void			XM_CALLCONV Clear() noexcept;
+
+		/// is the Hull empty ?
+		const bool		XM_CALLCONV IsEmpty() const noexcept				{ return m_Faces.empty(); }
+
+		/// is the Hull a flat Polygon (coplanar Input) ?
+		const bool		XM_CALLCONV IsFlat() const noexcept					{ return m_bFlat; }
+
+		//-----------------------------------------------------------------------------
+		// Build
+		//-----------------------------------------------------------------------------
+
+		/// build the Hull of the Points (Epsilon = 0 : from the Size of the Input), false for degenerated Input
+		const bool		XM_CALLCONV Build(const Vector4* pPoints, const UINT Count, const float Epsilon = 0.0f);
+
+		/// build the Hull of the Points
+		const bool		XM_CALLCONV Build(const XMFLOAT3* pPoints, const UINT Count, const float Epsilon = 0.0f);
+
+		//-----------------------------------------------------------------------------
+		// Access
+		//-----------------------------------------------------------------------------
+
+		/// get Number of Vertices / Faces / Half-Edges
+		const UINT		XM_CALLCONV GetNumVertices() const noexcept			{ return (UINT)m_Vertices.size(); }
+		const UINT		XM_CALLCONV GetNumFaces() const noexcept			{ return (UINT)m_Faces.size(); }
+		const UINT		XM_CALLCONV GetNumEdges() const noexcept			{ return (UINT)m_Edges.size(); }
+
+		/// get the Vertices of the Hull
+		const Vector4*	XM_CALLCONV GetVertices() const noexcept			{ return m_Vertices.data(); }
+
+		/// get the Index of a Vertex in the Input
+		const UINT		XM_CALLCONV GetInputIndex(const UINT Vertex) const noexcept	{ return m_InputIndices[Vertex]; }
+
+		/// get the Faces / Half-Edges
+		const HullFace*		XM_CALLCONV GetFaces() const noexcept			{ return m_Faces.data(); }
+		const HullHalfEdge*	XM_CALLCONV GetEdges() const noexcept			{ return m_Edges.data(); }
+
+		/// get the outward Plane of a Face
+		const Plane		XM_CALLCONV GetFacePlane(const UINT Face) const noexcept;
+
+		/// append the Vertex-Indices of a Face (counter-clockwise), returns their Number
+		const UINT		XM_CALLCONV GetFaceVertices(const UINT Face, std::vector<UINT>& Vertices) const;
+
+		/// the Epsilon used for the last Build
+		const float		XM_CALLCONV GetEpsilon() const noexcept				{ return m_Epsilon; }
+
+		//-----------------------------------------------------------------------------
+		// Queries
+		//-----------------------------------------------------------------------------
+
+		/// is the Point inside (or on) the Hull ? (for a flat Hull : on the Polygon)
+		const bool		XM_CALLCONV IsInside(const Vector4& Point) const noexcept;
+
+		/// Volume of the Hull
+		const float		XM_CALLCONV GetVolume() const noexcept;
+
+	protected:
+
+		/// Faces while building
+		struct BuildFace
+		{
+			UINT	OutsideHead;	// first Point of the Outside-List
+			UINT	Farthest;		// farthest Point of the Outside-List
+			float	FarthestDist;
+			UINT	Flags;
+		};
+
+		static constexpr UINT FACE_ALIVE = 1;
+		static constexpr UINT FACE_VISIBLE = 2;
+
+		/// Bound of the Faces while building Count Points : 2n - 4 on the Hull of n Points and a Cone of up to n new Faces
+		static constexpr UINT MaxWorkFaces(const UINT Count) noexcept		{ return 3 * Count + 16; }
+
+		/// index of the Point with the largest Func(X, Y, Z) (4 Points per Call), returns its Value in MaxValue
+		template <class DistFunc>
+		const UINT		XM_CALLCONV FarthestPoint(const DistFunc& Func, float& MaxValue) const noexcept;
+
+		/// Quickhull on the SoA-Streams
+		const bool		XM_CALLCONV BuildHull(const float Epsilon);
+
+		/// Hull of coplanar Points (2-sided Polygon)
+		const bool		XM_CALLCONV BuildFlatHull(FXMVECTOR Normal);
+
+		/// new Triangle (a, b, c), returns the Face
+		const UINT		XM_CALLCONV AddTriangle(const UINT a, const UINT b, const UINT c);
+
+		/// free a Face and its Edges
+		void			XM_CALLCONV RemoveFace(const UINT Face) noexcept;
+
+		/// compute the Plane of a Face
+		void			XM_CALLCONV ComputePlane(const UINT Face) noexcept;
+
+		/// put the Points on the Outside-List of the best of the Faces (or drop them)
+		void			XM_CALLCONV AssignPoints(const UINT* pPoints, const UINT NumPoints, const UINT* pFaces, const UINT NumFaces);
+
+		/// > 0, if the Point is in front of the Triangle-Face (Volume of the Tetrahedron * 6)
+		const double	XM_CALLCONV Orientation(const UINT Face, const UINT Point) const noexcept;
+
+		/// collect the Horizon seen from Point Eye, starting at the visible Face
+		void			XM_CALLCONV FindHorizon(const UINT Eye, const UINT Face);
+
+		/// are all Vertices of the Face within the Epsilon of the Plane ?
+		const bool		XM_CALLCONV IsCoplanar(const XMFLOAT4& FacePlane, const UINT Face) const noexcept;
+
+		/// copy the living Faces into the compact Output, coplanar Faces merged
+		void			XM_CALLCONV Compact();
+
+		/// Position of an Input-Point
+		XMVECTOR		XM_CALLCONV GetPoint(const UINT i) const noexcept	{ return XMVectorSet(m_X[i], m_Y[i], m_Z[i], 0.0f); }
+
+		// Output
+		VertexArray					m_Vertices;
+		std::vector<UINT>			m_InputIndices;
+		std::vector<HullFace>		m_Faces;
+		std::vector<HullHalfEdge>	m_Edges;
+		float						m_Epsilon;
+		bool						m_bFlat;
+
+		// Arena of the Build (reused)
+		FloatStream					m_X, m_Y, m_Z;
+		std::vector<UINT>			m_NextOutside;		// Outside-Lists
+		std::vector<HullFace>		m_WorkFaces;
+		std::vector<BuildFace>		m_BuildFaces;
+		std::vector<HullHalfEdge>	m_WorkEdges;
+		std::vector<UINT>			m_FreeFaces;
+		std::vector<UINT>			m_FreeEdges;
+		std::vector<UINT>			m_Pending;
+		std::vector<UINT>			m_Horizon;
+		std::vector<UINT>			m_VisibleFaces;
+		std::vector<UINT>			m_NewFaces;
+		std::vector<UINT>			m_Orphans;
+		std::vector<UINT>			m_Stack;
+		std::vector<float>			m_Areas;			// squared double Areas of the Faces (Compact)
+		std::vector<XMFLOAT4A, AAllocator<XMFLOAT4A> >	m_PlaneRows;	// Planes of 4 Faces transposed (AssignPoints)
+	};
+
+}; // end of namespace
+
+#endif
@@ -0,0 +1,1195 @@
+// -------------------------------------------------------------------
+// File			:	ConvexHull
+//
+// Project		:	TurboMath
+//
+// Description	:	3D Convex Hull (Quickhull) as Half-Edge-Mesh
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+namespace TurboMath
+{
+	//------------------------------------------------------------------------------
+	XM_INLINE ConvexHull::ConvexHull() noexcept
+		: m_Epsilon(0.0f), m_bFlat(false)
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE ConvexHull::~ConvexHull() noexcept
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ConvexHull::Clear() noexcept
+	{
+		m_Vertices.clear();
+		m_InputIndices.clear();
+		m_Faces.clear();
+		m_Edges.clear();
+		m_Epsilon = 0.0f;
+		m_bFlat = false;
+	}
+
+	//------------------------------------------------------------------------------
+	// Build
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV ConvexHull::Build(const Vector4* pPoints, const UINT Count, const float Epsilon)
+	{
+		assert(pPoints != nullptr || Count == 0);
+
+		m_X.resize(Count);
+		m_Y.resize(Count);
+		m_Z.resize(Count);
+
+		for (UINT i = 0; i < Count; ++i)
+		{
+			const float* p = pPoints[i];
+
+			m_X[i] = p[0];
+			m_Y[i] = p[1];
+			m_Z[i] = p[2];
+		}
+
+		return BuildHull(Epsilon);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV ConvexHull::Build(const XMFLOAT3* pPoints, const UINT Count, const float Epsilon)
+	{
+		assert(pPoints != nullptr || Count == 0);
+
+		m_X.resize(Count);
+		m_Y.resize(Count);
+		m_Z.resize(Count);
+
+		for (UINT i = 0; i < Count; ++i)
+		{
+			m_X[i] = pPoints[i].x;
+			m_Y[i] = pPoints[i].y;
+			m_Z[i] = pPoints[i].z;
+		}
+
+		return BuildHull(Epsilon);
+	}
+
+	//------------------------------------------------------------------------------
+	// Func gets the X-, Y- and Z-Coordinates of 4 Points and returns their 4
+	// Values. The Indices are carried along as Floats (exact up to 2^24), so
+	// the Search needs no Integer-Compares.
+	//------------------------------------------------------------------------------
+	template <class DistFunc>
+	XM_INLINE const UINT XM_CALLCONV ConvexHull::FarthestPoint(const DistFunc& Func, float& MaxValue) const noexcept
+	{
+		const UINT Count = (UINT)m_X.size();
+		const UINT Count4 = Count & ~3u;
+
+		assert(Count > 0 && Count < (1u << 24));
+
+		XMVECTOR BestValue = XMVectorReplicate(-FLT_MAX);
+		XMVECTOR BestIndex = XMVectorZero();
+		XMVECTOR Index = XMVectorSet(0.0f, 1.0f, 2.0f, 3.0f);
+		const XMVECTOR Four = XMVectorReplicate(4.0f);
+
+		for (UINT i = 0; i < Count4; i += 4)
+		{
+			const XMVECTOR Value = Func(XMLoadFloat4((const XMFLOAT4*)&m_X[i]), XMLoadFloat4((const XMFLOAT4*)&m_Y[i]), XMLoadFloat4((const XMFLOAT4*)&m_Z[i]));
+			const XMVECTOR Greater = XMVectorGreater(Value, BestValue);
+
+			BestValue = XMVectorSelect(BestValue, Value, Greater);
+			BestIndex = XMVectorSelect(BestIndex, Index, Greater);
+			Index = XMVectorAdd(Index, Four);
+		}
+
+		CACHE_ALIGN(16) float Values[4];
+		CACHE_ALIGN(16) float Indices[4];
+
+		XMStoreFloat4A((XMFLOAT4A*)Values, BestValue);
+		XMStoreFloat4A((XMFLOAT4A*)Indices, BestIndex);
+
+		UINT Best = INVALID_INDEX;
+		MaxValue = -FLT_MAX;
+
+		for (UINT Lane = 0; Lane < 4 && Count4 > 0; ++Lane)
+		{
+			const UINT i = (UINT)Indices[Lane];
+
+			if (Values[Lane] > MaxValue || (Values[Lane] == MaxValue && i < Best))
+			{
+				MaxValue = Values[Lane];
+				Best = i;
+			}
+		}
+
+		for (UINT i = Count4; i < Count; ++i)
+		{
+			const float Value = XMVectorGetX(Func(XMVectorReplicate(m_X[i]), XMVectorReplicate(m_Y[i]), XMVectorReplicate(m_Z[i])));
+
+			if (Value > MaxValue || Best == INVALID_INDEX)
+			{
+				MaxValue = Value;
+				Best = i;
+			}
+		}
+
+		return Best;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV ConvexHull::BuildHull(const float Epsilon)
+	{
+		const UINT Count = (UINT)m_X.size();
+
+		Clear();
+
+		if (Count < 3)
+			return false;
+
+		// extreme Points on the Axes (+X, -X, +Y, -Y, +Z, -Z)
+		UINT Extremes[6];
+		float ExtremeValues[6];
+
+		Extremes[0] = FarthestPoint([](FXMVECTOR X, FXMVECTOR, FXMVECTOR) { return X; }, ExtremeValues[0]);
+		Extremes[1] = FarthestPoint([](FXMVECTOR X, FXMVECTOR, FXMVECTOR) { return XMVectorNegate(X); }, ExtremeValues[1]);
+		Extremes[2] = FarthestPoint([](FXMVECTOR, FXMVECTOR Y, FXMVECTOR) { return Y; }, ExtremeValues[2]);
+		Extremes[3] = FarthestPoint([](FXMVECTOR, FXMVECTOR Y, FXMVECTOR) { return XMVectorNegate(Y); }, ExtremeValues[3]);
+		Extremes[4] = FarthestPoint([](FXMVECTOR, FXMVECTOR, FXMVECTOR Z) { return Z; }, ExtremeValues[4]);
+		Extremes[5] = FarthestPoint([](FXMVECTOR, FXMVECTOR, FXMVECTOR Z) { return XMVectorNegate(Z); }, ExtremeValues[5]);
+
+		// Tolerance relative to the Size of the Input (like qhull)
+		float Eps = Epsilon;
+
+		if (Eps <= 0.0f)
+		{
+			Eps = 3.0f * FLT_EPSILON * (XMMax(fabsf(ExtremeValues[0]), fabsf(ExtremeValues[1]))
+									  + XMMax(fabsf(ExtremeValues[2]), fabsf(ExtremeValues[3]))
+									  + XMMax(fabsf(ExtremeValues[4]), fabsf(ExtremeValues[5])));
+		}
+
+		m_Epsilon = Eps;
+
+		// 1. + 2. Point : the farthest Pair of the Extremes
+		UINT i0 = Extremes[0];
+		UINT i1 = Extremes[1];
+		float MaxDistSq = -1.0f;
+
+		for (UINT a = 0; a < 6; ++a)
+		{
+			for (UINT b = a + 1; b < 6; ++b)
+			{
+				const float DistSq = XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(GetPoint(Extremes[a]), GetPoint(Extremes[b]))));
+
+				if (DistSq > MaxDistSq)
+				{
+					MaxDistSq = DistSq;
+					i0 = Extremes[a];
+					i1 = Extremes[b];
+				}
+			}
+		}
+
+		if (sqrtf(MaxDistSq) <= Eps)
+			return false;
+
+		// 3. Point : farthest from the Line
+		const XMVECTOR A = GetPoint(i0);
+		const XMVECTOR Dir = XMVector3Normalize(XMVectorSubtract(GetPoint(i1), A));
+
+		float MaxValue;
+
+		{
+			const XMVECTOR Ax = XMVectorSplatX(A), Ay = XMVectorSplatY(A), Az = XMVectorSplatZ(A);
+			const XMVECTOR Dx = XMVectorSplatX(Dir), Dy = XMVectorSplatY(Dir), Dz = XMVectorSplatZ(Dir);
+
+			UINT i2 = FarthestPoint([&](FXMVECTOR X, FXMVECTOR Y, FXMVECTOR Z)
+			{
+				const XMVECTOR Px = XMVectorSubtract(X, Ax);
+				const XMVECTOR Py = XMVectorSubtract(Y, Ay);
+				const XMVECTOR Pz = XMVectorSubtract(Z, Az);
+
+				// |(P - A) x Dir|^2
+				const XMVECTOR Cx = XMVectorNegativeMultiplySubtract(Pz, Dy, XMVectorMultiply(Py, Dz));
+				const XMVECTOR Cy = XMVectorNegativeMultiplySubtract(Px, Dz, XMVectorMultiply(Pz, Dx));
+				const XMVECTOR Cz = XMVectorNegativeMultiplySubtract(Py, Dx, XMVectorMultiply(Px, Dy));
+
+				return XMVectorMultiplyAdd(Cx, Cx, XMVectorMultiplyAdd(Cy, Cy, XMVectorMultiply(Cz, Cz)));
+			}, MaxValue);
+
+			if (sqrtf(MaxValue) <= Eps)
+				return false;	// colinear
+
+			// 4. Point : farthest from the Plane
+			const XMVECTOR N = XMVector3Normalize(XMVector3Cross(XMVectorSubtract(GetPoint(i1), A), XMVectorSubtract(GetPoint(i2), A)));
+			const XMVECTOR Nx = XMVectorSplatX(N), Ny = XMVectorSplatY(N), Nz = XMVectorSplatZ(N);
+			const XMVECTOR D = XMVectorNegate(XMVector3Dot(N, A));
+
+			const UINT i3 = FarthestPoint([&](FXMVECTOR X, FXMVECTOR Y, FXMVECTOR Z)
+			{
+				return XMVectorAbs(XMVectorMultiplyAdd(X, Nx, XMVectorMultiplyAdd(Y, Ny, XMVectorMultiplyAdd(Z, Nz, D))));
+			}, MaxValue);
+
+			if (MaxValue <= Eps)
+				return BuildFlatHull(N);
+
+			// the Base (i0, i1, i2) has to face away from the 4. Point
+			if (XMVectorGetX(XMVectorAdd(XMVector3Dot(N, GetPoint(i3)), D)) > 0.0f)
+				std::swap(i1, i2);
+
+			// reset the Arena
+			m_WorkFaces.clear();
+			m_BuildFaces.clear();
+			m_WorkEdges.clear();
+			m_FreeFaces.clear();
+			m_FreeEdges.clear();
+			m_Pending.clear();
+
+			// a Hull of n Vertices has up to 2n - 4 Faces, the Cone of a new
+			// Point (up to n Faces) is added before the visible Faces are freed
+			m_WorkFaces.reserve(MaxWorkFaces(Count));
+			m_BuildFaces.reserve(MaxWorkFaces(Count));
+			m_WorkEdges.reserve(3 * MaxWorkFaces(Count));
+			m_NextOutside.assign(Count, INVALID_INDEX);
+
+			// Tetrahedron
+			UINT Faces[4];
+
+			Faces[0] = AddTriangle(i0, i1, i2);
+			Faces[1] = AddTriangle(i1, i0, i3);
+			Faces[2] = AddTriangle(i2, i1, i3);
+			Faces[3] = AddTriangle(i0, i2, i3);
+
+			const UINT NumEdges = (UINT)m_WorkEdges.size();
+
+			for (UINT e = 0; e < NumEdges; ++e)
+			{
+				HullHalfEdge& Edge = m_WorkEdges[e];
+				const UINT End = m_WorkEdges[Edge.Next].Vertex;
+
+				for (UINT t = 0; t < NumEdges; ++t)
+				{
+					if (m_WorkEdges[t].Vertex == End && m_WorkEdges[m_WorkEdges[t].Next].Vertex == Edge.Vertex)
+					{
+						Edge.Twin = t;
+						break;
+					}
+				}
+			}
+
+			// all other Points to the Faces
+			m_Orphans.clear();
+
+			for (UINT i = 0; i < Count; ++i)
+			{
+				if (i != i0 && i != i1 && i != i2 && i != i3)
+					m_Orphans.push_back(i);
+			}
+
+			AssignPoints(m_Orphans.data(), (UINT)m_Orphans.size(), Faces, 4);
+
+			for (UINT f = 0; f < 4; ++f)
+			{
+				if (m_BuildFaces[Faces[f]].OutsideHead != INVALID_INDEX)
+					m_Pending.push_back(Faces[f]);
+			}
+		}
+
+		// add the farthest Point of a Face until no Point is outside
+		while (!m_Pending.empty())
+		{
+			const UINT Face = m_Pending.back();
+			m_Pending.pop_back();
+
+			if ((m_BuildFaces[Face].Flags & FACE_ALIVE) == 0 || m_BuildFaces[Face].OutsideHead == INVALID_INDEX)
+				continue;
+
+			const UINT Eye = m_BuildFaces[Face].Farthest;
+
+			// the float Plane of a thin Face may see a Point the exact Test
+			// puts on or behind the Face : the Point is dropped as coplanar
+			if (Orientation(Face, Eye) <= 0.0)
+			{
+				m_Orphans.clear();
+
+				for (UINT p = m_BuildFaces[Face].OutsideHead; p != INVALID_INDEX; p = m_NextOutside[p])
+				{
+					if (p != Eye)
+						m_Orphans.push_back(p);
+				}
+
+				m_BuildFaces[Face].OutsideHead = INVALID_INDEX;
+				m_BuildFaces[Face].Farthest = INVALID_INDEX;
+
+				AssignPoints(m_Orphans.data(), (UINT)m_Orphans.size(), &Face, 1);
+
+				if (m_BuildFaces[Face].OutsideHead != INVALID_INDEX)
+					m_Pending.push_back(Face);
+
+				continue;
+			}
+
+			FindHorizon(Eye, Face);
+
+			assert(m_Horizon.size() >= 3);
+
+			// Points of the visible Faces have to be assigned again
+			m_Orphans.clear();
+
+			for (const UINT v : m_VisibleFaces)
+			{
+				for (UINT p = m_BuildFaces[v].OutsideHead; p != INVALID_INDEX; p = m_NextOutside[p])
+				{
+					if (p != Eye)
+						m_Orphans.push_back(p);
+				}
+
+				m_BuildFaces[v].OutsideHead = INVALID_INDEX;
+			}
+
+			// close the Horizon with a Cone of new Faces (before the visible Faces are freed,
+			// because the Horizon-Edges belong to them)
+			m_NewFaces.clear();
+
+			for (const UINT e : m_Horizon)
+			{
+				const UINT Twin = m_WorkEdges[e].Twin;
+				const UINT NewFace = AddTriangle(m_WorkEdges[e].Vertex, m_WorkEdges[m_WorkEdges[e].Next].Vertex, Eye);
+				const UINT NewEdge = m_WorkFaces[NewFace].Edge;
+
+				m_WorkEdges[NewEdge].Twin = Twin;
+				m_WorkEdges[Twin].Twin = NewEdge;
+
+				m_NewFaces.push_back(NewFace);
+			}
+
+			const UINT NumNew = (UINT)m_NewFaces.size();
+
+			for (UINT i = 0; i < NumNew; ++i)
+			{
+				// (b -> Eye) of this Face and (Eye -> a) of the next Face
+				const UINT Side = m_WorkEdges[m_WorkFaces[m_NewFaces[i]].Edge].Next;
+				const UINT NextFirst = m_WorkFaces[m_NewFaces[(i + 1) % NumNew]].Edge;
+				const UINT NextSide = m_WorkEdges[m_WorkEdges[NextFirst].Next].Next;
+
+				m_WorkEdges[Side].Twin = NextSide;
+				m_WorkEdges[NextSide].Twin = Side;
+			}
+
+			for (const UINT v : m_VisibleFaces)
+				RemoveFace(v);
+
+			AssignPoints(m_Orphans.data(), (UINT)m_Orphans.size(), m_NewFaces.data(), NumNew);
+
+			for (const UINT f : m_NewFaces)
+			{
+				if (m_BuildFaces[f].OutsideHead != INVALID_INDEX)
+					m_Pending.push_back(f);
+			}
+		}
+
+		Compact();
+
+		return true;
+	}
+
+	//------------------------------------------------------------------------------
+	// Andrews Monotone Chain in a Basis of the Plane, the Polygon is stored as
+	// Front- and Back-Face sharing the same Vertices.
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV ConvexHull::BuildFlatHull(FXMVECTOR Normal)
+	{
+		const UINT Count = (UINT)m_X.size();
+
+		// right-handed Basis (U, V, Normal)
+		const XMVECTOR Axis = (fabsf(XMVectorGetX(Normal)) > 0.9f) ? g_XMIdentityR1.v : g_XMIdentityR0.v;
+		const XMVECTOR U = XMVector3Normalize(XMVector3Cross(Normal, Axis));
+		const XMVECTOR V = XMVector3Cross(Normal, U);
+
+		// projected Points (the Plane-Rows are free here)
+		m_PlaneRows.resize(Count);
+		m_Orphans.resize(Count);
+
+		for (UINT i = 0; i < Count; ++i)
+		{
+			const XMVECTOR P = GetPoint(i);
+
+			m_PlaneRows[i] = XMFLOAT4A(XMVectorGetX(XMVector3Dot(P, U)), XMVectorGetX(XMVector3Dot(P, V)), 0.0f, 0.0f);
+			m_Orphans[i] = i;
+		}
+
+		const XMFLOAT4A* pUV = m_PlaneRows.data();
+
+		std::sort(m_Orphans.begin(), m_Orphans.end(), [pUV](const UINT a, const UINT b)
+		{
+			return (pUV[a].x < pUV[b].x) || (pUV[a].x == pUV[b].x && pUV[a].y < pUV[b].y);
+		});
+
+		// a is dropped, if it is closer than Epsilon to the Chord o -> b
+		const float Eps = m_Epsilon;
+
+		auto IsConvex = [pUV, Eps](const UINT o, const UINT a, const UINT b)
+		{
+			const float ax = pUV[a].x - pUV[o].x, ay = pUV[a].y - pUV[o].y;
+			const float bx = pUV[b].x - pUV[o].x, by = pUV[b].y - pUV[o].y;
+
+			return (bx * ay - by * ax) < -Eps * sqrtf(bx * bx + by * by);
+		};
+
+		m_Stack.resize(2 * Count);
+
+		UINT k = 0;
+
+		// lower Chain
+		for (UINT i = 0; i < Count; ++i)
+		{
+			while (k >= 2 && !IsConvex(m_Stack[k - 2], m_Stack[k - 1], m_Orphans[i]))
+				--k;
+
+			m_Stack[k++] = m_Orphans[i];
+		}
+
+		// upper Chain
+		for (UINT i = Count - 1, t = k + 1; i-- > 0;)
+		{
+			while (k >= t && !IsConvex(m_Stack[k - 2], m_Stack[k - 1], m_Orphans[i]))
+				--k;
+
+			m_Stack[k++] = m_Orphans[i];
+		}
+
+		const UINT NumVertices = k - 1;	// the last Point is the first one
+
+		if (NumVertices < 3)
+			return false;
+
+		m_bFlat = true;
+
+		XMVECTOR Centroid = XMVectorZero();
+
+		for (UINT i = 0; i < NumVertices; ++i)
+		{
+			const XMVECTOR P = GetPoint(m_Stack[i]);
+
+			m_Vertices.push_back(Vector4(P));
+			m_InputIndices.push_back(m_Stack[i]);
+
+			Centroid = XMVectorAdd(Centroid, P);
+		}
+
+		Centroid = XMVectorScale(Centroid, 1.0f / (float)NumVertices);
+
+		const XMVECTOR FrontPlane = XMVectorSetW(Normal, -XMVectorGetX(XMVector3Dot(Normal, Centroid)));
+
+		HullFace Front, Back;
+
+		XMStoreFloat4(&Front.Plane, FrontPlane);
+		XMStoreFloat4(&Back.Plane, XMVectorNegate(FrontPlane));
+
+		Front.Edge = 0;
+		Front.NumEdges = NumVertices;
+		Back.Edge = NumVertices;
+		Back.NumEdges = NumVertices;
+
+		m_Faces.push_back(Front);
+		m_Faces.push_back(Back);
+
+		m_Edges.resize(2 * NumVertices);
+
+		for (UINT i = 0; i < NumVertices; ++i)
+		{
+			const UINT Next = (i + 1) % NumVertices;
+
+			// v(i) -> v(i + 1) on the Front
+			HullHalfEdge& F = m_Edges[i];
+
+			F.Vertex = i;
+			F.Twin = NumVertices + i;
+			F.Next = Next;
+			F.Face = 0;
+
+			// v(i + 1) -> v(i) on the Back
+			HullHalfEdge& B = m_Edges[NumVertices + i];
+
+			B.Vertex = Next;
+			B.Twin = i;
+			B.Next = NumVertices + (i + NumVertices - 1) % NumVertices;
+			B.Face = 1;
+		}
+
+		return true;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV ConvexHull::AddTriangle(const UINT a, const UINT b, const UINT c)
+	{
+		UINT Face;
+
+		if (!m_FreeFaces.empty())
+		{
+			Face = m_FreeFaces.back();
+			m_FreeFaces.pop_back();
+		}
+		else
+		{
+			Face = (UINT)m_WorkFaces.size();
+
+			// the Arena never grows beyond its Bound
+			assert(Face < MaxWorkFaces((UINT)m_X.size()));
+
+			m_WorkFaces.emplace_back();
+			m_BuildFaces.emplace_back();
+		}
+
+		UINT Edges[3];
+
+		for (UINT k = 0; k < 3; ++k)
+		{
+			if (!m_FreeEdges.empty())
+			{
+				Edges[k] = m_FreeEdges.back();
+				m_FreeEdges.pop_back();
+			}
+			else
+			{
+				Edges[k] = (UINT)m_WorkEdges.size();
+
+				assert(Edges[k] < 3 * MaxWorkFaces((UINT)m_X.size()));
+
+				m_WorkEdges.emplace_back();
+			}
+		}
+
+		const UINT Vertices[3] = { a, b, c };
+
+		for (UINT k = 0; k < 3; ++k)
+		{
+			HullHalfEdge& Edge = m_WorkEdges[Edges[k]];
+
+			Edge.Vertex = Vertices[k];
+			Edge.Twin = INVALID_INDEX;
+			Edge.Next = Edges[(k + 1) % 3];
+			Edge.Face = Face;
+		}
+
+		m_WorkFaces[Face].Edge = Edges[0];
+		m_WorkFaces[Face].NumEdges = 3;
+
+		BuildFace& Build = m_BuildFaces[Face];
+
+		Build.OutsideHead = INVALID_INDEX;
+		Build.Farthest = INVALID_INDEX;
+		Build.FarthestDist = 0.0f;
+		Build.Flags = FACE_ALIVE;
+
+		ComputePlane(Face);
+
+		return Face;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ConvexHull::RemoveFace(const UINT Face) noexcept
+	{
+		UINT Edge = m_WorkFaces[Face].Edge;
+
+		for (UINT k = 0; k < m_WorkFaces[Face].NumEdges; ++k)
+		{
+			m_FreeEdges.push_back(Edge);
+			Edge = m_WorkEdges[Edge].Next;
+		}
+
+		m_BuildFaces[Face].Flags = 0;
+		m_FreeFaces.push_back(Face);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ConvexHull::ComputePlane(const UINT Face) noexcept
+	{
+		const HullHalfEdge& E0 = m_WorkEdges[m_WorkFaces[Face].Edge];
+		const HullHalfEdge& E1 = m_WorkEdges[E0.Next];
+		const HullHalfEdge& E2 = m_WorkEdges[E1.Next];
+
+		// in double Precision : the Normal of a thin Triangle looses most Bits in float
+		const double ax = m_X[E0.Vertex], ay = m_Y[E0.Vertex], az = m_Z[E0.Vertex];
+
+		const double bx = m_X[E1.Vertex] - ax, by = m_Y[E1.Vertex] - ay, bz = m_Z[E1.Vertex] - az;
+		const double cx = m_X[E2.Vertex] - ax, cy = m_Y[E2.Vertex] - ay, cz = m_Z[E2.Vertex] - az;
+
+		double nx = by * cz - bz * cy;
+		double ny = bz * cx - bx * cz;
+		double nz = bx * cy - by * cx;
+
+		const double Length = sqrt(nx * nx + ny * ny + nz * nz);
+
+		if (Length > 0.0)
+		{
+			nx /= Length;
+			ny /= Length;
+			nz /= Length;
+		}
+
+		// through the Centroid
+		const double d = -(nx * (ax + (bx + cx) / 3.0) + ny * (ay + (by + cy) / 3.0) + nz * (az + (bz + cz) / 3.0));
+
+		m_WorkFaces[Face].Plane = XMFLOAT4((float)nx, (float)ny, (float)nz, (float)d);
+	}
+
+	//------------------------------------------------------------------------------
+	// The Planes are stored transposed in Groups of 4 (Rows a, b, c, d), so one
+	// Point is tested against 4 Faces with 3 Multiply-Adds. Missing Faces of the
+	// last Group get d = -FLT_MAX and are never chosen.
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ConvexHull::AssignPoints(const UINT* pPoints, const UINT NumPoints, const UINT* pFaces, const UINT NumFaces)
+	{
+		const UINT NumGroups = (NumFaces + 3) / 4;
+		const XMVECTOR NoPlane = XMVectorSet(0.0f, 0.0f, 0.0f, -FLT_MAX);
+
+		m_PlaneRows.resize(NumGroups * 4);
+
+		for (UINT g = 0; g < NumGroups; ++g)
+		{
+			XMMATRIX Rows;
+
+			for (UINT k = 0; k < 4; ++k)
+			{
+				const UINT f = g * 4 + k;
+
+				Rows.r[k] = (f < NumFaces) ? XMLoadFloat4(&m_WorkFaces[pFaces[f]].Plane) : NoPlane;
+			}
+
+			Rows = XMMatrixTranspose(Rows);
+
+			for (UINT k = 0; k < 4; ++k)
+				XMStoreFloat4A(&m_PlaneRows[g * 4 + k], Rows.r[k]);
+		}
+
+		CACHE_ALIGN(16) float Dist[4];
+
+		for (UINT i = 0; i < NumPoints; ++i)
+		{
+			const UINT p = pPoints[i];
+			const XMVECTOR X = XMVectorReplicate(m_X[p]);
+			const XMVECTOR Y = XMVectorReplicate(m_Y[p]);
+			const XMVECTOR Z = XMVectorReplicate(m_Z[p]);
+
+			float BestDist = m_Epsilon;
+			UINT BestFace = INVALID_INDEX;
+
+			for (UINT g = 0; g < NumGroups; ++g)
+			{
+				const XMFLOAT4A* pRows = &m_PlaneRows[g * 4];
+				const XMVECTOR D = XMVectorMultiplyAdd(X, XMLoadFloat4A(&pRows[0]),
+									XMVectorMultiplyAdd(Y, XMLoadFloat4A(&pRows[1]),
+									XMVectorMultiplyAdd(Z, XMLoadFloat4A(&pRows[2]), XMLoadFloat4A(&pRows[3]))));
+
+				if (XMVector4LessOrEqual(D, XMVectorReplicate(BestDist)))
+					continue;
+
+				XMStoreFloat4A((XMFLOAT4A*)Dist, D);
+
+				for (UINT k = 0; k < 4; ++k)
+				{
+					if (Dist[k] > BestDist)
+					{
+						BestDist = Dist[k];
+						BestFace = pFaces[g * 4 + k];
+					}
+				}
+			}
+
+			// inside all Faces (or coplanar) : no longer needed
+			if (BestFace == INVALID_INDEX)
+				continue;
+
+			BuildFace& Build = m_BuildFaces[BestFace];
+
+			m_NextOutside[p] = Build.OutsideHead;
+			Build.OutsideHead = p;
+
+			if (Build.Farthest == INVALID_INDEX || BestDist > Build.FarthestDist)
+			{
+				Build.Farthest = p;
+				Build.FarthestDist = BestDist;
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	// The Determinant of (B - A, C - A, P - A) in double Precision : the Sign
+	// of the Visibility is then exact for nearly all float Inputs, while the
+	// float Plane of a thin or coplanar Face may say either Side.
+	//------------------------------------------------------------------------------
+	XM_INLINE const double XM_CALLCONV ConvexHull::Orientation(const UINT Face, const UINT Point) const noexcept
+	{
+		const HullHalfEdge& E0 = m_WorkEdges[m_WorkFaces[Face].Edge];
+		const HullHalfEdge& E1 = m_WorkEdges[E0.Next];
+		const HullHalfEdge& E2 = m_WorkEdges[E1.Next];
+
+		const double ax = m_X[E0.Vertex], ay = m_Y[E0.Vertex], az = m_Z[E0.Vertex];
+
+		const double bx = m_X[E1.Vertex] - ax, by = m_Y[E1.Vertex] - ay, bz = m_Z[E1.Vertex] - az;
+		const double cx = m_X[E2.Vertex] - ax, cy = m_Y[E2.Vertex] - ay, cz = m_Z[E2.Vertex] - az;
+		const double px = m_X[Point] - ax, py = m_Y[Point] - ay, pz = m_Z[Point] - az;
+
+		return px * (by * cz - bz * cy) + py * (bz * cx - bx * cz) + pz * (bx * cy - by * cx);
+	}
+
+	//------------------------------------------------------------------------------
+	// Depth-first Search over the visible Faces without Recursion : the Stack
+	// holds (current Edge, End-Edge, first Step) per Face. Entering a Face over
+	// its Edge Twin, its Edges are walked from Next[Twin] round to Twin, so the
+	// Horizon-Edges come out as a closed, counter-clockwise Loop.
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ConvexHull::FindHorizon(const UINT Eye, const UINT Face)
+	{
+		m_Horizon.clear();
+		m_VisibleFaces.clear();
+		m_Stack.clear();
+
+		m_BuildFaces[Face].Flags |= FACE_VISIBLE;
+		m_VisibleFaces.push_back(Face);
+
+		const UINT Start = m_WorkFaces[Face].Edge;
+
+		m_Stack.push_back(Start);
+		m_Stack.push_back(Start);
+		m_Stack.push_back(1);
+
+		while (!m_Stack.empty())
+		{
+			const size_t Top = m_Stack.size() - 3;
+			const UINT Edge = m_Stack[Top];
+
+			if (m_Stack[Top + 2] == 0 && Edge == m_Stack[Top + 1])
+			{
+				m_Stack.resize(Top);
+				continue;
+			}
+
+			m_Stack[Top] = m_WorkEdges[Edge].Next;
+			m_Stack[Top + 2] = 0;
+
+			const UINT Twin = m_WorkEdges[Edge].Twin;
+			const UINT Neighbour = m_WorkEdges[Twin].Face;
+
+			if (m_BuildFaces[Neighbour].Flags & FACE_VISIBLE)
+				continue;
+
+			// every Face in front of the Eye is replaced, so the Cone never
+			// meets a remaining Face at a concave Edge or folds over a
+			// coplanar Face
+			if (Orientation(Neighbour, Eye) > 0.0)
+			{
+				m_BuildFaces[Neighbour].Flags |= FACE_VISIBLE;
+				m_VisibleFaces.push_back(Neighbour);
+
+				m_Stack.push_back(m_WorkEdges[Twin].Next);
+				m_Stack.push_back(Twin);
+				m_Stack.push_back(0);
+			}
+			else
+			{
+				m_Horizon.push_back(Edge);
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	// is every Vertex of the Face closer than the Epsilon to the Plane (and
+	// does the Face look to the same Side) ?
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV ConvexHull::IsCoplanar(const XMFLOAT4& FacePlane, const UINT Face) const noexcept
+	{
+		const XMVECTOR P = XMLoadFloat4(&FacePlane);
+
+		if (XMVectorGetX(XMVector3Dot(P, XMLoadFloat4(&m_WorkFaces[Face].Plane))) <= 0.0f)
+			return false;
+
+		UINT Edge = m_WorkFaces[Face].Edge;
+
+		for (UINT k = 0; k < m_WorkFaces[Face].NumEdges; ++k)
+		{
+			if (fabsf(XMVectorGetX(XMPlaneDotCoord(P, GetPoint(m_WorkEdges[Edge].Vertex)))) > m_Epsilon)
+				return false;
+
+			Edge = m_WorkEdges[Edge].Next;
+		}
+
+		return true;
+	}
+
+	//------------------------------------------------------------------------------
+	// Neighbouring Triangles coplanar to the first Triangle of a Cluster are
+	// merged into one Polygon : its Edges are the Edges of the Cluster with the
+	// Twin outside, chained by stepping over the inner Edges. Vertices inside
+	// a Polygon are dropped. A Cluster without a single closed Boundary keeps
+	// its Triangles.
+	//
+	// A Vertex between 2 Edges to the same Neighbour lies on a straight Edge of
+	// the Hull : it is dropped too and the Edges are joined.
+	//
+	// The Arena-Arrays of the Build are reused as Index-Maps and Lists.
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ConvexHull::Compact()
+	{
+		std::vector<UINT>& VertexMap = m_NextOutside;
+		std::vector<UINT>& FaceMap = m_Pending;
+		std::vector<UINT>& EdgeMap = m_Stack;
+		std::vector<UINT>& Cluster = m_Orphans;
+		std::vector<UINT>& Loops = m_Horizon;
+
+		VertexMap.assign(m_X.size(), INVALID_INDEX);
+		FaceMap.assign(m_WorkFaces.size(), INVALID_INDEX);
+		EdgeMap.assign(m_WorkEdges.size(), INVALID_INDEX);
+		Loops.clear();
+
+		// Output-Face with the Loop of Work-Edges from First to the End of Loops
+		auto AddFace = [this, &Loops](const XMFLOAT4& FacePlane, const size_t First)
+		{
+			HullFace Face;
+
+			Face.Plane = FacePlane;
+			Face.Edge = (UINT)First;
+			Face.NumEdges = (UINT)(Loops.size() - First);
+
+			m_Faces.push_back(Face);
+		};
+
+		// the largest Triangles first : their Planes are the most exact Seeds
+		std::vector<UINT>& Seeds = m_NewFaces;
+		std::vector<float>& Area = m_Areas;
+
+		const UINT NumWorkFaces = (UINT)m_WorkFaces.size();
+
+		Seeds.clear();
+		Area.resize(NumWorkFaces);
+
+		for (UINT f = 0; f < NumWorkFaces; ++f)
+		{
+			if ((m_BuildFaces[f].Flags & FACE_ALIVE) == 0)
+				continue;
+
+			const HullHalfEdge& E0 = m_WorkEdges[m_WorkFaces[f].Edge];
+			const HullHalfEdge& E1 = m_WorkEdges[E0.Next];
+			const HullHalfEdge& E2 = m_WorkEdges[E1.Next];
+
+			const XMVECTOR A = GetPoint(E0.Vertex);
+
+			Area[f] = XMVectorGetX(XMVector3LengthSq(XMVector3Cross(XMVectorSubtract(GetPoint(E1.Vertex), A), XMVectorSubtract(GetPoint(E2.Vertex), A))));
+			Seeds.push_back(f);
+		}
+
+		std::sort(Seeds.begin(), Seeds.end(), [&Area](const UINT a, const UINT b)
+		{
+			return (Area[a] > Area[b]) || (Area[a] == Area[b] && a < b);
+		});
+
+		// 1. Pass : Clusters and their Boundary-Loops
+		for (const UINT f : Seeds)
+		{
+			if (FaceMap[f] != INVALID_INDEX)
+				continue;
+
+			// Cluster of coplanar Faces (FaceMap marks it with the next Output-Face)
+			const UINT Out = (UINT)m_Faces.size();
+			const XMFLOAT4 SeedPlane = m_WorkFaces[f].Plane;
+
+			Cluster.clear();
+			Cluster.push_back(f);
+			FaceMap[f] = Out;
+
+			UINT NumBoundary = 0;
+
+			for (size_t i = 0; i < Cluster.size(); ++i)
+			{
+				UINT Edge = m_WorkFaces[Cluster[i]].Edge;
+
+				for (UINT k = 0; k < m_WorkFaces[Cluster[i]].NumEdges; ++k)
+				{
+					const UINT Neighbour = m_WorkEdges[m_WorkEdges[Edge].Twin].Face;
+
+					if (FaceMap[Neighbour] == INVALID_INDEX && IsCoplanar(SeedPlane, Neighbour))
+					{
+						FaceMap[Neighbour] = Out;
+						Cluster.push_back(Neighbour);
+					}
+
+					Edge = m_WorkEdges[Edge].Next;
+				}
+			}
+
+			// Boundary-Loop
+			UINT First = INVALID_INDEX;
+
+			for (const UINT c : Cluster)
+			{
+				UINT Edge = m_WorkFaces[c].Edge;
+
+				for (UINT k = 0; k < m_WorkFaces[c].NumEdges; ++k)
+				{
+					if (FaceMap[m_WorkEdges[m_WorkEdges[Edge].Twin].Face] != Out)
+					{
+						++NumBoundary;
+
+						if (First == INVALID_INDEX)
+							First = Edge;
+					}
+
+					Edge = m_WorkEdges[Edge].Next;
+				}
+			}
+
+			const size_t LoopStart = Loops.size();
+
+			for (UINT Edge = First; Loops.size() - LoopStart <= NumBoundary;)
+			{
+				Loops.push_back(Edge);
+
+				// step over the inner Edges around the End-Vertex
+				UINT Next = m_WorkEdges[Edge].Next;
+
+				while (FaceMap[m_WorkEdges[m_WorkEdges[Next].Twin].Face] == Out)
+					Next = m_WorkEdges[m_WorkEdges[Next].Twin].Next;
+
+				if (Next == First)
+					break;
+
+				Edge = Next;
+			}
+
+			const size_t NumLoop = Loops.size() - LoopStart;
+
+			if (Cluster.size() == 1)
+			{
+				AddFace(SeedPlane, LoopStart);
+			}
+			else if (NumLoop == NumBoundary)
+			{
+				// Plane of the Polygon (Newell) through its Centroid
+				XMVECTOR Normal = XMVectorZero();
+				XMVECTOR Centroid = XMVectorZero();
+
+				for (size_t k = 0; k < NumLoop; ++k)
+				{
+					const XMVECTOR A = GetPoint(m_WorkEdges[Loops[LoopStart + k]].Vertex);
+					const XMVECTOR B = GetPoint(m_WorkEdges[Loops[LoopStart + (k + 1) % NumLoop]].Vertex);
+
+					Normal = XMVectorAdd(Normal, XMVector3Cross(A, B));
+					Centroid = XMVectorAdd(Centroid, A);
+				}
+
+				Normal = XMVector3Normalize(Normal);
+				Centroid = XMVectorScale(Centroid, 1.0f / (float)NumLoop);
+
+				XMFLOAT4 FacePlane;
+				XMStoreFloat4(&FacePlane, XMVectorSetW(Normal, -XMVectorGetX(XMVector3Dot(Normal, Centroid))));
+
+				AddFace(FacePlane, LoopStart);
+			}
+			else
+			{
+				// keep the Triangles
+				Loops.resize(LoopStart);
+
+				for (const UINT c : Cluster)
+				{
+					FaceMap[c] = (UINT)m_Faces.size();
+
+					const size_t TriangleStart = Loops.size();
+					const UINT e0 = m_WorkFaces[c].Edge;
+					const UINT e1 = m_WorkEdges[e0].Next;
+
+					Loops.push_back(e0);
+					Loops.push_back(e1);
+					Loops.push_back(m_WorkEdges[e1].Next);
+
+					AddFace(m_WorkFaces[c].Plane, TriangleStart);
+				}
+			}
+		}
+
+		// 2. Pass : Output-Edges, a Run of Loop-Edges to the same Neighbour becomes
+		// one Edge (its Twin is the first Edge of the matching Run of the Neighbour)
+		const UINT NumFaces = (UINT)m_Faces.size();
+
+		for (UINT f = 0; f < NumFaces; ++f)
+		{
+			HullFace& Face = m_Faces[f];
+
+			const UINT* pLoop = &Loops[Face.Edge];
+			const UINT NumLoop = Face.NumEdges;
+
+			auto Neighbour = [&](const UINT k)
+			{
+				return FaceMap[m_WorkEdges[m_WorkEdges[pLoop[k % NumLoop]].Twin].Face];
+			};
+
+			// start at a Vertex, which is kept
+			UINT Start = 0;
+
+			while (Start < NumLoop && Neighbour(Start + NumLoop - 1) == Neighbour(Start))
+				++Start;
+
+			assert(Start < NumLoop);
+
+			const UINT FirstEdge = (UINT)m_Edges.size();
+
+			for (UINT k = 0; k < NumLoop;)
+			{
+				UINT Last = k;
+
+				while (Last + 1 < NumLoop && Neighbour(Start + Last + 1) == Neighbour(Start + k))
+					++Last;
+
+				const UINT Rep = pLoop[(Start + k) % NumLoop];
+
+				HullHalfEdge Edge = m_WorkEdges[Rep];
+
+				Edge.Twin = m_WorkEdges[pLoop[(Start + Last) % NumLoop]].Twin;
+				Edge.Next = (UINT)m_Edges.size() + 1;
+				Edge.Face = f;
+
+				EdgeMap[Rep] = (UINT)m_Edges.size();
+				m_Edges.push_back(Edge);
+
+				k = Last + 1;
+			}
+
+			m_Edges.back().Next = FirstEdge;
+
+			Face.Edge = FirstEdge;
+			Face.NumEdges = (UINT)m_Edges.size() - FirstEdge;
+
+			assert(Face.NumEdges >= 3);
+		}
+
+		// Vertices in the Order of the Faces
+		for (HullHalfEdge& Edge : m_Edges)
+		{
+			if (VertexMap[Edge.Vertex] == INVALID_INDEX)
+			{
+				VertexMap[Edge.Vertex] = (UINT)m_Vertices.size();
+				m_Vertices.push_back(Vector4(GetPoint(Edge.Vertex)));
+				m_InputIndices.push_back(Edge.Vertex);
+			}
+
+			Edge.Vertex = VertexMap[Edge.Vertex];
+			Edge.Twin = EdgeMap[Edge.Twin];
+		}
+
+		m_Pending.clear();
+		m_Stack.clear();
+		m_Horizon.clear();
+	}
+
+	//------------------------------------------------------------------------------
+	// Access
+	//------------------------------------------------------------------------------
+	XM_INLINE const Plane XM_CALLCONV ConvexHull::GetFacePlane(const UINT Face) const noexcept
+	{
+		assert(Face < m_Faces.size());
+
+		return Plane(XMLoadFloat4(&m_Faces[Face].Plane));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV ConvexHull::GetFaceVertices(const UINT Face, std::vector<UINT>& Vertices) const
+	{
+		assert(Face < m_Faces.size());
+
+		UINT Edge = m_Faces[Face].Edge;
+
+		for (UINT k = 0; k < m_Faces[Face].NumEdges; ++k)
+		{
+			Vertices.push_back(m_Edges[Edge].Vertex);
+			Edge = m_Edges[Edge].Next;
+		}
+
+		return m_Faces[Face].NumEdges;
+	}
+
+	//------------------------------------------------------------------------------
+	// Queries
+	//------------------------------------------------------------------------------
+	// A flat Hull has only its 2 Planes : the Point has to be within the
+	// Epsilon of the Plane and on the inner Side of all Edges of the Front-Face
+	// (counter-clockwise around its Normal).
+	XM_INLINE const bool XM_CALLCONV ConvexHull::IsInside(const Vector4& Point) const noexcept
+	{
+		if (m_Faces.empty())
+			return false;
+
+		for (const HullFace& Face : m_Faces)
+		{
+			if (XMVectorGetX(XMPlaneDotCoord(XMLoadFloat4(&Face.Plane), Point)) > m_Epsilon)
+				return false;
+		}
+
+		if (m_bFlat)
+		{
+			const HullFace& Front = m_Faces[0];
+			const XMVECTOR Normal = XMLoadFloat4(&Front.Plane);
+
+			UINT Edge = Front.Edge;
+
+			for (UINT k = 0; k < Front.NumEdges; ++k)
+			{
+				const HullHalfEdge& E = m_Edges[Edge];
+				const XMVECTOR A = m_Vertices[E.Vertex];
+				const XMVECTOR Dir = XMVectorSubtract(m_Vertices[m_Edges[E.Next].Vertex], A);
+
+				// Distance to the Edge-Line, positive inside
+				const float Side = XMVectorGetX(XMVector3Dot(XMVector3Cross(Dir, XMVectorSubtract(Point, A)), Normal));
+
+				if (Side < -m_Epsilon * XMVectorGetX(XMVector3Length(Dir)))
+					return false;
+
+				Edge = E.Next;
+			}
+		}
+
+		return true;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const float XM_CALLCONV ConvexHull::GetVolume() const noexcept
+	{
+		if (m_Faces.empty())
+			return 0.0f;
+
+		// Tetrahedra from the first Vertex to the Fans of all Faces
+		const XMVECTOR O = m_Vertices[0];
+		XMVECTOR Volume = XMVectorZero();
+
+		for (const HullFace& Face : m_Faces)
+		{
+			const UINT e0 = Face.Edge;
+			const XMVECTOR A = XMVectorSubtract(m_Vertices[m_Edges[e0].Vertex], O);
+
+			UINT e = m_Edges[e0].Next;
+
+			for (UINT k = 2; k < Face.NumEdges; ++k)
+			{
+				const UINT Next = m_Edges[e].Next;
+				const XMVECTOR B = XMVectorSubtract(m_Vertices[m_Edges[e].Vertex], O);
+				const XMVECTOR C = XMVectorSubtract(m_Vertices[m_Edges[Next].Vertex], O);
+
+				Volume = XMVectorAdd(Volume, XMVector3Dot(A, XMVector3Cross(B, C)));
+				e = Next;
+			}
+		}
+
+		return XMVectorGetX(Volume) / 6.0f;
+	}
+
+}// end of Namespace TurboMath
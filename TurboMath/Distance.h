@@ -0,0 +1,103 @@
+// -------------------------------------------------------------------
+// File			:	Distance
+//
+// Project		:	TurboMath
+//
+// Description	:	Closest-Point- and Distance-Queries between Primitives
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_DISTANCE_H_
+#define _TURBOMATH_DISTANCE_H_
+
+#include <vector>
+
+namespace TurboMath
+{
+	//-----------------------------------------------------------------------------
+	// Closest-Point- and Distance-Functions on raw XMVECTORs, so they work on
+	// every Primitive-Class and stay in SIMD-Registers (Algorithms from Ericson :
+	// "Real-Time Collision Detection", Chapter 5). Segments are given by their
+	// End-Points, Triangles by their Vertices. The Distances are squared.
+	//
+	// The Array-Variants test 4 Points (or 4 Triangles) per Instruction in SoA-
+	// Form and run in parallel, their Output-Pointers are optional. The W of a
+	// closest Point is the W of its Input-Point.
+	//-----------------------------------------------------------------------------
+
+	//-----------------------------------------------------------------------------
+	// Point to Primitive
+	//-----------------------------------------------------------------------------
+
+	/// closest Point on the Segment [A, B], pT returns the Parameter (0 = A, 1 = B)
+	XM_INLINE XMVECTOR	XM_CALLCONV ClosestPointOnSegment(FXMVECTOR P, FXMVECTOR A, FXMVECTOR B, float* pT = nullptr) noexcept;
+
+	/// closest Point on the Triangle (A, B, C)
+	XM_INLINE XMVECTOR	XM_CALLCONV ClosestPointOnTriangle(FXMVECTOR P, FXMVECTOR A, FXMVECTOR B, GXMVECTOR C) noexcept;
+
+	/// closest Point on (or in) the Box [vMin, vMax]
+	XM_INLINE XMVECTOR	XM_CALLCONV ClosestPointOnAABB(FXMVECTOR P, FXMVECTOR vMin, FXMVECTOR vMax) noexcept;
+
+	/// closest Point on (or in) the oriented Box
+	XM_INLINE XMVECTOR	XM_CALLCONV ClosestPointOnOBB(FXMVECTOR P, FXMVECTOR Center, FXMVECTOR Extents, GXMVECTOR Orientation) noexcept;
+
+	//-----------------------------------------------------------------------------
+	// Primitive to Primitive (returns the squared Distance, pC1 / pC2 the closest Points)
+	//-----------------------------------------------------------------------------
+
+	/// Segment [P1, Q1] to Segment [P2, Q2]
+	XM_INLINE float		XM_CALLCONV DistanceSqSegmentSegment(FXMVECTOR P1, FXMVECTOR Q1, FXMVECTOR P2, GXMVECTOR Q2, XMVECTOR* pC1 = nullptr, XMVECTOR* pC2 = nullptr) noexcept;
+
+	/// Segment [P, Q] to Triangle (A, B, C)
+	XM_INLINE float		XM_CALLCONV DistanceSqSegmentTriangle(FXMVECTOR P, FXMVECTOR Q, FXMVECTOR A, GXMVECTOR B, HXMVECTOR C, XMVECTOR* pC1 = nullptr, XMVECTOR* pC2 = nullptr) noexcept;
+
+	/// Triangle (A0, A1, A2) to Triangle (B0, B1, B2)
+	XM_INLINE float		XM_CALLCONV DistanceSqTriangleTriangle(FXMVECTOR A0, FXMVECTOR A1, FXMVECTOR A2, GXMVECTOR B0, HXMVECTOR B1, HXMVECTOR B2, XMVECTOR* pC1 = nullptr, XMVECTOR* pC2 = nullptr) noexcept;
+
+	//-----------------------------------------------------------------------------
+	// 4 Points at once (SoA : x, y, z of 4 Points in 3 Registers)
+	//-----------------------------------------------------------------------------
+
+	/// closest Points of 4 Points on 4 Triangles (A, B, C), branch-free
+	XM_INLINE void		XM_CALLCONV ClosestPointOnTriangle4(const XMVECTOR P[3], const XMVECTOR A[3], const XMVECTOR B[3], const XMVECTOR C[3], XMVECTOR Closest[3]) noexcept;
+
+	//-----------------------------------------------------------------------------
+	// Arrays (parallel)
+	//-----------------------------------------------------------------------------
+
+	/// closest Points on one Triangle for many Points
+	XM_INLINE void		XM_CALLCONV ClosestPointOnTriangleArray(const Vector4* pPoints, const UINT Count, const Triangle& Tri, Vector4* pClosest, float* pDistSq);
+
+	/// closest Points on one Box for many Points
+	XM_INLINE void		XM_CALLCONV ClosestPointOnAABBArray(const Vector4* pPoints, const UINT Count, const AABB& Box, Vector4* pClosest, float* pDistSq);
+
+	/// closest Points on one oriented Box for many Points
+	XM_INLINE void		XM_CALLCONV ClosestPointOnOBBArray(const Vector4* pPoints, const UINT Count, const OBB& Box, Vector4* pClosest, float* pDistSq);
+
+	/// nearest of many Triangles to a Point, returns its Index (0xFFFFFFFF for no Triangles, the lowest Index on Ties)
+	XM_INLINE const UINT	XM_CALLCONV NearestTriangle(FXMVECTOR P, const Triangle* pTriangles, const UINT Count, Vector4* pClosest = nullptr, float* pDistSq = nullptr);
+
+	/// Blocks of 4 Points for the Array-Variants : Func(P, Closest) gets the Points in SoA and
+	/// sets their closest Points, the Results are written to the optional Outputs
+	template <class BlockFunc>
+	XM_INLINE void		XM_CALLCONV ClosestPointBlocks(const Vector4* pPoints, const UINT Count, Vector4* pClosest, float* pDistSq, const BlockFunc& Func);
+
+}; // end of namespace
+
+#endif
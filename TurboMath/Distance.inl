@@ -0,0 +1,640 @@
+// -------------------------------------------------------------------
+// File			:	Distance
+//
+// Project		:	TurboMath
+//
+// Description	:	Closest-Point- and Distance-Queries between Primitives
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+namespace TurboMath
+{
+	//------------------------------------------------------------------------------
+	// Point to Primitive
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV ClosestPointOnSegment(FXMVECTOR P, FXMVECTOR A, FXMVECTOR B, float* pT) noexcept
+	{
+		const XMVECTOR AB = XMVectorSubtract(B, A);
+		const float LengthSq = XMVectorGetX(XMVector3LengthSq(AB));
+
+		float t = 0.0f;
+		if (LengthSq > FLT_EPSILON)
+		{
+			t = XMVectorGetX(XMVector3Dot(XMVectorSubtract(P, A), AB)) / LengthSq;
+			t = XMMin(XMMax(t, 0.0f), 1.0f);
+		}
+
+		if (pT != nullptr)
+			*pT = t;
+
+		return XMVectorMultiplyAdd(AB, XMVectorReplicate(t), A);
+	}
+
+	//------------------------------------------------------------------------------
+	// Voronoi-Regions of the Vertices, Edges and the Face
+	XM_INLINE XMVECTOR XM_CALLCONV ClosestPointOnTriangle(FXMVECTOR P, FXMVECTOR A, FXMVECTOR B, GXMVECTOR C) noexcept
+	{
+		const XMVECTOR AB = XMVectorSubtract(B, A);
+		const XMVECTOR AC = XMVectorSubtract(C, A);
+
+		// Vertex A
+		const XMVECTOR AP = XMVectorSubtract(P, A);
+		const float d1 = XMVectorGetX(XMVector3Dot(AB, AP));
+		const float d2 = XMVectorGetX(XMVector3Dot(AC, AP));
+		if (d1 <= 0.0f && d2 <= 0.0f)
+			return A;
+
+		// Vertex B
+		const XMVECTOR BP = XMVectorSubtract(P, B);
+		const float d3 = XMVectorGetX(XMVector3Dot(AB, BP));
+		const float d4 = XMVectorGetX(XMVector3Dot(AC, BP));
+		if (d3 >= 0.0f && d4 <= d3)
+			return B;
+
+		// Edge AB
+		const float vc = d1 * d4 - d3 * d2;
+		if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+			return XMVectorMultiplyAdd(AB, XMVectorReplicate(d1 / (d1 - d3)), A);
+
+		// Vertex C
+		const XMVECTOR CP = XMVectorSubtract(P, C);
+		const float d5 = XMVectorGetX(XMVector3Dot(AB, CP));
+		const float d6 = XMVectorGetX(XMVector3Dot(AC, CP));
+		if (d6 >= 0.0f && d5 <= d6)
+			return C;
+
+		// Edge AC
+		const float vb = d5 * d2 - d1 * d6;
+		if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+			return XMVectorMultiplyAdd(AC, XMVectorReplicate(d2 / (d2 - d6)), A);
+
+		// Edge BC
+		const float va = d3 * d6 - d5 * d4;
+		if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+			return XMVectorMultiplyAdd(XMVectorSubtract(C, B), XMVectorReplicate((d4 - d3) / ((d4 - d3) + (d5 - d6))), B);
+
+		// Face
+		const float Denom = 1.0f / (va + vb + vc);
+		const XMVECTOR Result = XMVectorMultiplyAdd(AB, XMVectorReplicate(vb * Denom), A);
+		return XMVectorMultiplyAdd(AC, XMVectorReplicate(vc * Denom), Result);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV ClosestPointOnAABB(FXMVECTOR P, FXMVECTOR vMin, FXMVECTOR vMax) noexcept
+	{
+		return XMVectorClamp(P, vMin, vMax);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV ClosestPointOnOBB(FXMVECTOR P, FXMVECTOR Center, FXMVECTOR Extents, GXMVECTOR Orientation) noexcept
+	{
+		// clamp in the Space of the Box
+		XMVECTOR Local = XMVector3InverseRotate(XMVectorSubtract(P, Center), Orientation);
+		Local = XMVectorClamp(Local, XMVectorNegate(Extents), Extents);
+
+		return XMVectorAdd(XMVector3Rotate(Local, Orientation), Center);
+	}
+
+	//------------------------------------------------------------------------------
+	// Primitive to Primitive
+	//------------------------------------------------------------------------------
+	XM_INLINE float XM_CALLCONV DistanceSqSegmentSegment(FXMVECTOR P1, FXMVECTOR Q1, FXMVECTOR P2, GXMVECTOR Q2, XMVECTOR* pC1, XMVECTOR* pC2) noexcept
+	{
+		const XMVECTOR D1 = XMVectorSubtract(Q1, P1);
+		const XMVECTOR D2 = XMVectorSubtract(Q2, P2);
+		const XMVECTOR R = XMVectorSubtract(P1, P2);
+
+		const float a = XMVectorGetX(XMVector3LengthSq(D1));
+		const float e = XMVectorGetX(XMVector3LengthSq(D2));
+		const float f = XMVectorGetX(XMVector3Dot(D2, R));
+
+		float s = 0.0f;
+		float t = 0.0f;
+
+		if (a <= FLT_EPSILON && e <= FLT_EPSILON)
+		{
+			// both Segments are Points
+		}
+		else if (a <= FLT_EPSILON)
+		{
+			t = XMMin(XMMax(f / e, 0.0f), 1.0f);
+		}
+		else
+		{
+			const float c = XMVectorGetX(XMVector3Dot(D1, R));
+
+			if (e <= FLT_EPSILON)
+			{
+				s = XMMin(XMMax(-c / a, 0.0f), 1.0f);
+			}
+			else
+			{
+				const float b = XMVectorGetX(XMVector3Dot(D1, D2));
+				const float Denom = a * e - b * b;
+
+				// not parallel : closest Point on the infinite Lines, clamped to Segment 1
+				if (Denom != 0.0f)
+					s = XMMin(XMMax((b * f - c * e) / Denom, 0.0f), 1.0f);
+
+				t = (b * s + f) / e;
+
+				// clamp to Segment 2 and recompute s
+				if (t < 0.0f)
+				{
+					t = 0.0f;
+					s = XMMin(XMMax(-c / a, 0.0f), 1.0f);
+				}
+				else if (t > 1.0f)
+				{
+					t = 1.0f;
+					s = XMMin(XMMax((b - c) / a, 0.0f), 1.0f);
+				}
+			}
+		}
+
+		const XMVECTOR C1 = XMVectorMultiplyAdd(D1, XMVectorReplicate(s), P1);
+		const XMVECTOR C2 = XMVectorMultiplyAdd(D2, XMVectorReplicate(t), P2);
+
+		if (pC1 != nullptr)
+			*pC1 = C1;
+		if (pC2 != nullptr)
+			*pC2 = C2;
+
+		return XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(C1, C2)));
+	}
+
+	//------------------------------------------------------------------------------
+	// 0 if the Segment pierces the Triangle, else the Minimum of the Segment
+	// against the 3 Edges and of the 2 End-Points against the Triangle
+	XM_INLINE float XM_CALLCONV DistanceSqSegmentTriangle(FXMVECTOR P, FXMVECTOR Q, FXMVECTOR A, GXMVECTOR B, HXMVECTOR C, XMVECTOR* pC1, XMVECTOR* pC2) noexcept
+	{
+		const XMVECTOR D = XMVectorSubtract(Q, P);
+		const XMVECTOR E1 = XMVectorSubtract(B, A);
+		const XMVECTOR E2 = XMVectorSubtract(C, A);
+
+		// Segment / Triangle (Moeller-Trumbore)
+		const XMVECTOR PV = XMVector3Cross(D, E2);
+		const float Det = XMVectorGetX(XMVector3Dot(E1, PV));
+
+		if (fabsf(Det) > FLT_EPSILON)
+		{
+			const float InvDet = 1.0f / Det;
+			const XMVECTOR TV = XMVectorSubtract(P, A);
+			const float u = XMVectorGetX(XMVector3Dot(TV, PV)) * InvDet;
+
+			if (u >= 0.0f && u <= 1.0f)
+			{
+				const XMVECTOR QV = XMVector3Cross(TV, E1);
+				const float v = XMVectorGetX(XMVector3Dot(D, QV)) * InvDet;
+				const float t = XMVectorGetX(XMVector3Dot(E2, QV)) * InvDet;
+
+				if (v >= 0.0f && u + v <= 1.0f && t >= 0.0f && t <= 1.0f)
+				{
+					const XMVECTOR Hit = XMVectorMultiplyAdd(D, XMVectorReplicate(t), P);
+
+					if (pC1 != nullptr)
+						*pC1 = Hit;
+					if (pC2 != nullptr)
+						*pC2 = Hit;
+
+					return 0.0f;
+				}
+			}
+		}
+
+		// Segment against the Edges
+		XMVECTOR C1, C2, T1, T2;
+
+		float Best = DistanceSqSegmentSegment(P, Q, A, B, &C1, &C2);
+
+		float d = DistanceSqSegmentSegment(P, Q, B, C, &T1, &T2);
+		if (d < Best)
+		{
+			Best = d;
+			C1 = T1;
+			C2 = T2;
+		}
+
+		d = DistanceSqSegmentSegment(P, Q, C, A, &T1, &T2);
+		if (d < Best)
+		{
+			Best = d;
+			C1 = T1;
+			C2 = T2;
+		}
+
+		// End-Points against the Face
+		T2 = ClosestPointOnTriangle(P, A, B, C);
+		d = XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(P, T2)));
+		if (d < Best)
+		{
+			Best = d;
+			C1 = P;
+			C2 = T2;
+		}
+
+		T2 = ClosestPointOnTriangle(Q, A, B, C);
+		d = XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(Q, T2)));
+		if (d < Best)
+		{
+			Best = d;
+			C1 = Q;
+			C2 = T2;
+		}
+
+		if (pC1 != nullptr)
+			*pC1 = C1;
+		if (pC2 != nullptr)
+			*pC2 = C2;
+
+		return Best;
+	}
+
+	//------------------------------------------------------------------------------
+	// The closest Points of 2 Triangles always lie on an Edge of one of them
+	// (or the Triangles intersect, then an Edge pierces the other Triangle),
+	// so 6 Segment / Triangle Tests cover all Cases.
+	XM_INLINE float XM_CALLCONV DistanceSqTriangleTriangle(FXMVECTOR A0, FXMVECTOR A1, FXMVECTOR A2, GXMVECTOR B0, HXMVECTOR B1, HXMVECTOR B2, XMVECTOR* pC1, XMVECTOR* pC2) noexcept
+	{
+		const XMVECTOR TriA[3] = { A0, A1, A2 };
+		const XMVECTOR TriB[3] = { B0, B1, B2 };
+
+		XMVECTOR C1 = A0;
+		XMVECTOR C2 = B0;
+		float Best = FLT_MAX;
+
+		for (UINT i = 0; i < 3 && Best > 0.0f; i++)
+		{
+			XMVECTOR T1, T2;
+
+			// Edge of A against B
+			float d = DistanceSqSegmentTriangle(TriA[i], TriA[(i + 1) % 3], B0, B1, B2, &T1, &T2);
+			if (d < Best)
+			{
+				Best = d;
+				C1 = T1;
+				C2 = T2;
+			}
+
+			// Edge of B against A
+			d = DistanceSqSegmentTriangle(TriB[i], TriB[(i + 1) % 3], A0, A1, A2, &T2, &T1);
+			if (d < Best)
+			{
+				Best = d;
+				C1 = T1;
+				C2 = T2;
+			}
+		}
+
+		if (pC1 != nullptr)
+			*pC1 = C1;
+		if (pC2 != nullptr)
+			*pC2 = C2;
+
+		return Best;
+	}
+
+	//------------------------------------------------------------------------------
+	// 4 Points at once
+	//------------------------------------------------------------------------------
+	// the same Voronoi-Regions as ClosestPointOnTriangle, but every Region is
+	// computed for all Lanes as A + s * AB + t * AC and selected by its Mask.
+	// The Selects run from the last to the first Region of the scalar Code, so
+	// the first matching Region wins like there.
+	XM_INLINE void XM_CALLCONV ClosestPointOnTriangle4(const XMVECTOR P[3], const XMVECTOR A[3], const XMVECTOR B[3], const XMVECTOR C[3], XMVECTOR Closest[3]) noexcept
+	{
+		XMVECTOR AB[3], AC[3], AP[3], BP[3], CP[3];
+
+		for (UINT i = 0; i < 3; i++)
+		{
+			AB[i] = XMVectorSubtract(B[i], A[i]);
+			AC[i] = XMVectorSubtract(C[i], A[i]);
+			AP[i] = XMVectorSubtract(P[i], A[i]);
+			BP[i] = XMVectorSubtract(P[i], B[i]);
+			CP[i] = XMVectorSubtract(P[i], C[i]);
+		}
+
+		auto Dot = [](const XMVECTOR* u, const XMVECTOR* v)
+		{
+			return XMVectorMultiplyAdd(u[2], v[2], XMVectorMultiplyAdd(u[1], v[1], XMVectorMultiply(u[0], v[0])));
+		};
+
+		const XMVECTOR d1 = Dot(AB, AP);
+		const XMVECTOR d2 = Dot(AC, AP);
+		const XMVECTOR d3 = Dot(AB, BP);
+		const XMVECTOR d4 = Dot(AC, BP);
+		const XMVECTOR d5 = Dot(AB, CP);
+		const XMVECTOR d6 = Dot(AC, CP);
+
+		const XMVECTOR va = XMVectorSubtract(XMVectorMultiply(d3, d6), XMVectorMultiply(d5, d4));
+		const XMVECTOR vb = XMVectorSubtract(XMVectorMultiply(d5, d2), XMVectorMultiply(d1, d6));
+		const XMVECTOR vc = XMVectorSubtract(XMVectorMultiply(d1, d4), XMVectorMultiply(d3, d2));
+
+		const XMVECTOR Zero = XMVectorZero();
+		const XMVECTOR One = XMVectorSplatOne();
+		const XMVECTOR d43 = XMVectorSubtract(d4, d3);
+		const XMVECTOR d56 = XMVectorSubtract(d5, d6);
+
+		// Face
+		const XMVECTOR Denom = XMVectorDivide(One, XMVectorAdd(XMVectorAdd(va, vb), vc));
+		XMVECTOR s = XMVectorMultiply(vb, Denom);
+		XMVECTOR t = XMVectorMultiply(vc, Denom);
+
+		// Edge BC
+		XMVECTOR Mask = XMVectorAndInt(XMVectorLessOrEqual(va, Zero), XMVectorAndInt(XMVectorGreaterOrEqual(d43, Zero), XMVectorGreaterOrEqual(d56, Zero)));
+		const XMVECTOR w = XMVectorDivide(d43, XMVectorAdd(d43, d56));
+		s = XMVectorSelect(s, XMVectorSubtract(One, w), Mask);
+		t = XMVectorSelect(t, w, Mask);
+
+		// Edge AC
+		Mask = XMVectorAndInt(XMVectorLessOrEqual(vb, Zero), XMVectorAndInt(XMVectorGreaterOrEqual(d2, Zero), XMVectorLessOrEqual(d6, Zero)));
+		s = XMVectorSelect(s, Zero, Mask);
+		t = XMVectorSelect(t, XMVectorDivide(d2, XMVectorSubtract(d2, d6)), Mask);
+
+		// Vertex C
+		Mask = XMVectorAndInt(XMVectorGreaterOrEqual(d6, Zero), XMVectorLessOrEqual(d5, d6));
+		s = XMVectorSelect(s, Zero, Mask);
+		t = XMVectorSelect(t, One, Mask);
+
+		// Edge AB
+		Mask = XMVectorAndInt(XMVectorLessOrEqual(vc, Zero), XMVectorAndInt(XMVectorGreaterOrEqual(d1, Zero), XMVectorLessOrEqual(d3, Zero)));
+		s = XMVectorSelect(s, XMVectorDivide(d1, XMVectorSubtract(d1, d3)), Mask);
+		t = XMVectorSelect(t, Zero, Mask);
+
+		// Vertex B
+		Mask = XMVectorAndInt(XMVectorGreaterOrEqual(d3, Zero), XMVectorLessOrEqual(d4, d3));
+		s = XMVectorSelect(s, One, Mask);
+		t = XMVectorSelect(t, Zero, Mask);
+
+		// Vertex A
+		Mask = XMVectorAndInt(XMVectorLessOrEqual(d1, Zero), XMVectorLessOrEqual(d2, Zero));
+		s = XMVectorSelect(s, Zero, Mask);
+		t = XMVectorSelect(t, Zero, Mask);
+
+		for (UINT i = 0; i < 3; i++)
+			Closest[i] = XMVectorMultiplyAdd(AC[i], t, XMVectorMultiplyAdd(AB[i], s, A[i]));
+	}
+
+	//------------------------------------------------------------------------------
+	// Arrays
+	//------------------------------------------------------------------------------
+	// 4 Points are transposed to SoA, the last Block repeats its last Point
+	template <class BlockFunc>
+	XM_INLINE void XM_CALLCONV ClosestPointBlocks(const Vector4* pPoints, const UINT Count, Vector4* pClosest, float* pDistSq, const BlockFunc& Func)
+	{
+		assert(pPoints != nullptr || Count == 0);
+
+		const UINT NumBlocks = (Count + 3) / 4;
+
+		ParallelFor(NumBlocks, 1024, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT Block = Begin; Block < End; Block++)
+			{
+				const UINT First = Block * 4;
+				const UINT Num = XMMin(Count - First, 4u);
+
+				XMMATRIX Points;
+				for (UINT l = 0; l < 4; l++)
+					Points.r[l] = pPoints[First + XMMin(l, Num - 1)];
+
+				Points = XMMatrixTranspose(Points);
+
+				XMVECTOR Closest[3];
+				Func(Points.r, Closest);
+
+				if (pClosest != nullptr)
+				{
+					const XMMATRIX Rows = XMMatrixTranspose(XMMATRIX(Closest[0], Closest[1], Closest[2], Points.r[3]));
+
+					for (UINT l = 0; l < Num; l++)
+						pClosest[First + l] = Rows.r[l];
+				}
+
+				if (pDistSq != nullptr)
+				{
+					const XMVECTOR dx = XMVectorSubtract(Points.r[0], Closest[0]);
+					const XMVECTOR dy = XMVectorSubtract(Points.r[1], Closest[1]);
+					const XMVECTOR dz = XMVectorSubtract(Points.r[2], Closest[2]);
+					const XMVECTOR DistSq = XMVectorMultiplyAdd(dz, dz, XMVectorMultiplyAdd(dy, dy, XMVectorMultiply(dx, dx)));
+
+					if (Num == 4)
+						XMStoreFloat4((XMFLOAT4*)&pDistSq[First], DistSq);
+					else
+					{
+						XMFLOAT4A Dist;
+						XMStoreFloat4A(&Dist, DistSq);
+
+						for (UINT l = 0; l < Num; l++)
+							pDistSq[First + l] = (&Dist.x)[l];
+					}
+				}
+			}
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ClosestPointOnTriangleArray(const Vector4* pPoints, const UINT Count, const Triangle& Tri, Vector4* pClosest, float* pDistSq)
+	{
+		const XMVECTOR a = Tri.GetVector1();
+		const XMVECTOR b = Tri.GetVector2();
+		const XMVECTOR c = Tri.GetVector3();
+
+		const XMVECTOR A[3] = { XMVectorSplatX(a), XMVectorSplatY(a), XMVectorSplatZ(a) };
+		const XMVECTOR B[3] = { XMVectorSplatX(b), XMVectorSplatY(b), XMVectorSplatZ(b) };
+		const XMVECTOR C[3] = { XMVectorSplatX(c), XMVectorSplatY(c), XMVectorSplatZ(c) };
+
+		ClosestPointBlocks(pPoints, Count, pClosest, pDistSq, [&](const XMVECTOR* P, XMVECTOR* Closest)
+		{
+			ClosestPointOnTriangle4(P, A, B, C, Closest);
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ClosestPointOnAABBArray(const Vector4* pPoints, const UINT Count, const AABB& Box, Vector4* pClosest, float* pDistSq)
+	{
+		const XMVECTOR vMin = Box.GetMinExtents();
+		const XMVECTOR vMax = Box.GetMaxExtents();
+
+		const XMVECTOR Min[3] = { XMVectorSplatX(vMin), XMVectorSplatY(vMin), XMVectorSplatZ(vMin) };
+		const XMVECTOR Max[3] = { XMVectorSplatX(vMax), XMVectorSplatY(vMax), XMVectorSplatZ(vMax) };
+
+		ClosestPointBlocks(pPoints, Count, pClosest, pDistSq, [&](const XMVECTOR* P, XMVECTOR* Closest)
+		{
+			for (UINT i = 0; i < 3; i++)
+				Closest[i] = XMVectorClamp(P[i], Min[i], Max[i]);
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	// Local = (P - Center) projected on the Axes, clamped to the Extents and
+	// rotated back
+	XM_INLINE void XM_CALLCONV ClosestPointOnOBBArray(const Vector4* pPoints, const UINT Count, const OBB& Box, Vector4* pClosest, float* pDistSq)
+	{
+		const XMVECTOR vCenter = Box.GetCenter();
+		const XMVECTOR vExtents = Box.GetExtents();
+
+		// Rows = Axes of the Box
+		const XMMATRIX Rotation = XMMatrixRotationQuaternion(Box.GetOrientation().Get());
+
+		XMVECTOR Axis[3][3];
+		for (UINT a = 0; a < 3; a++)
+		{
+			Axis[a][0] = XMVectorSplatX(Rotation.r[a]);
+			Axis[a][1] = XMVectorSplatY(Rotation.r[a]);
+			Axis[a][2] = XMVectorSplatZ(Rotation.r[a]);
+		}
+
+		const XMVECTOR Center[3] = { XMVectorSplatX(vCenter), XMVectorSplatY(vCenter), XMVectorSplatZ(vCenter) };
+		const XMVECTOR Extents[3] = { XMVectorSplatX(vExtents), XMVectorSplatY(vExtents), XMVectorSplatZ(vExtents) };
+
+		ClosestPointBlocks(pPoints, Count, pClosest, pDistSq, [&](const XMVECTOR* P, XMVECTOR* Closest)
+		{
+			const XMVECTOR d[3] = { XMVectorSubtract(P[0], Center[0]), XMVectorSubtract(P[1], Center[1]), XMVectorSubtract(P[2], Center[2]) };
+
+			Closest[0] = Center[0];
+			Closest[1] = Center[1];
+			Closest[2] = Center[2];
+
+			for (UINT a = 0; a < 3; a++)
+			{
+				XMVECTOR Local = XMVectorMultiplyAdd(d[2], Axis[a][2], XMVectorMultiplyAdd(d[1], Axis[a][1], XMVectorMultiply(d[0], Axis[a][0])));
+				Local = XMVectorClamp(Local, XMVectorNegate(Extents[a]), Extents[a]);
+
+				for (UINT i = 0; i < 3; i++)
+					Closest[i] = XMVectorMultiplyAdd(Local, Axis[a][i], Closest[i]);
+			}
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	// 4 Triangles per Step against the splatted Point, every Lane keeps its
+	// best Triangle. Groups of Triangles run in parallel, the Lanes and Groups
+	// are reduced with the lowest Index on Ties, so the Result is the one of
+	// a serial Loop.
+	XM_INLINE const UINT XM_CALLCONV NearestTriangle(FXMVECTOR P, const Triangle* pTriangles, const UINT Count, Vector4* pClosest, float* pDistSq)
+	{
+		assert(pTriangles != nullptr || Count == 0);
+
+		struct Candidate
+		{
+			float		DistSq;
+			UINT		Index;
+			XMFLOAT3	Point;
+		};
+
+		const UINT GroupSize = 4096;
+		const UINT NumGroups = (Count + GroupSize - 1) / GroupSize;
+
+		std::vector<Candidate> Best(NumGroups);
+
+		const XMVECTOR Pos[3] = { XMVectorSplatX(P), XMVectorSplatY(P), XMVectorSplatZ(P) };
+
+		auto Better = [](const Candidate& a, const Candidate& b)
+		{
+			return a.DistSq < b.DistSq || (a.DistSq == b.DistSq && a.Index < b.Index);
+		};
+
+		ParallelFor(NumGroups, 1, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT Group = Begin; Group < End; Group++)
+			{
+				const UINT First = Group * GroupSize;
+				const UINT Last = XMMin(First + GroupSize, Count);
+
+				XMVECTOR BestDist = XMVectorReplicate(FLT_MAX);
+				XMVECTOR BestIndex = XMVectorTrueInt();
+				XMVECTOR BestPoint[3] = { Pos[0], Pos[1], Pos[2] };
+
+				for (UINT i = First; i < Last; i += 4)
+				{
+					const UINT Num = XMMin(Last - i, 4u);
+
+					XMMATRIX A, B, C;
+					UINT Lane[4];
+
+					for (UINT l = 0; l < 4; l++)
+					{
+						Lane[l] = i + XMMin(l, Num - 1);
+
+						const Triangle& Tri = pTriangles[Lane[l]];
+						A.r[l] = Tri.GetVector1();
+						B.r[l] = Tri.GetVector2();
+						C.r[l] = Tri.GetVector3();
+					}
+
+					A = XMMatrixTranspose(A);
+					B = XMMatrixTranspose(B);
+					C = XMMatrixTranspose(C);
+
+					XMVECTOR Closest[3];
+					ClosestPointOnTriangle4(Pos, A.r, B.r, C.r, Closest);
+
+					const XMVECTOR dx = XMVectorSubtract(Pos[0], Closest[0]);
+					const XMVECTOR dy = XMVectorSubtract(Pos[1], Closest[1]);
+					const XMVECTOR dz = XMVectorSubtract(Pos[2], Closest[2]);
+					const XMVECTOR DistSq = XMVectorMultiplyAdd(dz, dz, XMVectorMultiplyAdd(dy, dy, XMVectorMultiply(dx, dx)));
+
+					// the first (lowest) Index of a Lane wins on Ties
+					const XMVECTOR Closer = XMVectorLess(DistSq, BestDist);
+
+					BestDist = XMVectorSelect(BestDist, DistSq, Closer);
+					BestIndex = XMVectorSelect(BestIndex, XMVectorSetInt(Lane[0], Lane[1], Lane[2], Lane[3]), Closer);
+
+					for (UINT c = 0; c < 3; c++)
+						BestPoint[c] = XMVectorSelect(BestPoint[c], Closest[c], Closer);
+				}
+
+				// reduce the Lanes
+				XMFLOAT4A Dist, X, Y, Z;
+				CACHE_ALIGN(16) uint32_t Index[4];
+
+				XMStoreFloat4A(&Dist, BestDist);
+				XMStoreInt4A(Index, BestIndex);
+				XMStoreFloat4A(&X, BestPoint[0]);
+				XMStoreFloat4A(&Y, BestPoint[1]);
+				XMStoreFloat4A(&Z, BestPoint[2]);
+
+				Candidate& Result = Best[Group];
+				Result.DistSq = FLT_MAX;
+				Result.Index = 0xFFFFFFFF;
+
+				for (UINT l = 0; l < 4; l++)
+				{
+					const Candidate Cur = { (&Dist.x)[l], Index[l], XMFLOAT3((&X.x)[l], (&Y.x)[l], (&Z.x)[l]) };
+
+					if (Cur.Index != 0xFFFFFFFF && (Result.Index == 0xFFFFFFFF || Better(Cur, Result)))
+						Result = Cur;
+				}
+			}
+		});
+
+		// reduce the Groups
+		Candidate Result = { FLT_MAX, 0xFFFFFFFF, XMFLOAT3(0.0f, 0.0f, 0.0f) };
+
+		for (UINT Group = 0; Group < NumGroups; Group++)
+		{
+			if (Best[Group].Index != 0xFFFFFFFF && (Result.Index == 0xFFFFFFFF || Better(Best[Group], Result)))
+				Result = Best[Group];
+		}
+
+		if (pClosest != nullptr)
+			*pClosest = (Result.Index != 0xFFFFFFFF) ? XMVectorSetW(XMLoadFloat3(&Result.Point), XMVectorGetW(P)) : P;
+		if (pDistSq != nullptr)
+			*pDistSq = Result.DistSq;
+
+		return Result.Index;
+	}
+
+}// end of Namespace TurboMath
@@ -0,0 +1,286 @@
+// -------------------------------------------------------------------
+// File			:	DoublePrecision
+//
+// Project		:	TurboMath
+//
+// Description	:	Double-Precision Vectors / Matrix for large Worlds and Camera-relative Rendering
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_DOUBLEPRECISION_H_
+#define _TURBOMATH_DOUBLEPRECISION_H_
+
+namespace TurboMath
+{
+	//-----------------------------------------------------------------------------
+	// 4 Doubles in one AVX-Register, without AVX in 2 SSE2-Registers
+	//-----------------------------------------------------------------------------
+#ifdef XM_AVX_INTRINSICS
+	typedef __m256d		XMVECTORD;
+#else
+	struct XMVECTORD
+	{
+		__m128d		xy;
+		__m128d		zw;
+	};
+#endif
+
+	//-----------------------------------------------------------------------------
+	// Register-Functions for XMVECTORD (Loads and Stores are unaligned)
+	//-----------------------------------------------------------------------------
+	class VectorD
+	{
+	public:
+
+		static XMVECTORD	XM_CALLCONV Load(const double* p) noexcept;
+		static void			XM_CALLCONV Store(double* p, const XMVECTORD v) noexcept;
+
+		static XMVECTORD	XM_CALLCONV Replicate(const double s) noexcept;
+
+		static XMVECTORD	XM_CALLCONV Add(const XMVECTORD a, const XMVECTORD b) noexcept;
+		static XMVECTORD	XM_CALLCONV Subtract(const XMVECTORD a, const XMVECTORD b) noexcept;
+		static XMVECTORD	XM_CALLCONV Multiply(const XMVECTORD a, const XMVECTORD b) noexcept;
+
+		/// a * b + c
+		static XMVECTORD	XM_CALLCONV MultiplyAdd(const XMVECTORD a, const XMVECTORD b, const XMVECTORD c) noexcept;
+
+		/// Conversion to / from Float (rounded)
+		static XMVECTOR		XM_CALLCONV ToFloat(const XMVECTORD v) noexcept;
+		static XMVECTORD	XM_CALLCONV FromFloat(FXMVECTOR v) noexcept;
+	};
+
+	//-----------------------------------------------------------------------------
+	// Vector with 4 Doubles
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class Vector4d
+	{
+	public:
+
+		/// default constructor, setup to Zero
+		Vector4d() noexcept;
+
+		/// construct from components
+		Vector4d(const double x, const double y, const double z, const double w) noexcept;
+
+		/// construct from Vector4
+		explicit Vector4d(const Vector4& v) noexcept;
+
+		/// construct from XMVECTORD
+		Vector4d(const XMVECTORD v) noexcept;
+
+		/// assign XMVECTORD
+		void XM_CALLCONV operator=(const XMVECTORD v) noexcept;
+
+		/// equality operator
+		bool XM_CALLCONV operator==(const Vector4d& rhs) const noexcept;
+
+		/// inequality operator
+		bool XM_CALLCONV operator!=(const Vector4d& rhs) const noexcept;
+
+		Vector4d XM_CALLCONV operator+(const Vector4d& rhs) const noexcept;
+		Vector4d XM_CALLCONV operator-(const Vector4d& rhs) const noexcept;
+		Vector4d XM_CALLCONV operator*(const double s) const noexcept;
+		Vector4d XM_CALLCONV operator-() const noexcept;
+
+		void XM_CALLCONV operator+=(const Vector4d& rhs) noexcept;
+		void XM_CALLCONV operator-=(const Vector4d& rhs) noexcept;
+
+		/// by XMVECTORD
+		XMVECTORD XM_CALLCONV Get() const noexcept;
+
+		double XM_CALLCONV GetX() const noexcept					{ return m_v[0]; }
+		double XM_CALLCONV GetY() const noexcept					{ return m_v[1]; }
+		double XM_CALLCONV GetZ() const noexcept					{ return m_v[2]; }
+		double XM_CALLCONV GetW() const noexcept					{ return m_v[3]; }
+
+		void XM_CALLCONV Set(const double x, const double y, const double z, const double w) noexcept;
+
+		/// rounded to Float
+		Vector4 XM_CALLCONV ToFloat() const noexcept;
+
+		static double XM_CALLCONV Dot(const Vector4d& v0, const Vector4d& v1) noexcept;
+		static double XM_CALLCONV Length(const Vector4d& v) noexcept;
+		static Vector4d XM_CALLCONV Lerp(const Vector4d& v0, const Vector4d& v1, const double t) noexcept;
+
+	protected:
+		double		m_v[4];
+	};
+
+	//-----------------------------------------------------------------------------
+	// Vector with 3 Doubles (Positions, padded to 4 with w = 0)
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class Vector3d
+	{
+	public:
+
+		/// default constructor, setup to Zero
+		Vector3d() noexcept;
+
+		/// construct from components
+		Vector3d(const double x, const double y, const double z) noexcept;
+
+		/// construct from Vector3
+		explicit Vector3d(const Vector3& v) noexcept;
+
+		/// construct from the xyz of a Vector4
+		explicit Vector3d(const Vector4& v) noexcept;
+
+		/// construct from the xyz of a XMVECTORD
+		Vector3d(const XMVECTORD v) noexcept;
+
+		/// assign the xyz of a XMVECTORD
+		void XM_CALLCONV operator=(const XMVECTORD v) noexcept;
+
+		/// equality operator
+		bool XM_CALLCONV operator==(const Vector3d& rhs) const noexcept;
+
+		/// inequality operator
+		bool XM_CALLCONV operator!=(const Vector3d& rhs) const noexcept;
+
+		Vector3d XM_CALLCONV operator+(const Vector3d& rhs) const noexcept;
+		Vector3d XM_CALLCONV operator-(const Vector3d& rhs) const noexcept;
+		Vector3d XM_CALLCONV operator*(const double s) const noexcept;
+		Vector3d XM_CALLCONV operator-() const noexcept;
+
+		void XM_CALLCONV operator+=(const Vector3d& rhs) noexcept;
+		void XM_CALLCONV operator-=(const Vector3d& rhs) noexcept;
+
+		/// by XMVECTORD (w = 0)
+		XMVECTORD XM_CALLCONV Get() const noexcept;
+
+		double XM_CALLCONV GetX() const noexcept					{ return m_v[0]; }
+		double XM_CALLCONV GetY() const noexcept					{ return m_v[1]; }
+		double XM_CALLCONV GetZ() const noexcept					{ return m_v[2]; }
+
+		void XM_CALLCONV Set(const double x, const double y, const double z) noexcept;
+
+		/// rounded to Float
+		Vector3 XM_CALLCONV ToFloat() const noexcept;
+
+		static double XM_CALLCONV Dot(const Vector3d& v0, const Vector3d& v1) noexcept;
+		static Vector3d XM_CALLCONV Cross(const Vector3d& v0, const Vector3d& v1) noexcept;
+		static double XM_CALLCONV Length(const Vector3d& v) noexcept;
+		static double XM_CALLCONV Distance(const Vector3d& v0, const Vector3d& v1) noexcept;
+		static Vector3d XM_CALLCONV Lerp(const Vector3d& v0, const Vector3d& v1, const double t) noexcept;
+
+	protected:
+		double		m_v[4];
+	};
+
+	//-----------------------------------------------------------------------------
+	// 4x4 Matrix with Doubles (Row-Vectors like Matrix), e.g. World-Matrices
+	// with Positions far from the Origin
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class Matrixd
+	{
+	public:
+
+		/// default constructor, setup to Identity
+		Matrixd() noexcept;
+
+		/// construct from Rows
+		Matrixd(const Vector4d& Row0, const Vector4d& Row1, const Vector4d& Row2, const Vector4d& Row3) noexcept;
+
+		/// construct from Matrix
+		explicit Matrixd(const Matrix& m) noexcept;
+
+		/// construct from the Rotation / Scale of a Matrix and a Translation
+		Matrixd(const Matrix& m, const Vector3d& Translation) noexcept;
+
+		/// equality operator
+		bool XM_CALLCONV operator==(const Matrixd& rhs) const noexcept;
+
+		/// inequality operator
+		bool XM_CALLCONV operator!=(const Matrixd& rhs) const noexcept;
+
+		/// Multiply(*this, rhs)
+		Matrixd XM_CALLCONV operator*(const Matrixd& rhs) const noexcept;
+
+		const Vector4d& XM_CALLCONV GetRow(const UINT i) const noexcept	{ assert(i < 4); return m_Row[i]; }
+		void XM_CALLCONV SetRow(const UINT i, const Vector4d& Row) noexcept	{ assert(i < 4); m_Row[i] = Row; }
+
+		Vector3d XM_CALLCONV GetTranslation() const noexcept;
+		void XM_CALLCONV SetTranslation(const Vector3d& Translation) noexcept;
+
+		/// rounded to Float
+		Matrix XM_CALLCONV ToFloat() const noexcept;
+
+		static Matrixd XM_CALLCONV Identity() noexcept;
+		static Matrixd XM_CALLCONV Translation(const Vector3d& t) noexcept;
+		static Matrixd XM_CALLCONV Multiply(const Matrixd& m0, const Matrixd& m1) noexcept;
+		static Matrixd XM_CALLCONV Transpose(const Matrixd& m) noexcept;
+
+		/// Inverse of an affine Matrix (Rotation, Scale, Translation)
+		static Matrixd XM_CALLCONV InverseAffine(const Matrixd& m) noexcept;
+
+		/// v * M
+		static Vector4d XM_CALLCONV Transform(const Vector4d& v, const Matrixd& m) noexcept;
+
+		/// p * M with w = 1
+		static Vector3d XM_CALLCONV TransformCoord(const Vector3d& p, const Matrixd& m) noexcept;
+
+	protected:
+		Vector4d	m_Row[4];
+	};
+
+	//-----------------------------------------------------------------------------
+	// Camera-relative Rendering : World-Positions stay Double, the GPU gets Floats
+	// relative to an Origin near the Camera. The Subtraction is done in Double,
+	// so the Floats are exact near the Camera and nothing jitters far from the
+	// World-Origin. Render with the View of ViewAtOrigin (no Translation).
+	//-----------------------------------------------------------------------------
+	class CameraRelative
+	{
+	public:
+
+		explicit CameraRelative(const Vector3d& Origin = Vector3d()) noexcept;
+
+		void XM_CALLCONV SetOrigin(const Vector3d& Origin) noexcept;
+
+		/// Origin from Camera::GetPosition
+		void XM_CALLCONV SetOrigin(const Camera& theCamera) noexcept;
+
+		const Vector3d& XM_CALLCONV GetOrigin() const noexcept		{ return m_Origin; }
+
+		/// World -> relative (w = 1)
+		Vector4 XM_CALLCONV ToRelative(const Vector3d& p) const noexcept;
+
+		/// World-Matrix -> relative World-Matrix
+		Matrix XM_CALLCONV ToRelative(const Matrixd& World) const noexcept;
+
+		/// relative -> World
+		Vector3d XM_CALLCONV ToWorld(const Vector4& p) const noexcept;
+
+		/// Bulk-Conversion, split over all Cores with ParallelFor
+		void XM_CALLCONV ToRelative(const Vector3d* pIn, Vector4* pOut, const UINT Count) const;
+		void XM_CALLCONV ToRelative(const Matrixd* pIn, Matrix* pOut, const UINT Count) const;
+
+		/// View-Matrix of the Camera without Translation (Camera at the Origin)
+		static Matrix XM_CALLCONV ViewAtOrigin(const Camera& theCamera) noexcept;
+
+		/// Elements per Job of ParallelFor
+		static constexpr UINT	CHUNK_SIZE = 16384;
+
+	protected:
+		Vector3d	m_Origin;
+	};
+
+}; // end of namespace
+
+#endif
@@ -0,0 +1,661 @@
+// -------------------------------------------------------------------
+// File			:	DoublePrecision
+//
+// Project		:	TurboMath
+//
+// Description	:	Double-Precision Vectors / Matrix for large Worlds and Camera-relative Rendering
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+namespace TurboMath
+{
+	//------------------------------------------------------------------------------
+	// VectorD
+	//------------------------------------------------------------------------------
+
+#ifdef XM_AVX_INTRINSICS
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTORD XM_CALLCONV VectorD::Load(const double* p) noexcept
+	{
+		return _mm256_loadu_pd(p);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV VectorD::Store(double* p, const XMVECTORD v) noexcept
+	{
+		_mm256_storeu_pd(p, v);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTORD XM_CALLCONV VectorD::Replicate(const double s) noexcept
+	{
+		return _mm256_set1_pd(s);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTORD XM_CALLCONV VectorD::Add(const XMVECTORD a, const XMVECTORD b) noexcept
+	{
+		return _mm256_add_pd(a, b);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTORD XM_CALLCONV VectorD::Subtract(const XMVECTORD a, const XMVECTORD b) noexcept
+	{
+		return _mm256_sub_pd(a, b);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTORD XM_CALLCONV VectorD::Multiply(const XMVECTORD a, const XMVECTORD b) noexcept
+	{
+		return _mm256_mul_pd(a, b);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTORD XM_CALLCONV VectorD::MultiplyAdd(const XMVECTORD a, const XMVECTORD b, const XMVECTORD c) noexcept
+	{
+		return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV VectorD::ToFloat(const XMVECTORD v) noexcept
+	{
+		return _mm256_cvtpd_ps(v);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTORD XM_CALLCONV VectorD::FromFloat(FXMVECTOR v) noexcept
+	{
+		return _mm256_cvtps_pd(v);
+	}
+
+#else
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTORD XM_CALLCONV VectorD::Load(const double* p) noexcept
+	{
+		XMVECTORD v;
+		v.xy = _mm_loadu_pd(p);
+		v.zw = _mm_loadu_pd(p + 2);
+
+		return v;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV VectorD::Store(double* p, const XMVECTORD v) noexcept
+	{
+		_mm_storeu_pd(p, v.xy);
+		_mm_storeu_pd(p + 2, v.zw);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTORD XM_CALLCONV VectorD::Replicate(const double s) noexcept
+	{
+		XMVECTORD v;
+		v.xy = v.zw = _mm_set1_pd(s);
+
+		return v;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTORD XM_CALLCONV VectorD::Add(const XMVECTORD a, const XMVECTORD b) noexcept
+	{
+		XMVECTORD v;
+		v.xy = _mm_add_pd(a.xy, b.xy);
+		v.zw = _mm_add_pd(a.zw, b.zw);
+
+		return v;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTORD XM_CALLCONV VectorD::Subtract(const XMVECTORD a, const XMVECTORD b) noexcept
+	{
+		XMVECTORD v;
+		v.xy = _mm_sub_pd(a.xy, b.xy);
+		v.zw = _mm_sub_pd(a.zw, b.zw);
+
+		return v;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTORD XM_CALLCONV VectorD::Multiply(const XMVECTORD a, const XMVECTORD b) noexcept
+	{
+		XMVECTORD v;
+		v.xy = _mm_mul_pd(a.xy, b.xy);
+		v.zw = _mm_mul_pd(a.zw, b.zw);
+
+		return v;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTORD XM_CALLCONV VectorD::MultiplyAdd(const XMVECTORD a, const XMVECTORD b, const XMVECTORD c) noexcept
+	{
+		XMVECTORD v;
+		v.xy = _mm_add_pd(_mm_mul_pd(a.xy, b.xy), c.xy);
+		v.zw = _mm_add_pd(_mm_mul_pd(a.zw, b.zw), c.zw);
+
+		return v;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV VectorD::ToFloat(const XMVECTORD v) noexcept
+	{
+		return _mm_movelh_ps(_mm_cvtpd_ps(v.xy), _mm_cvtpd_ps(v.zw));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTORD XM_CALLCONV VectorD::FromFloat(FXMVECTOR v) noexcept
+	{
+		XMVECTORD d;
+		d.xy = _mm_cvtps_pd(v);
+		d.zw = _mm_cvtps_pd(_mm_movehl_ps(v, v));
+
+		return d;
+	}
+
+#endif
+
+	//------------------------------------------------------------------------------
+	// Vector4d
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector4d::Vector4d() noexcept
+	{
+		Set(0.0, 0.0, 0.0, 0.0);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector4d::Vector4d(const double x, const double y, const double z, const double w) noexcept
+	{
+		Set(x, y, z, w);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector4d::Vector4d(const Vector4& v) noexcept
+	{
+		VectorD::Store(m_v, VectorD::FromFloat(v));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector4d::Vector4d(const XMVECTORD v) noexcept
+	{
+		VectorD::Store(m_v, v);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Vector4d::operator=(const XMVECTORD v) noexcept
+	{
+		VectorD::Store(m_v, v);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE bool XM_CALLCONV Vector4d::operator==(const Vector4d& rhs) const noexcept
+	{
+		return m_v[0] == rhs.m_v[0] && m_v[1] == rhs.m_v[1] && m_v[2] == rhs.m_v[2] && m_v[3] == rhs.m_v[3];
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE bool XM_CALLCONV Vector4d::operator!=(const Vector4d& rhs) const noexcept
+	{
+		return !(*this == rhs);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector4d XM_CALLCONV Vector4d::operator+(const Vector4d& rhs) const noexcept
+	{
+		return VectorD::Add(Get(), rhs.Get());
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector4d XM_CALLCONV Vector4d::operator-(const Vector4d& rhs) const noexcept
+	{
+		return VectorD::Subtract(Get(), rhs.Get());
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector4d XM_CALLCONV Vector4d::operator*(const double s) const noexcept
+	{
+		return VectorD::Multiply(Get(), VectorD::Replicate(s));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector4d XM_CALLCONV Vector4d::operator-() const noexcept
+	{
+		return VectorD::Subtract(VectorD::Replicate(0.0), Get());
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Vector4d::operator+=(const Vector4d& rhs) noexcept
+	{
+		VectorD::Store(m_v, VectorD::Add(Get(), rhs.Get()));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Vector4d::operator-=(const Vector4d& rhs) noexcept
+	{
+		VectorD::Store(m_v, VectorD::Subtract(Get(), rhs.Get()));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTORD XM_CALLCONV Vector4d::Get() const noexcept
+	{
+		return VectorD::Load(m_v);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Vector4d::Set(const double x, const double y, const double z, const double w) noexcept
+	{
+		m_v[0] = x;
+		m_v[1] = y;
+		m_v[2] = z;
+		m_v[3] = w;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector4 XM_CALLCONV Vector4d::ToFloat() const noexcept
+	{
+		return VectorD::ToFloat(Get());
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE double XM_CALLCONV Vector4d::Dot(const Vector4d& v0, const Vector4d& v1) noexcept
+	{
+		return v0.m_v[0] * v1.m_v[0] + v0.m_v[1] * v1.m_v[1] + v0.m_v[2] * v1.m_v[2] + v0.m_v[3] * v1.m_v[3];
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE double XM_CALLCONV Vector4d::Length(const Vector4d& v) noexcept
+	{
+		return sqrt(Dot(v, v));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector4d XM_CALLCONV Vector4d::Lerp(const Vector4d& v0, const Vector4d& v1, const double t) noexcept
+	{
+		return VectorD::MultiplyAdd(VectorD::Subtract(v1.Get(), v0.Get()), VectorD::Replicate(t), v0.Get());
+	}
+
+	//------------------------------------------------------------------------------
+	// Vector3d
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector3d::Vector3d() noexcept
+	{
+		Set(0.0, 0.0, 0.0);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector3d::Vector3d(const double x, const double y, const double z) noexcept
+	{
+		Set(x, y, z);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector3d::Vector3d(const Vector3& v) noexcept
+	{
+		Set(v.GetX(), v.GetY(), v.GetZ());
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector3d::Vector3d(const Vector4& v) noexcept
+	{
+		*this = VectorD::FromFloat(v);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector3d::Vector3d(const XMVECTORD v) noexcept
+	{
+		*this = v;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Vector3d::operator=(const XMVECTORD v) noexcept
+	{
+		VectorD::Store(m_v, v);
+		m_v[3] = 0.0;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE bool XM_CALLCONV Vector3d::operator==(const Vector3d& rhs) const noexcept
+	{
+		return m_v[0] == rhs.m_v[0] && m_v[1] == rhs.m_v[1] && m_v[2] == rhs.m_v[2];
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE bool XM_CALLCONV Vector3d::operator!=(const Vector3d& rhs) const noexcept
+	{
+		return !(*this == rhs);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector3d XM_CALLCONV Vector3d::operator+(const Vector3d& rhs) const noexcept
+	{
+		return VectorD::Add(Get(), rhs.Get());
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector3d XM_CALLCONV Vector3d::operator-(const Vector3d& rhs) const noexcept
+	{
+		return VectorD::Subtract(Get(), rhs.Get());
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector3d XM_CALLCONV Vector3d::operator*(const double s) const noexcept
+	{
+		return VectorD::Multiply(Get(), VectorD::Replicate(s));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector3d XM_CALLCONV Vector3d::operator-() const noexcept
+	{
+		return VectorD::Subtract(VectorD::Replicate(0.0), Get());
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Vector3d::operator+=(const Vector3d& rhs) noexcept
+	{
+		*this = VectorD::Add(Get(), rhs.Get());
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Vector3d::operator-=(const Vector3d& rhs) noexcept
+	{
+		*this = VectorD::Subtract(Get(), rhs.Get());
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTORD XM_CALLCONV Vector3d::Get() const noexcept
+	{
+		return VectorD::Load(m_v);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Vector3d::Set(const double x, const double y, const double z) noexcept
+	{
+		m_v[0] = x;
+		m_v[1] = y;
+		m_v[2] = z;
+		m_v[3] = 0.0;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector3 XM_CALLCONV Vector3d::ToFloat() const noexcept
+	{
+		return VectorD::ToFloat(Get());
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE double XM_CALLCONV Vector3d::Dot(const Vector3d& v0, const Vector3d& v1) noexcept
+	{
+		return v0.m_v[0] * v1.m_v[0] + v0.m_v[1] * v1.m_v[1] + v0.m_v[2] * v1.m_v[2];
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector3d XM_CALLCONV Vector3d::Cross(const Vector3d& v0, const Vector3d& v1) noexcept
+	{
+		return Vector3d(v0.m_v[1] * v1.m_v[2] - v0.m_v[2] * v1.m_v[1],
+						v0.m_v[2] * v1.m_v[0] - v0.m_v[0] * v1.m_v[2],
+						v0.m_v[0] * v1.m_v[1] - v0.m_v[1] * v1.m_v[0]);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE double XM_CALLCONV Vector3d::Length(const Vector3d& v) noexcept
+	{
+		return sqrt(Dot(v, v));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE double XM_CALLCONV Vector3d::Distance(const Vector3d& v0, const Vector3d& v1) noexcept
+	{
+		return Length(v1 - v0);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector3d XM_CALLCONV Vector3d::Lerp(const Vector3d& v0, const Vector3d& v1, const double t) noexcept
+	{
+		return VectorD::MultiplyAdd(VectorD::Subtract(v1.Get(), v0.Get()), VectorD::Replicate(t), v0.Get());
+	}
+
+	//------------------------------------------------------------------------------
+	// Matrixd
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrixd::Matrixd() noexcept
+	{
+		m_Row[0].Set(1.0, 0.0, 0.0, 0.0);
+		m_Row[1].Set(0.0, 1.0, 0.0, 0.0);
+		m_Row[2].Set(0.0, 0.0, 1.0, 0.0);
+		m_Row[3].Set(0.0, 0.0, 0.0, 1.0);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrixd::Matrixd(const Vector4d& Row0, const Vector4d& Row1, const Vector4d& Row2, const Vector4d& Row3) noexcept
+	{
+		m_Row[0] = Row0;
+		m_Row[1] = Row1;
+		m_Row[2] = Row2;
+		m_Row[3] = Row3;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrixd::Matrixd(const Matrix& m) noexcept
+	{
+		m_Row[0] = VectorD::FromFloat(m.GetRow0());
+		m_Row[1] = VectorD::FromFloat(m.GetRow1());
+		m_Row[2] = VectorD::FromFloat(m.GetRow2());
+		m_Row[3] = VectorD::FromFloat(m.GetRow3());
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrixd::Matrixd(const Matrix& m, const Vector3d& Translation) noexcept
+	{
+		m_Row[0] = VectorD::FromFloat(m.GetRow0());
+		m_Row[1] = VectorD::FromFloat(m.GetRow1());
+		m_Row[2] = VectorD::FromFloat(m.GetRow2());
+
+		SetTranslation(Translation);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE bool XM_CALLCONV Matrixd::operator==(const Matrixd& rhs) const noexcept
+	{
+		return m_Row[0] == rhs.m_Row[0] && m_Row[1] == rhs.m_Row[1] && m_Row[2] == rhs.m_Row[2] && m_Row[3] == rhs.m_Row[3];
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE bool XM_CALLCONV Matrixd::operator!=(const Matrixd& rhs) const noexcept
+	{
+		return !(*this == rhs);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrixd XM_CALLCONV Matrixd::operator*(const Matrixd& rhs) const noexcept
+	{
+		return Multiply(*this, rhs);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector3d XM_CALLCONV Matrixd::GetTranslation() const noexcept
+	{
+		return m_Row[3].Get();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Matrixd::SetTranslation(const Vector3d& Translation) noexcept
+	{
+		m_Row[3].Set(Translation.GetX(), Translation.GetY(), Translation.GetZ(), 1.0);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrix XM_CALLCONV Matrixd::ToFloat() const noexcept
+	{
+		return XMMATRIX(VectorD::ToFloat(m_Row[0].Get()), VectorD::ToFloat(m_Row[1].Get()),
+						VectorD::ToFloat(m_Row[2].Get()), VectorD::ToFloat(m_Row[3].Get()));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrixd XM_CALLCONV Matrixd::Identity() noexcept
+	{
+		return Matrixd();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrixd XM_CALLCONV Matrixd::Translation(const Vector3d& t) noexcept
+	{
+		Matrixd Result;
+		Result.SetTranslation(t);
+
+		return Result;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrixd XM_CALLCONV Matrixd::Multiply(const Matrixd& m0, const Matrixd& m1) noexcept
+	{
+		Matrixd Result;
+
+		for (UINT i = 0; i < 4; i++)
+			Result.m_Row[i] = Transform(m0.m_Row[i], m1);
+
+		return Result;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrixd XM_CALLCONV Matrixd::Transpose(const Matrixd& m) noexcept
+	{
+		const Vector4d& r0 = m.m_Row[0];
+		const Vector4d& r1 = m.m_Row[1];
+		const Vector4d& r2 = m.m_Row[2];
+		const Vector4d& r3 = m.m_Row[3];
+
+		return Matrixd(Vector4d(r0.GetX(), r1.GetX(), r2.GetX(), r3.GetX()),
+					   Vector4d(r0.GetY(), r1.GetY(), r2.GetY(), r3.GetY()),
+					   Vector4d(r0.GetZ(), r1.GetZ(), r2.GetZ(), r3.GetZ()),
+					   Vector4d(r0.GetW(), r1.GetW(), r2.GetW(), r3.GetW()));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrixd XM_CALLCONV Matrixd::InverseAffine(const Matrixd& m) noexcept
+	{
+		// Inverse of the 3x3 = Transpose(Cofactors) / Determinant, Translation = -t * Inverse
+		const Vector3d r0(m.m_Row[0].Get()), r1(m.m_Row[1].Get()), r2(m.m_Row[2].Get());
+
+		const Vector3d c0 = Vector3d::Cross(r1, r2);
+		const Vector3d c1 = Vector3d::Cross(r2, r0);
+		const Vector3d c2 = Vector3d::Cross(r0, r1);
+
+		const double InvDet = 1.0 / Vector3d::Dot(r0, c0);
+
+		Matrixd Result;
+		Result.m_Row[0].Set(c0.GetX() * InvDet, c1.GetX() * InvDet, c2.GetX() * InvDet, 0.0);
+		Result.m_Row[1].Set(c0.GetY() * InvDet, c1.GetY() * InvDet, c2.GetY() * InvDet, 0.0);
+		Result.m_Row[2].Set(c0.GetZ() * InvDet, c1.GetZ() * InvDet, c2.GetZ() * InvDet, 0.0);
+
+		const Vector3d t = TransformCoord(-m.GetTranslation(), Result);
+		Result.SetTranslation(t);
+
+		return Result;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector4d XM_CALLCONV Matrixd::Transform(const Vector4d& v, const Matrixd& m) noexcept
+	{
+		XMVECTORD Result = VectorD::Multiply(VectorD::Replicate(v.GetX()), m.m_Row[0].Get());
+		Result = VectorD::MultiplyAdd(VectorD::Replicate(v.GetY()), m.m_Row[1].Get(), Result);
+		Result = VectorD::MultiplyAdd(VectorD::Replicate(v.GetZ()), m.m_Row[2].Get(), Result);
+
+		return VectorD::MultiplyAdd(VectorD::Replicate(v.GetW()), m.m_Row[3].Get(), Result);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector3d XM_CALLCONV Matrixd::TransformCoord(const Vector3d& p, const Matrixd& m) noexcept
+	{
+		XMVECTORD Result = VectorD::MultiplyAdd(VectorD::Replicate(p.GetX()), m.m_Row[0].Get(), m.m_Row[3].Get());
+		Result = VectorD::MultiplyAdd(VectorD::Replicate(p.GetY()), m.m_Row[1].Get(), Result);
+
+		return VectorD::MultiplyAdd(VectorD::Replicate(p.GetZ()), m.m_Row[2].Get(), Result);
+	}
+
+	//------------------------------------------------------------------------------
+	// CameraRelative
+	//------------------------------------------------------------------------------
+	XM_INLINE CameraRelative::CameraRelative(const Vector3d& Origin) noexcept :
+		m_Origin(Origin)
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV CameraRelative::SetOrigin(const Vector3d& Origin) noexcept
+	{
+		m_Origin = Origin;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV CameraRelative::SetOrigin(const Camera& theCamera) noexcept
+	{
+		m_Origin = Vector3d(theCamera.GetPosition());
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector4 XM_CALLCONV CameraRelative::ToRelative(const Vector3d& p) const noexcept
+	{
+		return XMVectorSetW(VectorD::ToFloat(VectorD::Subtract(p.Get(), m_Origin.Get())), 1.0f);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrix XM_CALLCONV CameraRelative::ToRelative(const Matrixd& World) const noexcept
+	{
+		// only the Translation is large, Rotation / Scale convert directly
+		return XMMATRIX(VectorD::ToFloat(World.GetRow(0).Get()), VectorD::ToFloat(World.GetRow(1).Get()),
+						VectorD::ToFloat(World.GetRow(2).Get()), ToRelative(World.GetTranslation()));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector3d XM_CALLCONV CameraRelative::ToWorld(const Vector4& p) const noexcept
+	{
+		return VectorD::Add(Vector3d(p).Get(), m_Origin.Get());
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV CameraRelative::ToRelative(const Vector3d* pIn, Vector4* pOut, const UINT Count) const
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		const XMVECTORD Origin = m_Origin.Get();
+
+		ParallelFor(Count, CHUNK_SIZE, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT i = Begin; i < End; i++)
+				pOut[i] = XMVectorSetW(VectorD::ToFloat(VectorD::Subtract(pIn[i].Get(), Origin)), 1.0f);
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV CameraRelative::ToRelative(const Matrixd* pIn, Matrix* pOut, const UINT Count) const
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		ParallelFor(Count, CHUNK_SIZE / 4, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT i = Begin; i < End; i++)
+				pOut[i] = ToRelative(pIn[i]);
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrix XM_CALLCONV CameraRelative::ViewAtOrigin(const Camera& theCamera) noexcept
+	{
+		const Matrix& View = theCamera.GetViewMatrix();
+
+		return XMMATRIX(View.GetRow0(), View.GetRow1(), View.GetRow2(), g_XMIdentityR3);
+	}
+
+}// end of Namespace TurboMath
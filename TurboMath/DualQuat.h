@@ -0,0 +1,164 @@
+// -------------------------------------------------------------------
+// File			:	DualQuat
+//
+// Project		:	TurboMath
+//
+// Description	:	Dual-Quaternion for rigid Transformations and Skinning
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_DUALQUAT_H_
+#define _TURBOMATH_DUALQUAT_H_
+
+namespace TurboMath
+{
+	//-----------------------------------------------------------------------------
+	// Unit Dual-Quaternion (Real + e * Dual) of a rigid Transformation :
+	// Real is the Rotation r, Dual = 0.5 * t * r with the Translation t.
+	// A Transformation needs 8 Floats instead of 16, composes cheaper than a
+	// Matrix and blends without the "Candy-Wrapper" Artifacts of linear
+	// blended Matrices. Multiply(a, b) is a, then b (like Quat::Multiply).
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class DualQuat
+	{
+	public:
+		//------------------------------------------------------------
+		// Constructor
+		// -----------------------------------------------------------
+
+		/// default constructor, setup to Identity
+		DualQuat() noexcept;
+
+		/// construct from Rotation (unit Quat) and Translation
+		DualQuat(const Quat& Rotation, const Vector4& Translation) noexcept;
+
+		/// construct from the Real- and Dual-Part
+		DualQuat(FXMVECTOR Real, FXMVECTOR Dual) noexcept;
+
+		/// construct from a rigid Matrix (Rotation and Translation only)
+		explicit DualQuat(const Matrix& m) noexcept;
+
+		/// copy constructor
+		DualQuat(const DualQuat& rhs) noexcept;
+
+		// -----------------------------------------------------------
+		// assignment operator
+		// -----------------------------------------------------------
+
+		void XM_CALLCONV operator=(const DualQuat& rhs) noexcept;
+
+		/// equality operator
+		bool XM_CALLCONV operator==(const DualQuat& rhs) const noexcept;
+
+		/// inequality operator
+		bool XM_CALLCONV operator!=(const DualQuat& rhs) const noexcept;
+
+		/// Multiply(*this, rhs)
+		DualQuat XM_CALLCONV operator*(const DualQuat& rhs) const noexcept;
+
+		/// *this = Multiply(*this, rhs)
+		void XM_CALLCONV operator*=(const DualQuat& rhs) noexcept;
+
+		// -----------------------------------------------------------
+		// Set / Get
+		// -----------------------------------------------------------
+
+		/// set from Rotation (unit Quat) and Translation
+		void XM_CALLCONV Set(const Quat& Rotation, const Vector4& Translation) noexcept;
+
+		/// set the Real- and Dual-Part
+		void XM_CALLCONV Set(FXMVECTOR Real, FXMVECTOR Dual) noexcept;
+
+		/// Real-Part by XMVECTOR
+		const XMVECTOR XM_CALLCONV GetReal() const noexcept			{ return m_Real; }
+
+		/// Dual-Part by XMVECTOR
+		const XMVECTOR XM_CALLCONV GetDual() const noexcept			{ return m_Dual; }
+
+		/// Rotation
+		Quat XM_CALLCONV GetRotation() const noexcept;
+
+		/// Translation (w = 0)
+		Vector4 XM_CALLCONV GetTranslation() const noexcept;
+
+		/// rigid Matrix
+		Matrix XM_CALLCONV GetMatrix() const noexcept;
+
+		// -----------------------------------------------------------
+		// Transform
+		// -----------------------------------------------------------
+
+		/// rotate and translate a Point
+		Vector4 XM_CALLCONV TransformPoint(const Vector4& p) const noexcept;
+
+		/// rotate a Normal (or Direction)
+		Vector4 XM_CALLCONV TransformNormal(const Vector4& n) const noexcept;
+
+		// -----------------------------------------------------------
+		// Functions
+		// -----------------------------------------------------------
+
+		/// returns an identity DualQuat
+		static DualQuat XM_CALLCONV Identity() noexcept;
+
+		/// multiply 2 DualQuats (Transformation dq0, then dq1)
+		static DualQuat XM_CALLCONV Multiply(const DualQuat& dq0, const DualQuat& dq1) noexcept;
+
+		/// unit DualQuat (unit Real-Part, Dual-Part orthogonal to it)
+		static DualQuat XM_CALLCONV Normalize(const DualQuat& dq) noexcept;
+
+		/// conjugate (Real and Dual) - the Inverse of a unit DualQuat
+		static DualQuat XM_CALLCONV Conjugate(const DualQuat& dq) noexcept;
+
+		/// inverse Transformation of a unit DualQuat
+		static DualQuat XM_CALLCONV Inverse(const DualQuat& dq) noexcept;
+
+		/// screw linear interpolation (constant Speed along the Screw-Axis)
+		static DualQuat XM_CALLCONV ScLerp(const DualQuat& dq0, const DualQuat& dq1, const float t) noexcept;
+
+		/// dual-quaternion linear Blending of Count weighted DualQuats
+		static DualQuat XM_CALLCONV DLB(const DualQuat* pDQ, const float* pWeights, const UINT Count) noexcept;
+
+		//-----------------------------------------------------------------------------
+		// Batch-Blending for Skinning : each Vertex has NumInfluences Bone-Indices
+		// and Weights (pIndices[i * NumInfluences + j]), Weights of 0 are skipped
+		//-----------------------------------------------------------------------------
+
+		/// blended and normalized DualQuat of each Vertex
+		static void XM_CALLCONV BlendArray(const DualQuat* pBones, const UINT* pIndices, const float* pWeights, const UINT NumInfluences,
+										   const UINT NumVertices, DualQuat* pOut);
+
+		/// skinned Positions (and optional Normals) of each Vertex
+		static void XM_CALLCONV SkinArray(const DualQuat* pBones, const UINT* pIndices, const float* pWeights, const UINT NumInfluences,
+										  const UINT NumVertices, const Vector4* pPositions, Vector4* pOutPositions,
+										  const Vector4* pNormals = nullptr, Vector4* pOutNormals = nullptr);
+
+	protected:
+
+		/// blended (not normalized) DualQuat of one Vertex
+		static void XM_CALLCONV BlendVertex(const DualQuat* pBones, const UINT* pIndices, const float* pWeights, const UINT NumInfluences,
+											XMVECTOR& Real, XMVECTOR& Dual) noexcept;
+
+		XMVECTOR	m_Real;
+		XMVECTOR	m_Dual;
+	};
+
+}; // end of namespace
+
+#endif
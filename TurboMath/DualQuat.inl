@@ -0,0 +1,337 @@
+// -------------------------------------------------------------------
+// File			:	DualQuat
+//
+// Project		:	TurboMath
+//
+// Description	:	Dual-Quaternion for rigid Transformations and Skinning
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+namespace TurboMath
+{
+	// NOTE : XMQuaternionMultiply(a, b) is the Product b * a (Rotation a, then b),
+	//		  so all Products below are written in this Order.
+
+	//------------------------------------------------------------------------------
+	XM_INLINE DualQuat::DualQuat() noexcept
+		: m_Real(g_XMIdentityR3),
+		  m_Dual(XMVectorZero())
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE DualQuat::DualQuat(const Quat& Rotation, const Vector4& Translation) noexcept
+	{
+		Set(Rotation, Translation);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE DualQuat::DualQuat(FXMVECTOR Real, FXMVECTOR Dual) noexcept
+		: m_Real(Real),
+		  m_Dual(Dual)
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE DualQuat::DualQuat(const Matrix& m) noexcept
+	{
+		Set(Quat::Normalize(Quat::RotationMatrix(m)), m.GetRow3());
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE DualQuat::DualQuat(const DualQuat& rhs) noexcept
+		: m_Real(rhs.m_Real),
+		  m_Dual(rhs.m_Dual)
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV DualQuat::operator=(const DualQuat& rhs) noexcept
+	{
+		m_Real = rhs.m_Real;
+		m_Dual = rhs.m_Dual;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE bool XM_CALLCONV DualQuat::operator==(const DualQuat& rhs) const noexcept
+	{
+		return XMVector4Equal(m_Real, rhs.m_Real) && XMVector4Equal(m_Dual, rhs.m_Dual);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE bool XM_CALLCONV DualQuat::operator!=(const DualQuat& rhs) const noexcept
+	{
+		return !(*this == rhs);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE DualQuat XM_CALLCONV DualQuat::operator*(const DualQuat& rhs) const noexcept
+	{
+		return Multiply(*this, rhs);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV DualQuat::operator*=(const DualQuat& rhs) noexcept
+	{
+		*this = Multiply(*this, rhs);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV DualQuat::Set(const Quat& Rotation, const Vector4& Translation) noexcept
+	{
+		// Dual = 0.5 * t * r
+		const XMVECTOR t = XMVectorSelect(g_XMZero, Translation, g_XMSelect1110);
+
+		m_Real = Rotation.Get();
+		m_Dual = XMVectorScale(XMQuaternionMultiply(m_Real, t), 0.5f);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV DualQuat::Set(FXMVECTOR Real, FXMVECTOR Dual) noexcept
+	{
+		m_Real = Real;
+		m_Dual = Dual;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Quat XM_CALLCONV DualQuat::GetRotation() const noexcept
+	{
+		return Quat(m_Real);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector4 XM_CALLCONV DualQuat::GetTranslation() const noexcept
+	{
+		// t = 2 * Dual * conjugate(r)
+		const XMVECTOR t = XMQuaternionMultiply(XMQuaternionConjugate(m_Real), m_Dual);
+
+		return Vector4(XMVectorSelect(g_XMZero, XMVectorAdd(t, t), g_XMSelect1110));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrix XM_CALLCONV DualQuat::GetMatrix() const noexcept
+	{
+		XMMATRIX m = XMMatrixRotationQuaternion(m_Real);
+
+		m.r[3] = XMVectorSelect(g_XMIdentityR3, GetTranslation(), g_XMSelect1110);
+
+		return Matrix(m);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector4 XM_CALLCONV DualQuat::TransformPoint(const Vector4& p) const noexcept
+	{
+		// p' = p + 2 * rv x (rv x p + rw * p) + 2 * (rw * dv - dw * rv + rv x dv)
+		const XMVECTOR rw = XMVectorSplatW(m_Real);
+		const XMVECTOR dw = XMVectorSplatW(m_Dual);
+
+		XMVECTOR r = XMVector3Cross(m_Real, XMVectorMultiplyAdd(rw, p, XMVector3Cross(m_Real, p)));
+		XMVECTOR t = XMVectorAdd(XMVectorNegativeMultiplySubtract(dw, m_Real, XMVectorMultiply(rw, m_Dual)), XMVector3Cross(m_Real, m_Dual));
+
+		return Vector4(XMVectorAdd(p, XMVectorScale(XMVectorAdd(r, t), 2.0f)));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector4 XM_CALLCONV DualQuat::TransformNormal(const Vector4& n) const noexcept
+	{
+		const XMVECTOR rw = XMVectorSplatW(m_Real);
+
+		XMVECTOR r = XMVector3Cross(m_Real, XMVectorMultiplyAdd(rw, n, XMVector3Cross(m_Real, n)));
+
+		return Vector4(XMVectorAdd(n, XMVectorAdd(r, r)));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE DualQuat XM_CALLCONV DualQuat::Identity() noexcept
+	{
+		return DualQuat(g_XMIdentityR3, XMVectorZero());
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE DualQuat XM_CALLCONV DualQuat::Multiply(const DualQuat& dq0, const DualQuat& dq1) noexcept
+	{
+		// (r1 + e d1) * (r0 + e d0) = r1 r0 + e (r1 d0 + d1 r0)
+		XMVECTOR Real = XMQuaternionMultiply(dq0.m_Real, dq1.m_Real);
+		XMVECTOR Dual = XMVectorAdd(XMQuaternionMultiply(dq0.m_Dual, dq1.m_Real), XMQuaternionMultiply(dq0.m_Real, dq1.m_Dual));
+
+		return DualQuat(Real, Dual);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE DualQuat XM_CALLCONV DualQuat::Normalize(const DualQuat& dq) noexcept
+	{
+		const XMVECTOR InvLength = XMVector4ReciprocalLength(dq.m_Real);
+
+		XMVECTOR Real = XMVectorMultiply(dq.m_Real, InvLength);
+		XMVECTOR Dual = XMVectorMultiply(dq.m_Dual, InvLength);
+
+		// remove the Part of the Dual, which isn't orthogonal to the Real
+		Dual = XMVectorNegativeMultiplySubtract(Real, XMVector4Dot(Real, Dual), Dual);
+
+		return DualQuat(Real, Dual);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE DualQuat XM_CALLCONV DualQuat::Conjugate(const DualQuat& dq) noexcept
+	{
+		return DualQuat(XMQuaternionConjugate(dq.m_Real), XMQuaternionConjugate(dq.m_Dual));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE DualQuat XM_CALLCONV DualQuat::Inverse(const DualQuat& dq) noexcept
+	{
+		return Conjugate(Normalize(dq));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE DualQuat XM_CALLCONV DualQuat::ScLerp(const DualQuat& dq0, const DualQuat& dq1, const float t) noexcept
+	{
+		// shortest Path
+		DualQuat dq = dq1;
+
+		if (XMVectorGetX(XMVector4Dot(dq0.m_Real, dq1.m_Real)) < 0.0f)
+		{
+			dq.m_Real = XMVectorNegate(dq.m_Real);
+			dq.m_Dual = XMVectorNegate(dq.m_Dual);
+		}
+
+		// Difference dq0 -> dq1 as Screw (Angle, Pitch, Axis, Moment)
+		const DualQuat Diff = Multiply(dq, Conjugate(dq0));
+
+		const float SinHalf = XMVectorGetX(XMVector3Length(Diff.m_Real));
+
+		DualQuat Power;
+
+		if (SinHalf < 1e-6f)
+		{
+			// pure Translation
+			Power.m_Real = g_XMIdentityR3;
+			Power.m_Dual = XMVectorScale(Diff.m_Dual, t);
+		}
+		else
+		{
+			const float CosHalf = XMVectorGetW(Diff.m_Real);
+			const float InvSin	= 1.0f / SinHalf;
+			const float Half	= atan2f(SinHalf, CosHalf);
+			const float Pitch	= -2.0f * XMVectorGetW(Diff.m_Dual) * InvSin;
+
+			const XMVECTOR Axis   = XMVectorScale(XMVectorSelect(g_XMZero, Diff.m_Real, g_XMSelect1110), InvSin);
+			const XMVECTOR Moment = XMVectorScale(XMVectorSubtract(XMVectorSelect(g_XMZero, Diff.m_Dual, g_XMSelect1110),
+																   XMVectorScale(Axis, 0.5f * Pitch * CosHalf)), InvSin);
+
+			// Screw scaled by t
+			float s, c;
+			XMScalarSinCos(&s, &c, Half * t);
+
+			const float HalfPitch = 0.5f * Pitch * t;
+
+			Power.m_Real = XMVectorSetW(XMVectorScale(Axis, s), c);
+			Power.m_Dual = XMVectorSetW(XMVectorAdd(XMVectorScale(Moment, s), XMVectorScale(Axis, HalfPitch * c)), -HalfPitch * s);
+		}
+
+		return Multiply(Power, dq0);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE DualQuat XM_CALLCONV DualQuat::DLB(const DualQuat* pDQ, const float* pWeights, const UINT Count) noexcept
+	{
+		assert(pDQ && pWeights && Count > 0);
+
+		XMVECTOR Real = XMVectorZero();
+		XMVECTOR Dual = XMVectorZero();
+
+		for (UINT i = 0; i < Count; i++)
+		{
+			// same Hemisphere as the first
+			XMVECTOR w = XMVectorReplicate(pWeights[i]);
+			w = XMVectorSelect(w, XMVectorNegate(w), XMVectorLess(XMVector4Dot(pDQ[0].m_Real, pDQ[i].m_Real), g_XMZero));
+
+			Real = XMVectorMultiplyAdd(pDQ[i].m_Real, w, Real);
+			Dual = XMVectorMultiplyAdd(pDQ[i].m_Dual, w, Dual);
+		}
+
+		return Normalize(DualQuat(Real, Dual));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV DualQuat::BlendVertex(const DualQuat* pBones, const UINT* pIndices, const float* pWeights, const UINT NumInfluences,
+													 XMVECTOR& Real, XMVECTOR& Dual) noexcept
+	{
+		const XMVECTOR Pivot = pBones[pIndices[0]].m_Real;
+
+		Real = XMVectorZero();
+		Dual = XMVectorZero();
+
+		for (UINT j = 0; j < NumInfluences; j++)
+		{
+			if (pWeights[j] == 0.0f)
+				continue;
+
+			const DualQuat& Bone = pBones[pIndices[j]];
+
+			XMVECTOR w = XMVectorReplicate(pWeights[j]);
+			w = XMVectorSelect(w, XMVectorNegate(w), XMVectorLess(XMVector4Dot(Pivot, Bone.m_Real), g_XMZero));
+
+			Real = XMVectorMultiplyAdd(Bone.m_Real, w, Real);
+			Dual = XMVectorMultiplyAdd(Bone.m_Dual, w, Dual);
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV DualQuat::BlendArray(const DualQuat* pBones, const UINT* pIndices, const float* pWeights, const UINT NumInfluences,
+													const UINT NumVertices, DualQuat* pOut)
+	{
+		assert(pBones && pIndices && pWeights && pOut && NumInfluences > 0);
+
+		ParallelFor(NumVertices, 1024, [&](const UINT Begin, const UINT End)
+		{
+			XMVECTOR Real, Dual;
+
+			for (UINT i = Begin; i < End; i++)
+			{
+				BlendVertex(pBones, pIndices + i * NumInfluences, pWeights + i * NumInfluences, NumInfluences, Real, Dual);
+
+				pOut[i] = Normalize(DualQuat(Real, Dual));
+			}
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV DualQuat::SkinArray(const DualQuat* pBones, const UINT* pIndices, const float* pWeights, const UINT NumInfluences,
+												   const UINT NumVertices, const Vector4* pPositions, Vector4* pOutPositions,
+												   const Vector4* pNormals, Vector4* pOutNormals)
+	{
+		assert(pBones && pIndices && pWeights && pPositions && pOutPositions && NumInfluences > 0);
+		assert((pNormals == nullptr) == (pOutNormals == nullptr));
+
+		ParallelFor(NumVertices, 1024, [&](const UINT Begin, const UINT End)
+		{
+			XMVECTOR Real, Dual;
+
+			for (UINT i = Begin; i < End; i++)
+			{
+				BlendVertex(pBones, pIndices + i * NumInfluences, pWeights + i * NumInfluences, NumInfluences, Real, Dual);
+
+				const DualQuat dq = Normalize(DualQuat(Real, Dual));
+
+				pOutPositions[i] = dq.TransformPoint(pPositions[i]);
+
+				if (pNormals)
+					pOutNormals[i] = dq.TransformNormal(pNormals[i]);
+			}
+		});
+	}
+
+}// end of Namespace TurboMath
@@ -0,0 +1,163 @@
+// -------------------------------------------------------------------
+// File			:	KdTree
+//
+// Project		:	TurboMath
+//
+// Description	:	balanced k-d Tree for Nearest-Neighbour-Queries on Points
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_KDTREE_H_
+#define _TURBOMATH_KDTREE_H_
+
+#include <vector>
+#include <algorithm>
+
+namespace TurboMath
+{
+
+	//-----------------------------------------------------------------------------
+	// Inner Node of the KdTree (8 Byte). Points with a Coordinate below Split
+	// are in the left Child, Points above in the right Child.
+	//-----------------------------------------------------------------------------
+	struct KdNode
+	{
+		float	Split;
+		UINT	Axis;
+	};
+
+	//-----------------------------------------------------------------------------
+	// Balanced k-d Tree over a static Set of Points in an implicit Layout :
+	// the Inner Nodes are stored in Heap-Order (Children of Node n are 2n+1 and
+	// 2n+2), so the Tree needs no Child-Pointers. Every Node splits its Points
+	// at the Median of its largest Axis, all Leafs are on the same Level and
+	// hold up to LeafSize Points.
+	//
+	// The Points are copied in Leaf-Order into SoA-Streams, a Leaf is tested
+	// 4 Points per Instruction. The Batch-Queries sort the Query-Points by
+	// their Leaf, run in parallel and start every Search with the Result of
+	// the previous (neighbouring) Query as Bound.
+	//
+	// All Queries return the Indices of the Points used for the Build.
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class KdTree
+	{
+	public:
+
+		typedef std::vector<float, AAllocator<float> >	FloatStream;
+
+		/// Index for "no Point found"
+		static constexpr UINT INVALID_INDEX = 0xFFFFFFFF;
+
+		/// default max. Number of Points per Leaf
+		static constexpr UINT DEFAULT_LEAF_SIZE = 8;
+
+		/// max. Depth of the Traversal-Stack
+		static constexpr UINT MAX_STACK = 64;
+
+		KdTree() noexcept;
+		~KdTree() noexcept;
+
+		/// remove all Points
+		void			XM_CALLCONV Clear() noexcept;
+
+		/// is the Tree empty ?
+		const bool		XM_CALLCONV IsEmpty() const noexcept				{ return m_NumPoints == 0; }
+
+		//-----------------------------------------------------------------------------
+		// Build
+		//-----------------------------------------------------------------------------
+
+		/// build the Tree over the Points
+		void			XM_CALLCONV Build(const Vector4* pPoints, const UINT Count, const UINT LeafSize = DEFAULT_LEAF_SIZE);
+
+		/// build the Tree over the Points
+		void			XM_CALLCONV Build(const Point3* pPoints, const UINT Count, const UINT LeafSize = DEFAULT_LEAF_SIZE);
+
+		//-----------------------------------------------------------------------------
+		// Access
+		//-----------------------------------------------------------------------------
+
+		/// get Number of Points
+		const UINT		XM_CALLCONV GetNumPoints() const noexcept			{ return m_NumPoints; }
+
+		/// get Number of Leafs
+		const UINT		XM_CALLCONV GetNumLeafs() const noexcept			{ return m_NumInner + 1; }
+
+		/// get Number of Levels below the Root
+		const UINT		XM_CALLCONV GetDepth() const noexcept				{ return m_Depth; }
+
+		//-----------------------------------------------------------------------------
+		// Queries
+		//-----------------------------------------------------------------------------
+
+		/// Index of the nearest Point closer than sqrt(MaxDistSq) or INVALID_INDEX
+		const UINT		XM_CALLCONV Nearest(FXMVECTOR Pos, float* pDistSq = nullptr, const float MaxDistSq = FLT_MAX) const noexcept;
+
+		/// the k nearest Points sorted by Distance (pIndices and pDistSq with k Entries), returns the Number found
+		const UINT		XM_CALLCONV KNearest(FXMVECTOR Pos, const UINT k, UINT* pIndices, float* pDistSq) const noexcept;
+
+		/// append the Indices of all Points inside the Radius, returns the Number found
+		const UINT		XM_CALLCONV RadiusSearch(FXMVECTOR Pos, const float Radius, std::vector<UINT>& Result) const;
+
+		//-----------------------------------------------------------------------------
+		// Batch-Queries (parallel)
+		//-----------------------------------------------------------------------------
+
+		/// nearest Point for every Query-Point (pDistSq optional)
+		void			XM_CALLCONV NearestBatch(const Vector4* pQueries, const UINT Count, UINT* pResults, float* pDistSq = nullptr) const;
+
+		/// k nearest Points for every Query-Point, Query i writes k Entries at i * k (Distances optional, INVALID_INDEX for missing Points)
+		void			XM_CALLCONV KNearestBatch(const Vector4* pQueries, const UINT Count, const UINT k, UINT* pIndices, float* pDistSq = nullptr) const;
+
+	protected:
+
+		/// Median-Split of the Points, Func(i) returns the Position of Point i as XMFLOAT3
+		template <class PointFunc>
+		void			XM_CALLCONV BuildPoints(const UINT Count, const UINT LeafSize, const PointFunc& Func);
+
+		/// visit the Leafs near to far, Func(Begin, End) tests the sorted Points [Begin, End) and may shrink MaxDistSq
+		template <class LeafFunc>
+		void			XM_CALLCONV Traverse(FXMVECTOR Pos, const float& MaxDistSq, const LeafFunc& Func) const noexcept;
+
+		/// nearest Point starting with a Bound, BestSorted is the Position in the sorted Streams
+		void			XM_CALLCONV FindNearest(FXMVECTOR Pos, float& BestDistSq, UINT& BestSorted) const noexcept;
+
+		/// Leaf containing a Position
+		const UINT		XM_CALLCONV FindLeaf(FXMVECTOR Pos) const noexcept;
+
+		/// squared Distance to a sorted Point
+		const float		XM_CALLCONV DistanceSq(FXMVECTOR Pos, const UINT Sorted) const noexcept;
+
+		/// order of the Query-Points sorted by their Leaf
+		void			XM_CALLCONV SortQueries(const Vector4* pQueries, const UINT Count, std::vector<UINT>& Order) const;
+
+		std::vector<KdNode>	m_Nodes;			// Inner Nodes in Heap-Order
+		std::vector<UINT>	m_LeafStart;		// first sorted Point of every Leaf (+ End)
+		std::vector<UINT>	m_Indices;			// sorted Position -> Point-Index
+		FloatStream		m_X, m_Y, m_Z;			// Positions in Leaf-Order
+
+		UINT			m_NumPoints;
+		UINT			m_NumInner;
+		UINT			m_Depth;
+	};
+
+}; // end of namespace
+
+#endif
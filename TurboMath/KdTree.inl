@@ -0,0 +1,578 @@
+// -------------------------------------------------------------------
+// File			:	KdTree
+//
+// Project		:	TurboMath
+//
+// Description	:	balanced k-d Tree for Nearest-Neighbour-Queries on Points
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+namespace TurboMath
+{
+	//------------------------------------------------------------------------------
+	XM_INLINE KdTree::KdTree() noexcept
+		: m_NumPoints(0)
+		, m_NumInner(0)
+		, m_Depth(0)
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE KdTree::~KdTree() noexcept
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV KdTree::Clear() noexcept
+	{
+		m_Nodes.clear();
+		m_LeafStart.clear();
+		m_Indices.clear();
+		m_X.clear();
+		m_Y.clear();
+		m_Z.clear();
+
+		m_NumPoints = 0;
+		m_NumInner = 0;
+		m_Depth = 0;
+	}
+
+	//------------------------------------------------------------------------------
+	// Build
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV KdTree::Build(const Vector4* pPoints, const UINT Count, const UINT LeafSize)
+	{
+		assert(pPoints != nullptr || Count == 0);
+
+		BuildPoints(Count, LeafSize, [pPoints](const UINT i)
+		{
+			const float* p = pPoints[i];
+			return XMFLOAT3(p[0], p[1], p[2]);
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV KdTree::Build(const Point3* pPoints, const UINT Count, const UINT LeafSize)
+	{
+		assert(pPoints != nullptr || Count == 0);
+
+		BuildPoints(Count, LeafSize, [pPoints](const UINT i)
+		{
+			const XMFLOAT3& p = pPoints[i];
+			return p;
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	// The Tree is built Level by Level : all Nodes of a Level split their
+	// Range of Points independently (nth_element on the largest Axis), so
+	// the Levels below the Root run in parallel.
+	template <class PointFunc>
+	XM_INLINE void XM_CALLCONV KdTree::BuildPoints(const UINT Count, const UINT LeafSize, const PointFunc& Func)
+	{
+		assert(LeafSize > 0);
+
+		Clear();
+
+		m_NumPoints = Count;
+
+		// all Leafs on one Level with at most LeafSize Points
+		m_Depth = 0;
+		while (m_Depth < 24 && ((Count + (1u << m_Depth) - 1) >> m_Depth) > LeafSize)
+			m_Depth++;
+
+		const UINT NumLeafs = 1u << m_Depth;
+		m_NumInner = NumLeafs - 1;
+		m_Nodes.resize(m_NumInner);
+
+		// copy the Positions
+		std::vector<XMFLOAT3> Points(Count);
+		std::vector<UINT> Order(Count);
+
+		ParallelFor(Count, 16384, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT i = Begin; i < End; i++)
+			{
+				Points[i] = Func(i);
+				Order[i] = i;
+			}
+		});
+
+		// split Level by Level
+		std::vector<UINT> LevelStart(2);
+		std::vector<UINT> NextStart;
+		LevelStart[0] = 0;
+		LevelStart[1] = Count;
+
+		for (UINT Level = 0; Level < m_Depth; Level++)
+		{
+			const UINT NumNodes = 1u << Level;
+			NextStart.resize(2 * NumNodes + 1);
+
+			ParallelFor(NumNodes, 1, [&](const UINT Begin, const UINT End)
+			{
+				for (UINT k = Begin; k < End; k++)
+				{
+					const UINT First = LevelStart[k];
+					const UINT Last = LevelStart[k + 1];
+					const UINT Mid = First + (Last - First) / 2;
+
+					// largest Axis of the Points
+					XMVECTOR vMin = g_XMFltMax;
+					XMVECTOR vMax = XMVectorNegate(g_XMFltMax);
+
+					for (UINT i = First; i < Last; i++)
+					{
+						const XMVECTOR P = XMLoadFloat3(&Points[Order[i]]);
+						vMin = XMVectorMin(vMin, P);
+						vMax = XMVectorMax(vMax, P);
+					}
+
+					XMFLOAT3 Extents;
+					XMStoreFloat3(&Extents, XMVectorSubtract(vMax, vMin));
+
+					UINT Axis = 0;
+					if (Extents.y > Extents.x)
+						Axis = 1;
+					if (Extents.z > ((Axis == 0) ? Extents.x : Extents.y))
+						Axis = 2;
+
+					KdNode& Node = m_Nodes[NumNodes - 1 + k];
+					Node.Axis = Axis;
+					Node.Split = 0.0f;
+
+					if (Mid < Last)
+					{
+						std::nth_element(Order.begin() + First, Order.begin() + Mid, Order.begin() + Last, [&](const UINT a, const UINT b)
+						{
+							return (&Points[a].x)[Axis] < (&Points[b].x)[Axis];
+						});
+
+						Node.Split = (&Points[Order[Mid]].x)[Axis];
+					}
+
+					NextStart[2 * k] = First;
+					NextStart[2 * k + 1] = Mid;
+				}
+			});
+
+			NextStart[2 * NumNodes] = Count;
+			LevelStart.swap(NextStart);
+		}
+
+		m_LeafStart.swap(LevelStart);
+
+		// Positions in Leaf-Order
+		m_Indices.swap(Order);
+		m_X.resize(Count);
+		m_Y.resize(Count);
+		m_Z.resize(Count);
+
+		ParallelFor(Count, 16384, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT i = Begin; i < End; i++)
+			{
+				const XMFLOAT3& P = Points[m_Indices[i]];
+				m_X[i] = P.x;
+				m_Y[i] = P.y;
+				m_Z[i] = P.z;
+			}
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	// Traversal
+	//------------------------------------------------------------------------------
+	template <class LeafFunc>
+	XM_INLINE void XM_CALLCONV KdTree::Traverse(FXMVECTOR Pos, const float& MaxDistSq, const LeafFunc& Func) const noexcept
+	{
+		if (m_NumPoints == 0)
+			return;
+
+		XMFLOAT4A P;
+		XMStoreFloat4A(&P, Pos);
+		const float* p = &P.x;
+
+		struct StackEntry
+		{
+			UINT	Node;
+			float	DistSq;		// lower Bound of the Distance to the Node
+		};
+
+		StackEntry Stack[MAX_STACK];
+		UINT StackSize = 0;
+
+		Stack[StackSize].Node = 0;
+		Stack[StackSize].DistSq = 0.0f;
+		StackSize++;
+
+		while (StackSize > 0)
+		{
+			const StackEntry Entry = Stack[--StackSize];
+
+			if (Entry.DistSq > MaxDistSq)
+				continue;
+
+			// down to the Leaf on the Side of the Position
+			UINT Node = Entry.Node;
+
+			while (Node < m_NumInner)
+			{
+				const KdNode& Inner = m_Nodes[Node];
+				const float d = p[Inner.Axis] - Inner.Split;
+
+				const UINT Near = (d >= 0.0f) ? 2 * Node + 2 : 2 * Node + 1;
+				const UINT Far = (d >= 0.0f) ? 2 * Node + 1 : 2 * Node + 2;
+				const float FarDistSq = XMMax(Entry.DistSq, d * d);
+
+				if (FarDistSq <= MaxDistSq)
+				{
+					assert(StackSize < MAX_STACK);
+					Stack[StackSize].Node = Far;
+					Stack[StackSize].DistSq = FarDistSq;
+					StackSize++;
+				}
+
+				Node = Near;
+			}
+
+			const UINT Leaf = Node - m_NumInner;
+			Func(m_LeafStart[Leaf], m_LeafStart[Leaf + 1]);
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV KdTree::FindLeaf(FXMVECTOR Pos) const noexcept
+	{
+		XMFLOAT4A P;
+		XMStoreFloat4A(&P, Pos);
+		const float* p = &P.x;
+
+		UINT Node = 0;
+		while (Node < m_NumInner)
+		{
+			const KdNode& Inner = m_Nodes[Node];
+			Node = (p[Inner.Axis] >= Inner.Split) ? 2 * Node + 2 : 2 * Node + 1;
+		}
+
+		return Node - m_NumInner;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const float XM_CALLCONV KdTree::DistanceSq(FXMVECTOR Pos, const UINT Sorted) const noexcept
+	{
+		const XMVECTOR P = XMVectorSet(m_X[Sorted], m_Y[Sorted], m_Z[Sorted], 0.0f);
+		return XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(P, Pos)));
+	}
+
+	//------------------------------------------------------------------------------
+	// Queries
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV KdTree::FindNearest(FXMVECTOR Pos, float& BestDistSq, UINT& BestSorted) const noexcept
+	{
+		const XMVECTOR Px = XMVectorSplatX(Pos);
+		const XMVECTOR Py = XMVectorSplatY(Pos);
+		const XMVECTOR Pz = XMVectorSplatZ(Pos);
+
+		Traverse(Pos, BestDistSq, [&](const UINT Begin, const UINT End)
+		{
+			UINT i = Begin;
+
+			// 4 Points at once
+			for (; i + 4 <= End; i += 4)
+			{
+				const XMVECTOR dx = XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)&m_X[i]), Px);
+				const XMVECTOR dy = XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)&m_Y[i]), Py);
+				const XMVECTOR dz = XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)&m_Z[i]), Pz);
+
+				XMVECTOR DistSq = XMVectorMultiply(dx, dx);
+				DistSq = XMVectorMultiplyAdd(dy, dy, DistSq);
+				DistSq = XMVectorMultiplyAdd(dz, dz, DistSq);
+
+				if (XMVector4GreaterOrEqual(DistSq, XMVectorReplicate(BestDistSq)))
+					continue;
+
+				XMFLOAT4A Dist;
+				XMStoreFloat4A(&Dist, DistSq);
+
+				const float* d = &Dist.x;
+				for (UINT l = 0; l < 4; l++)
+				{
+					if (d[l] < BestDistSq)
+					{
+						BestDistSq = d[l];
+						BestSorted = i + l;
+					}
+				}
+			}
+
+			for (; i < End; i++)
+			{
+				const float d = DistanceSq(Pos, i);
+				if (d < BestDistSq)
+				{
+					BestDistSq = d;
+					BestSorted = i;
+				}
+			}
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV KdTree::Nearest(FXMVECTOR Pos, float* pDistSq, const float MaxDistSq) const noexcept
+	{
+		float BestDistSq = MaxDistSq;
+		UINT BestSorted = INVALID_INDEX;
+
+		FindNearest(Pos, BestDistSq, BestSorted);
+
+		if (pDistSq != nullptr)
+			*pDistSq = BestDistSq;
+
+		return (BestSorted != INVALID_INDEX) ? m_Indices[BestSorted] : INVALID_INDEX;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV KdTree::KNearest(FXMVECTOR Pos, const UINT k, UINT* pIndices, float* pDistSq) const noexcept
+	{
+		assert(pIndices != nullptr && pDistSq != nullptr);
+
+		if (k == 0)
+			return 0;
+
+		const XMVECTOR Px = XMVectorSplatX(Pos);
+		const XMVECTOR Py = XMVectorSplatY(Pos);
+		const XMVECTOR Pz = XMVectorSplatZ(Pos);
+
+		UINT Found = 0;
+		float Bound = FLT_MAX;
+
+		// sorted Insert, pIndices holds the sorted Positions until the End
+		auto Insert = [&](const float d, const UINT Sorted)
+		{
+			UINT Slot = (Found < k) ? Found++ : k - 1;
+
+			while (Slot > 0 && pDistSq[Slot - 1] > d)
+			{
+				pDistSq[Slot] = pDistSq[Slot - 1];
+				pIndices[Slot] = pIndices[Slot - 1];
+				Slot--;
+			}
+
+			pDistSq[Slot] = d;
+			pIndices[Slot] = Sorted;
+
+			if (Found == k)
+				Bound = pDistSq[k - 1];
+		};
+
+		Traverse(Pos, Bound, [&](const UINT Begin, const UINT End)
+		{
+			UINT i = Begin;
+
+			// 4 Points at once
+			for (; i + 4 <= End; i += 4)
+			{
+				const XMVECTOR dx = XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)&m_X[i]), Px);
+				const XMVECTOR dy = XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)&m_Y[i]), Py);
+				const XMVECTOR dz = XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)&m_Z[i]), Pz);
+
+				XMVECTOR DistSq = XMVectorMultiply(dx, dx);
+				DistSq = XMVectorMultiplyAdd(dy, dy, DistSq);
+				DistSq = XMVectorMultiplyAdd(dz, dz, DistSq);
+
+				if (XMVector4GreaterOrEqual(DistSq, XMVectorReplicate(Bound)))
+					continue;
+
+				XMFLOAT4A Dist;
+				XMStoreFloat4A(&Dist, DistSq);
+
+				const float* d = &Dist.x;
+				for (UINT l = 0; l < 4; l++)
+				{
+					if (d[l] < Bound)
+						Insert(d[l], i + l);
+				}
+			}
+
+			for (; i < End; i++)
+			{
+				const float d = DistanceSq(Pos, i);
+				if (d < Bound)
+					Insert(d, i);
+			}
+		});
+
+		for (UINT i = 0; i < Found; i++)
+			pIndices[i] = m_Indices[pIndices[i]];
+
+		return Found;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV KdTree::RadiusSearch(FXMVECTOR Pos, const float Radius, std::vector<UINT>& Result) const
+	{
+		const size_t First = Result.size();
+
+		const XMVECTOR Px = XMVectorSplatX(Pos);
+		const XMVECTOR Py = XMVectorSplatY(Pos);
+		const XMVECTOR Pz = XMVectorSplatZ(Pos);
+
+		const float RadiusSq = Radius * Radius;
+		const XMVECTOR R2 = XMVectorReplicate(RadiusSq);
+
+		Traverse(Pos, RadiusSq, [&](const UINT Begin, const UINT End)
+		{
+			UINT i = Begin;
+
+			// 4 Points at once
+			for (; i + 4 <= End; i += 4)
+			{
+				const XMVECTOR dx = XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)&m_X[i]), Px);
+				const XMVECTOR dy = XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)&m_Y[i]), Py);
+				const XMVECTOR dz = XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)&m_Z[i]), Pz);
+
+				XMVECTOR DistSq = XMVectorMultiply(dx, dx);
+				DistSq = XMVectorMultiplyAdd(dy, dy, DistSq);
+				DistSq = XMVectorMultiplyAdd(dz, dz, DistSq);
+
+				const XMVECTOR Inside = XMVectorLessOrEqual(DistSq, R2);
+
+				if (XMVector4EqualInt(Inside, XMVectorFalseInt()))
+					continue;
+
+				CACHE_ALIGN(16) uint32_t Mask[4];
+				XMStoreInt4A(Mask, Inside);
+
+				for (UINT l = 0; l < 4; l++)
+				{
+					if (Mask[l])
+						Result.push_back(m_Indices[i + l]);
+				}
+			}
+
+			for (; i < End; i++)
+			{
+				if (DistanceSq(Pos, i) <= RadiusSq)
+					Result.push_back(m_Indices[i]);
+			}
+		});
+
+		return (UINT)(Result.size() - First);
+	}
+
+	//------------------------------------------------------------------------------
+	// Batch-Queries
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV KdTree::SortQueries(const Vector4* pQueries, const UINT Count, std::vector<UINT>& Order) const
+	{
+		const UINT NumLeafs = m_NumInner + 1;
+
+		std::vector<UINT> QueryLeaf(Count);
+
+		ParallelFor(Count, 4096, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT i = Begin; i < End; i++)
+				QueryLeaf[i] = FindLeaf(pQueries[i]);
+		});
+
+		// Counting-Sort by Leaf
+		std::vector<UINT> LeafStart(NumLeafs + 1, 0);
+
+		for (UINT i = 0; i < Count; i++)
+			LeafStart[QueryLeaf[i] + 1]++;
+
+		for (UINT i = 0; i < NumLeafs; i++)
+			LeafStart[i + 1] += LeafStart[i];
+
+		Order.resize(Count);
+
+		for (UINT i = 0; i < Count; i++)
+			Order[LeafStart[QueryLeaf[i]]++] = i;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV KdTree::NearestBatch(const Vector4* pQueries, const UINT Count, UINT* pResults, float* pDistSq) const
+	{
+		assert(pQueries != nullptr && pResults != nullptr);
+
+		std::vector<UINT> Order;
+		SortQueries(pQueries, Count, Order);
+
+		ParallelFor(Count, 256, [&](const UINT Begin, const UINT End)
+		{
+			UINT Previous = INVALID_INDEX;
+
+			for (UINT j = Begin; j < End; j++)
+			{
+				const UINT q = Order[j];
+				const XMVECTOR Pos = pQueries[q];
+
+				// the Result of the neighbouring Query is a good first Bound
+				float BestDistSq = FLT_MAX;
+				UINT BestSorted = INVALID_INDEX;
+
+				if (Previous != INVALID_INDEX)
+				{
+					BestDistSq = DistanceSq(Pos, Previous);
+					BestSorted = Previous;
+				}
+
+				FindNearest(Pos, BestDistSq, BestSorted);
+
+				pResults[q] = (BestSorted != INVALID_INDEX) ? m_Indices[BestSorted] : INVALID_INDEX;
+
+				if (pDistSq != nullptr)
+					pDistSq[q] = BestDistSq;
+
+				Previous = BestSorted;
+			}
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV KdTree::KNearestBatch(const Vector4* pQueries, const UINT Count, const UINT k, UINT* pIndices, float* pDistSq) const
+	{
+		assert(pQueries != nullptr && pIndices != nullptr);
+
+		if (k == 0)
+			return;
+
+		std::vector<UINT> Order;
+		SortQueries(pQueries, Count, Order);
+
+		ParallelFor(Count, 256, [&](const UINT Begin, const UINT End)
+		{
+			std::vector<float> Distances((pDistSq != nullptr) ? 0 : k);
+
+			for (UINT j = Begin; j < End; j++)
+			{
+				const UINT q = Order[j];
+
+				UINT* pQueryIndices = pIndices + (size_t)q * k;
+				float* pQueryDist = (pDistSq != nullptr) ? pDistSq + (size_t)q * k : Distances.data();
+
+				const UINT Found = KNearest(pQueries[q], k, pQueryIndices, pQueryDist);
+
+				for (UINT i = Found; i < k; i++)
+				{
+					pQueryIndices[i] = INVALID_INDEX;
+					pQueryDist[i] = FLT_MAX;
+				}
+			}
+		});
+	}
+
+}// end of Namespace TurboMath
@@ -82,6 +82,9 @@ namespace TurboMath
 		/// Return the point on the line segement  nearest the point P.
 		const Vector4  XM_CALLCONV PointOnLineSegmentNearestPoint(const Vector4& P ) noexcept;
 		
+		/// squared distance between the segments, pa / pb are the closest points
+		const float  XM_CALLCONV SegmentDistanceSq(const Line& l, Vector4& pa, Vector4& pb) const noexcept;
+		
 		/// Intersect Plane / Line
 		const bool  XM_CALLCONV IntersectPlane( const Plane& plane) const noexcept;
 
@@ -207,6 +207,20 @@ namespace TurboMath
 		return Point;
 	}
 
+	//-----------------------------------------------------------------------------
+	/// squared distance between the segments
+	//-----------------------------------------------------------------------------
+	XM_INLINE   const float  XM_CALLCONV Line::SegmentDistanceSq(const Line& l, Vector4& pa, Vector4& pb) const noexcept
+	{
+		XMVECTOR Ca, Cb;
+		const float d = DistanceSqSegmentSegment(b, b + m, l.b, l.b + l.m, &Ca, &Cb);
+
+		pa = Ca;
+		pb = Cb;
+
+		return d;
+	}
+
 	//-----------------------------------------------------------------------------
 	/// Intersect Plane / Line
 	//-----------------------------------------------------------------------------
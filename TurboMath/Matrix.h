@@ -401,6 +401,22 @@ namespace TurboMath
 		// transform a plane with a matrix
 		static Plane	XM_CALLCONV Transform(const Plane& p, const Matrix& m) noexcept;
 
+		//-----------------------------------------------------------------------------
+		// Arrays of Matrices (Skinning-Palettes, Instance-Buffers, Hierarchies). With
+		// AVX 2 Matrices are processed per Register. Stream = true writes past the
+		// Cache (for Buffers, which are uploaded to the GPU and not read back).
+		// pOut may be one of the Inputs.
+		//-----------------------------------------------------------------------------
+
+		/// pOut[i] = pM0[i] * pM1[i]
+		static void		XM_CALLCONV MultiplyArray(const Matrix* pM0, const Matrix* pM1, Matrix* pOut, const UINT Count, const bool Stream = false) noexcept;
+
+		/// pOut[i] = Inverse(pIn[i])
+		static void		XM_CALLCONV InverseArray(const Matrix* pIn, Matrix* pOut, const UINT Count, const bool Stream = false) noexcept;
+
+		/// Normal-Matrices : Inverse-Transpose of the upper 3x3 (4th Row and Column = Identity)
+		static void		XM_CALLCONV InverseTransposeArray(const Matrix* pIn, Matrix* pOut, const UINT Count, const bool Stream = false) noexcept;
+
 
 		/// Easy acces Matrix Members
 		/// So it is possible to do something like this:
@@ -436,6 +452,24 @@ namespace TurboMath
 		friend class Frustum;
 
 	protected:
+
+		/// store with or without Streaming
+		static void		XM_CALLCONV Store(Matrix* pOut, FXMMATRIX m, const bool Stream) noexcept;
+
+		/// Inverse-Transpose of the upper 3x3 from the Cofactors
+		static XMMATRIX	XM_CALLCONV InverseTranspose3x3(FXMMATRIX m) noexcept;
+
+#ifdef XM_AVX_INTRINSICS
+		/// Rows of pM[0] (low Half) and pM[1] (high Half)
+		static void		XM_CALLCONV LoadPair(const Matrix* pM, __m256* pRows) noexcept;
+		static void		XM_CALLCONV StorePair(Matrix* pOut, const __m256* pRows, const bool Stream) noexcept;
+
+		/// 2x2 Blocks (a, b, c, d) in the Halfs : A * B, Adj(A) * B, A * Adj(B)
+		static __m256	XM_CALLCONV Block2Mul(const __m256 a, const __m256 b) noexcept;
+		static __m256	XM_CALLCONV Block2AdjMul(const __m256 a, const __m256 b) noexcept;
+		static __m256	XM_CALLCONV Block2MulAdj(const __m256 a, const __m256 b) noexcept;
+#endif
+
 		XMMATRIX mx;
 	};// End of Class : Matrix
 
@@ -1191,6 +1191,248 @@ namespace TurboMath
 		return XMMatrixTransformation(scalingCenter,scalingRotation.vec,scaling,rotationCenter,rotation.vec,translation);
 	}
 
+	//------------------------------------------------------------------------------
+	XM_INLINE   void XM_CALLCONV Matrix::Store(Matrix* pOut, FXMMATRIX m, const bool Stream) noexcept
+	{
+		if (Stream)
+		{
+			float* p = reinterpret_cast<float*>(&pOut->mx);
+
+			_mm_stream_ps(p, m.r[0]);
+			_mm_stream_ps(p + 4, m.r[1]);
+			_mm_stream_ps(p + 8, m.r[2]);
+			_mm_stream_ps(p + 12, m.r[3]);
+		}
+		else
+			pOut->mx = m;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE   XMMATRIX XM_CALLCONV Matrix::InverseTranspose3x3(FXMMATRIX m) noexcept
+	{
+		// Rows of the Inverse-Transpose are the Cross-Products of the other Rows / Determinant
+		const XMVECTOR c0 = XMVector3Cross(m.r[1], m.r[2]);
+		const XMVECTOR c1 = XMVector3Cross(m.r[2], m.r[0]);
+		const XMVECTOR c2 = XMVector3Cross(m.r[0], m.r[1]);
+
+		const XMVECTOR InvDet = XMVectorReciprocal(XMVector3Dot(m.r[0], c0));
+
+		XMMATRIX Result;
+		Result.r[0] = XMVectorMultiply(c0, InvDet);
+		Result.r[1] = XMVectorMultiply(c1, InvDet);
+		Result.r[2] = XMVectorMultiply(c2, InvDet);
+		Result.r[3] = g_XMIdentityR3;
+
+		return Result;
+	}
+
+#ifdef XM_AVX_INTRINSICS
+
+	//------------------------------------------------------------------------------
+	XM_INLINE   void XM_CALLCONV Matrix::LoadPair(const Matrix* pM, __m256* pRows) noexcept
+	{
+		for (UINT i = 0; i < 4; i++)
+			pRows[i] = _mm256_insertf128_ps(_mm256_castps128_ps256(pM[0].mx.r[i]), pM[1].mx.r[i], 1);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE   void XM_CALLCONV Matrix::StorePair(Matrix* pOut, const __m256* pRows, const bool Stream) noexcept
+	{
+		XMMATRIX m0, m1;
+
+		for (UINT i = 0; i < 4; i++)
+		{
+			m0.r[i] = _mm256_castps256_ps128(pRows[i]);
+			m1.r[i] = _mm256_extractf128_ps(pRows[i], 1);
+		}
+
+		Store(&pOut[0], m0, Stream);
+		Store(&pOut[1], m1, Stream);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE   __m256 XM_CALLCONV Matrix::Block2Mul(const __m256 a, const __m256 b) noexcept
+	{
+		return _mm256_add_ps(_mm256_mul_ps(a, _mm256_permute_ps(b, _MM_SHUFFLE(3, 0, 3, 0))),
+							 _mm256_mul_ps(_mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1)), _mm256_permute_ps(b, _MM_SHUFFLE(1, 2, 1, 2))));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE   __m256 XM_CALLCONV Matrix::Block2AdjMul(const __m256 a, const __m256 b) noexcept
+	{
+		return _mm256_sub_ps(_mm256_mul_ps(_mm256_permute_ps(a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+							 _mm256_mul_ps(_mm256_permute_ps(a, _MM_SHUFFLE(2, 2, 1, 1)), _mm256_permute_ps(b, _MM_SHUFFLE(1, 0, 3, 2))));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE   __m256 XM_CALLCONV Matrix::Block2MulAdj(const __m256 a, const __m256 b) noexcept
+	{
+		return _mm256_sub_ps(_mm256_mul_ps(a, _mm256_permute_ps(b, _MM_SHUFFLE(0, 3, 0, 3))),
+							 _mm256_mul_ps(_mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1)), _mm256_permute_ps(b, _MM_SHUFFLE(1, 2, 1, 2))));
+	}
+
+#endif
+
+	//------------------------------------------------------------------------------
+	XM_INLINE   void XM_CALLCONV Matrix::MultiplyArray(const Matrix* pM0, const Matrix* pM1, Matrix* pOut, const UINT Count, const bool Stream) noexcept
+	{
+		assert((pM0 && pM1 && pOut) || Count == 0);
+
+		UINT i = 0;
+
+#ifdef XM_AVX_INTRINSICS
+
+		for (; i + 2 <= Count; i += 2)
+		{
+			__m256 a[4], b[4], r[4];
+
+			LoadPair(&pM0[i], a);
+			LoadPair(&pM1[i], b);
+
+			// Row k = a.x * b0 + a.y * b1 + a.z * b2 + a.w * b3 (in both Halfs)
+			for (UINT k = 0; k < 4; k++)
+			{
+				__m256 Row = _mm256_mul_ps(_mm256_permute_ps(a[k], _MM_SHUFFLE(0, 0, 0, 0)), b[0]);
+				Row = _mm256_add_ps(Row, _mm256_mul_ps(_mm256_permute_ps(a[k], _MM_SHUFFLE(1, 1, 1, 1)), b[1]));
+				Row = _mm256_add_ps(Row, _mm256_mul_ps(_mm256_permute_ps(a[k], _MM_SHUFFLE(2, 2, 2, 2)), b[2]));
+				r[k] = _mm256_add_ps(Row, _mm256_mul_ps(_mm256_permute_ps(a[k], _MM_SHUFFLE(3, 3, 3, 3)), b[3]));
+			}
+
+			StorePair(&pOut[i], r, Stream);
+		}
+
+#endif
+
+		for (; i < Count; i++)
+			Store(&pOut[i], XMMatrixMultiply(pM0[i].mx, pM1[i].mx), Stream);
+
+		if (Stream)
+			_mm_sfence();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE   void XM_CALLCONV Matrix::InverseArray(const Matrix* pIn, Matrix* pOut, const UINT Count, const bool Stream) noexcept
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		UINT i = 0;
+
+#ifdef XM_AVX_INTRINSICS
+
+		// Block-Inverse over the 2x2 Sub-Matrices | A B | with Adjugates (#) :
+		//                                         | C D |
+		// Inverse = 1 / |M| * | X Y |, |M| = |A||D| + |B||C| - tr(A#B D#C)
+		//                     | Z W |
+		const __m256 AdjSign = _mm256_setr_ps(1.0f, -1.0f, -1.0f, 1.0f, 1.0f, -1.0f, -1.0f, 1.0f);
+
+		for (; i + 2 <= Count; i += 2)
+		{
+			__m256 m[4], r[4];
+
+			LoadPair(&pIn[i], m);
+
+			const __m256 A = _mm256_shuffle_ps(m[0], m[1], _MM_SHUFFLE(1, 0, 1, 0));
+			const __m256 B = _mm256_shuffle_ps(m[0], m[1], _MM_SHUFFLE(3, 2, 3, 2));
+			const __m256 C = _mm256_shuffle_ps(m[2], m[3], _MM_SHUFFLE(1, 0, 1, 0));
+			const __m256 D = _mm256_shuffle_ps(m[2], m[3], _MM_SHUFFLE(3, 2, 3, 2));
+
+			// (|A|, |B|, |C|, |D|)
+			const __m256 DetSub = _mm256_sub_ps(
+				_mm256_mul_ps(_mm256_shuffle_ps(m[0], m[2], _MM_SHUFFLE(2, 0, 2, 0)), _mm256_shuffle_ps(m[1], m[3], _MM_SHUFFLE(3, 1, 3, 1))),
+				_mm256_mul_ps(_mm256_shuffle_ps(m[0], m[2], _MM_SHUFFLE(3, 1, 3, 1)), _mm256_shuffle_ps(m[1], m[3], _MM_SHUFFLE(2, 0, 2, 0))));
+
+			const __m256 DetA = _mm256_permute_ps(DetSub, _MM_SHUFFLE(0, 0, 0, 0));
+			const __m256 DetB = _mm256_permute_ps(DetSub, _MM_SHUFFLE(1, 1, 1, 1));
+			const __m256 DetC = _mm256_permute_ps(DetSub, _MM_SHUFFLE(2, 2, 2, 2));
+			const __m256 DetD = _mm256_permute_ps(DetSub, _MM_SHUFFLE(3, 3, 3, 3));
+
+			const __m256 D_C = Block2AdjMul(D, C);
+			const __m256 A_B = Block2AdjMul(A, B);
+
+			__m256 X = _mm256_sub_ps(_mm256_mul_ps(DetD, A), Block2Mul(B, D_C));
+			__m256 W = _mm256_sub_ps(_mm256_mul_ps(DetA, D), Block2Mul(C, A_B));
+			__m256 Y = _mm256_sub_ps(_mm256_mul_ps(DetB, C), Block2MulAdj(D, A_B));
+			__m256 Z = _mm256_sub_ps(_mm256_mul_ps(DetC, B), Block2MulAdj(A, D_C));
+
+			__m256 Trace = _mm256_mul_ps(A_B, _mm256_permute_ps(D_C, _MM_SHUFFLE(3, 1, 2, 0)));
+			Trace = _mm256_hadd_ps(Trace, Trace);
+			Trace = _mm256_hadd_ps(Trace, Trace);
+
+			const __m256 DetM = _mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(DetA, DetD), _mm256_mul_ps(DetB, DetC)), Trace);
+			const __m256 InvDet = _mm256_div_ps(AdjSign, DetM);
+
+			X = _mm256_mul_ps(X, InvDet);
+			Y = _mm256_mul_ps(Y, InvDet);
+			Z = _mm256_mul_ps(Z, InvDet);
+			W = _mm256_mul_ps(W, InvDet);
+
+			// Adjugate of the Blocks and back to Rows
+			r[0] = _mm256_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3));
+			r[1] = _mm256_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2));
+			r[2] = _mm256_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3));
+			r[3] = _mm256_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2));
+
+			StorePair(&pOut[i], r, Stream);
+		}
+
+#endif
+
+		for (; i < Count; i++)
+		{
+			XMVECTOR det;
+			Store(&pOut[i], XMMatrixInverse(&det, pIn[i].mx), Stream);
+		}
+
+		if (Stream)
+			_mm_sfence();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE   void XM_CALLCONV Matrix::InverseTransposeArray(const Matrix* pIn, Matrix* pOut, const UINT Count, const bool Stream) noexcept
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		UINT i = 0;
+
+#ifdef XM_AVX_INTRINSICS
+
+		const __m256 One = _mm256_set1_ps(1.0f);
+		const __m256 IdentityR3 = _mm256_setr_ps(0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+
+		for (; i + 2 <= Count; i += 2)
+		{
+			__m256 m[4], r[4];
+
+			LoadPair(&pIn[i], m);
+
+			// Cross-Products of the Rows (yzx * zxy - zxy * yzx)
+			for (UINT k = 0; k < 3; k++)
+			{
+				const __m256 a = m[(k + 1) % 3];
+				const __m256 b = m[(k + 2) % 3];
+
+				r[k] = _mm256_sub_ps(_mm256_mul_ps(_mm256_permute_ps(a, _MM_SHUFFLE(3, 0, 2, 1)), _mm256_permute_ps(b, _MM_SHUFFLE(3, 1, 0, 2))),
+									 _mm256_mul_ps(_mm256_permute_ps(a, _MM_SHUFFLE(3, 1, 0, 2)), _mm256_permute_ps(b, _MM_SHUFFLE(3, 0, 2, 1))));
+			}
+
+			const __m256 InvDet = _mm256_div_ps(One, _mm256_dp_ps(m[0], r[0], 0x7F));
+
+			r[0] = _mm256_mul_ps(r[0], InvDet);
+			r[1] = _mm256_mul_ps(r[1], InvDet);
+			r[2] = _mm256_mul_ps(r[2], InvDet);
+			r[3] = IdentityR3;
+
+			StorePair(&pOut[i], r, Stream);
+		}
+
+#endif
+
+		for (; i < Count; i++)
+			Store(&pOut[i], InverseTranspose3x3(pIn[i].mx), Stream);
+
+		if (Stream)
+			_mm_sfence();
+	}
 
 }; // Namespace TurboMath
 
@@ -0,0 +1,142 @@
+// -------------------------------------------------------------------
+// File			:	Matrix3
+//
+// Project		:	TurboMath
+//
+// Description	:	Class for 3x3 Matrix (Rotations and Normal-Matrices)
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_MATRIX3_H_
+#define _TURBOMATH_MATRIX3_H_
+
+namespace TurboMath
+{
+	//-----------------------------------------------------------------------------
+	// 3x3 Matrix in 3 Rows (w = 0) with Row-Vectors like Matrix (v * M).
+	// Multiply, Inverse and Transpose work only on the 3x3 Part, so Rotations,
+	// OBB-Orientations and Normal-Matrices skip the 4th Row and Column.
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class Matrix3
+	{
+	public:
+		//------------------------------------------------------------
+		// Constructor
+		// -----------------------------------------------------------
+
+		/// default constructor, setup to Identity
+		Matrix3() noexcept;
+
+		/// construct from 3 Rows (w is ignored)
+		Matrix3(FXMVECTOR Row0, FXMVECTOR Row1, FXMVECTOR Row2) noexcept;
+
+		/// construct from the upper 3x3 of a Matrix
+		explicit Matrix3(const Matrix& m) noexcept;
+
+		/// construct the Rotation of a (unit) Quat
+		explicit Matrix3(const Quat& q) noexcept;
+
+		/// construct the Rotation of the Orientation of an OBB
+		explicit Matrix3(const OBB& Box) noexcept;
+
+		/// copy constructor
+		Matrix3(const Matrix3& rhs) noexcept;
+
+		// -----------------------------------------------------------
+		// assignment operator
+		// -----------------------------------------------------------
+
+		void XM_CALLCONV operator=(const Matrix3& rhs) noexcept;
+
+		/// equality operator
+		bool XM_CALLCONV operator==(const Matrix3& rhs) const noexcept;
+
+		/// inequality operator
+		bool XM_CALLCONV operator!=(const Matrix3& rhs) const noexcept;
+
+		/// Multiply(*this, rhs)
+		Matrix3 XM_CALLCONV operator*(const Matrix3& rhs) const noexcept;
+
+		/// *this = Multiply(*this, rhs)
+		void XM_CALLCONV operator*=(const Matrix3& rhs) noexcept;
+
+		// -----------------------------------------------------------
+		// Set / Get
+		// -----------------------------------------------------------
+
+		/// set the Rows (w is ignored)
+		void XM_CALLCONV Set(FXMVECTOR Row0, FXMVECTOR Row1, FXMVECTOR Row2) noexcept;
+
+		/// Rows by XMVECTOR (w = 0)
+		const XMVECTOR XM_CALLCONV GetRow0() const noexcept			{ return m_Row[0]; }
+		const XMVECTOR XM_CALLCONV GetRow1() const noexcept			{ return m_Row[1]; }
+		const XMVECTOR XM_CALLCONV GetRow2() const noexcept			{ return m_Row[2]; }
+
+		/// 4x4 Matrix (4th Row and Column from the Identity)
+		Matrix XM_CALLCONV GetMatrix() const noexcept;
+
+		/// Quat of a Rotation-Matrix (e.g. for OBB::SetOrientation)
+		Quat XM_CALLCONV GetQuat() const noexcept;
+
+		/// return determinant of matrix
+		float XM_CALLCONV Determinant() const noexcept;
+
+		// -----------------------------------------------------------
+		// Transform
+		// -----------------------------------------------------------
+
+		/// v * M
+		Vector3 XM_CALLCONV Transform(const Vector3& v) const noexcept;
+
+		/// v * M with the xyz of an XMVECTOR (w = 0)
+		XMVECTOR XM_CALLCONV Transform(FXMVECTOR v) const noexcept;
+
+		/// pOut[i] = pIn[i] * M (pOut may be pIn)
+		void XM_CALLCONV TransformArray(const Vector3* pIn, Vector3* pOut, const UINT Count) const noexcept;
+
+		// -----------------------------------------------------------
+		// Functions
+		// -----------------------------------------------------------
+
+		/// returns an identity Matrix3
+		static Matrix3 XM_CALLCONV Identity() noexcept;
+
+		/// multiply 2 matrices
+		static Matrix3 XM_CALLCONV Multiply(const Matrix3& m0, const Matrix3& m1) noexcept;
+
+		/// return the transpose of a matrix (the Inverse of a Rotation)
+		static Matrix3 XM_CALLCONV Transpose(const Matrix3& m) noexcept;
+
+		/// compute the inverse of a matrix
+		static Matrix3 XM_CALLCONV Inverse(const Matrix3& m) noexcept;
+
+		/// Normal-Matrix : Inverse-Transpose of the upper 3x3 of a Matrix
+		static Matrix3 XM_CALLCONV InverseTranspose(const Matrix& m) noexcept;
+
+	protected:
+
+		/// Cofactor-Rows (Cross-Products of the other Rows) and 1 / Determinant
+		void XM_CALLCONV Cofactors(XMVECTOR* pRows, XMVECTOR& InvDet) const noexcept;
+
+		XMVECTOR	m_Row[3];
+	};
+
+}; // end of namespace
+
+#endif
@@ -0,0 +1,243 @@
+// -------------------------------------------------------------------
+// File			:	Matrix3
+//
+// Project		:	TurboMath
+//
+// Description	:	Class for 3x3 Matrix (Rotations and Normal-Matrices)
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+namespace TurboMath
+{
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrix3::Matrix3() noexcept
+	{
+		m_Row[0] = g_XMIdentityR0;
+		m_Row[1] = g_XMIdentityR1;
+		m_Row[2] = g_XMIdentityR2;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrix3::Matrix3(FXMVECTOR Row0, FXMVECTOR Row1, FXMVECTOR Row2) noexcept
+	{
+		Set(Row0, Row1, Row2);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrix3::Matrix3(const Matrix& m) noexcept
+	{
+		Set(m.GetRow0(), m.GetRow1(), m.GetRow2());
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrix3::Matrix3(const Quat& q) noexcept
+	{
+		// the 3 Rows of XMMatrixRotationQuaternion without the 4th Row and the Masks
+		const XMVECTOR Q = q.Get();
+		const XMVECTOR Q2 = XMVectorAdd(Q, Q);
+
+		// (2xx, 2yy, 2zz), (2xy, 2xz, 2yz) and (2zw, 2yw, 2xw), w is 2ww in all
+		const XMVECTOR a = XMVectorMultiply(Q, Q2);
+		const XMVECTOR b = XMVectorMultiply(XMVectorSwizzle<XM_SWIZZLE_X, XM_SWIZZLE_X, XM_SWIZZLE_Y, XM_SWIZZLE_W>(Q),
+											XMVectorSwizzle<XM_SWIZZLE_Y, XM_SWIZZLE_Z, XM_SWIZZLE_Z, XM_SWIZZLE_W>(Q2));
+		const XMVECTOR c = XMVectorMultiply(XMVectorSplatW(Q), XMVectorSwizzle<XM_SWIZZLE_Z, XM_SWIZZLE_Y, XM_SWIZZLE_X, XM_SWIZZLE_W>(Q2));
+
+		// Diagonal (1 - 2yy - 2zz, 1 - 2xx - 2zz, 1 - 2xx - 2yy), Sums and Differences (w = 0)
+		const XMVECTOR d = XMVectorSubtract(XMVectorSubtract(g_XMOne, XMVectorSwizzle<XM_SWIZZLE_Y, XM_SWIZZLE_X, XM_SWIZZLE_X, XM_SWIZZLE_W>(a)),
+											XMVectorSwizzle<XM_SWIZZLE_Z, XM_SWIZZLE_Z, XM_SWIZZLE_Y, XM_SWIZZLE_W>(a));
+		const XMVECTOR p = XMVectorAdd(b, c);
+		const XMVECTOR m = XMVectorSubtract(b, c);
+
+		// (d.x, d.y, p.x, p.z) and (p.y, m.z, -, m.w)
+		const XMVECTOR u = XMVectorPermute<XM_PERMUTE_0X, XM_PERMUTE_0Y, XM_PERMUTE_1X, XM_PERMUTE_1Z>(d, p);
+		const XMVECTOR v = XMVectorPermute<XM_PERMUTE_1Y, XM_PERMUTE_0Z, XM_PERMUTE_0Z, XM_PERMUTE_0W>(m, p);
+
+		m_Row[0] = XMVectorPermute<XM_PERMUTE_0X, XM_PERMUTE_0Z, XM_PERMUTE_1Y, XM_PERMUTE_1W>(u, m);
+		m_Row[1] = XMVectorPermute<XM_PERMUTE_1X, XM_PERMUTE_0Y, XM_PERMUTE_0W, XM_PERMUTE_1W>(u, m);
+		m_Row[2] = XMVectorPermute<XM_PERMUTE_0X, XM_PERMUTE_0Y, XM_PERMUTE_1Z, XM_PERMUTE_0W>(v, d);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrix3::Matrix3(const OBB& Box) noexcept :
+		Matrix3(Box.GetOrientation())
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrix3::Matrix3(const Matrix3& rhs) noexcept
+	{
+		m_Row[0] = rhs.m_Row[0];
+		m_Row[1] = rhs.m_Row[1];
+		m_Row[2] = rhs.m_Row[2];
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Matrix3::operator=(const Matrix3& rhs) noexcept
+	{
+		m_Row[0] = rhs.m_Row[0];
+		m_Row[1] = rhs.m_Row[1];
+		m_Row[2] = rhs.m_Row[2];
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE bool XM_CALLCONV Matrix3::operator==(const Matrix3& rhs) const noexcept
+	{
+		return XMVector3Equal(m_Row[0], rhs.m_Row[0]) && XMVector3Equal(m_Row[1], rhs.m_Row[1]) && XMVector3Equal(m_Row[2], rhs.m_Row[2]);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE bool XM_CALLCONV Matrix3::operator!=(const Matrix3& rhs) const noexcept
+	{
+		return !(*this == rhs);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrix3 XM_CALLCONV Matrix3::operator*(const Matrix3& rhs) const noexcept
+	{
+		return Multiply(*this, rhs);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Matrix3::operator*=(const Matrix3& rhs) noexcept
+	{
+		*this = Multiply(*this, rhs);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Matrix3::Set(FXMVECTOR Row0, FXMVECTOR Row1, FXMVECTOR Row2) noexcept
+	{
+		m_Row[0] = XMVectorAndInt(Row0, g_XMMask3);
+		m_Row[1] = XMVectorAndInt(Row1, g_XMMask3);
+		m_Row[2] = XMVectorAndInt(Row2, g_XMMask3);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrix XM_CALLCONV Matrix3::GetMatrix() const noexcept
+	{
+		return XMMATRIX(m_Row[0], m_Row[1], m_Row[2], g_XMIdentityR3);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Quat XM_CALLCONV Matrix3::GetQuat() const noexcept
+	{
+		return XMQuaternionRotationMatrix(XMMATRIX(m_Row[0], m_Row[1], m_Row[2], g_XMIdentityR3));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE float XM_CALLCONV Matrix3::Determinant() const noexcept
+	{
+		return XMVectorGetX(XMVector3Dot(m_Row[0], XMVector3Cross(m_Row[1], m_Row[2])));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Matrix3::Transform(FXMVECTOR v) const noexcept
+	{
+		XMVECTOR Result = XMVectorMultiply(XMVectorSplatX(v), m_Row[0]);
+		Result = XMVectorMultiplyAdd(XMVectorSplatY(v), m_Row[1], Result);
+
+		return XMVectorMultiplyAdd(XMVectorSplatZ(v), m_Row[2], Result);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector3 XM_CALLCONV Matrix3::Transform(const Vector3& v) const noexcept
+	{
+		return Transform(XMLoadFloat3(&static_cast<const XMFLOAT3&>(v)));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Matrix3::TransformArray(const Vector3* pIn, Vector3* pOut, const UINT Count) const noexcept
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		for (UINT i = 0; i < Count; i++)
+			XMStoreFloat3(&static_cast<XMFLOAT3&>(pOut[i]), Transform(XMLoadFloat3(&static_cast<const XMFLOAT3&>(pIn[i]))));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Matrix3::Cofactors(XMVECTOR* pRows, XMVECTOR& InvDet) const noexcept
+	{
+		pRows[0] = XMVector3Cross(m_Row[1], m_Row[2]);
+		pRows[1] = XMVector3Cross(m_Row[2], m_Row[0]);
+		pRows[2] = XMVector3Cross(m_Row[0], m_Row[1]);
+
+		InvDet = XMVectorReciprocal(XMVector3Dot(m_Row[0], pRows[0]));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrix3 XM_CALLCONV Matrix3::Identity() noexcept
+	{
+		return Matrix3();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrix3 XM_CALLCONV Matrix3::Multiply(const Matrix3& m0, const Matrix3& m1) noexcept
+	{
+		Matrix3 Result;
+
+		Result.m_Row[0] = m1.Transform(m0.m_Row[0]);
+		Result.m_Row[1] = m1.Transform(m0.m_Row[1]);
+		Result.m_Row[2] = m1.Transform(m0.m_Row[2]);
+
+		return Result;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrix3 XM_CALLCONV Matrix3::Transpose(const Matrix3& m) noexcept
+	{
+		// (x0, x1, y0, y1) and (z0, z1, 0, 0), Row 2 from the second Vector
+		const XMVECTOR XY = XMVectorMergeXY(m.m_Row[0], m.m_Row[1]);
+		const XMVECTOR ZW = XMVectorMergeZW(m.m_Row[0], m.m_Row[1]);
+
+		Matrix3 Result;
+
+		Result.m_Row[0] = XMVectorPermute<XM_PERMUTE_0X, XM_PERMUTE_0Y, XM_PERMUTE_1X, XM_PERMUTE_1W>(XY, m.m_Row[2]);
+		Result.m_Row[1] = XMVectorPermute<XM_PERMUTE_0Z, XM_PERMUTE_0W, XM_PERMUTE_1Y, XM_PERMUTE_1W>(XY, m.m_Row[2]);
+		Result.m_Row[2] = XMVectorPermute<XM_PERMUTE_0X, XM_PERMUTE_0Y, XM_PERMUTE_1Z, XM_PERMUTE_1W>(ZW, m.m_Row[2]);
+
+		return Result;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrix3 XM_CALLCONV Matrix3::Inverse(const Matrix3& m) noexcept
+	{
+		// Inverse = Transpose(Cofactors) / Determinant
+		XMVECTOR Rows[3], InvDet;
+		m.Cofactors(Rows, InvDet);
+
+		Matrix3 Result;
+
+		Result.m_Row[0] = XMVectorMultiply(Rows[0], InvDet);
+		Result.m_Row[1] = XMVectorMultiply(Rows[1], InvDet);
+		Result.m_Row[2] = XMVectorMultiply(Rows[2], InvDet);
+
+		return Transpose(Result);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Matrix3 XM_CALLCONV Matrix3::InverseTranspose(const Matrix& m) noexcept
+	{
+		XMVECTOR Rows[3], InvDet;
+		Matrix3(m).Cofactors(Rows, InvDet);
+
+		Matrix3 Result;
+
+		Result.m_Row[0] = XMVectorMultiply(Rows[0], InvDet);
+		Result.m_Row[1] = XMVectorMultiply(Rows[1], InvDet);
+		Result.m_Row[2] = XMVectorMultiply(Rows[2], InvDet);
+
+		return Result;
+	}
+
+}// end of Namespace TurboMath
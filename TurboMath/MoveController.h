@@ -33,6 +33,8 @@ namespace TurboMath
 
 	class MovementController
 	{
+		friend class MovementSystem;					// SoA-Integrator reads / writes the State
+
 	public:
 
 		MovementController() noexcept;
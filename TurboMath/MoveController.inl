@@ -108,7 +108,7 @@ namespace TurboMath
 
 		// neues Quaternion fr die Rotation ....
 
-		qFrame.MakeFromEuler(m_fRotX,m_fRotY,m_fRotZ);
+		qFrame = Quat::MakeFromEuler(m_fRotX,m_fRotY,m_fRotZ);
 
 
 		// zur bisherigen Rot. addieren
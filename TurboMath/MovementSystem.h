@@ -0,0 +1,150 @@
+// -------------------------------------------------------------------
+// File			:	MovementSystem
+//
+// Project		:	TurboMath
+//
+// Description	:	SoA-Integrator for many moving Objects
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_MOVEMENTSYSTEM_H_
+#define _TURBOMATH_MOVEMENTSYSTEM_H_
+
+#include <vector>
+
+namespace TurboMath
+{
+
+	//-----------------------------------------------------------------------------
+	// Integrator for many Objects moving like a MovementControllerFree (Rotation-
+	// Speed around the local Axes + Thrust along the Direction). The State of
+	// all Objects is stored in SoA-Streams, Update() integrates 4 Objects per
+	// Instruction (Quaternion-Integration and Axis-Recomputation in one Pass)
+	// without virtual Calls, large Systems are updated in parallel.
+	//
+	// Existing Controllers can be registered : Update() reads their State,
+	// integrates them with all other Objects and writes the Result back. The
+	// System does not own them, a Controller must be unregistered (or the
+	// System cleared) before it is destroyed.
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class MovementSystem
+	{
+	public:
+
+		typedef std::vector<float, AAllocator<float> >	FloatStream;
+
+		MovementSystem() noexcept;
+		~MovementSystem() noexcept;
+
+		/// remove all Objects and Controllers
+		void			XM_CALLCONV Clear() noexcept;
+
+		/// reserve Memory for Objects
+		void			XM_CALLCONV Reserve(const UINT NumObjects);
+
+		/// add an Object, returns the Index of the Object
+		const UINT		XM_CALLCONV AddObject(const Vector4& Pos, const Quat& Rotation = Quat(0.0f, 0.0f, 0.0f, 1.0f));
+
+		/// get Number of Objects
+		const UINT		XM_CALLCONV GetNumObjects() const noexcept		{ return m_NumObjects; }
+
+		//-----------------------------------------------------------------------------
+		// State of one Object
+		//-----------------------------------------------------------------------------
+		void			XM_CALLCONV SetPos(const UINT Index, const Vector4& Pos) noexcept;
+		void			XM_CALLCONV SetRotation(const UINT Index, const Quat& Rotation) noexcept;
+		void			XM_CALLCONV SetRotationSpeed(const UINT Index, const float Pitch, const float Yaw, const float Roll) noexcept;
+		void			XM_CALLCONV SetThrust(const UINT Index, const float Thrust) noexcept;
+
+		const Vector4	XM_CALLCONV GetPos(const UINT Index) const noexcept;
+		const Vector4	XM_CALLCONV GetRight(const UINT Index) const noexcept;
+		const Vector4	XM_CALLCONV GetUp(const UINT Index) const noexcept;
+		const Vector4	XM_CALLCONV GetDir(const UINT Index) const noexcept;
+		const Vector4	XM_CALLCONV GetMoveVector(const UINT Index) const noexcept;
+		const Quat		XM_CALLCONV GetRotation(const UINT Index) const noexcept;
+
+		//-----------------------------------------------------------------------------
+		// Raw Streams (padded to a Multiple of 4)
+		//-----------------------------------------------------------------------------
+		const float*	XM_CALLCONV GetPositionsX() const noexcept		{ return m_PosX.data(); }
+		const float*	XM_CALLCONV GetPositionsY() const noexcept		{ return m_PosY.data(); }
+		const float*	XM_CALLCONV GetPositionsZ() const noexcept		{ return m_PosZ.data(); }
+		const float*	XM_CALLCONV GetDirectionsX() const noexcept		{ return m_DirX.data(); }
+		const float*	XM_CALLCONV GetDirectionsY() const noexcept		{ return m_DirY.data(); }
+		const float*	XM_CALLCONV GetDirectionsZ() const noexcept		{ return m_DirZ.data(); }
+
+		//-----------------------------------------------------------------------------
+		// Controller-Adapter
+		//-----------------------------------------------------------------------------
+
+		/// integrate an existing Controller with the System, returns the Index of its Object
+		const UINT		XM_CALLCONV Register(MovementControllerFree* pController);
+
+		/// detach a Controller, its Object stays in the System without Rotation-Speed and Thrust
+		const bool		XM_CALLCONV Unregister(const MovementControllerFree* pController) noexcept;
+
+		/// is the Controller registered ?
+		const bool		XM_CALLCONV IsRegistered(const MovementControllerFree* pController) const noexcept;
+
+		/// get Number of registered Controllers
+		const UINT		XM_CALLCONV GetNumControllers() const noexcept	{ return (UINT)m_Controllers.size(); }
+
+		//-----------------------------------------------------------------------------
+		// Update
+		//-----------------------------------------------------------------------------
+
+		/// move and rotate all Objects by the elapsed Time
+		void			XM_CALLCONV Update(const float fTime);
+
+	protected:
+
+		/// integrate the Objects [4 * FirstBlock, 4 * EndBlock)
+		void			XM_CALLCONV UpdateBlocks(const UINT FirstBlock, const UINT EndBlock, const float fTime) noexcept;
+
+		/// copy the State of the registered Controllers into the Streams
+		void			XM_CALLCONV ReadControllers() noexcept;
+
+		/// copy the integrated State back to the registered Controllers
+		void			XM_CALLCONV WriteControllers() noexcept;
+
+		// Position and Move-Vector of the last Update
+		FloatStream		m_PosX, m_PosY, m_PosZ;
+		FloatStream		m_MoveX, m_MoveY, m_MoveZ;
+
+		// local Axes
+		FloatStream		m_RightX, m_RightY, m_RightZ;
+		FloatStream		m_UpX, m_UpY, m_UpZ;
+		FloatStream		m_DirX, m_DirY, m_DirZ;
+
+		// Rotation as Quaternion
+		FloatStream		m_QuatX, m_QuatY, m_QuatZ, m_QuatW;
+
+		// Rotation-Speed around the local Axes and Thrust along the Direction
+		FloatStream		m_PitchSpd, m_YawSpd, m_RollSpd;
+		FloatStream		m_Thrust;
+
+		UINT			m_NumObjects;
+
+		// registered Controllers and their Objects
+		std::vector<std::pair<MovementControllerFree*, UINT> >	m_Controllers;
+	};
+
+}; // end of namespace
+
+#endif
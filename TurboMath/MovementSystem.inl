@@ -0,0 +1,437 @@
+// -------------------------------------------------------------------
+// File			:	MovementSystem
+//
+// Project		:	TurboMath
+//
+// Description	:	SoA-Integrator for many moving Objects
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+namespace TurboMath
+{
+	//------------------------------------------------------------------------------
+	XM_INLINE MovementSystem::MovementSystem() noexcept
+		: m_NumObjects(0)
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE MovementSystem::~MovementSystem() noexcept
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV MovementSystem::Clear() noexcept
+	{
+		FloatStream* Streams[] = {	&m_PosX, &m_PosY, &m_PosZ, &m_MoveX, &m_MoveY, &m_MoveZ,
+									&m_RightX, &m_RightY, &m_RightZ, &m_UpX, &m_UpY, &m_UpZ,
+									&m_DirX, &m_DirY, &m_DirZ, &m_QuatX, &m_QuatY, &m_QuatZ, &m_QuatW,
+									&m_PitchSpd, &m_YawSpd, &m_RollSpd, &m_Thrust };
+
+		for (FloatStream* pStream : Streams)
+			pStream->clear();
+
+		m_Controllers.clear();
+		m_NumObjects = 0;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV MovementSystem::Reserve(const UINT NumObjects)
+	{
+		const size_t Size = (NumObjects + 3) & ~3u;
+
+		FloatStream* Streams[] = {	&m_PosX, &m_PosY, &m_PosZ, &m_MoveX, &m_MoveY, &m_MoveZ,
+									&m_RightX, &m_RightY, &m_RightZ, &m_UpX, &m_UpY, &m_UpZ,
+									&m_DirX, &m_DirY, &m_DirZ, &m_QuatX, &m_QuatY, &m_QuatZ, &m_QuatW,
+									&m_PitchSpd, &m_YawSpd, &m_RollSpd, &m_Thrust };
+
+		for (FloatStream* pStream : Streams)
+			pStream->reserve(Size);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV MovementSystem::AddObject(const Vector4& Pos, const Quat& Rotation)
+	{
+		// grow by one Block of 4, the unused Lanes hold a resting Object
+		if ((m_NumObjects & 3) == 0)
+		{
+			const size_t Size = m_NumObjects + 4;
+
+			FloatStream* ZeroStreams[] = {	&m_PosX, &m_PosY, &m_PosZ, &m_MoveX, &m_MoveY, &m_MoveZ,
+											&m_RightY, &m_RightZ, &m_UpX, &m_UpZ, &m_DirX, &m_DirY,
+											&m_QuatX, &m_QuatY, &m_QuatZ,
+											&m_PitchSpd, &m_YawSpd, &m_RollSpd, &m_Thrust };
+
+			for (FloatStream* pStream : ZeroStreams)
+				pStream->resize(Size, 0.0f);
+
+			m_RightX.resize(Size, 1.0f);
+			m_UpY.resize(Size, 1.0f);
+			m_DirZ.resize(Size, 1.0f);
+			m_QuatW.resize(Size, 1.0f);
+		}
+
+		const UINT Index = m_NumObjects++;
+
+		SetPos(Index, Pos);
+		SetRotation(Index, Rotation);
+
+		return Index;
+	}
+
+	//------------------------------------------------------------------------------
+	// State of one Object
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV MovementSystem::SetPos(const UINT Index, const Vector4& Pos) noexcept
+	{
+		assert(Index < m_NumObjects);
+
+		m_PosX[Index] = Pos.GetX();
+		m_PosY[Index] = Pos.GetY();
+		m_PosZ[Index] = Pos.GetZ();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV MovementSystem::SetRotation(const UINT Index, const Quat& Rotation) noexcept
+	{
+		assert(Index < m_NumObjects);
+
+		m_QuatX[Index] = Rotation.X();
+		m_QuatY[Index] = Rotation.Y();
+		m_QuatZ[Index] = Rotation.Z();
+		m_QuatW[Index] = Rotation.W();
+
+		// local Axes like MovementController::RecalcAxes
+		const Matrix mat = Quat::GetMatrix(Rotation);
+
+		m_RightX[Index] = mat.GetM11();
+		m_RightY[Index] = mat.GetM21();
+		m_RightZ[Index] = mat.GetM31();
+
+		m_UpX[Index] = mat.GetM12();
+		m_UpY[Index] = mat.GetM22();
+		m_UpZ[Index] = mat.GetM32();
+
+		m_DirX[Index] = mat.GetM13();
+		m_DirY[Index] = mat.GetM23();
+		m_DirZ[Index] = mat.GetM33();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV MovementSystem::SetRotationSpeed(const UINT Index, const float Pitch, const float Yaw, const float Roll) noexcept
+	{
+		assert(Index < m_NumObjects);
+
+		m_PitchSpd[Index] = Pitch;
+		m_YawSpd[Index] = Yaw;
+		m_RollSpd[Index] = Roll;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV MovementSystem::SetThrust(const UINT Index, const float Thrust) noexcept
+	{
+		assert(Index < m_NumObjects);
+
+		m_Thrust[Index] = Thrust;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const Vector4 XM_CALLCONV MovementSystem::GetPos(const UINT Index) const noexcept
+	{
+		assert(Index < m_NumObjects);
+
+		return Vector4(m_PosX[Index], m_PosY[Index], m_PosZ[Index]);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const Vector4 XM_CALLCONV MovementSystem::GetRight(const UINT Index) const noexcept
+	{
+		assert(Index < m_NumObjects);
+
+		return Vector4(m_RightX[Index], m_RightY[Index], m_RightZ[Index]);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const Vector4 XM_CALLCONV MovementSystem::GetUp(const UINT Index) const noexcept
+	{
+		assert(Index < m_NumObjects);
+
+		return Vector4(m_UpX[Index], m_UpY[Index], m_UpZ[Index]);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const Vector4 XM_CALLCONV MovementSystem::GetDir(const UINT Index) const noexcept
+	{
+		assert(Index < m_NumObjects);
+
+		return Vector4(m_DirX[Index], m_DirY[Index], m_DirZ[Index]);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const Vector4 XM_CALLCONV MovementSystem::GetMoveVector(const UINT Index) const noexcept
+	{
+		assert(Index < m_NumObjects);
+
+		return Vector4(m_MoveX[Index], m_MoveY[Index], m_MoveZ[Index]);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const Quat XM_CALLCONV MovementSystem::GetRotation(const UINT Index) const noexcept
+	{
+		assert(Index < m_NumObjects);
+
+		return Quat(m_QuatX[Index], m_QuatY[Index], m_QuatZ[Index], m_QuatW[Index]);
+	}
+
+	//------------------------------------------------------------------------------
+	// Controller-Adapter
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV MovementSystem::Register(MovementControllerFree* pController)
+	{
+		assert(pController != nullptr);
+		assert(!IsRegistered(pController));
+
+		const UINT Index = AddObject(pController->GetPos(), pController->GetRotation());
+
+		m_Controllers.push_back(std::make_pair(pController, Index));
+
+		return Index;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV MovementSystem::Unregister(const MovementControllerFree* pController) noexcept
+	{
+		for (size_t i = 0; i < m_Controllers.size(); i++)
+		{
+			if (m_Controllers[i].first == pController)
+			{
+				const UINT Index = m_Controllers[i].second;
+
+				SetRotationSpeed(Index, 0.0f, 0.0f, 0.0f);
+				SetThrust(Index, 0.0f);
+
+				m_Controllers.erase(m_Controllers.begin() + i);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV MovementSystem::IsRegistered(const MovementControllerFree* pController) const noexcept
+	{
+		for (const auto& Entry : m_Controllers)
+			if (Entry.first == pController) return true;
+
+		return false;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV MovementSystem::ReadControllers() noexcept
+	{
+		for (const auto& Entry : m_Controllers)
+		{
+			const MovementController& Ctrl = *Entry.first;
+			const UINT i = Entry.second;
+
+			m_PosX[i] = Ctrl.m_vcPos.GetX();
+			m_PosY[i] = Ctrl.m_vcPos.GetY();
+			m_PosZ[i] = Ctrl.m_vcPos.GetZ();
+
+			m_DirX[i] = Ctrl.m_vcDir.GetX();
+			m_DirY[i] = Ctrl.m_vcDir.GetY();
+			m_DirZ[i] = Ctrl.m_vcDir.GetZ();
+
+			m_QuatX[i] = Ctrl.m_Quat.X();
+			m_QuatY[i] = Ctrl.m_Quat.Y();
+			m_QuatZ[i] = Ctrl.m_Quat.Z();
+			m_QuatW[i] = Ctrl.m_Quat.W();
+
+			m_PitchSpd[i] = Ctrl.m_fPitchSpd;
+			m_YawSpd[i] = Ctrl.m_fYawSpd;
+			m_RollSpd[i] = Ctrl.m_fRollSpd;
+			m_Thrust[i] = Ctrl.m_fThrust;
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV MovementSystem::WriteControllers() noexcept
+	{
+		for (const auto& Entry : m_Controllers)
+		{
+			MovementController& Ctrl = *Entry.first;
+			const UINT i = Entry.second;
+
+			Ctrl.m_vcPos.Set(m_PosX[i], m_PosY[i], m_PosZ[i]);
+			Ctrl.m_vcV.Set(m_MoveX[i], m_MoveY[i], m_MoveZ[i]);
+			Ctrl.m_MoveVector = Ctrl.m_vcV;
+
+			Ctrl.m_vcRight.Set(m_RightX[i], m_RightY[i], m_RightZ[i]);
+			Ctrl.m_vcUp.Set(m_UpX[i], m_UpY[i], m_UpZ[i]);
+			Ctrl.m_vcDir.Set(m_DirX[i], m_DirY[i], m_DirZ[i]);
+
+			Ctrl.m_Quat.Set(m_QuatX[i], m_QuatY[i], m_QuatZ[i], m_QuatW[i]);
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	// Update
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV MovementSystem::Update(const float fTime)
+	{
+		ReadControllers();
+
+		const UINT NumBlocks = (m_NumObjects + 3) / 4;
+
+		if (NumBlocks >= 1024)
+		{
+			ParallelFor(NumBlocks, 256, [&](const UINT Begin, const UINT End)
+			{
+				UpdateBlocks(Begin, End, fTime);
+			});
+		}
+		else
+			UpdateBlocks(0, NumBlocks, fTime);
+
+		WriteControllers();
+	}
+
+	//------------------------------------------------------------------------------
+	// same Steps as MovementControllerFree::Update, 4 Objects at once :
+	// move along the old Direction, then rotate by the Euler-Angles of this Frame
+	XM_INLINE void XM_CALLCONV MovementSystem::UpdateBlocks(const UINT FirstBlock, const UINT EndBlock, const float fTime) noexcept
+	{
+		const XMVECTOR vTime = XMVectorReplicate(fTime);
+		const XMVECTOR vHalfTime = XMVectorReplicate(fTime * 0.5f);
+		const XMVECTOR vOne = XMVectorSplatOne();
+
+		for (UINT Block = FirstBlock; Block < EndBlock; Block++)
+		{
+			const UINT i = Block * 4;
+
+			//------------------------------------------------------------------
+			// Position
+			//------------------------------------------------------------------
+			const XMVECTOR Speed = XMVectorMultiply(XMLoadFloat4A((const XMFLOAT4A*)&m_Thrust[i]), vTime);
+
+			const XMVECTOR MoveX = XMVectorMultiply(XMLoadFloat4A((const XMFLOAT4A*)&m_DirX[i]), Speed);
+			const XMVECTOR MoveY = XMVectorMultiply(XMLoadFloat4A((const XMFLOAT4A*)&m_DirY[i]), Speed);
+			const XMVECTOR MoveZ = XMVectorMultiply(XMLoadFloat4A((const XMFLOAT4A*)&m_DirZ[i]), Speed);
+
+			XMStoreFloat4A((XMFLOAT4A*)&m_MoveX[i], MoveX);
+			XMStoreFloat4A((XMFLOAT4A*)&m_MoveY[i], MoveY);
+			XMStoreFloat4A((XMFLOAT4A*)&m_MoveZ[i], MoveZ);
+
+			XMStoreFloat4A((XMFLOAT4A*)&m_PosX[i], XMVectorAdd(XMLoadFloat4A((const XMFLOAT4A*)&m_PosX[i]), MoveX));
+			XMStoreFloat4A((XMFLOAT4A*)&m_PosY[i], XMVectorAdd(XMLoadFloat4A((const XMFLOAT4A*)&m_PosY[i]), MoveY));
+			XMStoreFloat4A((XMFLOAT4A*)&m_PosZ[i], XMVectorAdd(XMLoadFloat4A((const XMFLOAT4A*)&m_PosZ[i]), MoveZ));
+
+			//------------------------------------------------------------------
+			// Frame-Rotation (Quat::MakeFromEuler)
+			//------------------------------------------------------------------
+			XMVECTOR sX, cX, sY, cY, sZ, cZ;
+			XMVectorSinCos(&sX, &cX, XMVectorMultiply(XMLoadFloat4A((const XMFLOAT4A*)&m_PitchSpd[i]), vHalfTime));
+			XMVectorSinCos(&sY, &cY, XMVectorMultiply(XMLoadFloat4A((const XMFLOAT4A*)&m_YawSpd[i]), vHalfTime));
+			XMVectorSinCos(&sZ, &cZ, XMVectorMultiply(XMLoadFloat4A((const XMFLOAT4A*)&m_RollSpd[i]), vHalfTime));
+
+			const XMVECTOR cYcZ = XMVectorMultiply(cY, cZ);
+			const XMVECTOR sYsZ = XMVectorMultiply(sY, sZ);
+			const XMVECTOR cYsZ = XMVectorMultiply(cY, sZ);
+			const XMVECTOR sYcZ = XMVectorMultiply(sY, cZ);
+
+			const XMVECTOR fW = XMVectorMultiplyAdd(cX, cYcZ, XMVectorMultiply(sX, sYsZ));
+			const XMVECTOR fX = XMVectorNegativeMultiplySubtract(cX, sYsZ, XMVectorMultiply(sX, cYcZ));
+			const XMVECTOR fY = XMVectorMultiplyAdd(cX, sYcZ, XMVectorMultiply(sX, cYsZ));
+			const XMVECTOR fZ = XMVectorNegativeMultiplySubtract(sX, sYcZ, XMVectorMultiply(cX, cYsZ));
+
+			//------------------------------------------------------------------
+			// Rotation = Rotation * Frame (XMQuaternionMultiply-Order)
+			//------------------------------------------------------------------
+			const XMVECTOR qX = XMLoadFloat4A((const XMFLOAT4A*)&m_QuatX[i]);
+			const XMVECTOR qY = XMLoadFloat4A((const XMFLOAT4A*)&m_QuatY[i]);
+			const XMVECTOR qZ = XMLoadFloat4A((const XMFLOAT4A*)&m_QuatZ[i]);
+			const XMVECTOR qW = XMLoadFloat4A((const XMFLOAT4A*)&m_QuatW[i]);
+
+			XMVECTOR nX = XMVectorMultiply(fW, qX);
+			nX = XMVectorMultiplyAdd(qW, fX, nX);
+			nX = XMVectorMultiplyAdd(fY, qZ, nX);
+			nX = XMVectorNegativeMultiplySubtract(fZ, qY, nX);
+
+			XMVECTOR nY = XMVectorMultiply(fW, qY);
+			nY = XMVectorMultiplyAdd(qW, fY, nY);
+			nY = XMVectorMultiplyAdd(fZ, qX, nY);
+			nY = XMVectorNegativeMultiplySubtract(fX, qZ, nY);
+
+			XMVECTOR nZ = XMVectorMultiply(fW, qZ);
+			nZ = XMVectorMultiplyAdd(qW, fZ, nZ);
+			nZ = XMVectorMultiplyAdd(fX, qY, nZ);
+			nZ = XMVectorNegativeMultiplySubtract(fY, qX, nZ);
+
+			XMVECTOR nW = XMVectorMultiply(fW, qW);
+			nW = XMVectorNegativeMultiplySubtract(fX, qX, nW);
+			nW = XMVectorNegativeMultiplySubtract(fY, qY, nW);
+			nW = XMVectorNegativeMultiplySubtract(fZ, qZ, nW);
+
+			// renormalize against Drift
+			XMVECTOR LengthSq = XMVectorMultiply(nX, nX);
+			LengthSq = XMVectorMultiplyAdd(nY, nY, LengthSq);
+			LengthSq = XMVectorMultiplyAdd(nZ, nZ, LengthSq);
+			LengthSq = XMVectorMultiplyAdd(nW, nW, LengthSq);
+
+			const XMVECTOR InvLength = XMVectorReciprocalSqrt(LengthSq);
+
+			nX = XMVectorMultiply(nX, InvLength);
+			nY = XMVectorMultiply(nY, InvLength);
+			nZ = XMVectorMultiply(nZ, InvLength);
+			nW = XMVectorMultiply(nW, InvLength);
+
+			XMStoreFloat4A((XMFLOAT4A*)&m_QuatX[i], nX);
+			XMStoreFloat4A((XMFLOAT4A*)&m_QuatY[i], nY);
+			XMStoreFloat4A((XMFLOAT4A*)&m_QuatZ[i], nZ);
+			XMStoreFloat4A((XMFLOAT4A*)&m_QuatW[i], nW);
+
+			//------------------------------------------------------------------
+			// local Axes (Columns of Quat::GetMatrix)
+			//------------------------------------------------------------------
+			const XMVECTOR x2 = XMVectorAdd(nX, nX);
+			const XMVECTOR y2 = XMVectorAdd(nY, nY);
+			const XMVECTOR z2 = XMVectorAdd(nZ, nZ);
+
+			const XMVECTOR xx = XMVectorMultiply(nX, x2);
+			const XMVECTOR xy = XMVectorMultiply(nX, y2);
+			const XMVECTOR xz = XMVectorMultiply(nX, z2);
+			const XMVECTOR yy = XMVectorMultiply(nY, y2);
+			const XMVECTOR yz = XMVectorMultiply(nY, z2);
+			const XMVECTOR zz = XMVectorMultiply(nZ, z2);
+			const XMVECTOR wx = XMVectorMultiply(nW, x2);
+			const XMVECTOR wy = XMVectorMultiply(nW, y2);
+			const XMVECTOR wz = XMVectorMultiply(nW, z2);
+
+			XMStoreFloat4A((XMFLOAT4A*)&m_RightX[i], XMVectorSubtract(vOne, XMVectorAdd(yy, zz)));
+			XMStoreFloat4A((XMFLOAT4A*)&m_RightY[i], XMVectorAdd(xy, wz));
+			XMStoreFloat4A((XMFLOAT4A*)&m_RightZ[i], XMVectorSubtract(xz, wy));
+
+			XMStoreFloat4A((XMFLOAT4A*)&m_UpX[i], XMVectorSubtract(xy, wz));
+			XMStoreFloat4A((XMFLOAT4A*)&m_UpY[i], XMVectorSubtract(vOne, XMVectorAdd(xx, zz)));
+			XMStoreFloat4A((XMFLOAT4A*)&m_UpZ[i], XMVectorAdd(yz, wx));
+
+			XMStoreFloat4A((XMFLOAT4A*)&m_DirX[i], XMVectorAdd(xz, wy));
+			XMStoreFloat4A((XMFLOAT4A*)&m_DirY[i], XMVectorSubtract(yz, wx));
+			XMStoreFloat4A((XMFLOAT4A*)&m_DirZ[i], XMVectorSubtract(vOne, XMVectorAdd(xx, yy)));
+		}
+	}
+
+}// end of Namespace TurboMath
@@ -0,0 +1,106 @@
+// -------------------------------------------------------------------
+// File			:	MultiViewCuller
+//
+// Project		:	TurboMath
+//
+// Description	:	Cull one Set of Bounding-Volumes against many Views
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_MULTIVIEWCULLER_H_
+#define _TURBOMATH_MULTIVIEWCULLER_H_
+
+namespace TurboMath
+{
+
+	//-----------------------------------------------------------------------------
+	// Tests a Set of AABBs / Spheres against up to 32 Views (Split-Screen,
+	// Reflections, Shadow-Cascades, VR-Eyes ...) in one Pass. The Bounds of
+	// every Object are loaded once and tested against all Views while they
+	// are in Registers. The Planes of each View are stored transposed (SoA),
+	// so one Instruction tests the Object against 4 Planes.
+	//
+	// Result is a Bitmask per Object : Bit n is set, if the Object is
+	// (potentially) visible in View n.
+	// Outside a Plane is defined as being on the positive side of the Plane,
+	// like in the Intersect6Planes()-Routines.
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class MultiViewCuller
+	{
+	public:
+
+		/// max. Number of Views (Bits in the Visibility-Mask)
+		static constexpr UINT MAX_VIEWS = 32;
+
+		/// max. Number of Planes per View
+		static constexpr UINT MAX_PLANES = 8;
+
+		MultiViewCuller() noexcept;
+
+		/// remove all Views
+		void		XM_CALLCONV Reset() noexcept;
+
+		/// Get Number of Views
+		const UINT	XM_CALLCONV GetNumViews() const noexcept;
+
+		/// add a View from a Frustum, returns the Bit-Index of the View
+		const UINT	XM_CALLCONV AddView(const Frustum& ViewFrustum) noexcept;
+
+		/// add a View from 6 Planes (usually forming a Frustum), returns the Bit-Index of the View
+		const UINT	XM_CALLCONV AddView(const Plane& Plane0, const Plane& Plane1, const Plane& Plane2, const Plane& Plane3, const Plane& Plane4, const Plane& Plane5) noexcept;
+
+		/// add a View from a Set of up to MAX_PLANES Planes, returns the Bit-Index of the View
+		const UINT	XM_CALLCONV AddView(const Plane* pPlanes, const UINT NumPlanes) noexcept;
+
+		/// Cull Count Boxes against all Views, writes one Visibility-Mask per Box
+		void		XM_CALLCONV CullAABBs(const AABB* pBoxes, const UINT Count, UINT* pVisibleMask) const noexcept;
+
+		/// Cull Count Spheres against all Views, writes one Visibility-Mask per Sphere
+		void		XM_CALLCONV CullSpheres(const Sphere* pSpheres, const UINT Count, UINT* pVisibleMask) const noexcept;
+
+		/// Cull one Box against all Views
+		const UINT	XM_CALLCONV CullAABB(const AABB& Box) const noexcept;
+
+		/// Cull one Sphere against all Views
+		const UINT	XM_CALLCONV CullSphere(const Sphere& theSphere) const noexcept;
+
+	protected:
+
+		// Planes of one View, transposed in 2 Groups of 4 Planes
+		struct ViewPlanes
+		{
+			XMVECTOR	Nx[2];			// X of the Plane-Normals
+			XMVECTOR	Ny[2];			// Y of the Plane-Normals
+			XMVECTOR	Nz[2];			// Z of the Plane-Normals
+			XMVECTOR	D[2];			// Distance
+			XMVECTOR	AbsNx[2];		// abs(Nx) for the Box-Radius
+			XMVECTOR	AbsNy[2];		// abs(Ny) for the Box-Radius
+			XMVECTOR	AbsNz[2];		// abs(Nz) for the Box-Radius
+		};
+
+		/// Cull a Center / Extents against all Views (Extents = Radius for Spheres)
+		const UINT	XM_CALLCONV CullCenterExtents(FXMVECTOR Center, FXMVECTOR Extents, const bool bSphere) const noexcept;
+
+		ViewPlanes	m_Views[MAX_VIEWS];
+		UINT		m_NumViews;
+	};
+
+}; // end of namespace
+
+#endif
@@ -0,0 +1,208 @@
+// -------------------------------------------------------------------
+// File			:	MultiViewCuller.inl
+//
+// Project		:	TurboMath
+//
+// Description	:	Inline-Code for the MultiViewCuller-Class
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+namespace TurboMath
+{
+
+	//------------------------------------------------------------------------------
+	XM_INLINE MultiViewCuller::MultiViewCuller() noexcept
+	{
+		Reset();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV MultiViewCuller::Reset() noexcept
+	{
+		m_NumViews = 0;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV MultiViewCuller::GetNumViews() const noexcept
+	{
+		return m_NumViews;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV MultiViewCuller::AddView(const Frustum& ViewFrustum) noexcept
+	{
+		Plane Planes[6];
+
+		ViewFrustum.ComputePlanes(Planes[0], Planes[1], Planes[2], Planes[3], Planes[4], Planes[5]);
+
+		return AddView(Planes, 6);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV MultiViewCuller::AddView(const Plane& Plane0, const Plane& Plane1, const Plane& Plane2, const Plane& Plane3, const Plane& Plane4, const Plane& Plane5) noexcept
+	{
+		const Plane Planes[6] = { Plane0, Plane1, Plane2, Plane3, Plane4, Plane5 };
+
+		return AddView(Planes, 6);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV MultiViewCuller::AddView(const Plane* pPlanes, const UINT NumPlanes) noexcept
+	{
+		assert(pPlanes);
+		assert(NumPlanes <= MAX_PLANES);
+		assert(m_NumViews < MAX_VIEWS);
+
+		if (m_NumViews >= MAX_VIEWS) return MAX_VIEWS;
+
+		// Unused Slots get a Plane which never rejects (N = 0, D = -1)
+		XMFLOAT4A Padded[MAX_PLANES];
+
+		for (UINT i = 0; i < MAX_PLANES; i++)
+		{
+			if (i < NumPlanes)
+			{
+				// Normalize, so the Distance is comparable with a Sphere-Radius
+				XMStoreFloat4A(&Padded[i], XMPlaneNormalize(pPlanes[i].Get()));
+			}
+			else
+			{
+				Padded[i] = XMFLOAT4A(0.0f, 0.0f, 0.0f, -1.0f);
+			}
+		}
+
+		// Transpose the Planes into 2 Groups of 4
+		ViewPlanes& View = m_Views[m_NumViews];
+
+		for (UINT g = 0; g < 2; g++)
+		{
+			const XMMATRIX T = XMMatrixTranspose(XMMATRIX(	XMLoadFloat4A(&Padded[g * 4 + 0]),
+															XMLoadFloat4A(&Padded[g * 4 + 1]),
+															XMLoadFloat4A(&Padded[g * 4 + 2]),
+															XMLoadFloat4A(&Padded[g * 4 + 3]) ) );
+			View.Nx[g] = T.r[0];
+			View.Ny[g] = T.r[1];
+			View.Nz[g] = T.r[2];
+			View.D[g]  = T.r[3];
+
+			View.AbsNx[g] = XMVectorAbs(T.r[0]);
+			View.AbsNy[g] = XMVectorAbs(T.r[1]);
+			View.AbsNz[g] = XMVectorAbs(T.r[2]);
+		}
+
+		return m_NumViews++;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV MultiViewCuller::CullCenterExtents(FXMVECTOR Center, FXMVECTOR Extents, const bool bSphere) const noexcept
+	{
+		// Load the Object once ...
+		const XMVECTOR Cx = XMVectorSplatX(Center);
+		const XMVECTOR Cy = XMVectorSplatY(Center);
+		const XMVECTOR Cz = XMVectorSplatZ(Center);
+
+		const XMVECTOR Ex = XMVectorSplatX(Extents);
+		const XMVECTOR Ey = XMVectorSplatY(Extents);
+		const XMVECTOR Ez = XMVectorSplatZ(Extents);
+
+		const XMVECTOR False = XMVectorFalseInt();
+
+		UINT Mask = 0;
+
+		// ... and test it against all Views
+		for (UINT v = 0; v < m_NumViews; v++)
+		{
+			const ViewPlanes& View = m_Views[v];
+
+			XMVECTOR Outside = False;
+
+			for (UINT g = 0; g < 2; g++)
+			{
+				// Distance from the Center to 4 Planes
+				XMVECTOR Dist = XMVectorMultiplyAdd(Cx, View.Nx[g], View.D[g]);
+				Dist = XMVectorMultiplyAdd(Cy, View.Ny[g], Dist);
+				Dist = XMVectorMultiplyAdd(Cz, View.Nz[g], Dist);
+
+				// Projected Radius of the Volume onto the 4 Plane-Normals
+				XMVECTOR Radius;
+
+				if (bSphere)
+				{
+					Radius = Ex;
+				}
+				else
+				{
+					Radius = XMVectorMultiply(Ex, View.AbsNx[g]);
+					Radius = XMVectorMultiplyAdd(Ey, View.AbsNy[g], Radius);
+					Radius = XMVectorMultiplyAdd(Ez, View.AbsNz[g], Radius);
+				}
+
+				// Outside the plane?
+				Outside = XMVectorOrInt(Outside, XMVectorGreater(Dist, Radius));
+			}
+
+			// Visible, if the Volume is not outside any of the Planes
+			Mask |= (XMVector4EqualInt(Outside, False) ? 1u : 0u) << v;
+		}
+
+		return Mask;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV MultiViewCuller::CullAABB(const AABB& Box) const noexcept
+	{
+		return CullCenterExtents(Box.GetCenter(), Box.GetExtents(), false);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV MultiViewCuller::CullSphere(const Sphere& theSphere) const noexcept
+	{
+		return CullCenterExtents(theSphere.GetCenter(), XMVectorReplicate(theSphere.GetRadius()), true);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV MultiViewCuller::CullAABBs(const AABB* pBoxes, const UINT Count, UINT* pVisibleMask) const noexcept
+	{
+		assert(pBoxes);
+		assert(pVisibleMask);
+
+		for (UINT i = 0; i < Count; i++)
+		{
+			XM_PREFETCH(&pBoxes[i + 4]);
+
+			pVisibleMask[i] = CullCenterExtents(pBoxes[i].GetCenter(), pBoxes[i].GetExtents(), false);
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV MultiViewCuller::CullSpheres(const Sphere* pSpheres, const UINT Count, UINT* pVisibleMask) const noexcept
+	{
+		assert(pSpheres);
+		assert(pVisibleMask);
+
+		for (UINT i = 0; i < Count; i++)
+		{
+			XM_PREFETCH(&pSpheres[i + 4]);
+
+			pVisibleMask[i] = CullCenterExtents(pSpheres[i].GetCenter(), XMVectorReplicate(pSpheres[i].GetRadius()), true);
+		}
+	}
+
+}// end of Namespace TurboMath
@@ -0,0 +1,170 @@
+// -------------------------------------------------------------------
+// File			:	Noise
+//
+// Project		:	TurboMath
+//
+// Description	:	SIMD Value-, Perlin- and Simplex-Noise with Fractals and Bulk-Evaluation
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_NOISE_H_
+#define _TURBOMATH_NOISE_H_
+
+namespace TurboMath
+{
+	//-----------------------------------------------------------------------------
+	// Noise-Functions for 4 Points per Call (Coordinates in SoA : x, y, z, w of
+	// 4 Points in 4 Registers), Results in about [-1, 1]. The Lattice is hashed
+	// with Integer-Math in the Lanes (no Permutation-Table and no Gathers), the
+	// Seed selects an independent Noise.
+	//
+	// The Bulk-Functions evaluate a Fractal (fBm or ridged) of a Basis on SoA-
+	// Arrays or on whole Grids, split over all Cores with ParallelFor.
+	//-----------------------------------------------------------------------------
+	class Noise
+	{
+	public:
+
+		enum Basis
+		{
+			NOISE_VALUE = 0,
+			NOISE_PERLIN,
+			NOISE_SIMPLEX
+		};
+
+		enum Fractal
+		{
+			FRACTAL_NONE = 0,		// only the first Octave
+			FRACTAL_FBM,			// Sum of Octaves
+			FRACTAL_RIDGED			// Sum of (1 - |Noise|)^2
+		};
+
+		/// Setup of the Bulk-Evaluation
+		struct Params
+		{
+			Basis		theBasis;
+			Fractal		theFractal;
+			UINT		Seed;
+			UINT		Octaves;
+			float		Frequency;
+			float		Lacunarity;		// Frequency-Factor per Octave
+			float		Gain;			// Amplitude-Factor per Octave
+
+			Params() noexcept :
+				theBasis(NOISE_SIMPLEX), theFractal(FRACTAL_FBM), Seed(1337), Octaves(4),
+				Frequency(1.0f), Lacunarity(2.0f), Gain(0.5f)
+			{
+			}
+		};
+
+		//-----------------------------------------------------------------------------
+		// Basis-Functions (4 Points)
+		//-----------------------------------------------------------------------------
+		static XMVECTOR		XM_CALLCONV Value2(FXMVECTOR x, FXMVECTOR y, const UINT Seed) noexcept;
+		static XMVECTOR		XM_CALLCONV Value3(FXMVECTOR x, FXMVECTOR y, FXMVECTOR z, const UINT Seed) noexcept;
+
+		static XMVECTOR		XM_CALLCONV Perlin1(FXMVECTOR x, const UINT Seed) noexcept;
+		static XMVECTOR		XM_CALLCONV Perlin2(FXMVECTOR x, FXMVECTOR y, const UINT Seed) noexcept;
+		static XMVECTOR		XM_CALLCONV Perlin3(FXMVECTOR x, FXMVECTOR y, FXMVECTOR z, const UINT Seed) noexcept;
+		static XMVECTOR		XM_CALLCONV Perlin4(FXMVECTOR x, FXMVECTOR y, FXMVECTOR z, GXMVECTOR w, const UINT Seed) noexcept;
+
+		static XMVECTOR		XM_CALLCONV Simplex1(FXMVECTOR x, const UINT Seed) noexcept;
+		static XMVECTOR		XM_CALLCONV Simplex2(FXMVECTOR x, FXMVECTOR y, const UINT Seed) noexcept;
+		static XMVECTOR		XM_CALLCONV Simplex3(FXMVECTOR x, FXMVECTOR y, FXMVECTOR z, const UINT Seed) noexcept;
+		static XMVECTOR		XM_CALLCONV Simplex4(FXMVECTOR x, FXMVECTOR y, FXMVECTOR z, GXMVECTOR w, const UINT Seed) noexcept;
+
+		//-----------------------------------------------------------------------------
+		// Fractals (4 Points)
+		//-----------------------------------------------------------------------------
+		static XMVECTOR		XM_CALLCONV Fractal2(const Params& theParams, FXMVECTOR x, FXMVECTOR y) noexcept;
+		static XMVECTOR		XM_CALLCONV Fractal3(const Params& theParams, FXMVECTOR x, FXMVECTOR y, FXMVECTOR z) noexcept;
+
+		//-----------------------------------------------------------------------------
+		// Bulk-Evaluation
+		//-----------------------------------------------------------------------------
+
+		/// Count Points from SoA-Arrays (pZ = nullptr for 2D)
+		static void			XM_CALLCONV Evaluate(const Params& theParams, const float* pX, const float* pY, const float* pZ, float* pOut, const UINT Count);
+
+		/// Grid of Width x Height Samples from (x0, y0) with Step (Row-major)
+		static void			XM_CALLCONV EvaluateGrid2D(const Params& theParams, const float x0, const float y0, const float Step,
+													   const UINT Width, const UINT Height, float* pOut);
+
+		/// Grid of Width x Height x Depth Samples from (x0, y0, z0) with Step (Slices of Rows)
+		static void			XM_CALLCONV EvaluateGrid3D(const Params& theParams, const float x0, const float y0, const float z0, const float Step,
+													   const UINT Width, const UINT Height, const UINT Depth, float* pOut);
+
+		/// Samples per Job of ParallelFor
+		static constexpr UINT	CHUNK_SIZE = 4096;
+
+	protected:
+
+		/// Primes for the Lattice-Coordinates and the Hash-Multiplier
+		static constexpr int	PRIME_X = 501125321;
+		static constexpr int	PRIME_Y = 1136930381;
+		static constexpr int	PRIME_Z = 1720413743;
+		static constexpr int	PRIME_W = 1066037191;
+		static constexpr int	HASH_MUL = 0x27D4EB2D;
+
+		/// 32 Bit Multiply of the Lanes (SSE2 has no _mm_mullo_epi32)
+		static __m128i		XM_CALLCONV MulLo(const __m128i a, const __m128i b) noexcept;
+
+		/// floor(v) * Prime as Integers
+		static __m128i		XM_CALLCONV Lattice(FXMVECTOR Floor, const int Prime) noexcept;
+
+		/// Hash of the (primed) Lattice-Coordinates
+		static __m128i		XM_CALLCONV Hash(const __m128i Seed, const __m128i a) noexcept;
+		static __m128i		XM_CALLCONV Hash(const __m128i Seed, const __m128i a, const __m128i b) noexcept;
+		static __m128i		XM_CALLCONV Hash(const __m128i Seed, const __m128i a, const __m128i b, const __m128i c) noexcept;
+		static __m128i		XM_CALLCONV Hash(const __m128i Seed, const __m128i a, const __m128i b, const __m128i c, const __m128i d) noexcept;
+
+		/// Hash as Float in [-1, 1)
+		static XMVECTOR		XM_CALLCONV HashToFloat(const __m128i h) noexcept;
+
+		/// Gradient of the Hash dotted with the Offset
+		static XMVECTOR		XM_CALLCONV Grad1(const __m128i h, FXMVECTOR x) noexcept;
+		static XMVECTOR		XM_CALLCONV Grad2(const __m128i h, FXMVECTOR x, FXMVECTOR y) noexcept;
+		static XMVECTOR		XM_CALLCONV Grad3(const __m128i h, FXMVECTOR x, FXMVECTOR y, FXMVECTOR z) noexcept;
+		static XMVECTOR		XM_CALLCONV Grad4(const __m128i h, FXMVECTOR x, FXMVECTOR y, FXMVECTOR z, GXMVECTOR w) noexcept;
+
+		/// 6t^5 - 15t^4 + 10t^3
+		static XMVECTOR		XM_CALLCONV Fade(FXMVECTOR t) noexcept;
+
+		/// max(t, 0)^4 (Simplex-Kernel)
+		static XMVECTOR		XM_CALLCONV Falloff(FXMVECTOR t) noexcept;
+
+		/// Sign-Bit of the Lanes, where Bit of h is set
+		static XMVECTOR		XM_CALLCONV SignOf(const __m128i h, const int Bit) noexcept;
+
+		/// Basis of the Params
+		static XMVECTOR		XM_CALLCONV Basis2(const Basis theBasis, FXMVECTOR x, FXMVECTOR y, const UINT Seed) noexcept;
+		static XMVECTOR		XM_CALLCONV Basis3(const Basis theBasis, FXMVECTOR x, FXMVECTOR y, FXMVECTOR z, const UINT Seed) noexcept;
+
+		/// load / store Num (1 .. 4) Floats
+		static XMVECTOR		XM_CALLCONV LoadFloats(const float* p, const UINT Num) noexcept;
+		static void			XM_CALLCONV StoreFloats(FXMVECTOR v, float* p, const UINT Num) noexcept;
+
+		/// evaluate a Row of Width Samples with x = x0 + i * Step
+		static void			XM_CALLCONV EvaluateRow(const Params& theParams, const float x0, FXMVECTOR y, FXMVECTOR z, const bool Is3D,
+													const float Step, const UINT Width, float* pOut) noexcept;
+	};
+
+}; // end of namespace
+
+#endif
@@ -0,0 +1,761 @@
+// -------------------------------------------------------------------
+// File			:	Noise
+//
+// Project		:	TurboMath
+//
+// Description	:	SIMD Value-, Perlin- and Simplex-Noise with Fractals and Bulk-Evaluation
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+namespace TurboMath
+{
+	//------------------------------------------------------------------------------
+	XM_INLINE __m128i XM_CALLCONV Noise::MulLo(const __m128i a, const __m128i b) noexcept
+	{
+#ifdef XM_SSE4_INTRINSICS
+		return _mm_mullo_epi32(a, b);
+#else
+		const __m128i Even = _mm_mul_epu32(a, b);
+		const __m128i Odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+
+		return _mm_unpacklo_epi32(_mm_shuffle_epi32(Even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(Odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE __m128i XM_CALLCONV Noise::Lattice(FXMVECTOR Floor, const int Prime) noexcept
+	{
+		// wrap into [-2^31, 2^31] (exact for Integers) : no Overflow in the Conversion and
+		// 2^31 converts to 0x80000000, so the Lattice keeps the Period 2^32 of the Integer-Math
+		const XMVECTOR Periods = XMVectorRound(XMVectorScale(Floor, 1.0f / 4294967296.0f));
+		const XMVECTOR Wrapped = XMVectorNegativeMultiplySubtract(Periods, XMVectorReplicate(4294967296.0f), Floor);
+
+		return MulLo(_mm_cvttps_epi32(Wrapped), _mm_set1_epi32(Prime));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE __m128i XM_CALLCONV Noise::Hash(const __m128i Seed, const __m128i a) noexcept
+	{
+		__m128i h = MulLo(_mm_xor_si128(Seed, a), _mm_set1_epi32(HASH_MUL));
+
+		return _mm_xor_si128(h, _mm_srli_epi32(h, 15));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE __m128i XM_CALLCONV Noise::Hash(const __m128i Seed, const __m128i a, const __m128i b) noexcept
+	{
+		return Hash(Seed, _mm_xor_si128(a, b));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE __m128i XM_CALLCONV Noise::Hash(const __m128i Seed, const __m128i a, const __m128i b, const __m128i c) noexcept
+	{
+		return Hash(Seed, _mm_xor_si128(_mm_xor_si128(a, b), c));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE __m128i XM_CALLCONV Noise::Hash(const __m128i Seed, const __m128i a, const __m128i b, const __m128i c, const __m128i d) noexcept
+	{
+		return Hash(Seed, _mm_xor_si128(_mm_xor_si128(a, b), _mm_xor_si128(c, d)));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::HashToFloat(const __m128i h) noexcept
+	{
+		return XMVectorScale(_mm_cvtepi32_ps(h), 1.0f / 2147483648.0f);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::SignOf(const __m128i h, const int Bit) noexcept
+	{
+		return _mm_castsi128_ps(_mm_and_si128(_mm_sll_epi32(h, _mm_cvtsi32_si128(31 - Bit)), _mm_set1_epi32((int)0x80000000)));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Grad1(const __m128i h, FXMVECTOR x) noexcept
+	{
+		// Gradients -8 .. -1, 1 .. 8
+		const XMVECTOR g = _mm_cvtepi32_ps(_mm_add_epi32(_mm_and_si128(h, _mm_set1_epi32(7)), _mm_set1_epi32(1)));
+
+		return XMVectorXorInt(XMVectorMultiply(g, x), SignOf(h, 3));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Grad2(const __m128i h, FXMVECTOR x, FXMVECTOR y) noexcept
+	{
+		// 8 Gradients (+-1, +-2), (+-2, +-1)
+		const XMVECTOR m = _mm_castsi128_ps(_mm_cmplt_epi32(_mm_and_si128(h, _mm_set1_epi32(7)), _mm_set1_epi32(4)));
+
+		const XMVECTOR u = XMVectorSelect(y, x, m);
+		const XMVECTOR v = XMVectorSelect(x, y, m);
+
+		return XMVectorAdd(XMVectorXorInt(u, SignOf(h, 0)), XMVectorXorInt(XMVectorAdd(v, v), SignOf(h, 1)));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Grad3(const __m128i h, FXMVECTOR x, FXMVECTOR y, FXMVECTOR z) noexcept
+	{
+		// 12 Edges of the Cube (improved Perlin-Noise)
+		const __m128i hh = _mm_and_si128(h, _mm_set1_epi32(15));
+
+		const XMVECTOR mu = _mm_castsi128_ps(_mm_cmplt_epi32(hh, _mm_set1_epi32(8)));
+		const XMVECTOR mv = _mm_castsi128_ps(_mm_cmplt_epi32(hh, _mm_set1_epi32(4)));
+		const XMVECTOR mx = _mm_castsi128_ps(_mm_or_si128(_mm_cmpeq_epi32(hh, _mm_set1_epi32(12)), _mm_cmpeq_epi32(hh, _mm_set1_epi32(14))));
+
+		const XMVECTOR u = XMVectorSelect(y, x, mu);
+		const XMVECTOR v = XMVectorSelect(XMVectorSelect(z, x, mx), y, mv);
+
+		return XMVectorAdd(XMVectorXorInt(u, SignOf(h, 0)), XMVectorXorInt(v, SignOf(h, 1)));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Grad4(const __m128i h, FXMVECTOR x, FXMVECTOR y, FXMVECTOR z, GXMVECTOR w) noexcept
+	{
+		// 32 Edges of the Hypercube
+		const __m128i hh = _mm_and_si128(h, _mm_set1_epi32(31));
+
+		const XMVECTOR u = XMVectorSelect(y, x, _mm_castsi128_ps(_mm_cmplt_epi32(hh, _mm_set1_epi32(24))));
+		const XMVECTOR v = XMVectorSelect(z, y, _mm_castsi128_ps(_mm_cmplt_epi32(hh, _mm_set1_epi32(16))));
+		const XMVECTOR t = XMVectorSelect(w, z, _mm_castsi128_ps(_mm_cmplt_epi32(hh, _mm_set1_epi32(8))));
+
+		return XMVectorAdd(XMVectorAdd(XMVectorXorInt(u, SignOf(h, 0)), XMVectorXorInt(v, SignOf(h, 1))), XMVectorXorInt(t, SignOf(h, 2)));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Fade(FXMVECTOR t) noexcept
+	{
+		XMVECTOR Result = XMVectorMultiplyAdd(t, XMVectorReplicate(6.0f), XMVectorReplicate(-15.0f));
+		Result = XMVectorMultiplyAdd(Result, t, XMVectorReplicate(10.0f));
+
+		return XMVectorMultiply(Result, XMVectorMultiply(XMVectorMultiply(t, t), t));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Falloff(FXMVECTOR t) noexcept
+	{
+		const XMVECTOR t1 = XMVectorMax(t, g_XMZero);
+		const XMVECTOR t2 = XMVectorMultiply(t1, t1);
+
+		return XMVectorMultiply(t2, t2);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Value2(FXMVECTOR x, FXMVECTOR y, const UINT Seed) noexcept
+	{
+		const __m128i s = _mm_set1_epi32((int)Seed);
+
+		const XMVECTOR fx = XMVectorFloor(x);
+		const XMVECTOR fy = XMVectorFloor(y);
+
+		const __m128i x0 = Lattice(fx, PRIME_X);
+		const __m128i y0 = Lattice(fy, PRIME_Y);
+		const __m128i x1 = _mm_add_epi32(x0, _mm_set1_epi32(PRIME_X));
+		const __m128i y1 = _mm_add_epi32(y0, _mm_set1_epi32(PRIME_Y));
+
+		const XMVECTOR u = Fade(XMVectorSubtract(x, fx));
+		const XMVECTOR v = Fade(XMVectorSubtract(y, fy));
+
+		const XMVECTOR n0 = XMVectorLerpV(HashToFloat(Hash(s, x0, y0)), HashToFloat(Hash(s, x1, y0)), u);
+		const XMVECTOR n1 = XMVectorLerpV(HashToFloat(Hash(s, x0, y1)), HashToFloat(Hash(s, x1, y1)), u);
+
+		return XMVectorLerpV(n0, n1, v);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Value3(FXMVECTOR x, FXMVECTOR y, FXMVECTOR z, const UINT Seed) noexcept
+	{
+		const __m128i s = _mm_set1_epi32((int)Seed);
+
+		const XMVECTOR fx = XMVectorFloor(x);
+		const XMVECTOR fy = XMVectorFloor(y);
+		const XMVECTOR fz = XMVectorFloor(z);
+
+		const __m128i x0 = Lattice(fx, PRIME_X);
+		const __m128i y0 = Lattice(fy, PRIME_Y);
+		const __m128i z0 = Lattice(fz, PRIME_Z);
+		const __m128i x1 = _mm_add_epi32(x0, _mm_set1_epi32(PRIME_X));
+		const __m128i y1 = _mm_add_epi32(y0, _mm_set1_epi32(PRIME_Y));
+		const __m128i z1 = _mm_add_epi32(z0, _mm_set1_epi32(PRIME_Z));
+
+		const XMVECTOR u = Fade(XMVectorSubtract(x, fx));
+		const XMVECTOR v = Fade(XMVectorSubtract(y, fy));
+		const XMVECTOR w = Fade(XMVectorSubtract(z, fz));
+
+		const XMVECTOR n00 = XMVectorLerpV(HashToFloat(Hash(s, x0, y0, z0)), HashToFloat(Hash(s, x1, y0, z0)), u);
+		const XMVECTOR n10 = XMVectorLerpV(HashToFloat(Hash(s, x0, y1, z0)), HashToFloat(Hash(s, x1, y1, z0)), u);
+		const XMVECTOR n01 = XMVectorLerpV(HashToFloat(Hash(s, x0, y0, z1)), HashToFloat(Hash(s, x1, y0, z1)), u);
+		const XMVECTOR n11 = XMVectorLerpV(HashToFloat(Hash(s, x0, y1, z1)), HashToFloat(Hash(s, x1, y1, z1)), u);
+
+		return XMVectorLerpV(XMVectorLerpV(n00, n10, v), XMVectorLerpV(n01, n11, v), w);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Perlin1(FXMVECTOR x, const UINT Seed) noexcept
+	{
+		const __m128i s = _mm_set1_epi32((int)Seed);
+
+		const XMVECTOR fx = XMVectorFloor(x);
+		const XMVECTOR tx = XMVectorSubtract(x, fx);
+
+		const __m128i x0 = Lattice(fx, PRIME_X);
+		const __m128i x1 = _mm_add_epi32(x0, _mm_set1_epi32(PRIME_X));
+
+		const XMVECTOR n0 = Grad1(Hash(s, x0), tx);
+		const XMVECTOR n1 = Grad1(Hash(s, x1), XMVectorSubtract(tx, g_XMOne));
+
+		return XMVectorScale(XMVectorLerpV(n0, n1, Fade(tx)), 0.188f);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Perlin2(FXMVECTOR x, FXMVECTOR y, const UINT Seed) noexcept
+	{
+		const __m128i s = _mm_set1_epi32((int)Seed);
+
+		const XMVECTOR fx = XMVectorFloor(x);
+		const XMVECTOR fy = XMVectorFloor(y);
+
+		const XMVECTOR tx0 = XMVectorSubtract(x, fx);
+		const XMVECTOR ty0 = XMVectorSubtract(y, fy);
+		const XMVECTOR tx1 = XMVectorSubtract(tx0, g_XMOne);
+		const XMVECTOR ty1 = XMVectorSubtract(ty0, g_XMOne);
+
+		const __m128i x0 = Lattice(fx, PRIME_X);
+		const __m128i y0 = Lattice(fy, PRIME_Y);
+		const __m128i x1 = _mm_add_epi32(x0, _mm_set1_epi32(PRIME_X));
+		const __m128i y1 = _mm_add_epi32(y0, _mm_set1_epi32(PRIME_Y));
+
+		const XMVECTOR u = Fade(tx0);
+
+		const XMVECTOR n0 = XMVectorLerpV(Grad2(Hash(s, x0, y0), tx0, ty0), Grad2(Hash(s, x1, y0), tx1, ty0), u);
+		const XMVECTOR n1 = XMVectorLerpV(Grad2(Hash(s, x0, y1), tx0, ty1), Grad2(Hash(s, x1, y1), tx1, ty1), u);
+
+		return XMVectorScale(XMVectorLerpV(n0, n1, Fade(ty0)), 0.507f);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Perlin3(FXMVECTOR x, FXMVECTOR y, FXMVECTOR z, const UINT Seed) noexcept
+	{
+		const __m128i s = _mm_set1_epi32((int)Seed);
+
+		const XMVECTOR fx = XMVectorFloor(x);
+		const XMVECTOR fy = XMVectorFloor(y);
+		const XMVECTOR fz = XMVectorFloor(z);
+
+		const XMVECTOR tx0 = XMVectorSubtract(x, fx);
+		const XMVECTOR ty0 = XMVectorSubtract(y, fy);
+		const XMVECTOR tz0 = XMVectorSubtract(z, fz);
+		const XMVECTOR tx1 = XMVectorSubtract(tx0, g_XMOne);
+		const XMVECTOR ty1 = XMVectorSubtract(ty0, g_XMOne);
+		const XMVECTOR tz1 = XMVectorSubtract(tz0, g_XMOne);
+
+		const __m128i x0 = Lattice(fx, PRIME_X);
+		const __m128i y0 = Lattice(fy, PRIME_Y);
+		const __m128i z0 = Lattice(fz, PRIME_Z);
+		const __m128i x1 = _mm_add_epi32(x0, _mm_set1_epi32(PRIME_X));
+		const __m128i y1 = _mm_add_epi32(y0, _mm_set1_epi32(PRIME_Y));
+		const __m128i z1 = _mm_add_epi32(z0, _mm_set1_epi32(PRIME_Z));
+
+		const XMVECTOR u = Fade(tx0);
+		const XMVECTOR v = Fade(ty0);
+
+		const XMVECTOR n00 = XMVectorLerpV(Grad3(Hash(s, x0, y0, z0), tx0, ty0, tz0), Grad3(Hash(s, x1, y0, z0), tx1, ty0, tz0), u);
+		const XMVECTOR n10 = XMVectorLerpV(Grad3(Hash(s, x0, y1, z0), tx0, ty1, tz0), Grad3(Hash(s, x1, y1, z0), tx1, ty1, tz0), u);
+		const XMVECTOR n01 = XMVectorLerpV(Grad3(Hash(s, x0, y0, z1), tx0, ty0, tz1), Grad3(Hash(s, x1, y0, z1), tx1, ty0, tz1), u);
+		const XMVECTOR n11 = XMVectorLerpV(Grad3(Hash(s, x0, y1, z1), tx0, ty1, tz1), Grad3(Hash(s, x1, y1, z1), tx1, ty1, tz1), u);
+
+		const XMVECTOR n = XMVectorLerpV(XMVectorLerpV(n00, n10, v), XMVectorLerpV(n01, n11, v), Fade(tz0));
+
+		return XMVectorScale(n, 0.936f);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Perlin4(FXMVECTOR x, FXMVECTOR y, FXMVECTOR z, GXMVECTOR w, const UINT Seed) noexcept
+	{
+		const __m128i s = _mm_set1_epi32((int)Seed);
+
+		const XMVECTOR fx = XMVectorFloor(x);
+		const XMVECTOR fy = XMVectorFloor(y);
+		const XMVECTOR fz = XMVectorFloor(z);
+		const XMVECTOR fw = XMVectorFloor(w);
+
+		// Offsets and Lattice-Hashes for the Corners 0 and 1 per Axis
+		const XMVECTOR t[4][2] =
+		{
+			{ XMVectorSubtract(x, fx), XMVectorSubtract(XMVectorSubtract(x, fx), g_XMOne) },
+			{ XMVectorSubtract(y, fy), XMVectorSubtract(XMVectorSubtract(y, fy), g_XMOne) },
+			{ XMVectorSubtract(z, fz), XMVectorSubtract(XMVectorSubtract(z, fz), g_XMOne) },
+			{ XMVectorSubtract(w, fw), XMVectorSubtract(XMVectorSubtract(w, fw), g_XMOne) }
+		};
+
+		const __m128i l[4][2] =
+		{
+			{ Lattice(fx, PRIME_X), _mm_add_epi32(Lattice(fx, PRIME_X), _mm_set1_epi32(PRIME_X)) },
+			{ Lattice(fy, PRIME_Y), _mm_add_epi32(Lattice(fy, PRIME_Y), _mm_set1_epi32(PRIME_Y)) },
+			{ Lattice(fz, PRIME_Z), _mm_add_epi32(Lattice(fz, PRIME_Z), _mm_set1_epi32(PRIME_Z)) },
+			{ Lattice(fw, PRIME_W), _mm_add_epi32(Lattice(fw, PRIME_W), _mm_set1_epi32(PRIME_W)) }
+		};
+
+		// 16 Corners : Bit 0 = x, Bit 1 = y, Bit 2 = z, Bit 3 = w
+		XMVECTOR n[16];
+
+		for (UINT c = 0; c < 16; c++)
+		{
+			const UINT a = c & 1, b = (c >> 1) & 1, d = (c >> 2) & 1, e = (c >> 3) & 1;
+
+			n[c] = Grad4(Hash(s, l[0][a], l[1][b], l[2][d], l[3][e]), t[0][a], t[1][b], t[2][d], t[3][e]);
+		}
+
+		// reduce along x, y, z and w
+		for (UINT Axis = 0, Num = 16; Axis < 4; Axis++)
+		{
+			const XMVECTOR f = Fade(t[Axis][0]);
+
+			Num >>= 1;
+
+			for (UINT c = 0; c < Num; c++)
+				n[c] = XMVectorLerpV(n[c * 2], n[c * 2 + 1], f);
+		}
+
+		return XMVectorScale(n[0], 0.87f);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Simplex1(FXMVECTOR x, const UINT Seed) noexcept
+	{
+		const __m128i s = _mm_set1_epi32((int)Seed);
+
+		const XMVECTOR fx = XMVectorFloor(x);
+		const XMVECTOR x0 = XMVectorSubtract(x, fx);
+		const XMVECTOR x1 = XMVectorSubtract(x0, g_XMOne);
+
+		const __m128i i0 = Lattice(fx, PRIME_X);
+		const __m128i i1 = _mm_add_epi32(i0, _mm_set1_epi32(PRIME_X));
+
+		XMVECTOR n = XMVectorMultiply(Falloff(XMVectorNegativeMultiplySubtract(x0, x0, g_XMOne)), Grad1(Hash(s, i0), x0));
+		n = XMVectorMultiplyAdd(Falloff(XMVectorNegativeMultiplySubtract(x1, x1, g_XMOne)), Grad1(Hash(s, i1), x1), n);
+
+		return XMVectorScale(n, 0.395f);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Simplex2(FXMVECTOR x, FXMVECTOR y, const UINT Seed) noexcept
+	{
+		const float F2 = 0.36602540f;	// (sqrt(3) - 1) / 2
+		const float G2 = 0.21132487f;	// (3 - sqrt(3)) / 6
+
+		const __m128i s = _mm_set1_epi32((int)Seed);
+
+		// skew to the Cell
+		const XMVECTOR Skew = XMVectorScale(XMVectorAdd(x, y), F2);
+		const XMVECTOR fi = XMVectorFloor(XMVectorAdd(x, Skew));
+		const XMVECTOR fj = XMVectorFloor(XMVectorAdd(y, Skew));
+
+		const XMVECTOR Unskew = XMVectorScale(XMVectorAdd(fi, fj), G2);
+		const XMVECTOR x0 = XMVectorSubtract(x, XMVectorSubtract(fi, Unskew));
+		const XMVECTOR y0 = XMVectorSubtract(y, XMVectorSubtract(fj, Unskew));
+
+		// upper or lower Triangle
+		const XMVECTOR m = XMVectorGreater(x0, y0);
+		const XMVECTOR i1 = XMVectorAndInt(m, g_XMOne);
+		const XMVECTOR j1 = XMVectorAndCInt(g_XMOne, m);
+
+		const XMVECTOR x1 = XMVectorAdd(XMVectorSubtract(x0, i1), XMVectorReplicate(G2));
+		const XMVECTOR y1 = XMVectorAdd(XMVectorSubtract(y0, j1), XMVectorReplicate(G2));
+		const XMVECTOR x2 = XMVectorAdd(x0, XMVectorReplicate(2.0f * G2 - 1.0f));
+		const XMVECTOR y2 = XMVectorAdd(y0, XMVectorReplicate(2.0f * G2 - 1.0f));
+
+		const __m128i px = _mm_set1_epi32(PRIME_X);
+		const __m128i py = _mm_set1_epi32(PRIME_Y);
+		const __m128i mi = _mm_castps_si128(m);
+
+		const __m128i i0 = Lattice(fi, PRIME_X);
+		const __m128i j0 = Lattice(fj, PRIME_Y);
+
+		const __m128i h0 = Hash(s, i0, j0);
+		const __m128i h1 = Hash(s, _mm_add_epi32(i0, _mm_and_si128(mi, px)), _mm_add_epi32(j0, _mm_andnot_si128(mi, py)));
+		const __m128i h2 = Hash(s, _mm_add_epi32(i0, px), _mm_add_epi32(j0, py));
+
+		const XMVECTOR Half = g_XMOneHalf;
+
+		XMVECTOR n = XMVectorMultiply(Falloff(XMVectorSubtract(Half, XMVectorMultiplyAdd(x0, x0, XMVectorMultiply(y0, y0)))), Grad2(h0, x0, y0));
+		n = XMVectorMultiplyAdd(Falloff(XMVectorSubtract(Half, XMVectorMultiplyAdd(x1, x1, XMVectorMultiply(y1, y1)))), Grad2(h1, x1, y1), n);
+		n = XMVectorMultiplyAdd(Falloff(XMVectorSubtract(Half, XMVectorMultiplyAdd(x2, x2, XMVectorMultiply(y2, y2)))), Grad2(h2, x2, y2), n);
+
+		return XMVectorScale(n, 40.0f);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Simplex3(FXMVECTOR x, FXMVECTOR y, FXMVECTOR z, const UINT Seed) noexcept
+	{
+		const float F3 = 1.0f / 3.0f;
+		const float G3 = 1.0f / 6.0f;
+
+		const __m128i s = _mm_set1_epi32((int)Seed);
+
+		// skew to the Cell
+		const XMVECTOR Skew = XMVectorScale(XMVectorAdd(XMVectorAdd(x, y), z), F3);
+		const XMVECTOR fi = XMVectorFloor(XMVectorAdd(x, Skew));
+		const XMVECTOR fj = XMVectorFloor(XMVectorAdd(y, Skew));
+		const XMVECTOR fk = XMVectorFloor(XMVectorAdd(z, Skew));
+
+		const XMVECTOR Unskew = XMVectorScale(XMVectorAdd(XMVectorAdd(fi, fj), fk), G3);
+		const XMVECTOR x0 = XMVectorSubtract(x, XMVectorSubtract(fi, Unskew));
+		const XMVECTOR y0 = XMVectorSubtract(y, XMVectorSubtract(fj, Unskew));
+		const XMVECTOR z0 = XMVectorSubtract(z, XMVectorSubtract(fk, Unskew));
+
+		// Simplex of the 6 in the Cell from the Order of x0, y0, z0
+		const XMVECTOR xy = XMVectorGreaterOrEqual(x0, y0);
+		const XMVECTOR yx = XMVectorLess(x0, y0);
+		const XMVECTOR xz = XMVectorGreaterOrEqual(x0, z0);
+		const XMVECTOR zx = XMVectorLess(x0, z0);
+		const XMVECTOR yz = XMVectorGreaterOrEqual(y0, z0);
+		const XMVECTOR zy = XMVectorLess(y0, z0);
+
+		const XMVECTOR mi1 = XMVectorAndInt(xy, xz);
+		const XMVECTOR mj1 = XMVectorAndInt(yx, yz);
+		const XMVECTOR mk1 = XMVectorAndInt(zx, zy);
+		const XMVECTOR mi2 = XMVectorOrInt(xy, xz);
+		const XMVECTOR mj2 = XMVectorOrInt(yx, yz);
+		const XMVECTOR mk2 = XMVectorOrInt(zx, zy);
+
+		const XMVECTOR g1 = XMVectorReplicate(G3);
+		const XMVECTOR g2 = XMVectorReplicate(2.0f * G3);
+		const XMVECTOR g3 = XMVectorReplicate(3.0f * G3 - 1.0f);
+
+		const XMVECTOR x1 = XMVectorAdd(XMVectorSubtract(x0, XMVectorAndInt(mi1, g_XMOne)), g1);
+		const XMVECTOR y1 = XMVectorAdd(XMVectorSubtract(y0, XMVectorAndInt(mj1, g_XMOne)), g1);
+		const XMVECTOR z1 = XMVectorAdd(XMVectorSubtract(z0, XMVectorAndInt(mk1, g_XMOne)), g1);
+		const XMVECTOR x2 = XMVectorAdd(XMVectorSubtract(x0, XMVectorAndInt(mi2, g_XMOne)), g2);
+		const XMVECTOR y2 = XMVectorAdd(XMVectorSubtract(y0, XMVectorAndInt(mj2, g_XMOne)), g2);
+		const XMVECTOR z2 = XMVectorAdd(XMVectorSubtract(z0, XMVectorAndInt(mk2, g_XMOne)), g2);
+		const XMVECTOR x3 = XMVectorAdd(x0, g3);
+		const XMVECTOR y3 = XMVectorAdd(y0, g3);
+		const XMVECTOR z3 = XMVectorAdd(z0, g3);
+
+		const __m128i px = _mm_set1_epi32(PRIME_X);
+		const __m128i py = _mm_set1_epi32(PRIME_Y);
+		const __m128i pz = _mm_set1_epi32(PRIME_Z);
+
+		const __m128i i0 = Lattice(fi, PRIME_X);
+		const __m128i j0 = Lattice(fj, PRIME_Y);
+		const __m128i k0 = Lattice(fk, PRIME_Z);
+
+		const __m128i h0 = Hash(s, i0, j0, k0);
+		const __m128i h1 = Hash(s, _mm_add_epi32(i0, _mm_and_si128(_mm_castps_si128(mi1), px)),
+								   _mm_add_epi32(j0, _mm_and_si128(_mm_castps_si128(mj1), py)),
+								   _mm_add_epi32(k0, _mm_and_si128(_mm_castps_si128(mk1), pz)));
+		const __m128i h2 = Hash(s, _mm_add_epi32(i0, _mm_and_si128(_mm_castps_si128(mi2), px)),
+								   _mm_add_epi32(j0, _mm_and_si128(_mm_castps_si128(mj2), py)),
+								   _mm_add_epi32(k0, _mm_and_si128(_mm_castps_si128(mk2), pz)));
+		const __m128i h3 = Hash(s, _mm_add_epi32(i0, px), _mm_add_epi32(j0, py), _mm_add_epi32(k0, pz));
+
+		const XMVECTOR r = XMVectorReplicate(0.6f);
+
+		XMVECTOR d0 = XMVectorMultiplyAdd(x0, x0, XMVectorMultiplyAdd(y0, y0, XMVectorMultiply(z0, z0)));
+		XMVECTOR d1 = XMVectorMultiplyAdd(x1, x1, XMVectorMultiplyAdd(y1, y1, XMVectorMultiply(z1, z1)));
+		XMVECTOR d2 = XMVectorMultiplyAdd(x2, x2, XMVectorMultiplyAdd(y2, y2, XMVectorMultiply(z2, z2)));
+		XMVECTOR d3 = XMVectorMultiplyAdd(x3, x3, XMVectorMultiplyAdd(y3, y3, XMVectorMultiply(z3, z3)));
+
+		XMVECTOR n = XMVectorMultiply(Falloff(XMVectorSubtract(r, d0)), Grad3(h0, x0, y0, z0));
+		n = XMVectorMultiplyAdd(Falloff(XMVectorSubtract(r, d1)), Grad3(h1, x1, y1, z1), n);
+		n = XMVectorMultiplyAdd(Falloff(XMVectorSubtract(r, d2)), Grad3(h2, x2, y2, z2), n);
+		n = XMVectorMultiplyAdd(Falloff(XMVectorSubtract(r, d3)), Grad3(h3, x3, y3, z3), n);
+
+		return XMVectorScale(n, 32.0f);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Simplex4(FXMVECTOR x, FXMVECTOR y, FXMVECTOR z, GXMVECTOR w, const UINT Seed) noexcept
+	{
+		const float F4 = 0.30901699f;	// (sqrt(5) - 1) / 4
+		const float G4 = 0.13819660f;	// (5 - sqrt(5)) / 20
+
+		const __m128i s = _mm_set1_epi32((int)Seed);
+
+		// skew to the Cell
+		const XMVECTOR Skew = XMVectorScale(XMVectorAdd(XMVectorAdd(x, y), XMVectorAdd(z, w)), F4);
+		const XMVECTOR f[4] =
+		{
+			XMVectorFloor(XMVectorAdd(x, Skew)),
+			XMVectorFloor(XMVectorAdd(y, Skew)),
+			XMVectorFloor(XMVectorAdd(z, Skew)),
+			XMVectorFloor(XMVectorAdd(w, Skew))
+		};
+
+		const XMVECTOR Unskew = XMVectorScale(XMVectorAdd(XMVectorAdd(f[0], f[1]), XMVectorAdd(f[2], f[3])), G4);
+		const XMVECTOR t0[4] =
+		{
+			XMVectorSubtract(x, XMVectorSubtract(f[0], Unskew)),
+			XMVectorSubtract(y, XMVectorSubtract(f[1], Unskew)),
+			XMVectorSubtract(z, XMVectorSubtract(f[2], Unskew)),
+			XMVectorSubtract(w, XMVectorSubtract(f[3], Unskew))
+		};
+
+		// Simplex of the 24 in the Cell from the Rank of each Axis (0 .. 3)
+		XMVECTOR Rank[4] = { g_XMZero, g_XMZero, g_XMZero, g_XMZero };
+
+		for (UINT a = 0; a < 4; a++)
+		{
+			for (UINT b = a + 1; b < 4; b++)
+			{
+				const XMVECTOR m = XMVectorGreater(t0[a], t0[b]);
+
+				Rank[a] = XMVectorAdd(Rank[a], XMVectorAndInt(m, g_XMOne));
+				Rank[b] = XMVectorAdd(Rank[b], XMVectorAndCInt(g_XMOne, m));
+			}
+		}
+
+		const int Primes[4] = { PRIME_X, PRIME_Y, PRIME_Z, PRIME_W };
+
+		__m128i l0[4];
+
+		for (UINT a = 0; a < 4; a++)
+			l0[a] = Lattice(f[a], Primes[a]);
+
+		// Corner c (1 .. 3) steps along the Axes with Rank >= 4 - c, Corner 4 is (1, 1, 1, 1)
+		XMVECTOR n = g_XMZero;
+
+		for (UINT c = 0; c < 5; c++)
+		{
+			const XMVECTOR Offset = XMVectorReplicate((float)c * G4);
+			const XMVECTOR MinRank = XMVectorReplicate(4.0f - (float)c);
+
+			XMVECTOR t[4];
+			__m128i l[4];
+
+			for (UINT a = 0; a < 4; a++)
+			{
+				const XMVECTOR m = XMVectorGreaterOrEqual(Rank[a], MinRank);
+
+				t[a] = XMVectorAdd(XMVectorSubtract(t0[a], XMVectorAndInt(m, g_XMOne)), Offset);
+				l[a] = _mm_add_epi32(l0[a], _mm_and_si128(_mm_castps_si128(m), _mm_set1_epi32(Primes[a])));
+			}
+
+			const XMVECTOR d = XMVectorMultiplyAdd(t[0], t[0], XMVectorMultiplyAdd(t[1], t[1], XMVectorMultiplyAdd(t[2], t[2], XMVectorMultiply(t[3], t[3]))));
+
+			n = XMVectorMultiplyAdd(Falloff(XMVectorSubtract(XMVectorReplicate(0.6f), d)), Grad4(Hash(s, l[0], l[1], l[2], l[3]), t[0], t[1], t[2], t[3]), n);
+		}
+
+		return XMVectorScale(n, 27.0f);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Basis2(const Basis theBasis, FXMVECTOR x, FXMVECTOR y, const UINT Seed) noexcept
+	{
+		switch (theBasis)
+		{
+			case NOISE_VALUE:	return Value2(x, y, Seed);
+			case NOISE_PERLIN:	return Perlin2(x, y, Seed);
+			default:			return Simplex2(x, y, Seed);
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Basis3(const Basis theBasis, FXMVECTOR x, FXMVECTOR y, FXMVECTOR z, const UINT Seed) noexcept
+	{
+		switch (theBasis)
+		{
+			case NOISE_VALUE:	return Value3(x, y, z, Seed);
+			case NOISE_PERLIN:	return Perlin3(x, y, z, Seed);
+			default:			return Simplex3(x, y, z, Seed);
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Fractal2(const Params& theParams, FXMVECTOR x, FXMVECTOR y) noexcept
+	{
+		const UINT Octaves = (theParams.theFractal == FRACTAL_NONE) ? 1 : XMMax(theParams.Octaves, 1u);
+
+		XMVECTOR fx = XMVectorScale(x, theParams.Frequency);
+		XMVECTOR fy = XMVectorScale(y, theParams.Frequency);
+
+		XMVECTOR Sum = g_XMZero;
+		float Amplitude = 1.0f, Total = 0.0f;
+
+		for (UINT i = 0; i < Octaves; i++)
+		{
+			XMVECTOR n = Basis2(theParams.theBasis, fx, fy, theParams.Seed + i);
+
+			if (theParams.theFractal == FRACTAL_RIDGED)
+			{
+				n = XMVectorSubtract(g_XMOne, XMVectorAbs(n));
+				n = XMVectorMultiply(n, n);
+			}
+
+			Sum = XMVectorMultiplyAdd(n, XMVectorReplicate(Amplitude), Sum);
+			Total += Amplitude;
+			Amplitude *= theParams.Gain;
+
+			fx = XMVectorScale(fx, theParams.Lacunarity);
+			fy = XMVectorScale(fy, theParams.Lacunarity);
+		}
+
+		Sum = XMVectorScale(Sum, 1.0f / Total);
+
+		// Ridges in [0, 1] -> [-1, 1]
+		return (theParams.theFractal == FRACTAL_RIDGED) ? XMVectorMultiplyAdd(Sum, g_XMTwo, g_XMNegativeOne) : Sum;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::Fractal3(const Params& theParams, FXMVECTOR x, FXMVECTOR y, FXMVECTOR z) noexcept
+	{
+		const UINT Octaves = (theParams.theFractal == FRACTAL_NONE) ? 1 : XMMax(theParams.Octaves, 1u);
+
+		XMVECTOR fx = XMVectorScale(x, theParams.Frequency);
+		XMVECTOR fy = XMVectorScale(y, theParams.Frequency);
+		XMVECTOR fz = XMVectorScale(z, theParams.Frequency);
+
+		XMVECTOR Sum = g_XMZero;
+		float Amplitude = 1.0f, Total = 0.0f;
+
+		for (UINT i = 0; i < Octaves; i++)
+		{
+			XMVECTOR n = Basis3(theParams.theBasis, fx, fy, fz, theParams.Seed + i);
+
+			if (theParams.theFractal == FRACTAL_RIDGED)
+			{
+				n = XMVectorSubtract(g_XMOne, XMVectorAbs(n));
+				n = XMVectorMultiply(n, n);
+			}
+
+			Sum = XMVectorMultiplyAdd(n, XMVectorReplicate(Amplitude), Sum);
+			Total += Amplitude;
+			Amplitude *= theParams.Gain;
+
+			fx = XMVectorScale(fx, theParams.Lacunarity);
+			fy = XMVectorScale(fy, theParams.Lacunarity);
+			fz = XMVectorScale(fz, theParams.Lacunarity);
+		}
+
+		Sum = XMVectorScale(Sum, 1.0f / Total);
+
+		return (theParams.theFractal == FRACTAL_RIDGED) ? XMVectorMultiplyAdd(Sum, g_XMTwo, g_XMNegativeOne) : Sum;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Noise::LoadFloats(const float* p, const UINT Num) noexcept
+	{
+		if (Num >= 4)
+			return XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(p));
+
+		XMFLOAT4 v(0.0f, 0.0f, 0.0f, 0.0f);
+
+		for (UINT i = 0; i < Num; i++)
+			(&v.x)[i] = p[i];
+
+		return XMLoadFloat4(&v);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Noise::StoreFloats(FXMVECTOR v, float* p, const UINT Num) noexcept
+	{
+		if (Num >= 4)
+		{
+			XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(p), v);
+			return;
+		}
+
+		XMFLOAT4 r;
+		XMStoreFloat4(&r, v);
+
+		for (UINT i = 0; i < Num; i++)
+			p[i] = (&r.x)[i];
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Noise::Evaluate(const Params& theParams, const float* pX, const float* pY, const float* pZ, float* pOut, const UINT Count)
+	{
+		assert((pX && pY && pOut) || Count == 0);
+
+		// Jobs over Groups of 4 Points
+		ParallelFor((Count + 3) / 4, CHUNK_SIZE / 4, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT g = Begin; g < End; g++)
+			{
+				const UINT i = g * 4;
+				const UINT Num = XMMin(Count - i, 4u);
+
+				const XMVECTOR x = LoadFloats(&pX[i], Num);
+				const XMVECTOR y = LoadFloats(&pY[i], Num);
+
+				const XMVECTOR n = pZ ? Fractal3(theParams, x, y, LoadFloats(&pZ[i], Num)) : Fractal2(theParams, x, y);
+
+				StoreFloats(n, &pOut[i], Num);
+			}
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Noise::EvaluateRow(const Params& theParams, const float x0, FXMVECTOR y, FXMVECTOR z, const bool Is3D,
+												  const float Step, const UINT Width, float* pOut) noexcept
+	{
+		// x-Coordinates in the Register, y and z are constant over the Row
+		const XMVECTOR Lanes = XMVectorScale(XMVectorSet(0.0f, 1.0f, 2.0f, 3.0f), Step);
+
+		for (UINT i = 0; i < Width; i += 4)
+		{
+			const XMVECTOR x = XMVectorAdd(XMVectorReplicate(x0 + (float)i * Step), Lanes);
+
+			const XMVECTOR n = Is3D ? Fractal3(theParams, x, y, z) : Fractal2(theParams, x, y);
+
+			StoreFloats(n, &pOut[i], XMMin(Width - i, 4u));
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Noise::EvaluateGrid2D(const Params& theParams, const float x0, const float y0, const float Step,
+													 const UINT Width, const UINT Height, float* pOut)
+	{
+		assert(pOut || Width == 0 || Height == 0);
+
+		if (Width == 0)
+			return;
+
+		// Jobs over Rows
+		ParallelFor(Height, XMMax(CHUNK_SIZE / Width, 1u), [&](const UINT Begin, const UINT End)
+		{
+			for (UINT Row = Begin; Row < End; Row++)
+				EvaluateRow(theParams, x0, XMVectorReplicate(y0 + (float)Row * Step), g_XMZero, false, Step, Width, &pOut[(size_t)Row * Width]);
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Noise::EvaluateGrid3D(const Params& theParams, const float x0, const float y0, const float z0, const float Step,
+													 const UINT Width, const UINT Height, const UINT Depth, float* pOut)
+	{
+		assert(pOut || Width == 0 || Height == 0 || Depth == 0);
+
+		const size_t NumRows = (size_t)Height * Depth;
+
+		if (Width == 0 || NumRows == 0)
+			return;
+
+		// ParallelFor counts in UINT
+		assert(NumRows <= UINT_MAX);
+
+		// Jobs over the Rows of all Slices
+		ParallelFor((UINT)NumRows, XMMax(CHUNK_SIZE / Width, 1u), [&](const UINT Begin, const UINT End)
+		{
+			for (UINT Row = Begin; Row < End; Row++)
+			{
+				const XMVECTOR y = XMVectorReplicate(y0 + (float)(Row % Height) * Step);
+				const XMVECTOR z = XMVectorReplicate(z0 + (float)(Row / Height) * Step);
+
+				EvaluateRow(theParams, x0, y, z, true, Step, Width, &pOut[(size_t)Row * Width]);
+			}
+		});
+	}
+
+}// end of Namespace TurboMath
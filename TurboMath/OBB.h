@@ -65,11 +65,23 @@ namespace TurboMath
 		//-----------------------------------------------------------------------------
 		void XM_CALLCONV ComputeBoundingOBBFromPoints( UINT Count, const XMFLOAT3* pPoints, UINT Stride );
 
+		//-----------------------------------------------------------------------------
+		// Tighter Box from a Convex Hull : every Face-Normal (with its first Edge)
+		// is tried as Orientation, the Box with the smallest Volume is kept.
+		//-----------------------------------------------------------------------------
+		void XM_CALLCONV ComputeBoundingOBBFromHull( const ConvexHull& Hull );
+
 		//-----------------------------------------------------------------------------
 		// Bounding volume transforms.
 		//-----------------------------------------------------------------------------
 		void XM_CALLCONV Transform(const float Scale, const Quat& Rotation,const Vector4& Translation );
 
+		//-----------------------------------------------------------------------------
+		// Closest point on (or in) the box and squared distance to a point.
+		//-----------------------------------------------------------------------------
+		const Vector4 XM_CALLCONV ClosestPoint(const Vector4& Point) const noexcept;
+		const float XM_CALLCONV DistanceSq(const Vector4& Point) const noexcept;
+
 		//-----------------------------------------------------------------------------
 		// Intersection testing routines.
 		//-----------------------------------------------------------------------------
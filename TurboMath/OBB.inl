@@ -180,19 +180,19 @@ namespace TurboMath
 		Orientation = XMQuaternionNormalize( Orientation );
 
 		// Rebuild the rotation matrix from the quaternion.
-		R = XMMatrixRotationQuaternion( Orientation );
+		const Matrix3 Rotation = Matrix3( Quat( Orientation ) );
 
 		// Build the rotation into the rotated space.
-		const XMMATRIX InverseR = XMMatrixTranspose( R );
+		const Matrix3 InverseR = Matrix3::Transpose( Rotation );
 
 		// Find the minimum OBB using the eigenvectors as the axes.
 		XMVECTOR vMin, vMax;
 
-		vMin = vMax = XMVector3TransformNormal( XMLoadFloat3( pPoints ), InverseR );
+		vMin = vMax = InverseR.Transform( XMLoadFloat3( pPoints ) );
 
 		for( UINT i = 1; i < Count; i++ )
 		{
-			const XMVECTOR Point = XMVector3TransformNormal( XMLoadFloat3( ( XMFLOAT3* )( ( char* )pPoints + i * Stride ) ), InverseR );
+			const XMVECTOR Point = InverseR.Transform( XMLoadFloat3( ( XMFLOAT3* )( ( char* )pPoints + i * Stride ) ) );
 
 			vMin = XMVectorMin( vMin, Point );
 			vMax = XMVectorMax( vMax, Point );
@@ -200,7 +200,7 @@ namespace TurboMath
 
 		// Rotate the center into world space.
 		XMVECTOR Center = XMVectorMultiply(XMVectorAdd( vMin , vMax ) , XMVectorReplicate(0.5f));
-		Center = XMVector3TransformNormal( Center, R );
+		Center = Rotation.Transform( Center );
 
 		// Store center, extents, and orientation.
 		XMStoreFloat3( (XMFLOAT3*)&this->Center.GetRaw(), Center );
@@ -210,6 +210,77 @@ namespace TurboMath
 		return;
 	}
 
+	//-----------------------------------------------------------------------------
+	// Find the Box of the Hull-Vertices with the smallest Volume over the
+	// Orientations given by the Faces (Axes : first Edge, Normal x Edge, Normal).
+	//-----------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV OBB::ComputeBoundingOBBFromHull( const ConvexHull& Hull )
+	{
+		assert( !Hull.IsEmpty() );
+
+		const Vector4* pVertices = Hull.GetVertices();
+		const HullFace* pFaces = Hull.GetFaces();
+		const HullHalfEdge* pEdges = Hull.GetEdges();
+		const UINT NumVertices = Hull.GetNumVertices();
+		const UINT NumFaces = Hull.GetNumFaces();
+
+		float BestVolume = FLT_MAX;
+		XMMATRIX BestR = XMMatrixIdentity();
+		XMVECTOR BestMin = XMVectorZero();
+		XMVECTOR BestMax = XMVectorZero();
+
+		for( UINT f = 0; f < NumFaces; f++ )
+		{
+			const HullHalfEdge& Edge = pEdges[pFaces[f].Edge];
+
+			const XMVECTOR N = XMVector3Normalize( XMLoadFloat4( &pFaces[f].Plane ) );
+			const XMVECTOR U = XMVector3Normalize( XMVectorSubtract( pVertices[pEdges[Edge.Next].Vertex], pVertices[Edge.Vertex] ) );
+			const XMVECTOR W = XMVector3Cross( N, U );
+
+			// Rows are the Box-Axes (right handed : U x W = N)
+			XMMATRIX R;
+
+			R.r[0] = XMVectorSetW( U, 0.f );
+			R.r[1] = XMVectorSetW( W, 0.f );
+			R.r[2] = XMVectorSetW( N, 0.f );
+			R.r[3] = XMVectorSetBinaryConstant( 0, 0, 0, 1 );
+
+			const XMMATRIX InverseR = XMMatrixTranspose( R );
+
+			XMVECTOR vMin, vMax;
+
+			vMin = vMax = XMVector3TransformNormal( pVertices[0], InverseR );
+
+			for( UINT i = 1; i < NumVertices; i++ )
+			{
+				const XMVECTOR Point = XMVector3TransformNormal( pVertices[i], InverseR );
+
+				vMin = XMVectorMin( vMin, Point );
+				vMax = XMVectorMax( vMax, Point );
+			}
+
+			const XMVECTOR Size = XMVectorSubtract( vMax, vMin );
+			const float Volume = XMVectorGetX( Size ) * XMVectorGetY( Size ) * XMVectorGetZ( Size );
+
+			if( Volume < BestVolume )
+			{
+				BestVolume = Volume;
+				BestR = R;
+				BestMin = vMin;
+				BestMax = vMax;
+			}
+		}
+
+		const XMVECTOR Orientation = XMQuaternionNormalize( XMQuaternionRotationMatrix( BestR ) );
+
+		// Rotate the center into world space.
+		const XMVECTOR Center = XMVector3TransformNormal( XMVectorMultiply( XMVectorAdd( BestMin, BestMax ), XMVectorReplicate( 0.5f ) ), BestR );
+
+		this->Center = XMVectorSetW( Center, 0.f );
+		this->Extents = XMVectorSetW( XMVectorMultiply( XMVectorSubtract( BestMax, BestMin ), XMVectorReplicate( 0.5f ) ), 0.f );
+		this->Orientation = Orientation;
+	}
+
 	//-----------------------------------------------------------------------------
 	// Transform an oriented box by an angle preserving transform.
 	//-----------------------------------------------------------------------------
@@ -242,6 +313,24 @@ namespace TurboMath
 		return;
 	}
 
+	//-----------------------------------------------------------------------------
+	// Closest point on (or in) the oriented box.
+	//-----------------------------------------------------------------------------
+	XM_INLINE const Vector4 XM_CALLCONV OBB::ClosestPoint( const Vector4& Point ) const noexcept
+	{
+		return ClosestPointOnOBB( Point, Center, Extents, Orientation.Get() );
+	}
+
+	//-----------------------------------------------------------------------------
+	// Squared distance of a point to the oriented box (0 inside).
+	//-----------------------------------------------------------------------------
+	XM_INLINE const float XM_CALLCONV OBB::DistanceSq( const Vector4& Point ) const noexcept
+	{
+		const XMVECTOR Closest = ClosestPointOnOBB( Point, Center, Extents, Orientation.Get() );
+
+		return XMVectorGetX( XMVector3LengthSq( XMVectorSubtract(Point.GetRaw(), Closest) ) );
+	}
+
 	//-----------------------------------------------------------------------------
 	// Point in oriented box test.
 	//-----------------------------------------------------------------------------
@@ -275,7 +364,7 @@ namespace TurboMath
 		assert( Quat::IsUnit(B_quat) );
 
 		const XMVECTOR Q = XMQuaternionMultiply( A_quat, XMQuaternionConjugate( B_quat ) );
-		XMMATRIX R = XMMatrixRotationQuaternion( Q );
+		const Matrix3 R = Matrix3( Quat( Q ) );
 
 		// Compute the translation of B relative to A.
 		const XMVECTOR A_cent = XMLoadFloat3( (XMFLOAT3*)&this->Center.GetRaw() );
@@ -300,16 +389,16 @@ namespace TurboMath
 		const XMVECTOR h_B = XMLoadFloat3( (XMFLOAT3*)&pVolumeB->Extents.GetRaw() );
 
 		// Rows. Note R[0,1,2]X.w = 0.
-		const XMVECTOR R0X = R.r[0];
-		const XMVECTOR R1X = R.r[1];
-		const XMVECTOR R2X = R.r[2];
+		const XMVECTOR R0X = R.GetRow0();
+		const XMVECTOR R1X = R.GetRow1();
+		const XMVECTOR R2X = R.GetRow2();
 
-		R = XMMatrixTranspose( R );
+		const Matrix3 RT = Matrix3::Transpose( R );
 
 		// Columns. Note RX[0,1,2].w = 0.
-		const XMVECTOR RX0 = R.r[0];
-		const XMVECTOR RX1 = R.r[1];
-		const XMVECTOR RX2 = R.r[2];
+		const XMVECTOR RX0 = RT.GetRow0();
+		const XMVECTOR RX1 = RT.GetRow1();
+		const XMVECTOR RX2 = RT.GetRow2();
 
 		// Absolute value of rows.
 		const XMVECTOR AR0X = XMVectorAbs( R0X );
@@ -489,19 +578,19 @@ namespace TurboMath
 		assert( Quat::IsUnit( Orientation ) );
 
 		// Get the boxes normalized side directions.
-		const XMMATRIX R = XMMatrixRotationQuaternion( Orientation );
+		const Matrix3 R = Matrix3( Quat( Orientation ) );
 
 		// Adjust ray origin to be relative to center of the box.
 		const XMVECTOR TOrigin = XMVectorSubtract(Center, theRay.GetStartPoint().GetRaw());
 
 		// Compute the dot product againt each axis of the box.
-		XMVECTOR AxisDotOrigin = XMVector3Dot( R.r[0], TOrigin );
-		AxisDotOrigin = XMVectorSelect( AxisDotOrigin, XMVector3Dot( R.r[1], TOrigin ), SelectY );
-		AxisDotOrigin = XMVectorSelect( AxisDotOrigin, XMVector3Dot( R.r[2], TOrigin ), SelectZ );
+		XMVECTOR AxisDotOrigin = XMVector3Dot( R.GetRow0(), TOrigin );
+		AxisDotOrigin = XMVectorSelect( AxisDotOrigin, XMVector3Dot( R.GetRow1(), TOrigin ), SelectY );
+		AxisDotOrigin = XMVectorSelect( AxisDotOrigin, XMVector3Dot( R.GetRow2(), TOrigin ), SelectZ );
 
-		XMVECTOR AxisDotDirection = XMVector3Dot( R.r[0], theRay.GetDirection() );
-		AxisDotDirection = XMVectorSelect( AxisDotDirection, XMVector3Dot( R.r[1], theRay.GetDirection() ), SelectY );
-		AxisDotDirection = XMVectorSelect( AxisDotDirection, XMVector3Dot( R.r[2], theRay.GetDirection() ), SelectZ );
+		XMVECTOR AxisDotDirection = XMVector3Dot( R.GetRow0(), theRay.GetDirection() );
+		AxisDotDirection = XMVectorSelect( AxisDotDirection, XMVector3Dot( R.GetRow1(), theRay.GetDirection() ), SelectY );
+		AxisDotDirection = XMVectorSelect( AxisDotDirection, XMVector3Dot( R.GetRow2(), theRay.GetDirection() ), SelectZ );
 
 		// if (fabs(AxisDotDirection) <= Epsilon) the ray is nearly parallel to the slab.
 		const XMVECTOR IsParallel = XMVectorLessOrEqual( XMVectorAbs( AxisDotDirection ), Epsilon );
@@ -649,33 +738,33 @@ namespace TurboMath
 		Center = XMVectorInsert( Center, XMVectorSplatOne(), 0, 0, 0, 0, 1 );
 
 		// Build the 3x3 rotation matrix that defines the box axes.
-		const XMMATRIX R = XMMatrixRotationQuaternion( BoxOrientation );
+		const Matrix3 R = Matrix3( Quat( BoxOrientation ) );
 
 		XMVECTOR Outside, Inside;
 
 		// Test against each plane.
-		FastIntersectOrientedBoxPlane( Center, Extents, R.r[0], R.r[1], R.r[2], Plane0.Get(), Outside, Inside );
+		FastIntersectOrientedBoxPlane( Center, Extents, R.GetRow0(), R.GetRow1(), R.GetRow2(), Plane0.Get(), Outside, Inside );
 
 		XMVECTOR AnyOutside = Outside;
 		XMVECTOR AllInside = Inside;
 
-		FastIntersectOrientedBoxPlane( Center, Extents, R.r[0], R.r[1], R.r[2], Plane1.Get(), Outside, Inside );
+		FastIntersectOrientedBoxPlane( Center, Extents, R.GetRow0(), R.GetRow1(), R.GetRow2(), Plane1.Get(), Outside, Inside );
 		AnyOutside = XMVectorOrInt( AnyOutside, Outside );
 		AllInside = XMVectorAndInt( AllInside, Inside );
 
-		FastIntersectOrientedBoxPlane( Center, Extents, R.r[0], R.r[1], R.r[2], Plane2.Get(), Outside, Inside );
+		FastIntersectOrientedBoxPlane( Center, Extents, R.GetRow0(), R.GetRow1(), R.GetRow2(), Plane2.Get(), Outside, Inside );
 		AnyOutside = XMVectorOrInt( AnyOutside, Outside );
 		AllInside = XMVectorAndInt( AllInside, Inside );
 
-		FastIntersectOrientedBoxPlane( Center, Extents, R.r[0], R.r[1], R.r[2], Plane3.Get(), Outside, Inside );
+		FastIntersectOrientedBoxPlane( Center, Extents, R.GetRow0(), R.GetRow1(), R.GetRow2(), Plane3.Get(), Outside, Inside );
 		AnyOutside = XMVectorOrInt( AnyOutside, Outside );
 		AllInside = XMVectorAndInt( AllInside, Inside );
 
-		FastIntersectOrientedBoxPlane( Center, Extents, R.r[0], R.r[1], R.r[2], Plane4.Get(), Outside, Inside );
+		FastIntersectOrientedBoxPlane( Center, Extents, R.GetRow0(), R.GetRow1(), R.GetRow2(), Plane4.Get(), Outside, Inside );
 		AnyOutside = XMVectorOrInt( AnyOutside, Outside );
 		AllInside = XMVectorAndInt( AllInside, Inside );
 
-		FastIntersectOrientedBoxPlane( Center, Extents, R.r[0], R.r[1], R.r[2], Plane5.Get(), Outside, Inside );
+		FastIntersectOrientedBoxPlane( Center, Extents, R.GetRow0(), R.GetRow1(), R.GetRow2(), Plane5.Get(), Outside, Inside );
 		AnyOutside = XMVectorOrInt( AnyOutside, Outside );
 		AllInside = XMVectorAndInt( AllInside, Inside );
 
@@ -712,10 +801,10 @@ namespace TurboMath
 		Center = XMVectorInsert( Center, XMVectorSplatOne(), 0, 0, 0, 0, 1);
 
 		// Build the 3x3 rotation matrix that defines the box axes.
-		const XMMATRIX R = XMMatrixRotationQuaternion( BoxOrientation );
+		const Matrix3 R = Matrix3( Quat( BoxOrientation ) );
 
 		XMVECTOR Outside, Inside;
-		FastIntersectOrientedBoxPlane( Center, Extents, R.r[0], R.r[1], R.r[2], Plane.Get(), Outside, Inside );
+		FastIntersectOrientedBoxPlane( Center, Extents, R.GetRow0(), R.GetRow1(), R.GetRow2(), Plane.Get(), Outside, Inside );
 
 		// If the box is outside any plane it is outside.
 		if ( XMVector4EqualInt( Outside, XMVectorTrueInt() ) )
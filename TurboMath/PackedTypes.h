@@ -0,0 +1,121 @@
+// -------------------------------------------------------------------
+// File			:	PackedTypes
+//
+// Project		:	TurboMath
+//
+// Description	:	Half-Precision and quantized Storage-Types with Bulk-Encode/Decode
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_PACKEDTYPES_H_
+#define _TURBOMATH_PACKEDTYPES_H_
+
+namespace TurboMath
+{
+
+	//-----------------------------------------------------------------------------
+	// Storage-Types (only for Buffers - the Math is done with Vector2/3/4 and Quat)
+	//-----------------------------------------------------------------------------
+	typedef PackedVector::XMHALF2	Half2;			// 4 Bytes  : UVs
+	typedef PackedVector::XMHALF4	Half4;			// 8 Bytes  : Positions, Colors
+	typedef PackedVector::XMSHORTN4	SNorm16x4;		// 8 Bytes  : [-1, 1] with 16 Bit (Tangents with Sign in w)
+	typedef PackedVector::XMXDECN4	XDecN4;			// 4 Bytes  : x, y, z in [-1, 1] with 10 Bit, w in [0, 1] with 2 Bit
+
+	/// unit Normal with octahedral Encoding (2 x 16 Bit, 4 Bytes)
+	struct OctNormal
+	{
+		int16_t		x;
+		int16_t		y;
+	};
+
+	/// unit Quaternion with "smallest three" Encoding (4 Bytes) : Index of the
+	/// largest Component in Bit 30-31, the other Components with 10 Bit each
+	struct PackedQuat
+	{
+		uint32_t	v;
+	};
+
+	//-----------------------------------------------------------------------------
+	// Encode / Decode of single Values and whole Arrays. The Arrays may not
+	// overlap. Half-Precision uses the Stream-Conversion of DirectXMath (F16C
+	// if enabled). The other Array-Functions convert a Register of packed Data
+	// per Step : SNorm16 2 Vectors, XDecN4, Octahedral and Quats 4 Values,
+	// transposed to SoA and encoded without Branches (the Rest of the Array
+	// uses the single Functions).
+	//-----------------------------------------------------------------------------
+	class Packing
+	{
+	public:
+
+		//-----------------------------------------------------------------------------
+		// single Values
+		//-----------------------------------------------------------------------------
+
+		/// octahedral Encoding of a unit Normal
+		static OctNormal	XM_CALLCONV EncodeOctahedral(FXMVECTOR n) noexcept;
+
+		/// unit Normal of an octahedral Encoding
+		static XMVECTOR		XM_CALLCONV DecodeOctahedral(const OctNormal& Oct) noexcept;
+
+		/// "smallest three" Encoding of a unit Quaternion (max. Error ~ 0.001 per Component)
+		static PackedQuat	XM_CALLCONV EncodeQuat(FXMVECTOR q) noexcept;
+
+		/// unit Quaternion of a "smallest three" Encoding
+		static XMVECTOR		XM_CALLCONV DecodeQuat(const PackedQuat& Packed) noexcept;
+
+		//-----------------------------------------------------------------------------
+		// Arrays
+		//-----------------------------------------------------------------------------
+
+		static void			XM_CALLCONV EncodeHalf2(const Vector2* pIn, Half2* pOut, const UINT Count) noexcept;
+		static void			XM_CALLCONV DecodeHalf2(const Half2* pIn, Vector2* pOut, const UINT Count) noexcept;
+
+		static void			XM_CALLCONV EncodeHalf4(const Vector4* pIn, Half4* pOut, const UINT Count) noexcept;
+		static void			XM_CALLCONV DecodeHalf4(const Half4* pIn, Vector4* pOut, const UINT Count) noexcept;
+
+		static void			XM_CALLCONV EncodeSNorm16(const Vector4* pIn, SNorm16x4* pOut, const UINT Count) noexcept;
+		static void			XM_CALLCONV DecodeSNorm16(const SNorm16x4* pIn, Vector4* pOut, const UINT Count) noexcept;
+
+		static void			XM_CALLCONV EncodeXDecN4(const Vector4* pIn, XDecN4* pOut, const UINT Count) noexcept;
+		static void			XM_CALLCONV DecodeXDecN4(const XDecN4* pIn, Vector4* pOut, const UINT Count) noexcept;
+
+		static void			XM_CALLCONV EncodeOctahedral(const Vector3* pIn, OctNormal* pOut, const UINT Count) noexcept;
+		static void			XM_CALLCONV DecodeOctahedral(const OctNormal* pIn, Vector3* pOut, const UINT Count) noexcept;
+
+		static void			XM_CALLCONV EncodeQuats(const Quat* pIn, PackedQuat* pOut, const UINT Count) noexcept;
+		static void			XM_CALLCONV DecodeQuats(const PackedQuat* pIn, Quat* pOut, const UINT Count) noexcept;
+
+		/// Scale of the Quaternion-Components : a = (c / QUAT_MAX * 2 - 1) * QUAT_RANGE
+		static constexpr UINT	QUAT_MAX = 1023;
+		static constexpr float	QUAT_RANGE = 0.70710678f;
+
+	protected:
+
+		/// "smallest three" Encoding of 4 unit Quaternions in SoA (one PackedQuat per Lane)
+		static __m128i		XM_CALLCONV EncodeQuatLanes(FXMVECTOR x, FXMVECTOR y, FXMVECTOR z, GXMVECTOR w) noexcept;
+		static void			XM_CALLCONV DecodeQuatLanes(const __m128i Packed, XMVECTOR& x, XMVECTOR& y, XMVECTOR& z, XMVECTOR& w) noexcept;
+
+		/// octahedral Encoding of 4 unit Normals in SoA (one OctNormal per Lane)
+		static __m128i		XM_CALLCONV EncodeOctahedralLanes(FXMVECTOR x, FXMVECTOR y, FXMVECTOR z) noexcept;
+		static void			XM_CALLCONV DecodeOctahedralLanes(const __m128i Packed, XMVECTOR& x, XMVECTOR& y, XMVECTOR& z) noexcept;
+	};
+
+}; // end of namespace
+
+#endif
@@ -0,0 +1,480 @@
+// -------------------------------------------------------------------
+// File			:	PackedTypes
+//
+// Project		:	TurboMath
+//
+// Description	:	Half-Precision and quantized Storage-Types with Bulk-Encode/Decode
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+namespace TurboMath
+{
+	//------------------------------------------------------------------------------
+	XM_INLINE OctNormal XM_CALLCONV Packing::EncodeOctahedral(FXMVECTOR n) noexcept
+	{
+		// Projection onto the Octahedron |x| + |y| + |z| = 1
+		XMVECTOR p = XMVectorDivide(n, XMVector3Dot(XMVectorAbs(n), g_XMOne));
+
+		// lower Hemisphere : fold the Triangles over the Diagonals
+		const XMVECTOR Sign = XMVectorSelect(g_XMNegativeOne, g_XMOne, XMVectorGreaterOrEqual(p, g_XMZero));
+		const XMVECTOR Fold = XMVectorMultiply(XMVectorSubtract(g_XMOne, XMVectorAbs(XMVectorSwizzle<1, 0, 2, 3>(p))), Sign);
+
+		p = XMVectorSelect(p, Fold, XMVectorLess(XMVectorSplatZ(n), g_XMZero));
+
+		PackedVector::XMSHORTN2 s;
+		PackedVector::XMStoreShortN2(&s, p);
+
+		OctNormal Oct;
+		Oct.x = s.x;
+		Oct.y = s.y;
+
+		return Oct;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Packing::DecodeOctahedral(const OctNormal& Oct) noexcept
+	{
+		const PackedVector::XMSHORTN2 s(Oct.x, Oct.y);
+
+		XMVECTOR v = PackedVector::XMLoadShortN2(&s);
+
+		// z = 1 - |x| - |y|, negative z is the folded lower Hemisphere
+		const XMVECTOR Abs = XMVectorAbs(v);
+		const XMVECTOR z = XMVectorSubtract(g_XMOne, XMVectorAdd(XMVectorSplatX(Abs), XMVectorSplatY(Abs)));
+		const XMVECTOR t = XMVectorMax(XMVectorNegate(z), g_XMZero);
+
+		XMVECTOR Offset = XMVectorSelect(t, XMVectorNegate(t), XMVectorGreaterOrEqual(v, g_XMZero));
+		Offset = XMVectorSelect(g_XMZero, Offset, g_XMSelect1100);
+
+		v = XMVectorSelect(z, XMVectorAdd(v, Offset), g_XMSelect1100);
+
+		return XMVectorSelect(g_XMZero, XMVector3Normalize(v), g_XMSelect1110);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE PackedQuat XM_CALLCONV Packing::EncodeQuat(FXMVECTOR q) noexcept
+	{
+		PackedQuat Packed;
+		Packed.v = (uint32_t)_mm_cvtsi128_si32(EncodeQuatLanes(XMVectorSplatX(q), XMVectorSplatY(q), XMVectorSplatZ(q), XMVectorSplatW(q)));
+
+		return Packed;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV Packing::DecodeQuat(const PackedQuat& Packed) noexcept
+	{
+		XMVECTOR x, y, z, w;
+		DecodeQuatLanes(_mm_set1_epi32((int)Packed.v), x, y, z, w);
+
+		// all Lanes are equal : (x, y, z, w) from the first ones
+		return XMVectorPermute<0, 1, 4, 5>(XMVectorMergeXY(x, y), XMVectorMergeXY(z, w));
+	}
+
+	//------------------------------------------------------------------------------
+	// The Index of the largest Component (the first one on Ties) and the Order
+	// of the 3 others are Selects, the Components are quantized like
+	// floor((a * Scale + 0.5) * QUAT_MAX + 0.5).
+	//------------------------------------------------------------------------------
+	XM_INLINE __m128i XM_CALLCONV Packing::EncodeQuatLanes(FXMVECTOR x, FXMVECTOR y, FXMVECTOR z, GXMVECTOR w) noexcept
+	{
+		const XMVECTOR ax = XMVectorAbs(x);
+		const XMVECTOR ay = XMVectorAbs(y);
+		const XMVECTOR az = XMVectorAbs(z);
+		const XMVECTOR MaxAbs = XMVectorMax(XMVectorMax(ax, ay), XMVectorMax(az, XMVectorAbs(w)));
+
+		XMVECTOR Index = XMVectorReplicate(3.0f);
+		XMVECTOR Largest = w;
+		XMVECTOR Mask = XMVectorEqual(az, MaxAbs);
+
+		Index = XMVectorSelect(Index, XMVectorReplicate(2.0f), Mask);
+		Largest = XMVectorSelect(Largest, z, Mask);
+
+		Mask = XMVectorEqual(ay, MaxAbs);
+		Index = XMVectorSelect(Index, g_XMOne, Mask);
+		Largest = XMVectorSelect(Largest, y, Mask);
+
+		Mask = XMVectorEqual(ax, MaxAbs);
+		Index = XMVectorSelect(Index, g_XMZero, Mask);
+		Largest = XMVectorSelect(Largest, x, Mask);
+
+		// the 3 small Components in their Order
+		const XMVECTOR a0 = XMVectorSelect(x, y, XMVectorEqual(Index, g_XMZero));
+		const XMVECTOR a1 = XMVectorSelect(y, z, XMVectorLessOrEqual(Index, g_XMOne));
+		const XMVECTOR a2 = XMVectorSelect(z, w, XMVectorLessOrEqual(Index, XMVectorReplicate(2.0f)));
+
+		// q and -q are the same Rotation : the largest Component is always positive
+		const XMVECTOR Scale = XMVectorSelect(XMVectorReplicate(0.5f / QUAT_RANGE), XMVectorReplicate(-0.5f / QUAT_RANGE), XMVectorLess(Largest, g_XMZero));
+		const XMVECTOR QuatMax = XMVectorReplicate((float)QUAT_MAX);
+
+		const XMVECTOR c0 = XMVectorFloor(XMVectorMultiplyAdd(XMVectorMultiplyAdd(a0, Scale, g_XMOneHalf), QuatMax, g_XMOneHalf));
+		const XMVECTOR c1 = XMVectorFloor(XMVectorMultiplyAdd(XMVectorMultiplyAdd(a1, Scale, g_XMOneHalf), QuatMax, g_XMOneHalf));
+		const XMVECTOR c2 = XMVectorFloor(XMVectorMultiplyAdd(XMVectorMultiplyAdd(a2, Scale, g_XMOneHalf), QuatMax, g_XMOneHalf));
+
+		__m128i Packed = _mm_slli_epi32(_mm_cvttps_epi32(Index), 30);
+
+		Packed = _mm_or_si128(Packed, _mm_slli_epi32(_mm_cvttps_epi32(XMVectorClamp(c0, g_XMZero, QuatMax)), 20));
+		Packed = _mm_or_si128(Packed, _mm_slli_epi32(_mm_cvttps_epi32(XMVectorClamp(c1, g_XMZero, QuatMax)), 10));
+		Packed = _mm_or_si128(Packed, _mm_cvttps_epi32(XMVectorClamp(c2, g_XMZero, QuatMax)));
+
+		return Packed;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Packing::DecodeQuatLanes(const __m128i Packed, XMVECTOR& x, XMVECTOR& y, XMVECTOR& z, XMVECTOR& w) noexcept
+	{
+		const __m128i Bits = _mm_set1_epi32((int)QUAT_MAX);
+		const XMVECTOR Scale = XMVectorReplicate(2.0f * QUAT_RANGE / (float)QUAT_MAX);
+		const XMVECTOR Offset = XMVectorReplicate(-QUAT_RANGE);
+
+		// the 3 small Components
+		const XMVECTOR a0 = XMVectorMultiplyAdd(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(Packed, 20), Bits)), Scale, Offset);
+		const XMVECTOR a1 = XMVectorMultiplyAdd(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(Packed, 10), Bits)), Scale, Offset);
+		const XMVECTOR a2 = XMVectorMultiplyAdd(_mm_cvtepi32_ps(_mm_and_si128(Packed, Bits)), Scale, Offset);
+
+		// the largest from the Unit-Length
+		const XMVECTOR LengthSq = XMVectorMultiplyAdd(a0, a0, XMVectorMultiplyAdd(a1, a1, XMVectorMultiply(a2, a2)));
+		const XMVECTOR a = XMVectorSqrt(XMVectorMax(XMVectorSubtract(g_XMOne, LengthSq), g_XMZero));
+
+		// put it in at its Index
+		const XMVECTOR Index = _mm_cvtepi32_ps(_mm_srli_epi32(Packed, 30));
+		const XMVECTOR Two = XMVectorReplicate(2.0f);
+
+		x = XMVectorSelect(a0, a, XMVectorEqual(Index, g_XMZero));
+		y = XMVectorSelect(XMVectorSelect(a1, a, XMVectorEqual(Index, g_XMOne)), a0, XMVectorEqual(Index, g_XMZero));
+		z = XMVectorSelect(XMVectorSelect(a2, a, XMVectorEqual(Index, Two)), a1, XMVectorLess(Index, Two));
+		w = XMVectorSelect(a2, a, XMVectorEqual(Index, XMVectorReplicate(3.0f)));
+
+		// normalize
+		const XMVECTOR InvLength = XMVectorReciprocalSqrt(XMVectorMultiplyAdd(x, x, XMVectorMultiplyAdd(y, y, XMVectorMultiplyAdd(z, z, XMVectorMultiply(w, w)))));
+
+		x = XMVectorMultiply(x, InvLength);
+		y = XMVectorMultiply(y, InvLength);
+		z = XMVectorMultiply(z, InvLength);
+		w = XMVectorMultiply(w, InvLength);
+	}
+
+	//------------------------------------------------------------------------------
+	// Like EncodeOctahedral, the Components are stored with 16 Bit (x in the low,
+	// y in the high Half of each Lane) like XMStoreShortN2.
+	//------------------------------------------------------------------------------
+	XM_INLINE __m128i XM_CALLCONV Packing::EncodeOctahedralLanes(FXMVECTOR x, FXMVECTOR y, FXMVECTOR z) noexcept
+	{
+		// Projection onto the Octahedron |x| + |y| + |z| = 1
+		const XMVECTOR Length = XMVectorAdd(XMVectorAdd(XMVectorAbs(x), XMVectorAbs(y)), XMVectorAbs(z));
+
+		XMVECTOR px = XMVectorDivide(x, Length);
+		XMVECTOR py = XMVectorDivide(y, Length);
+
+		// lower Hemisphere : fold the Triangles over the Diagonals
+		const XMVECTOR SignX = XMVectorSelect(g_XMNegativeOne, g_XMOne, XMVectorGreaterOrEqual(px, g_XMZero));
+		const XMVECTOR SignY = XMVectorSelect(g_XMNegativeOne, g_XMOne, XMVectorGreaterOrEqual(py, g_XMZero));
+		const XMVECTOR Lower = XMVectorLess(z, g_XMZero);
+
+		const XMVECTOR FoldX = XMVectorMultiply(XMVectorSubtract(g_XMOne, XMVectorAbs(py)), SignX);
+		const XMVECTOR FoldY = XMVectorMultiply(XMVectorSubtract(g_XMOne, XMVectorAbs(px)), SignY);
+
+		px = XMVectorSelect(px, FoldX, Lower);
+		py = XMVectorSelect(py, FoldY, Lower);
+
+		const XMVECTOR Scale = XMVectorReplicate(32767.0f);
+
+		const __m128i ix = _mm_cvtps_epi32(XMVectorMultiply(XMVectorClamp(px, g_XMNegativeOne, g_XMOne), Scale));
+		const __m128i iy = _mm_cvtps_epi32(XMVectorMultiply(XMVectorClamp(py, g_XMNegativeOne, g_XMOne), Scale));
+
+		return _mm_or_si128(_mm_and_si128(ix, _mm_set1_epi32(0xFFFF)), _mm_slli_epi32(iy, 16));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Packing::DecodeOctahedralLanes(const __m128i Packed, XMVECTOR& x, XMVECTOR& y, XMVECTOR& z) noexcept
+	{
+		const XMVECTOR Scale = XMVectorReplicate(1.0f / 32767.0f);
+
+		// sign-extended 16 Bit Components like XMLoadShortN2
+		x = XMVectorMax(XMVectorMultiply(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Packed, 16), 16)), Scale), g_XMNegativeOne);
+		y = XMVectorMax(XMVectorMultiply(_mm_cvtepi32_ps(_mm_srai_epi32(Packed, 16)), Scale), g_XMNegativeOne);
+
+		// z = 1 - |x| - |y|, negative z is the folded lower Hemisphere
+		z = XMVectorSubtract(XMVectorSubtract(g_XMOne, XMVectorAbs(x)), XMVectorAbs(y));
+
+		const XMVECTOR t = XMVectorMax(XMVectorNegate(z), g_XMZero);
+
+		x = XMVectorAdd(x, XMVectorSelect(t, XMVectorNegate(t), XMVectorGreaterOrEqual(x, g_XMZero)));
+		y = XMVectorAdd(y, XMVectorSelect(t, XMVectorNegate(t), XMVectorGreaterOrEqual(y, g_XMZero)));
+
+		// normalize
+		const XMVECTOR InvLength = XMVectorReciprocalSqrt(XMVectorMultiplyAdd(x, x, XMVectorMultiplyAdd(y, y, XMVectorMultiply(z, z))));
+
+		x = XMVectorMultiply(x, InvLength);
+		y = XMVectorMultiply(y, InvLength);
+		z = XMVectorMultiply(z, InvLength);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Packing::EncodeHalf2(const Vector2* pIn, Half2* pOut, const UINT Count) noexcept
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		for (UINT i = 0; i < Count; i++)
+		{
+			const XMFLOAT2& f = pIn[i];
+			PackedVector::XMStoreHalf2(&pOut[i], XMLoadFloat2(&f));
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Packing::DecodeHalf2(const Half2* pIn, Vector2* pOut, const UINT Count) noexcept
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		for (UINT i = 0; i < Count; i++)
+		{
+			XMFLOAT2& f = pOut[i];
+			XMStoreFloat2(&f, PackedVector::XMLoadHalf2(&pIn[i]));
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Packing::EncodeHalf4(const Vector4* pIn, Half4* pOut, const UINT Count) noexcept
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		// Vector4 and Half4 are 4 packed Components : convert as one Stream
+		PackedVector::XMConvertFloatToHalfStream(&pOut->x, sizeof(PackedVector::HALF), reinterpret_cast<const float*>(pIn), sizeof(float), (size_t)Count * 4);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Packing::DecodeHalf4(const Half4* pIn, Vector4* pOut, const UINT Count) noexcept
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		PackedVector::XMConvertHalfToFloatStream(reinterpret_cast<float*>(pOut), sizeof(float), &pIn->x, sizeof(PackedVector::HALF), (size_t)Count * 4);
+	}
+
+	//------------------------------------------------------------------------------
+	// 2 Vectors per Step : the 8 Shorts of 2 SNorm16x4 are one Register
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Packing::EncodeSNorm16(const Vector4* pIn, SNorm16x4* pOut, const UINT Count) noexcept
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		const XMVECTOR Scale = XMVectorReplicate(32767.0f);
+
+		UINT i = 0;
+
+		for (; i + 2 <= Count; i += 2)
+		{
+			const __m128i a = _mm_cvtps_epi32(XMVectorMultiply(XMVectorClamp(pIn[i], g_XMNegativeOne, g_XMOne), Scale));
+			const __m128i b = _mm_cvtps_epi32(XMVectorMultiply(XMVectorClamp(pIn[i + 1], g_XMNegativeOne, g_XMOne), Scale));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&pOut[i]), _mm_packs_epi32(a, b));
+		}
+
+		for (; i < Count; i++)
+			PackedVector::XMStoreShortN4(&pOut[i], pIn[i]);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Packing::DecodeSNorm16(const SNorm16x4* pIn, Vector4* pOut, const UINT Count) noexcept
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		const XMVECTOR Scale = XMVectorReplicate(1.0f / 32767.0f);
+
+		UINT i = 0;
+
+		for (; i + 2 <= Count; i += 2)
+		{
+			const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&pIn[i]));
+
+			// sign-extend the Shorts to 32 Bit
+			const __m128i a = _mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16);
+			const __m128i b = _mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16);
+
+			pOut[i] = XMVectorMax(XMVectorMultiply(_mm_cvtepi32_ps(a), Scale), g_XMNegativeOne);
+			pOut[i + 1] = XMVectorMax(XMVectorMultiply(_mm_cvtepi32_ps(b), Scale), g_XMNegativeOne);
+		}
+
+		for (; i < Count; i++)
+			pOut[i] = PackedVector::XMLoadShortN4(&pIn[i]);
+	}
+
+	//------------------------------------------------------------------------------
+	// 4 Vectors per Step : transposed to x, y, z, w of 4 Values, then the Bit-
+	// Fields of the 4 XDecN4 are shifted into one Register
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Packing::EncodeXDecN4(const Vector4* pIn, XDecN4* pOut, const UINT Count) noexcept
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		const XMVECTOR Min = XMVectorSet(-1.0f, -1.0f, -1.0f, 0.0f);
+		const XMVECTOR Scale = XMVectorSet(511.0f, 511.0f, 511.0f, 3.0f);
+		const __m128i Bits = _mm_set1_epi32(0x3FF);
+
+		UINT i = 0;
+
+		for (; i + 4 <= Count; i += 4)
+		{
+			XMMATRIX M;
+
+			for (UINT k = 0; k < 4; k++)
+				M.r[k] = XMVectorRound(XMVectorMultiply(XMVectorClamp(pIn[i + k], Min, g_XMOne), Scale));
+
+			M = XMMatrixTranspose(M);
+
+			__m128i Packed = _mm_and_si128(_mm_cvttps_epi32(M.r[0]), Bits);
+
+			Packed = _mm_or_si128(Packed, _mm_slli_epi32(_mm_and_si128(_mm_cvttps_epi32(M.r[1]), Bits), 10));
+			Packed = _mm_or_si128(Packed, _mm_slli_epi32(_mm_and_si128(_mm_cvttps_epi32(M.r[2]), Bits), 20));
+			Packed = _mm_or_si128(Packed, _mm_slli_epi32(_mm_cvttps_epi32(M.r[3]), 30));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&pOut[i]), Packed);
+		}
+
+		for (; i < Count; i++)
+			PackedVector::XMStoreXDecN4(&pOut[i], pIn[i]);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Packing::DecodeXDecN4(const XDecN4* pIn, Vector4* pOut, const UINT Count) noexcept
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		const XMVECTOR Scale = XMVectorReplicate(1.0f / 511.0f);
+
+		UINT i = 0;
+
+		for (; i + 4 <= Count; i += 4)
+		{
+			const __m128i Packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&pIn[i]));
+
+			// sign-extend the 10 Bit Fields, w is unsigned
+			XMMATRIX M;
+
+			M.r[0] = XMVectorMax(XMVectorMultiply(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Packed, 22), 22)), Scale), g_XMNegativeOne);
+			M.r[1] = XMVectorMax(XMVectorMultiply(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Packed, 12), 22)), Scale), g_XMNegativeOne);
+			M.r[2] = XMVectorMax(XMVectorMultiply(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Packed, 2), 22)), Scale), g_XMNegativeOne);
+			M.r[3] = XMVectorScale(_mm_cvtepi32_ps(_mm_srli_epi32(Packed, 30)), 1.0f / 3.0f);
+
+			M = XMMatrixTranspose(M);
+
+			for (UINT k = 0; k < 4; k++)
+				pOut[i + k] = M.r[k];
+		}
+
+		for (; i < Count; i++)
+			pOut[i] = PackedVector::XMLoadXDecN4(&pIn[i]);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Packing::EncodeOctahedral(const Vector3* pIn, OctNormal* pOut, const UINT Count) noexcept
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		UINT i = 0;
+
+		for (; i + 4 <= Count; i += 4)
+		{
+			XMMATRIX M;
+
+			for (UINT k = 0; k < 4; k++)
+			{
+				const XMFLOAT3& f = pIn[i + k];
+				M.r[k] = XMLoadFloat3(&f);
+			}
+
+			M = XMMatrixTranspose(M);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&pOut[i]), EncodeOctahedralLanes(M.r[0], M.r[1], M.r[2]));
+		}
+
+		for (; i < Count; i++)
+		{
+			const XMFLOAT3& f = pIn[i];
+			pOut[i] = EncodeOctahedral(XMLoadFloat3(&f));
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Packing::DecodeOctahedral(const OctNormal* pIn, Vector3* pOut, const UINT Count) noexcept
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		UINT i = 0;
+
+		for (; i + 4 <= Count; i += 4)
+		{
+			XMMATRIX M;
+
+			DecodeOctahedralLanes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&pIn[i])), M.r[0], M.r[1], M.r[2]);
+			M.r[3] = g_XMZero;
+
+			M = XMMatrixTranspose(M);
+
+			for (UINT k = 0; k < 4; k++)
+			{
+				XMFLOAT3& f = pOut[i + k];
+				XMStoreFloat3(&f, M.r[k]);
+			}
+		}
+
+		for (; i < Count; i++)
+		{
+			XMFLOAT3& f = pOut[i];
+			XMStoreFloat3(&f, DecodeOctahedral(pIn[i]));
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Packing::EncodeQuats(const Quat* pIn, PackedQuat* pOut, const UINT Count) noexcept
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		UINT i = 0;
+
+		for (; i + 4 <= Count; i += 4)
+		{
+			const XMMATRIX M = XMMatrixTranspose(XMMATRIX(pIn[i].Get(), pIn[i + 1].Get(), pIn[i + 2].Get(), pIn[i + 3].Get()));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&pOut[i]), EncodeQuatLanes(M.r[0], M.r[1], M.r[2], M.r[3]));
+		}
+
+		for (; i < Count; i++)
+			pOut[i] = EncodeQuat(pIn[i].Get());
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Packing::DecodeQuats(const PackedQuat* pIn, Quat* pOut, const UINT Count) noexcept
+	{
+		assert((pIn && pOut) || Count == 0);
+
+		UINT i = 0;
+
+		for (; i + 4 <= Count; i += 4)
+		{
+			XMMATRIX M;
+
+			DecodeQuatLanes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&pIn[i])), M.r[0], M.r[1], M.r[2], M.r[3]);
+
+			M = XMMatrixTranspose(M);
+
+			for (UINT k = 0; k < 4; k++)
+				pOut[i + k] = M.r[k];
+		}
+
+		for (; i < Count; i++)
+			pOut[i] = DecodeQuat(pIn[i]);
+	}
+
+}// end of Namespace TurboMath
@@ -0,0 +1,111 @@
+// -------------------------------------------------------------------
+// File			:	Parallel
+//
+// Project		:	TurboMath
+//
+// Description	:	Simple Parallel-For over all CPU-Cores
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_PARALLEL_H_
+#define _TURBOMATH_PARALLEL_H_
+
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+namespace TurboMath
+{
+	//-----------------------------------------------------------------------------
+	// One ParallelFor-Call in the Queue of the ThreadPool. Lives on the Stack
+	// of the calling Thread until all Chunks are done.
+	//-----------------------------------------------------------------------------
+	struct ParallelJob
+	{
+		void				(*pRun)(const void* pFunc, const UINT Begin, const UINT End);
+		const void*			pFunc;			// the Functor of ParallelFor
+		UINT				Count;			// Range [0, Count)
+		UINT				ChunkSize;
+		UINT				NumChunks;
+		std::atomic<UINT>	NextChunk;		// next Chunk to fetch
+		UINT				NumWorkers;		// Workers inside the Job (guarded by the Mutex of the Pool)
+	};
+
+	//-----------------------------------------------------------------------------
+	// Persistent Worker-Threads (one less than the CPU-Cores) for ParallelFor,
+	// created on the first Use. Jobs are queued and the Workers fetch Chunks of
+	// the oldest Job, the calling Thread works on its own Job too. So nested and
+	// concurrent ParallelFor-Calls never deadlock, and no Thread is created per
+	// Call.
+	//-----------------------------------------------------------------------------
+	class ThreadPool
+	{
+	public:
+
+		/// the global Pool
+		static ThreadPool&	XM_CALLCONV Get();
+
+		/// Worker-Threads + the calling Thread
+		const UINT			XM_CALLCONV GetNumThreads() const noexcept		{ return (UINT)m_Threads.size() + 1; }
+
+		/// run all Chunks of the Job, returns when all are done
+		void				XM_CALLCONV Execute(ParallelJob& Job);
+
+	protected:
+
+		ThreadPool();
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		/// Main-Loop of a Worker-Thread
+		void				XM_CALLCONV WorkerLoop();
+
+		/// fetch and run Chunks until the Job has none left
+		static void			XM_CALLCONV RunChunks(ParallelJob& Job);
+
+		std::vector<std::thread>	m_Threads;
+		std::deque<ParallelJob*>	m_Queue;		// Jobs with Chunks left
+		std::mutex					m_Mutex;
+		std::condition_variable		m_WakeWorkers;
+		std::condition_variable		m_JobDone;
+		bool						m_bQuit;
+	};
+
+	//-----------------------------------------------------------------------------
+	// Minimal Parallel-For for the Bulk-Operations of TurboMath.
+	// The Range [0, Count) is split into Chunks of ChunkSize Elements, which
+	// are fetched by the Threads of the ThreadPool from an atomic Counter.
+	// Func is called as Func(Begin, End) and must be thread-safe for disjoint
+	// Ranges. Small Ranges (one Chunk) run on the calling Thread.
+	//-----------------------------------------------------------------------------
+
+	/// Number of Threads used by ParallelFor
+	XM_INLINE const UINT GetNumParallelThreads() noexcept;
+
+	/// call Func(Begin, End) for all Chunks of [0, Count) on all CPU-Cores
+	template <class Func> XM_INLINE void ParallelFor(const UINT Count, const UINT ChunkSize, const Func& Fn);
+
+}; // end of namespace
+
+#endif
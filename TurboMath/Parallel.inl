@@ -0,0 +1,185 @@
+// -------------------------------------------------------------------
+// File			:	Parallel.inl
+//
+// Project		:	TurboMath
+//
+// Description	:	Inline-Code for ParallelFor
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+namespace TurboMath
+{
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT GetNumParallelThreads() noexcept
+	{
+		static const UINT NumThreads = XMMax(1u, (UINT)std::thread::hardware_concurrency());
+
+		return NumThreads;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE ThreadPool& XM_CALLCONV ThreadPool::Get()
+	{
+		static ThreadPool Pool;
+
+		return Pool;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE ThreadPool::ThreadPool() :
+		m_bQuit(false)
+	{
+		const UINT NumWorkers = GetNumParallelThreads() - 1;
+
+		m_Threads.reserve(NumWorkers);
+
+		for (UINT t = 0; t < NumWorkers; t++)
+		{
+			m_Threads.emplace_back([this]() { WorkerLoop(); });
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> Lock(m_Mutex);
+			m_bQuit = true;
+		}
+
+		m_WakeWorkers.notify_all();
+
+		for (auto& t : m_Threads)
+		{
+			t.join();
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ThreadPool::RunChunks(ParallelJob& Job)
+	{
+		for (;;)
+		{
+			const UINT c = Job.NextChunk.fetch_add(1, std::memory_order_relaxed);
+
+			if (c >= Job.NumChunks) break;
+
+			const UINT Begin = c * Job.ChunkSize;
+
+			Job.pRun(Job.pFunc, Begin, XMMin(Begin + Job.ChunkSize, Job.Count));
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ThreadPool::Execute(ParallelJob& Job)
+	{
+		{
+			std::lock_guard<std::mutex> Lock(m_Mutex);
+			m_Queue.push_back(&Job);
+		}
+
+		m_WakeWorkers.notify_all();
+
+		// the calling Thread works too
+		RunChunks(Job);
+
+		std::unique_lock<std::mutex> Lock(m_Mutex);
+
+		// no new Worker may enter the Job (if no Worker has removed it yet)
+		for (auto it = m_Queue.begin(); it != m_Queue.end(); ++it)
+		{
+			if (*it == &Job)
+			{
+				m_Queue.erase(it);
+				break;
+			}
+		}
+
+		// wait for the Chunks still running on the Workers
+		m_JobDone.wait(Lock, [&Job]() { return Job.NumWorkers == 0; });
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV ThreadPool::WorkerLoop()
+	{
+		std::unique_lock<std::mutex> Lock(m_Mutex);
+
+		for (;;)
+		{
+			m_WakeWorkers.wait(Lock, [this]() { return m_bQuit || !m_Queue.empty(); });
+
+			if (m_bQuit) return;
+
+			ParallelJob* pJob = m_Queue.front();
+
+			// all Chunks fetched -> the next Job
+			if (pJob->NextChunk.load(std::memory_order_relaxed) >= pJob->NumChunks)
+			{
+				m_Queue.pop_front();
+				continue;
+			}
+
+			pJob->NumWorkers++;
+
+			Lock.unlock();
+			RunChunks(*pJob);
+			Lock.lock();
+
+			if (!m_Queue.empty() && m_Queue.front() == pJob)
+			{
+				m_Queue.pop_front();
+			}
+
+			if (--pJob->NumWorkers == 0)
+			{
+				m_JobDone.notify_all();
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	template <class Func> XM_INLINE void ParallelFor(const UINT Count, const UINT ChunkSize, const Func& Fn)
+	{
+		if (Count == 0) return;
+
+		const UINT Chunk = XMMax(1u, ChunkSize);
+		const UINT NumChunks = (Count + Chunk - 1) / Chunk;
+
+		// not worth the Threads
+		if (NumChunks <= 1 || GetNumParallelThreads() <= 1)
+		{
+			Fn(0, Count);
+			return;
+		}
+
+		ParallelJob Job;
+		Job.pRun = [](const void* pFunc, const UINT Begin, const UINT End) { (*(const Func*)pFunc)(Begin, End); };
+		Job.pFunc = &Fn;
+		Job.Count = Count;
+		Job.ChunkSize = Chunk;
+		Job.NumChunks = NumChunks;
+		Job.NextChunk.store(0, std::memory_order_relaxed);
+		Job.NumWorkers = 0;
+
+		ThreadPool::Get().Execute(Job);
+	}
+
+}// end of Namespace TurboMath
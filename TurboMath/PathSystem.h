@@ -0,0 +1,157 @@
+// -------------------------------------------------------------------
+// File			:	PathSystem
+//
+// Project		:	TurboMath
+//
+// Description	:	Batch-Evaluation of many Paths and Path-Followers
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_PATHSYSTEM_H_
+#define _TURBOMATH_PATHSYSTEM_H_
+
+#include <vector>
+
+namespace TurboMath
+{
+
+	//-----------------------------------------------------------------------------
+	// Stores the Segments of many closed Paths (like WayPoints) in one Place.
+	// Every Segment is converted once into the Coefficients of its cubic
+	// Polynomial P(t) = ((A * t + B) * t + C) * t + D (Catmull-Rom or linear),
+	// so the Evaluation is only a Horner-Scheme.
+	//
+	// Followers move along a Path with a Speed in Path-Time per Second (1.0 =
+	// the whole Path in one Second). The Path-Time of every Segment is
+	// proportional to its Length. Update() evaluates Position and Look-At-
+	// Direction (normalized Tangent) of all Followers, 4 Followers per
+	// Instruction, large Systems in parallel.
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class PathSystem
+	{
+	public:
+
+		typedef std::vector<float, AAllocator<float> >	FloatStream;
+
+		/// Samples per Segment for the Length-Estimation
+		static constexpr UINT LENGTH_SAMPLES = 16;
+
+		PathSystem() noexcept;
+		~PathSystem() noexcept;
+
+		/// remove all Paths and Followers
+		void			XM_CALLCONV Clear() noexcept;
+
+		//-----------------------------------------------------------------------------
+		// Paths
+		//-----------------------------------------------------------------------------
+
+		/// add a closed Path through the Points, returns the Index of the Path
+		const UINT		XM_CALLCONV AddPath(const Vector4* pPoints, const UINT NumPoints, const bool bCurved = true);
+
+		/// add the Path of a WayPoints-List (Points and Position-Path-Type), returns the Index of the Path
+		const UINT		XM_CALLCONV AddPath(const WayPoints& Path);
+
+		/// get Number of Paths
+		const UINT		XM_CALLCONV GetNumPaths() const noexcept			{ return (UINT)m_Paths.size(); }
+
+		/// get the Length of a Path
+		const float		XM_CALLCONV GetPathLength(const UINT Path) const noexcept;
+
+		//-----------------------------------------------------------------------------
+		// Followers
+		//-----------------------------------------------------------------------------
+
+		/// add a Follower on a Path, returns the Index of the Follower
+		const UINT		XM_CALLCONV AddFollower(const UINT Path, const float Speed, const float StartTime = 0.0f);
+
+		/// get Number of Followers
+		const UINT		XM_CALLCONV GetNumFollowers() const noexcept		{ return m_NumFollowers; }
+
+		void			XM_CALLCONV SetFollowerSpeed(const UINT Follower, const float Speed) noexcept;
+		void			XM_CALLCONV SetFollowerTime(const UINT Follower, const float Time) noexcept;
+		void			XM_CALLCONV SetFollowerActive(const UINT Follower, const bool bActive) noexcept;
+
+		const float		XM_CALLCONV GetFollowerTime(const UINT Follower) const noexcept;
+		const bool		XM_CALLCONV IsFollowerActive(const UINT Follower) const noexcept;
+
+		/// Position of a Follower (after the last Update)
+		const Vector4	XM_CALLCONV GetPosition(const UINT Follower) const noexcept;
+
+		/// normalized Direction of Movement of a Follower (after the last Update)
+		const Vector4	XM_CALLCONV GetLookAt(const UINT Follower) const noexcept;
+
+		//-----------------------------------------------------------------------------
+		// Raw Output-Streams (padded to a Multiple of 4)
+		//-----------------------------------------------------------------------------
+		const float*	XM_CALLCONV GetPositionsX() const noexcept			{ return m_PosX.data(); }
+		const float*	XM_CALLCONV GetPositionsY() const noexcept			{ return m_PosY.data(); }
+		const float*	XM_CALLCONV GetPositionsZ() const noexcept			{ return m_PosZ.data(); }
+		const float*	XM_CALLCONV GetLookAtsX() const noexcept			{ return m_LookX.data(); }
+		const float*	XM_CALLCONV GetLookAtsY() const noexcept			{ return m_LookY.data(); }
+		const float*	XM_CALLCONV GetLookAtsZ() const noexcept			{ return m_LookZ.data(); }
+
+		//-----------------------------------------------------------------------------
+		// Update
+		//-----------------------------------------------------------------------------
+
+		/// move all active Followers by the elapsed Time and evaluate all Followers
+		void			XM_CALLCONV Update(const float fTime);
+
+	protected:
+
+		struct PathInfo
+		{
+			UINT	FirstSegment;
+			UINT	NumSegments;
+			float	Length;
+		};
+
+		/// advance the Followers [4 * FirstBlock, 4 * EndBlock) and evaluate them
+		void			XM_CALLCONV UpdateBlocks(const UINT FirstBlock, const UINT EndBlock, const float fTime) noexcept;
+
+		/// advance one Follower, returns its Segment and the Time inside the Segment
+		void			XM_CALLCONV AdvanceFollower(const UINT Follower, const float fTime, UINT& Segment, float& SegmentTime) noexcept;
+
+		// Segment-Coefficients
+		FloatStream		m_AX, m_AY, m_AZ;
+		FloatStream		m_BX, m_BY, m_BZ;
+		FloatStream		m_CX, m_CY, m_CZ;
+		FloatStream		m_DX, m_DY, m_DZ;
+		FloatStream		m_SegStart;				// Path-Time at the Start of the Segment
+		FloatStream		m_SegInvDuration;		// 1 / Path-Time of the Segment
+
+		std::vector<PathInfo>	m_Paths;
+
+		// Followers
+		std::vector<UINT>	m_FollowerPath;
+		std::vector<UINT>	m_FollowerSegment;	// current Segment inside the Path (Cursor)
+		FloatStream		m_FollowerTime;			// Path-Time [0..1)
+		FloatStream		m_FollowerSpeed;
+		std::vector<UINT>	m_FollowerActive;
+		UINT			m_NumFollowers;
+
+		// Output (padded to a Multiple of 4)
+		FloatStream		m_PosX, m_PosY, m_PosZ;
+		FloatStream		m_LookX, m_LookY, m_LookZ;
+	};
+
+}; // end of namespace
+
+#endif
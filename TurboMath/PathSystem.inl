@@ -0,0 +1,350 @@
+// -------------------------------------------------------------------
+// File			:	PathSystem
+//
+// Project		:	TurboMath
+//
+// Description	:	Batch-Evaluation of many Paths and Path-Followers
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+namespace TurboMath
+{
+	//------------------------------------------------------------------------------
+	XM_INLINE PathSystem::PathSystem() noexcept
+		: m_NumFollowers(0)
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE PathSystem::~PathSystem() noexcept
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV PathSystem::Clear() noexcept
+	{
+		FloatStream* Streams[] = {	&m_AX, &m_AY, &m_AZ, &m_BX, &m_BY, &m_BZ,
+									&m_CX, &m_CY, &m_CZ, &m_DX, &m_DY, &m_DZ,
+									&m_SegStart, &m_SegInvDuration, &m_FollowerTime, &m_FollowerSpeed,
+									&m_PosX, &m_PosY, &m_PosZ, &m_LookX, &m_LookY, &m_LookZ };
+
+		for (FloatStream* pStream : Streams)
+			pStream->clear();
+
+		m_Paths.clear();
+		m_FollowerPath.clear();
+		m_FollowerSegment.clear();
+		m_FollowerActive.clear();
+		m_NumFollowers = 0;
+	}
+
+	//------------------------------------------------------------------------------
+	// Paths
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV PathSystem::AddPath(const Vector4* pPoints, const UINT NumPoints, const bool bCurved)
+	{
+		assert(pPoints != nullptr && NumPoints > 0);
+
+		PathInfo Info;
+		Info.FirstSegment = (UINT)m_AX.size();
+		Info.NumSegments = NumPoints;
+		Info.Length = 0.0f;
+
+		std::vector<float> Lengths(NumPoints);
+
+		const XMVECTOR vHalf = XMVectorReplicate(0.5f);
+
+		for (UINT s = 0; s < NumPoints; s++)
+		{
+			const XMVECTOR p0 = pPoints[(s + NumPoints - 1) % NumPoints];
+			const XMVECTOR p1 = pPoints[s];
+			const XMVECTOR p2 = pPoints[(s + 1) % NumPoints];
+			const XMVECTOR p3 = pPoints[(s + 2) % NumPoints];
+
+			XMVECTOR A, B, C;
+			const XMVECTOR D = p1;
+
+			if (bCurved)
+			{
+				// Catmull-Rom (like XMVectorCatmullRom) as Polynomial
+				A = XMVectorMultiply(vHalf, XMVectorAdd(XMVectorSubtract(p3, p0), XMVectorScale(XMVectorSubtract(p1, p2), 3.0f)));
+				B = XMVectorMultiply(vHalf, XMVectorSubtract(XMVectorAdd(XMVectorScale(p0, 2.0f), XMVectorScale(p2, 4.0f)), XMVectorAdd(XMVectorScale(p1, 5.0f), p3)));
+				C = XMVectorMultiply(vHalf, XMVectorSubtract(p2, p0));
+			}
+			else
+			{
+				A = XMVectorZero();
+				B = XMVectorZero();
+				C = XMVectorSubtract(p2, p1);
+			}
+
+			m_AX.push_back(XMVectorGetX(A)); m_AY.push_back(XMVectorGetY(A)); m_AZ.push_back(XMVectorGetZ(A));
+			m_BX.push_back(XMVectorGetX(B)); m_BY.push_back(XMVectorGetY(B)); m_BZ.push_back(XMVectorGetZ(B));
+			m_CX.push_back(XMVectorGetX(C)); m_CY.push_back(XMVectorGetY(C)); m_CZ.push_back(XMVectorGetZ(C));
+			m_DX.push_back(XMVectorGetX(D)); m_DY.push_back(XMVectorGetY(D)); m_DZ.push_back(XMVectorGetZ(D));
+
+			// Length of the Segment
+			float Length = 0.0f;
+			XMVECTOR Prev = D;
+
+			for (UINT i = 1; i <= LENGTH_SAMPLES; i++)
+			{
+				const XMVECTOR t = XMVectorReplicate((float)i / (float)LENGTH_SAMPLES);
+				const XMVECTOR P = XMVectorMultiplyAdd(XMVectorMultiplyAdd(XMVectorMultiplyAdd(A, t, B), t, C), t, D);
+
+				Length += XMVectorGetX(XMVector3Length(XMVectorSubtract(P, Prev)));
+				Prev = P;
+			}
+
+			Lengths[s] = Length;
+			Info.Length += Length;
+		}
+
+		// Path-Time of the Segments proportional to their Length
+		float Start = 0.0f;
+
+		for (UINT s = 0; s < NumPoints; s++)
+		{
+			const float Duration = (Info.Length > 0.0f) ? Lengths[s] / Info.Length : 1.0f / (float)NumPoints;
+
+			m_SegStart.push_back(Start);
+			m_SegInvDuration.push_back((Duration > 0.0f) ? 1.0f / Duration : 0.0f);
+
+			Start += Duration;
+		}
+
+		m_Paths.push_back(Info);
+
+		return (UINT)m_Paths.size() - 1;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV PathSystem::AddPath(const WayPoints& Path)
+	{
+		const UINT NumPoints = (UINT)Path.GetNumPathPoints();
+
+		std::vector<Vector4, AAllocator<Vector4> > Points(NumPoints);
+
+		for (UINT i = 0; i < NumPoints; i++)
+			Points[i] = Path.GetPathPoint(i).GetPoint();
+
+		return AddPath(Points.data(), NumPoints, Path.GetPathTypePosition() != WayPoints::PATH_STRAIGHT);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const float XM_CALLCONV PathSystem::GetPathLength(const UINT Path) const noexcept
+	{
+		assert(Path < m_Paths.size());
+
+		return m_Paths[Path].Length;
+	}
+
+	//------------------------------------------------------------------------------
+	// Followers
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV PathSystem::AddFollower(const UINT Path, const float Speed, const float StartTime)
+	{
+		assert(Path < m_Paths.size());
+
+		// Output-Streams grow by one Block of 4
+		if ((m_NumFollowers & 3) == 0)
+		{
+			const size_t Size = m_NumFollowers + 4;
+
+			FloatStream* Streams[] = { &m_PosX, &m_PosY, &m_PosZ, &m_LookX, &m_LookY, &m_LookZ };
+
+			for (FloatStream* pStream : Streams)
+				pStream->resize(Size, 0.0f);
+		}
+
+		m_FollowerPath.push_back(Path);
+		m_FollowerSegment.push_back(0);
+		m_FollowerTime.push_back(StartTime - floorf(StartTime));
+		m_FollowerSpeed.push_back(Speed);
+		m_FollowerActive.push_back(1);
+
+		return m_NumFollowers++;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV PathSystem::SetFollowerSpeed(const UINT Follower, const float Speed) noexcept
+	{
+		assert(Follower < m_NumFollowers);
+
+		m_FollowerSpeed[Follower] = Speed;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV PathSystem::SetFollowerTime(const UINT Follower, const float Time) noexcept
+	{
+		assert(Follower < m_NumFollowers);
+
+		m_FollowerTime[Follower] = Time - floorf(Time);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV PathSystem::SetFollowerActive(const UINT Follower, const bool bActive) noexcept
+	{
+		assert(Follower < m_NumFollowers);
+
+		m_FollowerActive[Follower] = bActive ? 1 : 0;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const float XM_CALLCONV PathSystem::GetFollowerTime(const UINT Follower) const noexcept
+	{
+		assert(Follower < m_NumFollowers);
+
+		return m_FollowerTime[Follower];
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV PathSystem::IsFollowerActive(const UINT Follower) const noexcept
+	{
+		assert(Follower < m_NumFollowers);
+
+		return m_FollowerActive[Follower] != 0;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const Vector4 XM_CALLCONV PathSystem::GetPosition(const UINT Follower) const noexcept
+	{
+		assert(Follower < m_NumFollowers);
+
+		return Vector4(m_PosX[Follower], m_PosY[Follower], m_PosZ[Follower]);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const Vector4 XM_CALLCONV PathSystem::GetLookAt(const UINT Follower) const noexcept
+	{
+		assert(Follower < m_NumFollowers);
+
+		return Vector4(m_LookX[Follower], m_LookY[Follower], m_LookZ[Follower]);
+	}
+
+	//------------------------------------------------------------------------------
+	// Update
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV PathSystem::Update(const float fTime)
+	{
+		const UINT NumBlocks = (m_NumFollowers + 3) / 4;
+
+		if (NumBlocks >= 1024)
+		{
+			ParallelFor(NumBlocks, 256, [&](const UINT Begin, const UINT End)
+			{
+				UpdateBlocks(Begin, End, fTime);
+			});
+		}
+		else
+			UpdateBlocks(0, NumBlocks, fTime);
+	}
+
+	//------------------------------------------------------------------------------
+	// the Segment-Cursor of the Follower only moves to the Neighbours for a
+	// continuous Movement, so finding the Segment is O(1) per Update
+	XM_INLINE void XM_CALLCONV PathSystem::AdvanceFollower(const UINT Follower, const float fTime, UINT& Segment, float& SegmentTime) noexcept
+	{
+		float Time = m_FollowerTime[Follower];
+
+		if (m_FollowerActive[Follower])
+		{
+			Time += m_FollowerSpeed[Follower] * fTime;
+			Time -= floorf(Time);
+
+			m_FollowerTime[Follower] = Time;
+		}
+
+		const PathInfo& Path = m_Paths[m_FollowerPath[Follower]];
+		const float* pStart = &m_SegStart[Path.FirstSegment];
+
+		UINT Cur = m_FollowerSegment[Follower];
+
+		while (Cur > 0 && Time < pStart[Cur])
+			Cur--;
+
+		while (Cur + 1 < Path.NumSegments && Time >= pStart[Cur + 1])
+			Cur++;
+
+		m_FollowerSegment[Follower] = Cur;
+
+		Segment = Path.FirstSegment + Cur;
+		SegmentTime = XMMin((Time - pStart[Cur]) * m_SegInvDuration[Segment], 1.0f);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV PathSystem::UpdateBlocks(const UINT FirstBlock, const UINT EndBlock, const float fTime) noexcept
+	{
+		const XMVECTOR vZero = XMVectorZero();
+		const XMVECTOR vTwo = XMVectorReplicate(2.0f);
+		const XMVECTOR vThree = XMVectorReplicate(3.0f);
+
+		for (UINT Block = FirstBlock; Block < EndBlock; Block++)
+		{
+			const UINT Base = Block * 4;
+
+			UINT Segment[4];
+			float SegmentTime[4];
+
+			// advance the Followers (missing Followers repeat the first one)
+			for (UINT Lane = 0; Lane < 4; Lane++)
+			{
+				if (Base + Lane < m_NumFollowers)
+					AdvanceFollower(Base + Lane, fTime, Segment[Lane], SegmentTime[Lane]);
+				else
+				{
+					Segment[Lane] = Segment[0];
+					SegmentTime[Lane] = SegmentTime[0];
+				}
+			}
+
+			auto Gather = [&](const FloatStream& Stream)
+			{
+				return XMVectorSet(Stream[Segment[0]], Stream[Segment[1]], Stream[Segment[2]], Stream[Segment[3]]);
+			};
+
+			const XMVECTOR t = XMLoadFloat4((const XMFLOAT4*)SegmentTime);
+
+			const XMVECTOR AX = Gather(m_AX), AY = Gather(m_AY), AZ = Gather(m_AZ);
+			const XMVECTOR BX = Gather(m_BX), BY = Gather(m_BY), BZ = Gather(m_BZ);
+			const XMVECTOR CX = Gather(m_CX), CY = Gather(m_CY), CZ = Gather(m_CZ);
+			const XMVECTOR DX = Gather(m_DX), DY = Gather(m_DY), DZ = Gather(m_DZ);
+
+			// Position : ((A * t + B) * t + C) * t + D
+			XMStoreFloat4A((XMFLOAT4A*)&m_PosX[Base], XMVectorMultiplyAdd(XMVectorMultiplyAdd(XMVectorMultiplyAdd(AX, t, BX), t, CX), t, DX));
+			XMStoreFloat4A((XMFLOAT4A*)&m_PosY[Base], XMVectorMultiplyAdd(XMVectorMultiplyAdd(XMVectorMultiplyAdd(AY, t, BY), t, CY), t, DY));
+			XMStoreFloat4A((XMFLOAT4A*)&m_PosZ[Base], XMVectorMultiplyAdd(XMVectorMultiplyAdd(XMVectorMultiplyAdd(AZ, t, BZ), t, CZ), t, DZ));
+
+			// Tangent : (3 * A * t + 2 * B) * t + C
+			const XMVECTOR t3 = XMVectorMultiply(t, vThree);
+
+			XMVECTOR TX = XMVectorMultiplyAdd(XMVectorMultiplyAdd(AX, t3, XMVectorMultiply(BX, vTwo)), t, CX);
+			XMVECTOR TY = XMVectorMultiplyAdd(XMVectorMultiplyAdd(AY, t3, XMVectorMultiply(BY, vTwo)), t, CY);
+			XMVECTOR TZ = XMVectorMultiplyAdd(XMVectorMultiplyAdd(AZ, t3, XMVectorMultiply(BZ, vTwo)), t, CZ);
+
+			XMVECTOR LengthSq = XMVectorMultiply(TX, TX);
+			LengthSq = XMVectorMultiplyAdd(TY, TY, LengthSq);
+			LengthSq = XMVectorMultiplyAdd(TZ, TZ, LengthSq);
+
+			const XMVECTOR Valid = XMVectorGreater(LengthSq, vZero);
+			const XMVECTOR InvLength = XMVectorSelect(vZero, XMVectorReciprocalSqrt(LengthSq), Valid);
+
+			XMStoreFloat4A((XMFLOAT4A*)&m_LookX[Base], XMVectorMultiply(TX, InvLength));
+			XMStoreFloat4A((XMFLOAT4A*)&m_LookY[Base], XMVectorMultiply(TY, InvLength));
+			XMStoreFloat4A((XMFLOAT4A*)&m_LookZ[Base], XMVectorMultiply(TZ, InvLength));
+		}
+	}
+
+}// end of Namespace TurboMath
@@ -168,8 +168,8 @@ namespace TurboMath
 		// Classify point to plane.
 		const eCullClassify XM_CALLCONV Classify(const Vector4& vcPoint) noexcept;
 		
-		// Classify point to plane.
-		const eCullClassify XM_CALLCONV Classify(const Polygon& vcPoint) noexcept;
+		// Classify polygon to plane.
+		const eCullClassify XM_CALLCONV Classify(const Polygon& Pol) noexcept;
 
 		// clips a ray into two segments if it Collision the plane
 		const bool XM_CALLCONV Clip(const Line& inLine, float fL, Line* pFrontLine, Line* pBackLine) noexcept;
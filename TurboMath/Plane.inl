@@ -323,44 +323,12 @@ namespace TurboMath
 	}
 
 	//------------------------------------------------------------------------------
-/*	 XM_INLINE const eCullClassify  XM_CALLCONV Plane::Classify(const Polygon& Pol) noexcept
+	// Classify polygon to plane.
+	 XM_INLINE const eCullClassify  XM_CALLCONV Plane::Classify(const Polygon& Pol) noexcept
 	{
-		int NumFront=0, NumBack=0, NumPlanar=0;
-
-		// cast away const
-		Polygon* pPoly = ((Polygon*)&Pol);
-
-		int NumPoints = pPoly->GetNumPoints();
-
-		// loop through all points
-		for (int i=0; i < NumPoints; i++)
-		{
-			const eCullClassify nClass = Classify( pPoly->m_pPoints[i] );
-
-			if (nClass == FRONT)     NumFront++;
-			else if (nClass == BACK) NumBack++;
-			else
-			{
-				NumFront++;
-				NumBack++;
-				NumPlanar++;
-			}
-		} // for
-
-		// all points are planar
-		if (NumPlanar == NumPoints)
-			return PLANAR;
-		// all points are in front of plane
-		else if (NumFront == NumPoints)
-			return FRONT;
-		// all points are on backside of plane
-		else if (NumBack == NumPoints)
-			return BACK;
-		// poly is intersecting the plane
-		else
-			return CLIPPED;
+		return Pol.Classify(*this);
 	}
-*/
+
 	//------------------------------------------------------------------------------
 	// clips a ray into two segments if it Collision the plane
 	const bool  XM_CALLCONV Plane::Clip(const Line& iLine, float fL, Line* pFrontLine, Line* pBackLine) noexcept
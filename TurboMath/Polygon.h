@@ -0,0 +1,142 @@
+// -------------------------------------------------------------------
+// File			:	Polygon
+//
+// Project		:	TurboMath
+//
+// Description	:	convex planar Polygon with Plane-Classification and Clipping
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_POLYGON_H_
+#define _TURBOMATH_POLYGON_H_
+
+#include <vector>
+
+namespace TurboMath
+{
+
+	//-----------------------------------------------------------------------------
+	// Planar (convex) Polygon. Up to INLINE_POINTS Points are stored inside the
+	// Object, so Portals, Decals and Clip-Results dont touch the Heap. Larger
+	// Polygons move their Points to a Heap-Buffer.
+	//
+	// The Distances of the Points to a Plane are computed 4 Points at once
+	// (transposed to SoA). Split() / Clip() use Sutherland-Hodgman, Clip() keeps
+	// the negative Side of the Plane (inside, like the Frustum-Planes).
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class Polygon
+	{
+	public:
+
+		/// Number of Points stored without Heap-Allocation
+		static constexpr UINT INLINE_POINTS = 16;
+
+		/// default Tolerance for "on the Plane"
+		static constexpr float PLANAR_EPSILON = 1e-4f;
+
+		Polygon() noexcept;
+
+		/// construct from Points
+		explicit Polygon(const Vector4* pPoints, const UINT NumPoints);
+
+		/// remove all Points
+		void			XM_CALLCONV Clear() noexcept;
+
+		/// set all Points
+		void			XM_CALLCONV Set(const Vector4* pPoints, const UINT NumPoints);
+
+		/// add a Point
+		void			XM_CALLCONV AddPoint(const Vector4& Point);
+
+		/// change a Point
+		void			XM_CALLCONV SetPoint(const UINT Index, const Vector4& Point) noexcept;
+
+		/// get a Point
+		const Vector4&	XM_CALLCONV GetPoint(const UINT Index) const noexcept;
+
+		/// get all Points
+		const Vector4*	XM_CALLCONV GetPoints() const noexcept;
+
+		/// get Number of Points
+		const UINT		XM_CALLCONV GetNumPoints() const noexcept;
+
+		/// is it a valid Polygon (at least 3 Points) ?
+		const bool		XM_CALLCONV IsValid() const noexcept;
+
+		/// reverse the Winding (flips the Normal)
+		void			XM_CALLCONV Flip() noexcept;
+
+		//-----------------------------------------------------------------------------
+		// Properties
+		//-----------------------------------------------------------------------------
+
+		/// Plane of the Polygon (Newell-Normal, robust for nearly collinear Points)
+		const Plane		XM_CALLCONV GetPlane() const noexcept;
+
+		/// Average of the Points
+		const Vector4	XM_CALLCONV GetCenter() const noexcept;
+
+		/// Area of the Polygon
+		const float		XM_CALLCONV GetArea() const noexcept;
+
+		/// Bounding-Box of the Points
+		const AABB		XM_CALLCONV GetAABB() const noexcept;
+
+		//-----------------------------------------------------------------------------
+		// Plane-Tests
+		//-----------------------------------------------------------------------------
+
+		/// signed Distance of all Points to the Plane (pDist needs GetNumPoints() Entries)
+		void			XM_CALLCONV ComputeDistances(const Plane& thePlane, float* pDist) const noexcept;
+
+		/// classify the Polygon : FRONT, BACK, PLANAR or CLIPPED
+		const eCullClassify XM_CALLCONV Classify(const Plane& thePlane, const float Epsilon = PLANAR_EPSILON) const noexcept;
+
+		/// split into the Parts in front of and behind the Plane, returns the Classification
+		/// (a planar Polygon goes to the Side its Normal is facing)
+		const eCullClassify XM_CALLCONV Split(const Plane& thePlane, Polygon* pFront, Polygon* pBack, const float Epsilon = PLANAR_EPSILON) const;
+
+		/// keep the Part behind the Plane, returns false if nothing is left
+		const bool		XM_CALLCONV Clip(const Plane& thePlane, const float Epsilon = PLANAR_EPSILON);
+
+		/// clip against a Set of Planes, returns false if nothing is left
+		const bool		XM_CALLCONV Clip(const Plane* pPlanes, const UINT NumPlanes, const float Epsilon = PLANAR_EPSILON);
+
+		/// clip against the 6 Planes of a Frustum, returns false if nothing is left
+		const bool		XM_CALLCONV Clip(const Frustum& theFrustum, const float Epsilon = PLANAR_EPSILON);
+
+	protected:
+
+		/// Pointer to the Points (inline or Heap)
+		Vector4*		XM_CALLCONV Data() noexcept;
+
+		/// load the Points [Index, Index + 4) transposed, missing Points repeat the last Point
+		void			XM_CALLCONV LoadPoints4(const UINT Index, XMVECTOR& X, XMVECTOR& Y, XMVECTOR& Z) const noexcept;
+
+		/// Split with precomputed Distances
+		void			XM_CALLCONV SplitByDistances(const float* pDist, Polygon* pFront, Polygon* pBack, const float Epsilon) const;
+
+		Vector4			m_InlinePoints[INLINE_POINTS];	// Points for small Polygons
+		std::vector<Vector4, AAllocator<Vector4> > m_HeapPoints;	// Points for large Polygons
+		UINT			m_NumPoints;
+	};
+
+}; // end of namespace
+
+#endif
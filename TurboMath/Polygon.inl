@@ -0,0 +1,485 @@
+// -------------------------------------------------------------------
+// File			:	Polygon
+//
+// Project		:	TurboMath
+//
+// Description	:	convex planar Polygon with Plane-Classification and Clipping
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+namespace TurboMath
+{
+	//------------------------------------------------------------------------------
+	XM_INLINE Polygon::Polygon() noexcept
+		: m_NumPoints(0)
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Polygon::Polygon(const Vector4* pPoints, const UINT NumPoints)
+		: m_NumPoints(0)
+	{
+		Set(pPoints, NumPoints);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Polygon::Clear() noexcept
+	{
+		m_HeapPoints.clear();
+		m_NumPoints = 0;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Polygon::Set(const Vector4* pPoints, const UINT NumPoints)
+	{
+		assert(pPoints != nullptr || NumPoints == 0);
+
+		if (NumPoints <= INLINE_POINTS)
+		{
+			m_HeapPoints.clear();
+
+			for (UINT i = 0; i < NumPoints; i++)
+				m_InlinePoints[i] = pPoints[i];
+		}
+		else
+			m_HeapPoints.assign(pPoints, pPoints + NumPoints);
+
+		m_NumPoints = NumPoints;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Polygon::AddPoint(const Vector4& Point)
+	{
+		if (m_HeapPoints.empty())
+		{
+			if (m_NumPoints < INLINE_POINTS)
+			{
+				m_InlinePoints[m_NumPoints++] = Point;
+				return;
+			}
+
+			// inline Storage is full, move to the Heap
+			m_HeapPoints.reserve(INLINE_POINTS * 2);
+			m_HeapPoints.assign(m_InlinePoints, m_InlinePoints + m_NumPoints);
+		}
+
+		m_HeapPoints.push_back(Point);
+		m_NumPoints++;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Polygon::SetPoint(const UINT Index, const Vector4& Point) noexcept
+	{
+		assert(Index < m_NumPoints);
+
+		Data()[Index] = Point;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const Vector4& XM_CALLCONV Polygon::GetPoint(const UINT Index) const noexcept
+	{
+		assert(Index < m_NumPoints);
+
+		return GetPoints()[Index];
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const Vector4* XM_CALLCONV Polygon::GetPoints() const noexcept
+	{
+		return m_HeapPoints.empty() ? m_InlinePoints : m_HeapPoints.data();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE Vector4* XM_CALLCONV Polygon::Data() noexcept
+	{
+		return m_HeapPoints.empty() ? m_InlinePoints : m_HeapPoints.data();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV Polygon::GetNumPoints() const noexcept
+	{
+		return m_NumPoints;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV Polygon::IsValid() const noexcept
+	{
+		return m_NumPoints >= 3;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Polygon::Flip() noexcept
+	{
+		Vector4* pPoints = Data();
+
+		for (UINT i = 0, j = m_NumPoints - 1; m_NumPoints > 1 && i < j; i++, j--)
+		{
+			const XMVECTOR Temp = pPoints[i];
+			pPoints[i] = pPoints[j];
+			pPoints[j] = Temp;
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	// Properties
+	//------------------------------------------------------------------------------
+	XM_INLINE const Vector4 XM_CALLCONV Polygon::GetCenter() const noexcept
+	{
+		if (m_NumPoints == 0)
+			return Vector4();
+
+		const Vector4* pPoints = GetPoints();
+
+		XMVECTOR Sum = XMVectorZero();
+
+		for (UINT i = 0; i < m_NumPoints; i++)
+			Sum = XMVectorAdd(Sum, pPoints[i]);
+
+		return XMVectorScale(Sum, 1.0f / (float)m_NumPoints);
+	}
+
+	//------------------------------------------------------------------------------
+	// Newell-Method : the Sum of the Cross-Products of all Edges (relative to the
+	// Center) is twice the Area-Vector, no Choice of 3 "good" Points needed.
+	XM_INLINE const Plane XM_CALLCONV Polygon::GetPlane() const noexcept
+	{
+		assert(IsValid());
+
+		const Vector4* pPoints = GetPoints();
+		const XMVECTOR Center = GetCenter();
+
+		XMVECTOR Normal = XMVectorZero();
+		XMVECTOR Prev = XMVectorSubtract(pPoints[m_NumPoints - 1], Center);
+
+		for (UINT i = 0; i < m_NumPoints; i++)
+		{
+			const XMVECTOR Cur = XMVectorSubtract(pPoints[i], Center);
+			Normal = XMVectorAdd(Normal, XMVector3Cross(Prev, Cur));
+			Prev = Cur;
+		}
+
+		return Plane(XMPlaneFromPointNormal(Center, XMVector3Normalize(Normal)));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const float XM_CALLCONV Polygon::GetArea() const noexcept
+	{
+		if (!IsValid())
+			return 0.0f;
+
+		const Vector4* pPoints = GetPoints();
+		const XMVECTOR Center = GetCenter();
+
+		XMVECTOR Normal = XMVectorZero();
+		XMVECTOR Prev = XMVectorSubtract(pPoints[m_NumPoints - 1], Center);
+
+		for (UINT i = 0; i < m_NumPoints; i++)
+		{
+			const XMVECTOR Cur = XMVectorSubtract(pPoints[i], Center);
+			Normal = XMVectorAdd(Normal, XMVector3Cross(Prev, Cur));
+			Prev = Cur;
+		}
+
+		return 0.5f * XMVectorGetX(XMVector3Length(Normal));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const AABB XM_CALLCONV Polygon::GetAABB() const noexcept
+	{
+		AABB Result;
+
+		if (m_NumPoints == 0)
+			return Result;
+
+		const Vector4* pPoints = GetPoints();
+
+		XMVECTOR vMin = pPoints[0];
+		XMVECTOR vMax = vMin;
+
+		for (UINT i = 1; i < m_NumPoints; i++)
+		{
+			vMin = XMVectorMin(vMin, pPoints[i]);
+			vMax = XMVectorMax(vMax, pPoints[i]);
+		}
+
+		Result.SetMinMaxExtents(Vector4(vMin), Vector4(vMax));
+		return Result;
+	}
+
+	//------------------------------------------------------------------------------
+	// Plane-Tests
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Polygon::LoadPoints4(const UINT Index, XMVECTOR& X, XMVECTOR& Y, XMVECTOR& Z) const noexcept
+	{
+		const Vector4* pPoints = GetPoints();
+		const UINT Last = m_NumPoints - 1;
+
+		XMMATRIX M(	pPoints[Index],
+					pPoints[XMMin(Index + 1, Last)],
+					pPoints[XMMin(Index + 2, Last)],
+					pPoints[XMMin(Index + 3, Last)] );
+
+		M = XMMatrixTranspose(M);
+
+		X = M.r[0];
+		Y = M.r[1];
+		Z = M.r[2];
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV Polygon::ComputeDistances(const Plane& thePlane, float* pDist) const noexcept
+	{
+		assert(pDist != nullptr || m_NumPoints == 0);
+
+		const XMVECTOR P = thePlane.Get();
+		const XMVECTOR PX = XMVectorSplatX(P);
+		const XMVECTOR PY = XMVectorSplatY(P);
+		const XMVECTOR PZ = XMVectorSplatZ(P);
+		const XMVECTOR PW = XMVectorSplatW(P);
+
+		XMFLOAT4A Dist4;
+
+		for (UINT i = 0; i < m_NumPoints; i += 4)
+		{
+			XMVECTOR X, Y, Z;
+			LoadPoints4(i, X, Y, Z);
+
+			const XMVECTOR D = XMVectorMultiplyAdd(Z, PZ, XMVectorMultiplyAdd(Y, PY, XMVectorMultiplyAdd(X, PX, PW)));
+
+			if (i + 4 <= m_NumPoints)
+				XMStoreFloat4((XMFLOAT4*)&pDist[i], D);
+			else
+			{
+				XMStoreFloat4A(&Dist4, D);
+
+				const float* pSrc = &Dist4.x;
+				for (UINT j = i; j < m_NumPoints; j++)
+					pDist[j] = pSrc[j - i];
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const eCullClassify XM_CALLCONV Polygon::Classify(const Plane& thePlane, const float Epsilon) const noexcept
+	{
+		const XMVECTOR P = thePlane.Get();
+		const XMVECTOR PX = XMVectorSplatX(P);
+		const XMVECTOR PY = XMVectorSplatY(P);
+		const XMVECTOR PZ = XMVectorSplatZ(P);
+		const XMVECTOR PW = XMVectorSplatW(P);
+
+		const XMVECTOR vEpsilon = XMVectorReplicate(Epsilon);
+		const XMVECTOR vNegEpsilon = XMVectorNegate(vEpsilon);
+
+		XMVECTOR AnyFront = XMVectorFalseInt();
+		XMVECTOR AnyBack = XMVectorFalseInt();
+
+		// missing Points in the last Block repeat the last Point, so they dont change the Result
+		for (UINT i = 0; i < m_NumPoints; i += 4)
+		{
+			XMVECTOR X, Y, Z;
+			LoadPoints4(i, X, Y, Z);
+
+			const XMVECTOR D = XMVectorMultiplyAdd(Z, PZ, XMVectorMultiplyAdd(Y, PY, XMVectorMultiplyAdd(X, PX, PW)));
+
+			AnyFront = XMVectorOrInt(AnyFront, XMVectorGreater(D, vEpsilon));
+			AnyBack = XMVectorOrInt(AnyBack, XMVectorLess(D, vNegEpsilon));
+		}
+
+		const bool bFront = !XMVector4EqualInt(AnyFront, XMVectorFalseInt());
+		const bool bBack = !XMVector4EqualInt(AnyBack, XMVectorFalseInt());
+
+		if (bFront && bBack)
+			return CLIPPED;
+		if (bFront)
+			return FRONT;
+		if (bBack)
+			return BACK;
+
+		return PLANAR;
+	}
+
+	//------------------------------------------------------------------------------
+	// Sutherland-Hodgman for both Sides at once. Points on the Plane go to both
+	// Sides, Edges crossing the Plane add the Intersection-Point to both Sides.
+	XM_INLINE void XM_CALLCONV Polygon::SplitByDistances(const float* pDist, Polygon* pFront, Polygon* pBack, const float Epsilon) const
+	{
+		const Vector4* pPoints = GetPoints();
+
+		for (UINT i = 0; i < m_NumPoints; i++)
+		{
+			const UINT Next = (i + 1 == m_NumPoints) ? 0 : i + 1;
+
+			const float dCur = pDist[i];
+			const float dNext = pDist[Next];
+
+			if (dCur > Epsilon)
+			{
+				if (pFront) pFront->AddPoint(pPoints[i]);
+			}
+			else if (dCur < -Epsilon)
+			{
+				if (pBack) pBack->AddPoint(pPoints[i]);
+			}
+			else
+			{
+				if (pFront) pFront->AddPoint(pPoints[i]);
+				if (pBack) pBack->AddPoint(pPoints[i]);
+			}
+
+			// Edge crosses the Plane ?
+			if ((dCur > Epsilon && dNext < -Epsilon) || (dCur < -Epsilon && dNext > Epsilon))
+			{
+				const float t = dCur / (dCur - dNext);
+				const Vector4 Hit = XMVectorLerp(pPoints[i], pPoints[Next], t);
+
+				if (pFront) pFront->AddPoint(Hit);
+				if (pBack) pBack->AddPoint(Hit);
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const eCullClassify XM_CALLCONV Polygon::Split(const Plane& thePlane, Polygon* pFront, Polygon* pBack, const float Epsilon) const
+	{
+		assert(pFront != this && pBack != this);
+
+		if (pFront) pFront->Clear();
+		if (pBack) pBack->Clear();
+
+		float StackDist[INLINE_POINTS];
+		std::vector<float> HeapDist;
+		float* pDist = StackDist;
+
+		if (m_NumPoints > INLINE_POINTS)
+		{
+			HeapDist.resize(m_NumPoints);
+			pDist = HeapDist.data();
+		}
+
+		ComputeDistances(thePlane, pDist);
+
+		bool bFront = false, bBack = false;
+
+		for (UINT i = 0; i < m_NumPoints; i++)
+		{
+			bFront |= pDist[i] > Epsilon;
+			bBack |= pDist[i] < -Epsilon;
+		}
+
+		if (bFront && bBack)
+		{
+			SplitByDistances(pDist, pFront, pBack, Epsilon);
+			return CLIPPED;
+		}
+
+		const Vector4* pPoints = GetPoints();
+
+		if (bFront)
+		{
+			if (pFront) pFront->Set(pPoints, m_NumPoints);
+			return FRONT;
+		}
+
+		if (bBack)
+		{
+			if (pBack) pBack->Set(pPoints, m_NumPoints);
+			return BACK;
+		}
+
+		// planar, sort by the Direction of the Normal
+		if (IsValid())
+		{
+			const float Facing = XMVectorGetX(XMVector3Dot(GetPlane().Get(), thePlane.Get()));
+
+			if (Facing >= 0.0f)
+			{
+				if (pFront) pFront->Set(pPoints, m_NumPoints);
+			}
+			else
+			{
+				if (pBack) pBack->Set(pPoints, m_NumPoints);
+			}
+		}
+
+		return PLANAR;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV Polygon::Clip(const Plane& thePlane, const float Epsilon)
+	{
+		float StackDist[INLINE_POINTS];
+		std::vector<float> HeapDist;
+		float* pDist = StackDist;
+
+		if (m_NumPoints > INLINE_POINTS)
+		{
+			HeapDist.resize(m_NumPoints);
+			pDist = HeapDist.data();
+		}
+
+		ComputeDistances(thePlane, pDist);
+
+		bool bFront = false, bBack = false;
+
+		for (UINT i = 0; i < m_NumPoints; i++)
+		{
+			bFront |= pDist[i] > Epsilon;
+			bBack |= pDist[i] < -Epsilon;
+		}
+
+		// completely inside (or on the Plane)
+		if (!bFront)
+			return IsValid();
+
+		// completely outside
+		if (!bBack)
+		{
+			Clear();
+			return false;
+		}
+
+		Polygon Inside;
+		SplitByDistances(pDist, nullptr, &Inside, Epsilon);
+
+		Set(Inside.GetPoints(), Inside.GetNumPoints());
+
+		return IsValid();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV Polygon::Clip(const Plane* pPlanes, const UINT NumPlanes, const float Epsilon)
+	{
+		assert(pPlanes != nullptr || NumPlanes == 0);
+
+		for (UINT i = 0; i < NumPlanes; i++)
+		{
+			if (!Clip(pPlanes[i], Epsilon))
+				return false;
+		}
+
+		return IsValid();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV Polygon::Clip(const Frustum& theFrustum, const float Epsilon)
+	{
+		Plane Planes[6];
+		theFrustum.ComputePlanes(Planes[0], Planes[1], Planes[2], Planes[3], Planes[4], Planes[5]);
+
+		return Clip(Planes, 6, Epsilon);
+	}
+
+}// end of Namespace TurboMath
@@ -391,7 +391,7 @@ namespace TurboMath
 
 		XMScalarSinCos(&sX, &cX, (fPitch/2.0f) );
 		XMScalarSinCos(&sY, &cY, (fYaw/2.0f) );
-		XMScalarSinCos(&cZ, &sZ, (fRoll/2.0f) );
+		XMScalarSinCos(&sZ, &cZ, (fRoll/2.0f) );
 
 		cYcZ = cY * cZ;
 		sYsZ = sY * sZ;
@@ -0,0 +1,131 @@
+// -------------------------------------------------------------------
+// File			:	QuatArray
+//
+// Project		:	TurboMath
+//
+// Description	:	Array of Quaternions as SoA-Streams with Batch-Kernels
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_QUATARRAY_H_
+#define _TURBOMATH_QUATARRAY_H_
+
+#include <vector>
+
+namespace TurboMath
+{
+
+	//-----------------------------------------------------------------------------
+	// Quaternions stored as SoA-Streams (x[], y[], z[], w[]) for Animation-
+	// Blending and other Batch-Work. The Kernels work like the static Functions
+	// of Quat, but on whole Arrays : 4 Quaternions per Instruction (8 with
+	// AVX for Multiply, Normalize and NLerp).
+	//
+	// The Streams are padded to a Multiple of 8 with Identity-Quaternions, so
+	// the Kernels need no Tail-Handling. The Output may be one of the Inputs,
+	// it is resized to the Count of the first Input.
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class QuatArray
+	{
+	public:
+
+		typedef std::vector<float, AAllocator<float> >	FloatStream;
+
+		QuatArray() noexcept;
+		explicit QuatArray(const UINT Count);
+		~QuatArray() noexcept;
+
+		/// remove all Quaternions
+		void			XM_CALLCONV Clear() noexcept;
+
+		/// set the Number of Quaternions (new ones are Identity)
+		void			XM_CALLCONV Resize(const UINT Count);
+
+		/// get Number of Quaternions
+		const UINT		XM_CALLCONV GetCount() const noexcept			{ return m_Count; }
+
+		//-----------------------------------------------------------------------------
+		// Access
+		//-----------------------------------------------------------------------------
+		void			XM_CALLCONV Set(const UINT Index, const Quat& q) noexcept;
+		const Quat		XM_CALLCONV Get(const UINT Index) const noexcept;
+
+		/// copy Count Quaternions into the Array (resizes it)
+		void			XM_CALLCONV Load(const Quat* pQuats, const UINT Count);
+
+		/// copy the Quaternions out of the Array
+		void			XM_CALLCONV Store(Quat* pQuats) const noexcept;
+
+		/// Raw Streams (padded to a Multiple of 8)
+		float*			XM_CALLCONV GetX() noexcept						{ return m_X.data(); }
+		float*			XM_CALLCONV GetY() noexcept						{ return m_Y.data(); }
+		float*			XM_CALLCONV GetZ() noexcept						{ return m_Z.data(); }
+		float*			XM_CALLCONV GetW() noexcept						{ return m_W.data(); }
+		const float*	XM_CALLCONV GetX() const noexcept				{ return m_X.data(); }
+		const float*	XM_CALLCONV GetY() const noexcept				{ return m_Y.data(); }
+		const float*	XM_CALLCONV GetZ() const noexcept				{ return m_Z.data(); }
+		const float*	XM_CALLCONV GetW() const noexcept				{ return m_W.data(); }
+
+		//-----------------------------------------------------------------------------
+		// Batch-Kernels (per Element like the Functions of Quat)
+		//-----------------------------------------------------------------------------
+
+		/// Out[i] = Quat::Multiply(q0[i], q1[i]) (Rotation q0, then q1)
+		static void		XM_CALLCONV Multiply(const QuatArray& q0, const QuatArray& q1, QuatArray& Out);
+
+		/// Out[i] = Quat::Normalize(q[i])
+		static void		XM_CALLCONV Normalize(const QuatArray& q, QuatArray& Out);
+
+		/// fast Slerp : normalized Lerp with corrected Parameter (Angle-Error < 1e-3 Radians)
+		static void		XM_CALLCONV NLerp(const QuatArray& q1, const QuatArray& q2, const float t, QuatArray& Out);
+
+		/// Out[i] = Quat::Slerp(q1[i], q2[i], t)
+		static void		XM_CALLCONV Slerp(const QuatArray& q1, const QuatArray& q2, const float t, QuatArray& Out);
+
+		/// Out[i] = Quat::Squad(q1[i], a[i], b[i], c[i], t) (Control-Points from Quat::SquadSetup)
+		static void		XM_CALLCONV Squad(const QuatArray& q1, const QuatArray& a, const QuatArray& b, const QuatArray& c, const float t, QuatArray& Out);
+
+		/// Rotation-Matrices of all (unit) Quaternions
+		void			XM_CALLCONV ToMatrices(Matrix* pMatrices) const noexcept;
+
+	protected:
+
+		/// 4 Quaternions in Registers
+		struct Lanes
+		{
+			XMVECTOR	x, y, z, w;
+		};
+
+		/// load / store the 4 Quaternions at Index i
+		const Lanes		XM_CALLCONV LoadLanes(const UINT i) const noexcept;
+		void			XM_CALLCONV StoreLanes(const UINT i, const Lanes& q) noexcept;
+
+		/// Slerp of 4 Quaternions
+		static const Lanes XM_CALLCONV SlerpLanes(const Lanes& q1, const Lanes& q2, FXMVECTOR t) noexcept;
+
+		/// padded Size of the Streams
+		const UINT		XM_CALLCONV GetPaddedCount() const noexcept		{ return (UINT)m_X.size(); }
+
+		FloatStream		m_X, m_Y, m_Z, m_W;
+		UINT			m_Count;
+	};
+
+}; // end of namespace
+
+#endif
@@ -0,0 +1,497 @@
+// -------------------------------------------------------------------
+// File			:	QuatArray
+//
+// Project		:	TurboMath
+//
+// Description	:	Array of Quaternions as SoA-Streams with Batch-Kernels
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+namespace TurboMath
+{
+	//------------------------------------------------------------------------------
+	XM_INLINE QuatArray::QuatArray() noexcept
+		: m_Count(0)
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE QuatArray::QuatArray(const UINT Count)
+		: m_Count(0)
+	{
+		Resize(Count);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE QuatArray::~QuatArray() noexcept
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV QuatArray::Clear() noexcept
+	{
+		m_X.clear();
+		m_Y.clear();
+		m_Z.clear();
+		m_W.clear();
+
+		m_Count = 0;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV QuatArray::Resize(const UINT Count)
+	{
+		const UINT NumPadded = (Count + 7) & ~7u;
+
+		m_X.resize(NumPadded, 0.0f);
+		m_Y.resize(NumPadded, 0.0f);
+		m_Z.resize(NumPadded, 0.0f);
+		m_W.resize(NumPadded, 1.0f);
+
+		// Elements behind the Count are always Identity
+		for (UINT i = Count; i < XMMin(m_Count, NumPadded); i++)
+		{
+			m_X[i] = 0.0f;
+			m_Y[i] = 0.0f;
+			m_Z[i] = 0.0f;
+			m_W[i] = 1.0f;
+		}
+
+		m_Count = Count;
+	}
+
+	//------------------------------------------------------------------------------
+	// Access
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV QuatArray::Set(const UINT Index, const Quat& q) noexcept
+	{
+		assert(Index < m_Count);
+
+		CACHE_ALIGN(16) float f[4];
+
+		XMStoreFloat4A((XMFLOAT4A*)f, q.Get());
+
+		m_X[Index] = f[0];
+		m_Y[Index] = f[1];
+		m_Z[Index] = f[2];
+		m_W[Index] = f[3];
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const Quat XM_CALLCONV QuatArray::Get(const UINT Index) const noexcept
+	{
+		assert(Index < m_Count);
+
+		return Quat(m_X[Index], m_Y[Index], m_Z[Index], m_W[Index]);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV QuatArray::Load(const Quat* pQuats, const UINT Count)
+	{
+		assert(pQuats != nullptr || Count == 0);
+
+		Resize(Count);
+
+		for (UINT i = 0; i < Count; i++)
+			Set(i, pQuats[i]);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV QuatArray::Store(Quat* pQuats) const noexcept
+	{
+		assert(pQuats != nullptr || m_Count == 0);
+
+		for (UINT i = 0; i < m_Count; i++)
+			pQuats[i] = XMVectorSet(m_X[i], m_Y[i], m_Z[i], m_W[i]);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const QuatArray::Lanes XM_CALLCONV QuatArray::LoadLanes(const UINT i) const noexcept
+	{
+		Lanes q;
+
+		q.x = XMLoadFloat4((const XMFLOAT4*)&m_X[i]);
+		q.y = XMLoadFloat4((const XMFLOAT4*)&m_Y[i]);
+		q.z = XMLoadFloat4((const XMFLOAT4*)&m_Z[i]);
+		q.w = XMLoadFloat4((const XMFLOAT4*)&m_W[i]);
+
+		return q;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV QuatArray::StoreLanes(const UINT i, const Lanes& q) noexcept
+	{
+		XMStoreFloat4((XMFLOAT4*)&m_X[i], q.x);
+		XMStoreFloat4((XMFLOAT4*)&m_Y[i], q.y);
+		XMStoreFloat4((XMFLOAT4*)&m_Z[i], q.z);
+		XMStoreFloat4((XMFLOAT4*)&m_W[i], q.w);
+	}
+
+	//------------------------------------------------------------------------------
+	// Batch-Kernels
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV QuatArray::Multiply(const QuatArray& q0, const QuatArray& q1, QuatArray& Out)
+	{
+		assert(q0.GetCount() == q1.GetCount());
+
+		Out.Resize(q0.GetCount());
+
+		const UINT NumPadded = q0.GetPaddedCount();
+
+		const float* pAx = q0.GetX(); const float* pAy = q0.GetY(); const float* pAz = q0.GetZ(); const float* pAw = q0.GetW();
+		const float* pBx = q1.GetX(); const float* pBy = q1.GetY(); const float* pBz = q1.GetZ(); const float* pBw = q1.GetW();
+		float* pOx = Out.GetX(); float* pOy = Out.GetY(); float* pOz = Out.GetZ(); float* pOw = Out.GetW();
+
+#ifdef XM_AVX_INTRINSICS
+
+		for (UINT i = 0; i < NumPadded; i += 8)
+		{
+			const __m256 ax = _mm256_loadu_ps(pAx + i), ay = _mm256_loadu_ps(pAy + i), az = _mm256_loadu_ps(pAz + i), aw = _mm256_loadu_ps(pAw + i);
+			const __m256 bx = _mm256_loadu_ps(pBx + i), by = _mm256_loadu_ps(pBy + i), bz = _mm256_loadu_ps(pBz + i), bw = _mm256_loadu_ps(pBw + i);
+
+			// q1 * q0 (Hamilton), like XMQuaternionMultiply(q0, q1)
+			const __m256 x = _mm256_sub_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(bw, ax), _mm256_mul_ps(bx, aw)), _mm256_mul_ps(by, az)), _mm256_mul_ps(bz, ay));
+			const __m256 y = _mm256_add_ps(_mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(bw, ay), _mm256_mul_ps(bx, az)), _mm256_mul_ps(by, aw)), _mm256_mul_ps(bz, ax));
+			const __m256 z = _mm256_add_ps(_mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(bw, az), _mm256_mul_ps(bx, ay)), _mm256_mul_ps(by, ax)), _mm256_mul_ps(bz, aw));
+			const __m256 w = _mm256_sub_ps(_mm256_sub_ps(_mm256_sub_ps(_mm256_mul_ps(bw, aw), _mm256_mul_ps(bx, ax)), _mm256_mul_ps(by, ay)), _mm256_mul_ps(bz, az));
+
+			_mm256_storeu_ps(pOx + i, x);
+			_mm256_storeu_ps(pOy + i, y);
+			_mm256_storeu_ps(pOz + i, z);
+			_mm256_storeu_ps(pOw + i, w);
+		}
+
+#else
+
+		for (UINT i = 0; i < NumPadded; i += 4)
+		{
+			const XMVECTOR ax = XMLoadFloat4((const XMFLOAT4*)(pAx + i)), ay = XMLoadFloat4((const XMFLOAT4*)(pAy + i));
+			const XMVECTOR az = XMLoadFloat4((const XMFLOAT4*)(pAz + i)), aw = XMLoadFloat4((const XMFLOAT4*)(pAw + i));
+			const XMVECTOR bx = XMLoadFloat4((const XMFLOAT4*)(pBx + i)), by = XMLoadFloat4((const XMFLOAT4*)(pBy + i));
+			const XMVECTOR bz = XMLoadFloat4((const XMFLOAT4*)(pBz + i)), bw = XMLoadFloat4((const XMFLOAT4*)(pBw + i));
+
+			// q1 * q0 (Hamilton), like XMQuaternionMultiply(q0, q1)
+			const XMVECTOR x = XMVectorNegativeMultiplySubtract(bz, ay, XMVectorMultiplyAdd(by, az, XMVectorMultiplyAdd(bx, aw, XMVectorMultiply(bw, ax))));
+			const XMVECTOR y = XMVectorMultiplyAdd(bz, ax, XMVectorMultiplyAdd(by, aw, XMVectorNegativeMultiplySubtract(bx, az, XMVectorMultiply(bw, ay))));
+			const XMVECTOR z = XMVectorMultiplyAdd(bz, aw, XMVectorNegativeMultiplySubtract(by, ax, XMVectorMultiplyAdd(bx, ay, XMVectorMultiply(bw, az))));
+			const XMVECTOR w = XMVectorNegativeMultiplySubtract(bz, az, XMVectorNegativeMultiplySubtract(by, ay, XMVectorNegativeMultiplySubtract(bx, ax, XMVectorMultiply(bw, aw))));
+
+			XMStoreFloat4((XMFLOAT4*)(pOx + i), x);
+			XMStoreFloat4((XMFLOAT4*)(pOy + i), y);
+			XMStoreFloat4((XMFLOAT4*)(pOz + i), z);
+			XMStoreFloat4((XMFLOAT4*)(pOw + i), w);
+		}
+
+#endif
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV QuatArray::Normalize(const QuatArray& q, QuatArray& Out)
+	{
+		Out.Resize(q.GetCount());
+
+		const UINT NumPadded = q.GetPaddedCount();
+
+		const float* pX = q.GetX(); const float* pY = q.GetY(); const float* pZ = q.GetZ(); const float* pW = q.GetW();
+		float* pOx = Out.GetX(); float* pOy = Out.GetY(); float* pOz = Out.GetZ(); float* pOw = Out.GetW();
+
+#ifdef XM_AVX_INTRINSICS
+
+		const __m256 One = _mm256_set1_ps(1.0f);
+		const __m256 Zero = _mm256_setzero_ps();
+
+		for (UINT i = 0; i < NumPadded; i += 8)
+		{
+			const __m256 x = _mm256_loadu_ps(pX + i), y = _mm256_loadu_ps(pY + i), z = _mm256_loadu_ps(pZ + i), w = _mm256_loadu_ps(pW + i);
+
+			const __m256 LenSq = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_add_ps(_mm256_mul_ps(z, z), _mm256_mul_ps(w, w)));
+
+			// zero Quaternions stay zero
+			const __m256 InvLen = _mm256_and_ps(_mm256_div_ps(One, _mm256_sqrt_ps(LenSq)), _mm256_cmp_ps(LenSq, Zero, _CMP_GT_OQ));
+
+			_mm256_storeu_ps(pOx + i, _mm256_mul_ps(x, InvLen));
+			_mm256_storeu_ps(pOy + i, _mm256_mul_ps(y, InvLen));
+			_mm256_storeu_ps(pOz + i, _mm256_mul_ps(z, InvLen));
+			_mm256_storeu_ps(pOw + i, _mm256_mul_ps(w, InvLen));
+		}
+
+#else
+
+		const XMVECTOR One = XMVectorSplatOne();
+		const XMVECTOR Zero = XMVectorZero();
+
+		for (UINT i = 0; i < NumPadded; i += 4)
+		{
+			const XMVECTOR x = XMLoadFloat4((const XMFLOAT4*)(pX + i)), y = XMLoadFloat4((const XMFLOAT4*)(pY + i));
+			const XMVECTOR z = XMLoadFloat4((const XMFLOAT4*)(pZ + i)), w = XMLoadFloat4((const XMFLOAT4*)(pW + i));
+
+			// the same Operations in the same Order as the AVX-Path (no Estimate, no FMA), so both Builds give the same Bits
+			const XMVECTOR LenSq = XMVectorAdd(XMVectorAdd(XMVectorMultiply(x, x), XMVectorMultiply(y, y)), XMVectorAdd(XMVectorMultiply(z, z), XMVectorMultiply(w, w)));
+
+			// zero Quaternions stay zero
+			const XMVECTOR InvLen = XMVectorAndInt(XMVectorDivide(One, XMVectorSqrt(LenSq)), XMVectorGreater(LenSq, Zero));
+
+			XMStoreFloat4((XMFLOAT4*)(pOx + i), XMVectorMultiply(x, InvLen));
+			XMStoreFloat4((XMFLOAT4*)(pOy + i), XMVectorMultiply(y, InvLen));
+			XMStoreFloat4((XMFLOAT4*)(pOz + i), XMVectorMultiply(z, InvLen));
+			XMStoreFloat4((XMFLOAT4*)(pOw + i), XMVectorMultiply(w, InvLen));
+		}
+
+#endif
+	}
+
+	//------------------------------------------------------------------------------
+	// Lerp on the shorter Arc with a Parameter t', which is corrected by a Fit
+	// over the Angle between the Quaternions (Cos = |q1 . q2|), so the Rotation
+	// moves with nearly constant Speed like Slerp, but without acos / sin :
+	//
+	//	k  = A(Cos) * (t - 0.5)^2 + B(Cos)
+	//	t' = t + t * (t - 0.5) * (t - 1) * k
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV QuatArray::NLerp(const QuatArray& q1, const QuatArray& q2, const float t, QuatArray& Out)
+	{
+		assert(q1.GetCount() == q2.GetCount());
+
+		Out.Resize(q1.GetCount());
+
+		const UINT NumPadded = q1.GetPaddedCount();
+
+		const float* pAx = q1.GetX(); const float* pAy = q1.GetY(); const float* pAz = q1.GetZ(); const float* pAw = q1.GetW();
+		const float* pBx = q2.GetX(); const float* pBy = q2.GetY(); const float* pBz = q2.GetZ(); const float* pBw = q2.GetW();
+		float* pOx = Out.GetX(); float* pOy = Out.GetY(); float* pOz = Out.GetZ(); float* pOw = Out.GetW();
+
+		const float th = t - 0.5f;
+		const float tCorr = t * th * (t - 1.0f);
+
+#ifdef XM_AVX_INTRINSICS
+
+		const __m256 T = _mm256_set1_ps(t);
+		const __m256 Th2 = _mm256_set1_ps(th * th);
+		const __m256 TCorr = _mm256_set1_ps(tCorr);
+		const __m256 One = _mm256_set1_ps(1.0f);
+		const __m256 SignMask = _mm256_set1_ps(-0.0f);
+
+		for (UINT i = 0; i < NumPadded; i += 8)
+		{
+			const __m256 ax = _mm256_loadu_ps(pAx + i), ay = _mm256_loadu_ps(pAy + i), az = _mm256_loadu_ps(pAz + i), aw = _mm256_loadu_ps(pAw + i);
+			const __m256 bx = _mm256_loadu_ps(pBx + i), by = _mm256_loadu_ps(pBy + i), bz = _mm256_loadu_ps(pBz + i), bw = _mm256_loadu_ps(pBw + i);
+
+			const __m256 Dot = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax, bx), _mm256_mul_ps(ay, by)), _mm256_add_ps(_mm256_mul_ps(az, bz), _mm256_mul_ps(aw, bw)));
+			const __m256 Sign = _mm256_and_ps(Dot, SignMask);
+			const __m256 Cos = _mm256_andnot_ps(SignMask, Dot);
+
+			// A = 1.0904 - 3.2452 Cos + 3.55645 Cos^2 - 1.43519 Cos^3, B = 0.848013 - 1.06021 Cos + 0.215638 Cos^2
+			__m256 A = _mm256_sub_ps(_mm256_set1_ps(3.55645f), _mm256_mul_ps(Cos, _mm256_set1_ps(1.43519f)));
+			A = _mm256_add_ps(_mm256_set1_ps(-3.2452f), _mm256_mul_ps(Cos, A));
+			A = _mm256_add_ps(_mm256_set1_ps(1.0904f), _mm256_mul_ps(Cos, A));
+
+			__m256 B = _mm256_add_ps(_mm256_set1_ps(-1.06021f), _mm256_mul_ps(Cos, _mm256_set1_ps(0.215638f)));
+			B = _mm256_add_ps(_mm256_set1_ps(0.848013f), _mm256_mul_ps(Cos, B));
+
+			const __m256 K = _mm256_add_ps(_mm256_mul_ps(A, Th2), B);
+			const __m256 T1 = _mm256_add_ps(T, _mm256_mul_ps(TCorr, K));
+			const __m256 T0 = _mm256_sub_ps(One, T1);
+			const __m256 T1s = _mm256_xor_ps(T1, Sign);	// shorter Arc
+
+			const __m256 x = _mm256_add_ps(_mm256_mul_ps(ax, T0), _mm256_mul_ps(bx, T1s));
+			const __m256 y = _mm256_add_ps(_mm256_mul_ps(ay, T0), _mm256_mul_ps(by, T1s));
+			const __m256 z = _mm256_add_ps(_mm256_mul_ps(az, T0), _mm256_mul_ps(bz, T1s));
+			const __m256 w = _mm256_add_ps(_mm256_mul_ps(aw, T0), _mm256_mul_ps(bw, T1s));
+
+			const __m256 LenSq = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_add_ps(_mm256_mul_ps(z, z), _mm256_mul_ps(w, w)));
+			const __m256 InvLen = _mm256_div_ps(One, _mm256_sqrt_ps(LenSq));
+
+			_mm256_storeu_ps(pOx + i, _mm256_mul_ps(x, InvLen));
+			_mm256_storeu_ps(pOy + i, _mm256_mul_ps(y, InvLen));
+			_mm256_storeu_ps(pOz + i, _mm256_mul_ps(z, InvLen));
+			_mm256_storeu_ps(pOw + i, _mm256_mul_ps(w, InvLen));
+		}
+
+#else
+
+		const XMVECTOR T = XMVectorReplicate(t);
+		const XMVECTOR Th2 = XMVectorReplicate(th * th);
+		const XMVECTOR TCorr = XMVectorReplicate(tCorr);
+		const XMVECTOR One = XMVectorSplatOne();
+		const XMVECTOR SignMask = XMVectorSplatSignMask();
+
+		for (UINT i = 0; i < NumPadded; i += 4)
+		{
+			const XMVECTOR ax = XMLoadFloat4((const XMFLOAT4*)(pAx + i)), ay = XMLoadFloat4((const XMFLOAT4*)(pAy + i));
+			const XMVECTOR az = XMLoadFloat4((const XMFLOAT4*)(pAz + i)), aw = XMLoadFloat4((const XMFLOAT4*)(pAw + i));
+			const XMVECTOR bx = XMLoadFloat4((const XMFLOAT4*)(pBx + i)), by = XMLoadFloat4((const XMFLOAT4*)(pBy + i));
+			const XMVECTOR bz = XMLoadFloat4((const XMFLOAT4*)(pBz + i)), bw = XMLoadFloat4((const XMFLOAT4*)(pBw + i));
+
+			// the same Operations in the same Order as the AVX-Path (no Estimate, no FMA), so both Builds give the same Bits
+			const XMVECTOR Dot = XMVectorAdd(XMVectorAdd(XMVectorMultiply(ax, bx), XMVectorMultiply(ay, by)), XMVectorAdd(XMVectorMultiply(az, bz), XMVectorMultiply(aw, bw)));
+			const XMVECTOR Sign = XMVectorAndInt(Dot, SignMask);
+			const XMVECTOR Cos = XMVectorAndCInt(Dot, SignMask);
+
+			XMVECTOR A = XMVectorSubtract(XMVectorReplicate(3.55645f), XMVectorMultiply(Cos, XMVectorReplicate(1.43519f)));
+			A = XMVectorAdd(XMVectorReplicate(-3.2452f), XMVectorMultiply(Cos, A));
+			A = XMVectorAdd(XMVectorReplicate(1.0904f), XMVectorMultiply(Cos, A));
+
+			XMVECTOR B = XMVectorAdd(XMVectorReplicate(-1.06021f), XMVectorMultiply(Cos, XMVectorReplicate(0.215638f)));
+			B = XMVectorAdd(XMVectorReplicate(0.848013f), XMVectorMultiply(Cos, B));
+
+			const XMVECTOR K = XMVectorAdd(XMVectorMultiply(A, Th2), B);
+			const XMVECTOR T1 = XMVectorAdd(T, XMVectorMultiply(TCorr, K));
+			const XMVECTOR T0 = XMVectorSubtract(One, T1);
+			const XMVECTOR T1s = XMVectorXorInt(T1, Sign);	// shorter Arc
+
+			const XMVECTOR x = XMVectorAdd(XMVectorMultiply(ax, T0), XMVectorMultiply(bx, T1s));
+			const XMVECTOR y = XMVectorAdd(XMVectorMultiply(ay, T0), XMVectorMultiply(by, T1s));
+			const XMVECTOR z = XMVectorAdd(XMVectorMultiply(az, T0), XMVectorMultiply(bz, T1s));
+			const XMVECTOR w = XMVectorAdd(XMVectorMultiply(aw, T0), XMVectorMultiply(bw, T1s));
+
+			const XMVECTOR LenSq = XMVectorAdd(XMVectorAdd(XMVectorMultiply(x, x), XMVectorMultiply(y, y)), XMVectorAdd(XMVectorMultiply(z, z), XMVectorMultiply(w, w)));
+			const XMVECTOR InvLen = XMVectorDivide(One, XMVectorSqrt(LenSq));
+
+			XMStoreFloat4((XMFLOAT4*)(pOx + i), XMVectorMultiply(x, InvLen));
+			XMStoreFloat4((XMFLOAT4*)(pOy + i), XMVectorMultiply(y, InvLen));
+			XMStoreFloat4((XMFLOAT4*)(pOz + i), XMVectorMultiply(z, InvLen));
+			XMStoreFloat4((XMFLOAT4*)(pOw + i), XMVectorMultiply(w, InvLen));
+		}
+
+#endif
+	}
+
+	//------------------------------------------------------------------------------
+	// like XMQuaternionSlerp : shorter Arc, Lerp for nearly equal Quaternions
+	//------------------------------------------------------------------------------
+	XM_INLINE const QuatArray::Lanes XM_CALLCONV QuatArray::SlerpLanes(const Lanes& q1, const Lanes& q2, FXMVECTOR t) noexcept
+	{
+		const XMVECTOR OneMinusEpsilon = XMVectorReplicate(1.0f - 0.00001f);
+
+		const XMVECTOR Dot = XMVectorMultiplyAdd(q1.x, q2.x, XMVectorMultiplyAdd(q1.y, q2.y, XMVectorMultiplyAdd(q1.z, q2.z, XMVectorMultiply(q1.w, q2.w))));
+		const XMVECTOR Sign = XMVectorAndInt(Dot, XMVectorSplatSignMask());
+		const XMVECTOR Cos = XMVectorAbs(Dot);
+
+		const XMVECTOR Omega = XMVectorACos(XMVectorMin(Cos, XMVectorSplatOne()));
+		const XMVECTOR InvSin = XMVectorReciprocal(XMVectorSin(Omega));
+
+		XMVECTOR S0 = XMVectorMultiply(XMVectorSin(XMVectorMultiply(XMVectorSubtract(XMVectorSplatOne(), t), Omega)), InvSin);
+		XMVECTOR S1 = XMVectorMultiply(XMVectorSin(XMVectorMultiply(t, Omega)), InvSin);
+
+		const XMVECTOR UseLerp = XMVectorGreaterOrEqual(Cos, OneMinusEpsilon);
+
+		S0 = XMVectorSelect(S0, XMVectorSubtract(XMVectorSplatOne(), t), UseLerp);
+		S1 = XMVectorXorInt(XMVectorSelect(S1, t, UseLerp), Sign);
+
+		Lanes Result;
+
+		Result.x = XMVectorMultiplyAdd(q2.x, S1, XMVectorMultiply(q1.x, S0));
+		Result.y = XMVectorMultiplyAdd(q2.y, S1, XMVectorMultiply(q1.y, S0));
+		Result.z = XMVectorMultiplyAdd(q2.z, S1, XMVectorMultiply(q1.z, S0));
+		Result.w = XMVectorMultiplyAdd(q2.w, S1, XMVectorMultiply(q1.w, S0));
+
+		return Result;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV QuatArray::Slerp(const QuatArray& q1, const QuatArray& q2, const float t, QuatArray& Out)
+	{
+		assert(q1.GetCount() == q2.GetCount());
+
+		Out.Resize(q1.GetCount());
+
+		const UINT NumPadded = q1.GetPaddedCount();
+		const XMVECTOR T = XMVectorReplicate(t);
+
+		for (UINT i = 0; i < NumPadded; i += 4)
+			Out.StoreLanes(i, SlerpLanes(q1.LoadLanes(i), q2.LoadLanes(i), T));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV QuatArray::Squad(const QuatArray& q1, const QuatArray& a, const QuatArray& b, const QuatArray& c, const float t, QuatArray& Out)
+	{
+		assert(q1.GetCount() == a.GetCount() && q1.GetCount() == b.GetCount() && q1.GetCount() == c.GetCount());
+
+		Out.Resize(q1.GetCount());
+
+		const UINT NumPadded = q1.GetPaddedCount();
+		const XMVECTOR T = XMVectorReplicate(t);
+		const XMVECTOR T2 = XMVectorReplicate(2.0f * t * (1.0f - t));
+
+		for (UINT i = 0; i < NumPadded; i += 4)
+		{
+			const Lanes Q03 = SlerpLanes(q1.LoadLanes(i), c.LoadLanes(i), T);
+			const Lanes Q12 = SlerpLanes(a.LoadLanes(i), b.LoadLanes(i), T);
+
+			Out.StoreLanes(i, SlerpLanes(Q03, Q12, T2));
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	// The 9 Elements are computed for 4 Quaternions at once, 3 Transposes turn
+	// them into the Rows of the 4 Matrices (like XMMatrixRotationQuaternion).
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV QuatArray::ToMatrices(Matrix* pMatrices) const noexcept
+	{
+		assert(pMatrices != nullptr || m_Count == 0);
+
+		const XMVECTOR One = XMVectorSplatOne();
+		const XMVECTOR Zero = XMVectorZero();
+
+		for (UINT i = 0; i < m_Count; i += 4)
+		{
+			const Lanes q = LoadLanes(i);
+
+			const XMVECTOR x2 = XMVectorAdd(q.x, q.x);
+			const XMVECTOR y2 = XMVectorAdd(q.y, q.y);
+			const XMVECTOR z2 = XMVectorAdd(q.z, q.z);
+
+			const XMVECTOR xx = XMVectorMultiply(q.x, x2), yy = XMVectorMultiply(q.y, y2), zz = XMVectorMultiply(q.z, z2);
+			const XMVECTOR xy = XMVectorMultiply(q.x, y2), xz = XMVectorMultiply(q.x, z2), yz = XMVectorMultiply(q.y, z2);
+			const XMVECTOR wx = XMVectorMultiply(q.w, x2), wy = XMVectorMultiply(q.w, y2), wz = XMVectorMultiply(q.w, z2);
+
+			XMMATRIX R0, R1, R2;
+
+			R0.r[0] = XMVectorSubtract(XMVectorSubtract(One, yy), zz);
+			R0.r[1] = XMVectorAdd(xy, wz);
+			R0.r[2] = XMVectorSubtract(xz, wy);
+			R0.r[3] = Zero;
+
+			R1.r[0] = XMVectorSubtract(xy, wz);
+			R1.r[1] = XMVectorSubtract(XMVectorSubtract(One, xx), zz);
+			R1.r[2] = XMVectorAdd(yz, wx);
+			R1.r[3] = Zero;
+
+			R2.r[0] = XMVectorAdd(xz, wy);
+			R2.r[1] = XMVectorSubtract(yz, wx);
+			R2.r[2] = XMVectorSubtract(XMVectorSubtract(One, xx), yy);
+			R2.r[3] = Zero;
+
+			R0 = XMMatrixTranspose(R0);
+			R1 = XMMatrixTranspose(R1);
+			R2 = XMMatrixTranspose(R2);
+
+			const UINT NumLanes = XMMin(m_Count - i, 4u);
+
+			for (UINT l = 0; l < NumLanes; l++)
+			{
+				XMMATRIX M;
+
+				M.r[0] = R0.r[l];
+				M.r[1] = R1.r[l];
+				M.r[2] = R2.r[l];
+				M.r[3] = g_XMIdentityR3;
+
+				pMatrices[i + l] = M;
+			}
+		}
+	}
+
+}// end of Namespace TurboMath
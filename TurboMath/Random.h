@@ -0,0 +1,107 @@
+// -------------------------------------------------------------------
+// File			:	Random
+//
+// Project		:	TurboMath
+//
+// Description	:	SIMD Random-Number-Generator (xoshiro128+) with Sample-Generators
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_RANDOM_H_
+#define _TURBOMATH_RANDOM_H_
+
+namespace TurboMath
+{
+	//-----------------------------------------------------------------------------
+	// 4 independent xoshiro128+ Generators in the Lanes of SSE-Registers, so
+	// every Call gives 4 Random-Numbers (instead of rand() per Component).
+	// The Generator is not thread-safe : use one per Thread / Job and seed it
+	// with (Seed, Stream = Job-Index) - the Results are then deterministic,
+	// independent of the Number of Threads.
+	//
+	// The Fill-Functions generate 4 Samples per Step in SoA-Form.
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class RandomGenerator
+	{
+	public:
+
+		explicit RandomGenerator(const uint64_t Seed = 1, const UINT Stream = 0) noexcept;
+
+		/// restart with a new Seed and Stream
+		void			XM_CALLCONV SetSeed(const uint64_t Seed, const UINT Stream = 0) noexcept;
+
+		//-----------------------------------------------------------------------------
+		// 4 Lanes
+		//-----------------------------------------------------------------------------
+
+		/// 4 Random-Integers (32 Bit) in the Lanes (Integer-Vector)
+		XMVECTOR		XM_CALLCONV NextUInt() noexcept;
+
+		/// 4 Random-Floats in [0, 1)
+		XMVECTOR		XM_CALLCONV NextFloat() noexcept;
+
+		/// 4 Random-Floats in [Min, Max)
+		XMVECTOR		XM_CALLCONV NextFloat(FXMVECTOR Min, FXMVECTOR Max) noexcept;
+
+		//-----------------------------------------------------------------------------
+		// Bulk-Generators
+		//-----------------------------------------------------------------------------
+
+		/// uniform Floats in [Min, Max)
+		void			XM_CALLCONV FillUniform(float* pOut, const UINT Count, const float Min = 0.0f, const float Max = 1.0f) noexcept;
+
+		/// uniform Directions on the Unit-Sphere (w = 0)
+		void			XM_CALLCONV FillUnitVectors(Vector4* pOut, const UINT Count) noexcept;
+
+		/// uniform Directions on the Hemisphere around the (unit) Normal
+		void			XM_CALLCONV FillHemisphere(const Vector4& Normal, Vector4* pOut, const UINT Count) noexcept;
+
+		/// cosine-weighted Directions on the Hemisphere around the (unit) Normal (for Irradiance)
+		void			XM_CALLCONV FillCosineHemisphere(const Vector4& Normal, Vector4* pOut, const UINT Count) noexcept;
+
+		/// uniform Points in the Box (w = 1)
+		void			XM_CALLCONV FillPoints(const AABB& Box, Vector4* pOut, const UINT Count) noexcept;
+
+		/// uniform Points in the Sphere (w = 1)
+		void			XM_CALLCONV FillPoints(const Sphere& theSphere, Vector4* pOut, const UINT Count) noexcept;
+
+		/// uniform Points on the Triangle (w = 1)
+		void			XM_CALLCONV FillPoints(const Triangle& theTriangle, Vector4* pOut, const UINT Count) noexcept;
+
+		/// uniform Rotations
+		void			XM_CALLCONV FillQuats(Quat* pOut, const UINT Count) noexcept;
+
+		/// random Colors (random Alpha for Alpha < 0, like Color::Random)
+		void			XM_CALLCONV FillColors(Color* pOut, const UINT Count, const float Alpha = 1.0f) noexcept;
+
+	protected:
+
+		/// write the 4 Samples (x, y, z, w in SoA) to pOut[0 .. Num - 1]
+		template <class T>
+		static void		XM_CALLCONV StoreLanes(FXMVECTOR x, FXMVECTOR y, FXMVECTOR z, GXMVECTOR w, T* pOut, const UINT Num) noexcept;
+
+		/// 4 uniform Directions in SoA
+		void			XM_CALLCONV NextUnitVectors(XMVECTOR& x, XMVECTOR& y, XMVECTOR& z) noexcept;
+
+		__m128i			m_State[4];
+	};
+
+}; // end of namespace
+
+#endif
@@ -0,0 +1,328 @@
+// -------------------------------------------------------------------
+// File			:	Random
+//
+// Project		:	TurboMath
+//
+// Description	:	SIMD Random-Number-Generator (xoshiro128+) with Sample-Generators
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+namespace TurboMath
+{
+	//------------------------------------------------------------------------------
+	XM_INLINE RandomGenerator::RandomGenerator(const uint64_t Seed, const UINT Stream) noexcept
+	{
+		SetSeed(Seed, Stream);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV RandomGenerator::SetSeed(const uint64_t Seed, const UINT Stream) noexcept
+	{
+		// SplitMix64 fills the 4 Words of all Lanes (never all zero in Practice)
+		uint64_t x = Seed;
+
+		auto SplitMix64 = [&x]() -> uint64_t
+		{
+			uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+			return z ^ (z >> 31);
+		};
+
+		x = SplitMix64() + (uint64_t)Stream * 0xD1B54A32D192ED03ull;
+
+		CACHE_ALIGN(16) uint32_t Words[4][4];
+
+		for (UINT Lane = 0; Lane < 4; Lane++)
+		{
+			for (UINT k = 0; k < 4; k += 2)
+			{
+				const uint64_t z = SplitMix64();
+
+				Words[k][Lane]	   = (uint32_t)z;
+				Words[k + 1][Lane] = (uint32_t)(z >> 32);
+			}
+		}
+
+		for (UINT k = 0; k < 4; k++)
+			m_State[k] = _mm_load_si128((const __m128i*)Words[k]);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV RandomGenerator::NextUInt() noexcept
+	{
+		// xoshiro128+
+		const __m128i Result = _mm_add_epi32(m_State[0], m_State[3]);
+		const __m128i t		 = _mm_slli_epi32(m_State[1], 9);
+
+		m_State[2] = _mm_xor_si128(m_State[2], m_State[0]);
+		m_State[3] = _mm_xor_si128(m_State[3], m_State[1]);
+		m_State[1] = _mm_xor_si128(m_State[1], m_State[2]);
+		m_State[0] = _mm_xor_si128(m_State[0], m_State[3]);
+		m_State[2] = _mm_xor_si128(m_State[2], t);
+		m_State[3] = _mm_or_si128(_mm_slli_epi32(m_State[3], 11), _mm_srli_epi32(m_State[3], 21));
+
+		return _mm_castsi128_ps(Result);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV RandomGenerator::NextFloat() noexcept
+	{
+		// upper 23 Bits (the lower Bits of xoshiro128+ are weak) as Mantissa of [1, 2)
+		const __m128i Bits = _mm_or_si128(_mm_srli_epi32(_mm_castps_si128(NextUInt()), 9), _mm_set1_epi32(0x3F800000));
+
+		return XMVectorSubtract(_mm_castsi128_ps(Bits), g_XMOne);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE XMVECTOR XM_CALLCONV RandomGenerator::NextFloat(FXMVECTOR Min, FXMVECTOR Max) noexcept
+	{
+		return XMVectorMultiplyAdd(NextFloat(), XMVectorSubtract(Max, Min), Min);
+	}
+
+	//------------------------------------------------------------------------------
+	template <class T>
+	XM_INLINE void XM_CALLCONV RandomGenerator::StoreLanes(FXMVECTOR x, FXMVECTOR y, FXMVECTOR z, GXMVECTOR w, T* pOut, const UINT Num) noexcept
+	{
+		const XMMATRIX m = XMMatrixTranspose(XMMATRIX(x, y, z, w));
+
+		for (UINT k = 0; k < Num; k++)
+			pOut[k] = m.r[k];
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV RandomGenerator::NextUnitVectors(XMVECTOR& x, XMVECTOR& y, XMVECTOR& z) noexcept
+	{
+		// z uniform in [-1, 1], Angle uniform around z
+		const XMVECTOR u = NextFloat();
+
+		z = XMVectorSubtract(XMVectorAdd(u, u), g_XMOne);
+
+		const XMVECTOR r = XMVectorSqrt(XMVectorMax(XMVectorNegativeMultiplySubtract(z, z, g_XMOne), g_XMZero));
+
+		XMVECTOR s, c;
+		XMVectorSinCos(&s, &c, XMVectorMultiplyAdd(NextFloat(), XMVectorReplicate(XM_2PI), XMVectorReplicate(-XM_PI)));
+
+		x = XMVectorMultiply(r, c);
+		y = XMVectorMultiply(r, s);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV RandomGenerator::FillUniform(float* pOut, const UINT Count, const float Min, const float Max) noexcept
+	{
+		assert(pOut || Count == 0);
+
+		const XMVECTOR vMin = XMVectorReplicate(Min);
+		const XMVECTOR vMax = XMVectorReplicate(Max);
+
+		UINT i = 0;
+
+		for (; i + 4 <= Count; i += 4)
+			XMStoreFloat4((XMFLOAT4*)&pOut[i], NextFloat(vMin, vMax));
+
+		if (i < Count)
+		{
+			CACHE_ALIGN(16) float f[4];
+
+			XMStoreFloat4A((XMFLOAT4A*)f, NextFloat(vMin, vMax));
+
+			for (UINT k = 0; i < Count; i++, k++)
+				pOut[i] = f[k];
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV RandomGenerator::FillUnitVectors(Vector4* pOut, const UINT Count) noexcept
+	{
+		assert(pOut || Count == 0);
+
+		XMVECTOR x, y, z;
+
+		for (UINT i = 0; i < Count; i += 4)
+		{
+			NextUnitVectors(x, y, z);
+
+			StoreLanes(x, y, z, g_XMZero, pOut + i, XMMin(4u, Count - i));
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV RandomGenerator::FillHemisphere(const Vector4& Normal, Vector4* pOut, const UINT Count) noexcept
+	{
+		assert(pOut || Count == 0);
+
+		const XMVECTOR nx = XMVectorSplatX(Normal);
+		const XMVECTOR ny = XMVectorSplatY(Normal);
+		const XMVECTOR nz = XMVectorSplatZ(Normal);
+
+		XMVECTOR x, y, z;
+
+		for (UINT i = 0; i < Count; i += 4)
+		{
+			NextUnitVectors(x, y, z);
+
+			// mirror the Directions below the Surface
+			const XMVECTOR d	= XMVectorMultiplyAdd(x, nx, XMVectorMultiplyAdd(y, ny, XMVectorMultiply(z, nz)));
+			const XMVECTOR Sign = XMVectorAndInt(d, g_XMNegativeZero);
+
+			StoreLanes(XMVectorXorInt(x, Sign), XMVectorXorInt(y, Sign), XMVectorXorInt(z, Sign), g_XMZero, pOut + i, XMMin(4u, Count - i));
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV RandomGenerator::FillCosineHemisphere(const Vector4& Normal, Vector4* pOut, const UINT Count) noexcept
+	{
+		assert(pOut || Count == 0);
+
+		// orthonormal Basis (Tangent, Bitangent, Normal) without Branches on the Direction
+		XMFLOAT3 n;
+		XMStoreFloat3(&n, Normal);
+
+		const float Sign = (n.z >= 0.0f) ? 1.0f : -1.0f;
+		const float a	 = -1.0f / (Sign + n.z);
+		const float b	 = n.x * n.y * a;
+
+		const XMVECTOR Tangent	 = XMVectorSet(1.0f + Sign * n.x * n.x * a, Sign * b, -Sign * n.x, 0.0f);
+		const XMVECTOR Bitangent = XMVectorSet(b, Sign + n.y * n.y * a, -n.y, 0.0f);
+
+		XMVECTOR s, c;
+
+		for (UINT i = 0; i < Count; i += 4)
+		{
+			// uniform on the Disk, projected up to the Hemisphere
+			const XMVECTOR u = NextFloat();
+			const XMVECTOR r = XMVectorSqrt(u);
+
+			XMVectorSinCos(&s, &c, XMVectorMultiplyAdd(NextFloat(), XMVectorReplicate(XM_2PI), XMVectorReplicate(-XM_PI)));
+
+			const XMVECTOR lx = XMVectorMultiply(r, c);
+			const XMVECTOR ly = XMVectorMultiply(r, s);
+			const XMVECTOR lz = XMVectorSqrt(XMVectorMax(XMVectorSubtract(g_XMOne, u), g_XMZero));
+
+			const XMVECTOR x = XMVectorMultiplyAdd(lx, XMVectorSplatX(Tangent), XMVectorMultiplyAdd(ly, XMVectorSplatX(Bitangent), XMVectorMultiply(lz, XMVectorSplatX(Normal))));
+			const XMVECTOR y = XMVectorMultiplyAdd(lx, XMVectorSplatY(Tangent), XMVectorMultiplyAdd(ly, XMVectorSplatY(Bitangent), XMVectorMultiply(lz, XMVectorSplatY(Normal))));
+			const XMVECTOR z = XMVectorMultiplyAdd(lx, XMVectorSplatZ(Tangent), XMVectorMultiplyAdd(ly, XMVectorSplatZ(Bitangent), XMVectorMultiply(lz, XMVectorSplatZ(Normal))));
+
+			StoreLanes(x, y, z, g_XMZero, pOut + i, XMMin(4u, Count - i));
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV RandomGenerator::FillPoints(const AABB& Box, Vector4* pOut, const UINT Count) noexcept
+	{
+		assert(pOut || Count == 0);
+
+		const XMVECTOR Min	  = Box.GetMinExtents();
+		const XMVECTOR Extent = XMVectorSubtract(Box.GetMaxExtents(), Min);
+
+		for (UINT i = 0; i < Count; i += 4)
+		{
+			const XMVECTOR x = XMVectorMultiplyAdd(NextFloat(), XMVectorSplatX(Extent), XMVectorSplatX(Min));
+			const XMVECTOR y = XMVectorMultiplyAdd(NextFloat(), XMVectorSplatY(Extent), XMVectorSplatY(Min));
+			const XMVECTOR z = XMVectorMultiplyAdd(NextFloat(), XMVectorSplatZ(Extent), XMVectorSplatZ(Min));
+
+			StoreLanes(x, y, z, g_XMOne, pOut + i, XMMin(4u, Count - i));
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV RandomGenerator::FillPoints(const Sphere& theSphere, Vector4* pOut, const UINT Count) noexcept
+	{
+		assert(pOut || Count == 0);
+
+		const XMVECTOR Center = theSphere.GetCenter();
+		const XMVECTOR Radius = XMVectorReplicate(theSphere.GetRadius());
+
+		XMVECTOR x, y, z;
+
+		for (UINT i = 0; i < Count; i += 4)
+		{
+			NextUnitVectors(x, y, z);
+
+			// Distance ~ cbrt(u) with u in (0, 1]
+			const XMVECTOR u = XMVectorSubtract(g_XMOne, NextFloat());
+			const XMVECTOR r = XMVectorMultiply(Radius, XMVectorExp2(XMVectorScale(XMVectorLog2(u), 1.0f / 3.0f)));
+
+			StoreLanes(XMVectorMultiplyAdd(x, r, XMVectorSplatX(Center)),
+					   XMVectorMultiplyAdd(y, r, XMVectorSplatY(Center)),
+					   XMVectorMultiplyAdd(z, r, XMVectorSplatZ(Center)), g_XMOne, pOut + i, XMMin(4u, Count - i));
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV RandomGenerator::FillPoints(const Triangle& theTriangle, Vector4* pOut, const UINT Count) noexcept
+	{
+		assert(pOut || Count == 0);
+
+		const XMVECTOR A = theTriangle.GetVector1();
+		const XMVECTOR B = theTriangle.GetVector2();
+		const XMVECTOR C = theTriangle.GetVector3();
+
+		for (UINT i = 0; i < Count; i += 4)
+		{
+			// Barycentrics (1 - sqrt(u), sqrt(u) * (1 - v), sqrt(u) * v)
+			const XMVECTOR su = XMVectorSqrt(NextFloat());
+			const XMVECTOR b2 = XMVectorMultiply(su, NextFloat());
+			const XMVECTOR b1 = XMVectorSubtract(su, b2);
+			const XMVECTOR b0 = XMVectorSubtract(g_XMOne, su);
+
+			const XMVECTOR x = XMVectorMultiplyAdd(b0, XMVectorSplatX(A), XMVectorMultiplyAdd(b1, XMVectorSplatX(B), XMVectorMultiply(b2, XMVectorSplatX(C))));
+			const XMVECTOR y = XMVectorMultiplyAdd(b0, XMVectorSplatY(A), XMVectorMultiplyAdd(b1, XMVectorSplatY(B), XMVectorMultiply(b2, XMVectorSplatY(C))));
+			const XMVECTOR z = XMVectorMultiplyAdd(b0, XMVectorSplatZ(A), XMVectorMultiplyAdd(b1, XMVectorSplatZ(B), XMVectorMultiply(b2, XMVectorSplatZ(C))));
+
+			StoreLanes(x, y, z, g_XMOne, pOut + i, XMMin(4u, Count - i));
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV RandomGenerator::FillQuats(Quat* pOut, const UINT Count) noexcept
+	{
+		assert(pOut || Count == 0);
+
+		XMVECTOR s1, c1, s2, c2;
+
+		for (UINT i = 0; i < Count; i += 4)
+		{
+			// Shoemake : uniform on the 4D Unit-Sphere
+			const XMVECTOR u  = NextFloat();
+			const XMVECTOR r1 = XMVectorSqrt(XMVectorSubtract(g_XMOne, u));
+			const XMVECTOR r2 = XMVectorSqrt(u);
+
+			XMVectorSinCos(&s1, &c1, XMVectorMultiplyAdd(NextFloat(), XMVectorReplicate(XM_2PI), XMVectorReplicate(-XM_PI)));
+			XMVectorSinCos(&s2, &c2, XMVectorMultiplyAdd(NextFloat(), XMVectorReplicate(XM_2PI), XMVectorReplicate(-XM_PI)));
+
+			StoreLanes(XMVectorMultiply(r1, s1), XMVectorMultiply(r1, c1), XMVectorMultiply(r2, s2), XMVectorMultiply(r2, c2), pOut + i, XMMin(4u, Count - i));
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV RandomGenerator::FillColors(Color* pOut, const UINT Count, const float Alpha) noexcept
+	{
+		assert(pOut || Count == 0);
+
+		const XMVECTOR vAlpha = XMVectorReplicate(Alpha);
+
+		for (UINT i = 0; i < Count; i += 4)
+		{
+			const XMVECTOR r = NextFloat();
+			const XMVECTOR g = NextFloat();
+			const XMVECTOR b = NextFloat();
+			const XMVECTOR a = (Alpha < 0.0f) ? NextFloat() : vAlpha;
+
+			StoreLanes(r, g, b, a, pOut + i, XMMin(4u, Count - i));
+		}
+	}
+
+}// end of Namespace TurboMath
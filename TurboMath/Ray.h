@@ -105,6 +105,37 @@ namespace TurboMath
 
 		const bool	IntersectPlane( const Plane& plane,float* pDist, Vector4* vHit) const;
 		const bool	IntersectPlane( const Plane& plane,float length, float* pDist, Vector4* vHit) const;
+
+		/// watertight Ray-Triangle Test (no Misses along shared Edges), pU/pV are the Barycentrics of V1/V2
+		const bool	IntersectTriangleWatertight( const Vector4& V0, const Vector4& V1, const Vector4& V2, float* pDist, float* pU = nullptr, float* pV = nullptr) const;
+	};
+
+
+	//-----------------------------------------------------------------------------
+	// Precomputed Shear-Transformation of a Ray for the watertight Ray-Triangle
+	// Test (Woop, Benthin, Wald : "Watertight Ray/Triangle Intersection",
+	// JCGT 2013). The Ray-Direction is mapped onto the Z-Axis, so every Triangle
+	// only needs a 2D-Edge-Test. The Edge-Functions of a shared Edge are computed
+	// from the same Values, so a Ray never slips through between two Triangles.
+	//
+	// Build it once per Ray and reuse it for all Triangles.
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class WatertightRay
+	{
+	public:
+
+		WatertightRay() noexcept;
+		explicit WatertightRay(const Ray& theRay) noexcept;
+
+		/// precompute the Shear for a Ray
+		void		XM_CALLCONV Set(const Ray& theRay) noexcept;
+
+		/// test one Triangle, only Hits with Distance <= MaxDist are reported
+		const bool	XM_CALLCONV IntersectTriangle(const Vector4& V0, const Vector4& V1, const Vector4& V2, const float MaxDist, float* pDist, float* pU, float* pV) const noexcept;
+
+		float		Org[3];			// Ray-Origin
+		UINT		Kx, Ky, Kz;		// Dimension-Permutation, Kz = largest Direction-Component
+		float		Sx, Sy, Sz;		// Shear-Constants
 	};
 
 }; // end of namespace
@@ -357,4 +357,118 @@ namespace TurboMath
 		return true;
 	}
 
+	//------------------------------------------------------------------------------
+	__forceinline const bool	Ray::IntersectTriangleWatertight( const Vector4& V0, const Vector4& V1, const Vector4& V2, float* pDist, float* pU, float* pV) const
+	{
+		assert(pDist);
+
+		const WatertightRay R(*this);
+
+		return R.IntersectTriangle(V0, V1, V2, FLT_MAX, pDist, pU, pV);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE WatertightRay::WatertightRay() noexcept
+	{
+		// empty
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE WatertightRay::WatertightRay(const Ray& theRay) noexcept
+	{
+		Set(theRay);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV WatertightRay::Set(const Ray& theRay) noexcept
+	{
+		const Vector4& O = theRay.GetStartPoint();
+		const Vector4  D = theRay.GetDirection();
+
+		Org[0] = O.GetX();
+		Org[1] = O.GetY();
+		Org[2] = O.GetZ();
+
+		const float Dir[3] = { D.GetX(), D.GetY(), D.GetZ() };
+
+		// Dimension where the Ray-Direction is maximal
+		Kz = 0;
+
+		if (fabsf(Dir[1]) > fabsf(Dir[Kz])) Kz = 1;
+		if (fabsf(Dir[2]) > fabsf(Dir[Kz])) Kz = 2;
+
+		Kx = (Kz + 1) % 3;
+		Ky = (Kx + 1) % 3;
+
+		// swap Kx and Ky to preserve the Winding-Direction of the Triangles
+		if (Dir[Kz] < 0.0f)
+		{
+			const UINT Tmp = Kx;
+			Kx = Ky;
+			Ky = Tmp;
+		}
+
+		assert(Dir[Kz] != 0.0f);
+
+		Sx = Dir[Kx] / Dir[Kz];
+		Sy = Dir[Ky] / Dir[Kz];
+		Sz = 1.0f / Dir[Kz];
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV WatertightRay::IntersectTriangle(const Vector4& V0, const Vector4& V1, const Vector4& V2, const float MaxDist, float* pDist, float* pU, float* pV) const noexcept
+	{
+		assert(pDist);
+
+		// Vertices relative to the Ray-Origin
+		const float A[3] = { V0.GetX() - Org[0], V0.GetY() - Org[1], V0.GetZ() - Org[2] };
+		const float B[3] = { V1.GetX() - Org[0], V1.GetY() - Org[1], V1.GetZ() - Org[2] };
+		const float C[3] = { V2.GetX() - Org[0], V2.GetY() - Org[1], V2.GetZ() - Org[2] };
+
+		// Shear and Scale
+		const float Ax = A[Kx] - Sx * A[Kz];
+		const float Ay = A[Ky] - Sy * A[Kz];
+		const float Bx = B[Kx] - Sx * B[Kz];
+		const float By = B[Ky] - Sy * B[Kz];
+		const float Cx = C[Kx] - Sx * C[Kz];
+		const float Cy = C[Ky] - Sy * C[Kz];
+
+		// scaled Barycentrics
+		float U = Cx * By - Cy * Bx;
+		float V = Ax * Cy - Ay * Cx;
+		float W = Bx * Ay - By * Ax;
+
+		// fall back to double Precision on Edges
+		if (U == 0.0f || V == 0.0f || W == 0.0f)
+		{
+			U = (float)((double)Cx * (double)By - (double)Cy * (double)Bx);
+			V = (float)((double)Ax * (double)Cy - (double)Ay * (double)Cx);
+			W = (float)((double)Bx * (double)Ay - (double)By * (double)Ax);
+		}
+
+		// Edge-Tests (both Windings)
+		if ((U < 0.0f || V < 0.0f || W < 0.0f) && (U > 0.0f || V > 0.0f || W > 0.0f)) return false;
+
+		const float Det = U + V + W;
+
+		if (Det == 0.0f) return false;
+
+		// scaled Distance
+		const float T = U * (Sz * A[Kz]) + V * (Sz * B[Kz]) + W * (Sz * C[Kz]);
+
+		const float AbsDet = fabsf(Det);
+		const float SignT = (Det < 0.0f) ? -T : T;
+
+		if (SignT < 0.0f || SignT > MaxDist * AbsDet) return false;
+
+		const float RcpDet = 1.0f / Det;
+
+		*pDist = T * RcpDet;
+
+		if (pU) *pU = V * RcpDet;
+		if (pV) *pV = W * RcpDet;
+
+		return true;
+	}
+
 }// end of Namespace TurboMath
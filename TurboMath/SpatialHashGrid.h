@@ -0,0 +1,167 @@
+// -------------------------------------------------------------------
+// File			:	SpatialHashGrid
+//
+// Project		:	TurboMath
+//
+// Description	:	hashed uniform Grid for Neighbour-Queries on Points
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_SPATIALHASHGRID_H_
+#define _TURBOMATH_SPATIALHASHGRID_H_
+
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <algorithm>
+
+namespace TurboMath
+{
+
+	//-----------------------------------------------------------------------------
+	// Span [Begin, End) in the sorted Point-Arrays of a SpatialHashGrid
+	//-----------------------------------------------------------------------------
+	struct IndexSpan
+	{
+		UINT	Begin;
+		UINT	End;
+	};
+
+	//-----------------------------------------------------------------------------
+	// Unbounded uniform Grid for Points (Crowds, Particles). The Cell-Coordinates
+	// are hashed into a Table with a Power of 2 Buckets, so the Grid needs no
+	// Bounds and its Memory only depends on the Number of Points.
+	//
+	// Build() is a parallel Counting-Sort of the Points by their Bucket : every
+	// Bucket ends up as one contiguous Span of Point-Indices, and the Positions
+	// are copied in the same Order (SoA), so a Query only streams through a few
+	// contiguous Blocks of Memory. Meant for a full Rebuild every Frame. The
+	// Sort is stable, inside a Bucket the Points keep their Input-Order, so
+	// the Result does not depend on the Number of Threads.
+	//
+	// Different Cells can share a Bucket, the Span-Queries therefore return
+	// Candidates, the Index-Queries test the Points exactly. A Query only
+	// walks the Cells inside the Bounds of the Points and visits every Bucket
+	// once. A Query over more Cells than the Table has Buckets walks the non-
+	// empty Buckets instead, so no Query costs more than O(Buckets + Candidates).
+	//
+	// Cell-Coordinates are clamped to +-CELL_LIMIT, Points far outside share
+	// the Border-Cells (more Candidates, but no Overflow of the int-Coordinates).
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class SpatialHashGrid
+	{
+	public:
+
+		typedef std::vector<float, AAllocator<float> >	FloatStream;
+
+		/// Cells hashed per Batch while walking the Cells of a Query
+		static constexpr UINT QUERY_BATCH = 64;
+
+		SpatialHashGrid() noexcept;
+		~SpatialHashGrid() noexcept;
+
+		/// remove all Points
+		void			XM_CALLCONV Clear() noexcept;
+
+		//-----------------------------------------------------------------------------
+		// Build
+		//-----------------------------------------------------------------------------
+
+		/// sort the Points into Cells of CellSize (TableSize = 0 : 2 Buckets per Point)
+		void			XM_CALLCONV Build(const Vector4* pPoints, const UINT Count, const float CellSize, const UINT TableSize = 0);
+
+		/// sort Points given as SoA-Streams into Cells of CellSize
+		void			XM_CALLCONV Build(const float* pX, const float* pY, const float* pZ, const UINT Count, const float CellSize, const UINT TableSize = 0);
+
+		//-----------------------------------------------------------------------------
+		// Access
+		//-----------------------------------------------------------------------------
+
+		/// get Number of Points
+		const UINT		XM_CALLCONV GetNumPoints() const noexcept			{ return m_NumPoints; }
+
+		/// get the Size of a Cell
+		const float		XM_CALLCONV GetCellSize() const noexcept			{ return m_CellSize; }
+
+		/// get the Point-Indices sorted by Bucket
+		const UINT*		XM_CALLCONV GetSortedIndices() const noexcept		{ return m_SortedIndices.data(); }
+
+		/// get the Positions sorted by Bucket
+		const float*	XM_CALLCONV GetSortedX() const noexcept				{ return m_SortedX.data(); }
+		const float*	XM_CALLCONV GetSortedY() const noexcept				{ return m_SortedY.data(); }
+		const float*	XM_CALLCONV GetSortedZ() const noexcept				{ return m_SortedZ.data(); }
+
+		//-----------------------------------------------------------------------------
+		// Queries
+		//-----------------------------------------------------------------------------
+
+		/// append the Spans of all Buckets touched by the Sphere (Candidates), returns the Number of Spans
+		const UINT		XM_CALLCONV QuerySphere(const Sphere& theSphere, std::vector<IndexSpan>& Spans) const;
+
+		/// append the Spans of all Buckets touched by the Box (Candidates), returns the Number of Spans
+		const UINT		XM_CALLCONV QueryAABB(const AABB& Box, std::vector<IndexSpan>& Spans) const;
+
+		/// append the Indices of all Points inside the Sphere, returns the Number found
+		const UINT		XM_CALLCONV QuerySphere(const Sphere& theSphere, std::vector<UINT>& Result) const;
+
+		/// append the Indices of all Points inside the Box, returns the Number found
+		const UINT		XM_CALLCONV QueryAABB(const AABB& Box, std::vector<UINT>& Result) const;
+
+	protected:
+
+		/// Bucket of a Cell
+		const UINT		XM_CALLCONV HashCell(const int x, const int y, const int z) const noexcept;
+
+		/// Bucket of a Position
+		const UINT		XM_CALLCONV HashPoint(const float x, const float y, const float z) const noexcept;
+
+		/// floor(v / CellSize) clamped to +-CELL_LIMIT (NaN to -CELL_LIMIT)
+		const float		XM_CALLCONV CellCoord(const float v) const noexcept;
+
+		/// Limit of the Cell-Coordinates, exact in float and far from the int-Range
+		static constexpr float CELL_LIMIT = 1073741824.0f;
+
+		/// Counting-Sort of the Points, Func(i, x, y, z) returns the Position of Point i
+		template <class PointFunc>
+		void			XM_CALLCONV BuildPoints(const UINT Count, const float CellSize, const UINT TableSize, const PointFunc& Func);
+
+		/// call Func(Begin, End) once for every non-empty Bucket touched by the Box [vMin, vMax]
+		template <class SpanFunc>
+		void			XM_CALLCONV ForEachSpan(FXMVECTOR vMin, FXMVECTOR vMax, const SpanFunc& Func) const;
+
+		float			m_CellSize;
+		float			m_InvCellSize;
+		UINT			m_TableMask;			// Number of Buckets - 1
+		UINT			m_NumPoints;
+
+		XMFLOAT4A		m_CellMin;				// Bounds of the occupied Cells
+		XMFLOAT4A		m_CellMax;
+
+		std::vector<UINT>	m_CellStart;		// first sorted Point of every Bucket (+ End)
+		std::vector<UINT>	m_SortedIndices;	// Point-Indices sorted by Bucket
+		FloatStream		m_SortedX, m_SortedY, m_SortedZ;
+		std::vector<UINT>	m_PointBucket;		// Bucket of every Point (Build)
+
+		std::unique_ptr<std::atomic<UINT>[]>	m_Counters;		// Counting-Sort (Build)
+		UINT			m_NumCounters;
+	};
+
+}; // end of namespace
+
+#endif
@@ -0,0 +1,543 @@
+// -------------------------------------------------------------------
+// File			:	SpatialHashGrid
+//
+// Project		:	TurboMath
+//
+// Description	:	hashed uniform Grid for Neighbour-Queries on Points
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+namespace TurboMath
+{
+	//------------------------------------------------------------------------------
+	XM_INLINE SpatialHashGrid::SpatialHashGrid() noexcept
+		: m_CellSize(1.0f)
+		, m_InvCellSize(1.0f)
+		, m_TableMask(0)
+		, m_NumPoints(0)
+		, m_CellMin(0.0f, 0.0f, 0.0f, 0.0f)
+		, m_CellMax(0.0f, 0.0f, 0.0f, 0.0f)
+		, m_NumCounters(0)
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE SpatialHashGrid::~SpatialHashGrid() noexcept
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV SpatialHashGrid::Clear() noexcept
+	{
+		m_CellStart.clear();
+		m_SortedIndices.clear();
+		m_SortedX.clear();
+		m_SortedY.clear();
+		m_SortedZ.clear();
+		m_PointBucket.clear();
+		m_Counters.reset();
+
+		m_NumCounters = 0;
+		m_TableMask = 0;
+		m_NumPoints = 0;
+	}
+
+	//------------------------------------------------------------------------------
+	// Hashing
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV SpatialHashGrid::HashCell(const int x, const int y, const int z) const noexcept
+	{
+		// Teschner et al. : "Optimized Spatial Hashing for Collision Detection of Deformable Objects"
+		return (((UINT)x * 73856093u) ^ ((UINT)y * 19349663u) ^ ((UINT)z * 83492791u)) & m_TableMask;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV SpatialHashGrid::HashPoint(const float x, const float y, const float z) const noexcept
+	{
+		return HashCell((int)CellCoord(x), (int)CellCoord(y), (int)CellCoord(z));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const float XM_CALLCONV SpatialHashGrid::CellCoord(const float v) const noexcept
+	{
+		const float c = floorf(v * m_InvCellSize);
+
+		// written so that NaN fails the first Test
+		return (c >= -CELL_LIMIT) ? ((c <= CELL_LIMIT) ? c : CELL_LIMIT) : -CELL_LIMIT;
+	}
+
+	//------------------------------------------------------------------------------
+	// Build
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV SpatialHashGrid::Build(const Vector4* pPoints, const UINT Count, const float CellSize, const UINT TableSize)
+	{
+		assert(pPoints != nullptr || Count == 0);
+
+		BuildPoints(Count, CellSize, TableSize, [pPoints](const UINT i, float& x, float& y, float& z)
+		{
+			const float* p = pPoints[i];
+			x = p[0];
+			y = p[1];
+			z = p[2];
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV SpatialHashGrid::Build(const float* pX, const float* pY, const float* pZ, const UINT Count, const float CellSize, const UINT TableSize)
+	{
+		assert((pX != nullptr && pY != nullptr && pZ != nullptr) || Count == 0);
+
+		BuildPoints(Count, CellSize, TableSize, [pX, pY, pZ](const UINT i, float& x, float& y, float& z)
+		{
+			x = pX[i];
+			y = pY[i];
+			z = pZ[i];
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	// 1. count the Points per Bucket, 2. prefix-sum the Counts to the Start of
+	// every Bucket, 3. scatter the Point-Indices to their Bucket, 4. sort every
+	// Bucket by Index (the atomic Scatter leaves them in Thread-Order), which is
+	// exactly the Order of a serial stable Counting-Sort, 5. copy the Positions
+	// in sorted Order. All Steps run parallel, the Counters are atomic.
+	template <class PointFunc>
+	XM_INLINE void XM_CALLCONV SpatialHashGrid::BuildPoints(const UINT Count, const float CellSize, const UINT TableSize, const PointFunc& Func)
+	{
+		assert(CellSize > 0.0f);
+
+		m_CellSize = CellSize;
+		m_InvCellSize = 1.0f / CellSize;
+		m_NumPoints = Count;
+
+		// Power of 2 Buckets
+		const UINT Wanted = (TableSize > 0) ? TableSize : XMMax(Count * 2, 1u);
+
+		UINT NumBuckets = 1;
+		while (NumBuckets < Wanted && NumBuckets < 0x80000000u)
+			NumBuckets <<= 1;
+
+		m_TableMask = NumBuckets - 1;
+
+		if (m_NumCounters != NumBuckets)
+		{
+			m_Counters.reset(new std::atomic<UINT>[NumBuckets]);
+			m_NumCounters = NumBuckets;
+		}
+
+		m_CellStart.resize(NumBuckets + 1);
+		m_PointBucket.resize(Count);
+		m_SortedIndices.resize(Count);
+		m_SortedX.resize(Count);
+		m_SortedY.resize(Count);
+		m_SortedZ.resize(Count);
+
+		const UINT PointChunk = 16384;
+		const UINT NumPointChunks = (Count + PointChunk - 1) / PointChunk;
+		const UINT BucketBlock = 65536;
+		const UINT NumBlocks = (NumBuckets + BucketBlock - 1) / BucketBlock;
+
+		std::atomic<UINT>* pCounters = m_Counters.get();
+
+		// clear the Counters
+		ParallelFor(NumBuckets, BucketBlock, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT i = Begin; i < End; i++)
+				pCounters[i].store(0, std::memory_order_relaxed);
+		});
+
+		// 1. Bucket of every Point, Bounds of the occupied Cells per Chunk
+		std::vector<XMFLOAT4A, AAllocator<XMFLOAT4A> > ChunkBounds(NumPointChunks * 2);
+
+		ParallelFor(NumPointChunks, 1, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT Chunk = Begin; Chunk < End; Chunk++)
+			{
+				const UINT Last = XMMin((Chunk + 1) * PointChunk, Count);
+
+				XMFLOAT4A CellMin(FLT_MAX, FLT_MAX, FLT_MAX, 0.0f);
+				XMFLOAT4A CellMax(-FLT_MAX, -FLT_MAX, -FLT_MAX, 0.0f);
+
+				for (UINT i = Chunk * PointChunk; i < Last; i++)
+				{
+					float x, y, z;
+					Func(i, x, y, z);
+
+					const float cx = CellCoord(x);
+					const float cy = CellCoord(y);
+					const float cz = CellCoord(z);
+
+					CellMin.x = XMMin(CellMin.x, cx); CellMax.x = XMMax(CellMax.x, cx);
+					CellMin.y = XMMin(CellMin.y, cy); CellMax.y = XMMax(CellMax.y, cy);
+					CellMin.z = XMMin(CellMin.z, cz); CellMax.z = XMMax(CellMax.z, cz);
+
+					const UINT Bucket = HashCell((int)cx, (int)cy, (int)cz);
+					m_PointBucket[i] = Bucket;
+					pCounters[Bucket].fetch_add(1, std::memory_order_relaxed);
+				}
+
+				ChunkBounds[Chunk * 2] = CellMin;
+				ChunkBounds[Chunk * 2 + 1] = CellMax;
+			}
+		});
+
+		XMVECTOR CellMin = XMVectorZero();
+		XMVECTOR CellMax = XMVectorZero();
+
+		for (UINT Chunk = 0; Chunk < NumPointChunks; Chunk++)
+		{
+			CellMin = (Chunk == 0) ? XMLoadFloat4A(&ChunkBounds[0]) : XMVectorMin(CellMin, XMLoadFloat4A(&ChunkBounds[Chunk * 2]));
+			CellMax = (Chunk == 0) ? XMLoadFloat4A(&ChunkBounds[1]) : XMVectorMax(CellMax, XMLoadFloat4A(&ChunkBounds[Chunk * 2 + 1]));
+		}
+
+		XMStoreFloat4A(&m_CellMin, CellMin);
+		XMStoreFloat4A(&m_CellMax, CellMax);
+
+		// 2. exclusive Prefix-Sum, first per Block, then over the Blocks
+		std::vector<UINT> BlockStart(NumBlocks);
+
+		ParallelFor(NumBlocks, 1, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT Block = Begin; Block < End; Block++)
+			{
+				const UINT Last = XMMin((Block + 1) * BucketBlock, NumBuckets);
+
+				UINT Sum = 0;
+				for (UINT i = Block * BucketBlock; i < Last; i++)
+					Sum += pCounters[i].load(std::memory_order_relaxed);
+
+				BlockStart[Block] = Sum;
+			}
+		});
+
+		UINT Running = 0;
+		for (UINT Block = 0; Block < NumBlocks; Block++)
+		{
+			const UINT Sum = BlockStart[Block];
+			BlockStart[Block] = Running;
+			Running += Sum;
+		}
+
+		ParallelFor(NumBlocks, 1, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT Block = Begin; Block < End; Block++)
+			{
+				const UINT Last = XMMin((Block + 1) * BucketBlock, NumBuckets);
+
+				UINT Start = BlockStart[Block];
+				for (UINT i = Block * BucketBlock; i < Last; i++)
+				{
+					const UINT Num = pCounters[i].load(std::memory_order_relaxed);
+
+					m_CellStart[i] = Start;
+					pCounters[i].store(Start, std::memory_order_relaxed);		// now the Write-Cursor
+					Start += Num;
+				}
+			}
+		});
+
+		m_CellStart[NumBuckets] = Count;
+
+		// 3. scatter the Indices
+		ParallelFor(Count, PointChunk, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT i = Begin; i < End; i++)
+			{
+				const UINT Pos = pCounters[m_PointBucket[i]].fetch_add(1, std::memory_order_relaxed);
+				m_SortedIndices[Pos] = i;
+			}
+		});
+
+		// 4. stable Order inside every Bucket (the Buckets are short)
+		ParallelFor(NumBlocks, 1, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT Block = Begin; Block < End; Block++)
+			{
+				const UINT Last = XMMin((Block + 1) * BucketBlock, NumBuckets);
+
+				for (UINT i = Block * BucketBlock; i < Last; i++)
+				{
+					if (m_CellStart[i + 1] - m_CellStart[i] > 1)
+						std::sort(m_SortedIndices.begin() + m_CellStart[i], m_SortedIndices.begin() + m_CellStart[i + 1]);
+				}
+			}
+		});
+
+		// 5. Positions in sorted Order
+		ParallelFor(Count, PointChunk, [&](const UINT Begin, const UINT End)
+		{
+			for (UINT Pos = Begin; Pos < End; Pos++)
+			{
+				float x, y, z;
+				Func(m_SortedIndices[Pos], x, y, z);
+
+				m_SortedX[Pos] = x;
+				m_SortedY[Pos] = y;
+				m_SortedZ[Pos] = z;
+			}
+		});
+	}
+
+	//------------------------------------------------------------------------------
+	// Queries
+	//------------------------------------------------------------------------------
+	// the Cells are hashed in Batches of QUERY_BATCH, every Batch is sorted and
+	// made unique. Larger Queries keep the non-empty Buckets of the previous
+	// Batches in a sorted List, so no Bucket is reported twice. Queries over
+	// more Cells than Buckets report every non-empty Bucket once instead.
+	template <class SpanFunc>
+	XM_INLINE void XM_CALLCONV SpatialHashGrid::ForEachSpan(FXMVECTOR vMin, FXMVECTOR vMax, const SpanFunc& Func) const
+	{
+		if (m_NumPoints == 0)
+			return;
+
+		const XMVECTOR vInvCellSize = XMVectorReplicate(m_InvCellSize);
+		const XMVECTOR vCellMin = XMLoadFloat4A(&m_CellMin);
+		const XMVECTOR vCellMax = XMLoadFloat4A(&m_CellMax);
+
+		// clamped like CellCoord, so the int Loop-Bounds cannot overflow
+		const XMVECTOR vLimit = XMVectorReplicate(CELL_LIMIT);
+		const XMVECTOR QueryMin = XMVectorClamp(XMVectorFloor(XMVectorMultiply(vMin, vInvCellSize)), XMVectorNegate(vLimit), vLimit);
+		const XMVECTOR QueryMax = XMVectorClamp(XMVectorFloor(XMVectorMultiply(vMax, vInvCellSize)), XMVectorNegate(vLimit), vLimit);
+
+		// only Cells inside the Bounds of the Points can hold one
+		if (!XMVector3LessOrEqual(QueryMin, vCellMax) || !XMVector3LessOrEqual(vCellMin, QueryMax))
+			return;
+
+		XMFLOAT4A CellMin, CellMax;
+		XMStoreFloat4A(&CellMin, XMVectorMax(QueryMin, vCellMin));
+		XMStoreFloat4A(&CellMax, XMVectorMin(QueryMax, vCellMax));
+
+		const double NumCells =	((double)CellMax.x - CellMin.x + 1.0) *
+								((double)CellMax.y - CellMin.y + 1.0) *
+								((double)CellMax.z - CellMin.z + 1.0);
+
+		// more Cells than Buckets : every non-empty Bucket once, O(Buckets)
+		if (NumCells > (double)m_TableMask + 1.0)
+		{
+			for (UINT Bucket = 0; Bucket <= m_TableMask; Bucket++)
+			{
+				const UINT Begin = m_CellStart[Bucket];
+				const UINT End = m_CellStart[Bucket + 1];
+
+				if (Begin != End)
+					Func(Begin, End);
+			}
+
+			return;
+		}
+
+		const bool bSingleBatch = (NumCells <= (double)QUERY_BATCH);
+
+		UINT Batch[QUERY_BATCH];
+		UINT NumBatch = 0;
+
+		std::vector<UINT> Visited;
+
+		auto FlushBatch = [&]()
+		{
+			std::sort(Batch, Batch + NumBatch);
+			const UINT* pEnd = std::unique(Batch, Batch + NumBatch);
+
+			const size_t NumVisited = Visited.size();
+
+			for (const UINT* p = Batch; p != pEnd; p++)
+			{
+				const UINT Begin = m_CellStart[*p];
+				const UINT End = m_CellStart[*p + 1];
+
+				if (Begin == End)
+					continue;
+
+				if (!bSingleBatch)
+				{
+					if (std::binary_search(Visited.begin(), Visited.begin() + NumVisited, *p))
+						continue;
+
+					Visited.push_back(*p);
+				}
+
+				Func(Begin, End);
+			}
+
+			if (!bSingleBatch)
+				std::inplace_merge(Visited.begin(), Visited.begin() + NumVisited, Visited.end());
+
+			NumBatch = 0;
+		};
+
+		for (int z = (int)CellMin.z; z <= (int)CellMax.z; z++)
+		{
+			for (int y = (int)CellMin.y; y <= (int)CellMax.y; y++)
+			{
+				for (int x = (int)CellMin.x; x <= (int)CellMax.x; x++)
+				{
+					Batch[NumBatch++] = HashCell(x, y, z);
+
+					if (NumBatch == QUERY_BATCH)
+						FlushBatch();
+				}
+			}
+		}
+
+		if (NumBatch > 0)
+			FlushBatch();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV SpatialHashGrid::QuerySphere(const Sphere& theSphere, std::vector<IndexSpan>& Spans) const
+	{
+		const size_t First = Spans.size();
+
+		const XMVECTOR Center = theSphere.GetCenter();
+		const XMVECTOR Radius = XMVectorReplicate(theSphere.GetRadius());
+
+		ForEachSpan(XMVectorSubtract(Center, Radius), XMVectorAdd(Center, Radius), [&](const UINT Begin, const UINT End)
+		{
+			const IndexSpan Span = { Begin, End };
+			Spans.push_back(Span);
+		});
+
+		return (UINT)(Spans.size() - First);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV SpatialHashGrid::QueryAABB(const AABB& Box, std::vector<IndexSpan>& Spans) const
+	{
+		const size_t First = Spans.size();
+
+		ForEachSpan(Box.GetMinExtents(), Box.GetMaxExtents(), [&](const UINT Begin, const UINT End)
+		{
+			const IndexSpan Span = { Begin, End };
+			Spans.push_back(Span);
+		});
+
+		return (UINT)(Spans.size() - First);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV SpatialHashGrid::QuerySphere(const Sphere& theSphere, std::vector<UINT>& Result) const
+	{
+		const size_t First = Result.size();
+
+		const XMVECTOR Center = theSphere.GetCenter();
+		const float r = theSphere.GetRadius();
+		const XMVECTOR Radius = XMVectorReplicate(r);
+
+		const XMVECTOR Cx = XMVectorSplatX(Center);
+		const XMVECTOR Cy = XMVectorSplatY(Center);
+		const XMVECTOR Cz = XMVectorSplatZ(Center);
+		const XMVECTOR R2 = XMVectorReplicate(r * r);
+
+		ForEachSpan(XMVectorSubtract(Center, Radius), XMVectorAdd(Center, Radius), [&](const UINT Begin, const UINT End)
+		{
+			UINT i = Begin;
+
+			// 4 Points at once
+			for (; i + 4 <= End; i += 4)
+			{
+				const XMVECTOR dx = XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)&m_SortedX[i]), Cx);
+				const XMVECTOR dy = XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)&m_SortedY[i]), Cy);
+				const XMVECTOR dz = XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)&m_SortedZ[i]), Cz);
+
+				XMVECTOR DistSq = XMVectorMultiply(dx, dx);
+				DistSq = XMVectorMultiplyAdd(dy, dy, DistSq);
+				DistSq = XMVectorMultiplyAdd(dz, dz, DistSq);
+
+				const XMVECTOR Inside = XMVectorLessOrEqual(DistSq, R2);
+
+				if (XMVector4EqualInt(Inside, XMVectorFalseInt()))
+					continue;
+
+				CACHE_ALIGN(16) uint32_t Mask[4];
+				XMStoreInt4A(Mask, Inside);
+
+				for (UINT l = 0; l < 4; l++)
+				{
+					if (Mask[l])
+						Result.push_back(m_SortedIndices[i + l]);
+				}
+			}
+
+			for (; i < End; i++)
+			{
+				const float dx = m_SortedX[i] - XMVectorGetX(Center);
+				const float dy = m_SortedY[i] - XMVectorGetY(Center);
+				const float dz = m_SortedZ[i] - XMVectorGetZ(Center);
+
+				if (dx * dx + dy * dy + dz * dz <= r * r)
+					Result.push_back(m_SortedIndices[i]);
+			}
+		});
+
+		return (UINT)(Result.size() - First);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV SpatialHashGrid::QueryAABB(const AABB& Box, std::vector<UINT>& Result) const
+	{
+		const size_t First = Result.size();
+
+		const XMVECTOR vMin = Box.GetMinExtents();
+		const XMVECTOR vMax = Box.GetMaxExtents();
+
+		const XMVECTOR MinX = XMVectorSplatX(vMin), MinY = XMVectorSplatY(vMin), MinZ = XMVectorSplatZ(vMin);
+		const XMVECTOR MaxX = XMVectorSplatX(vMax), MaxY = XMVectorSplatY(vMax), MaxZ = XMVectorSplatZ(vMax);
+
+		XMFLOAT4A fMin, fMax;
+		XMStoreFloat4A(&fMin, vMin);
+		XMStoreFloat4A(&fMax, vMax);
+
+		ForEachSpan(vMin, vMax, [&](const UINT Begin, const UINT End)
+		{
+			UINT i = Begin;
+
+			// 4 Points at once
+			for (; i + 4 <= End; i += 4)
+			{
+				const XMVECTOR X = XMLoadFloat4((const XMFLOAT4*)&m_SortedX[i]);
+				const XMVECTOR Y = XMLoadFloat4((const XMFLOAT4*)&m_SortedY[i]);
+				const XMVECTOR Z = XMLoadFloat4((const XMFLOAT4*)&m_SortedZ[i]);
+
+				XMVECTOR Inside = XMVectorAndInt(XMVectorGreaterOrEqual(X, MinX), XMVectorLessOrEqual(X, MaxX));
+				Inside = XMVectorAndInt(Inside, XMVectorAndInt(XMVectorGreaterOrEqual(Y, MinY), XMVectorLessOrEqual(Y, MaxY)));
+				Inside = XMVectorAndInt(Inside, XMVectorAndInt(XMVectorGreaterOrEqual(Z, MinZ), XMVectorLessOrEqual(Z, MaxZ)));
+
+				if (XMVector4EqualInt(Inside, XMVectorFalseInt()))
+					continue;
+
+				CACHE_ALIGN(16) uint32_t Mask[4];
+				XMStoreInt4A(Mask, Inside);
+
+				for (UINT l = 0; l < 4; l++)
+				{
+					if (Mask[l])
+						Result.push_back(m_SortedIndices[i + l]);
+				}
+			}
+
+			for (; i < End; i++)
+			{
+				if (m_SortedX[i] >= fMin.x && m_SortedX[i] <= fMax.x &&
+					m_SortedY[i] >= fMin.y && m_SortedY[i] <= fMax.y &&
+					m_SortedZ[i] >= fMin.z && m_SortedZ[i] <= fMax.z)
+					Result.push_back(m_SortedIndices[i]);
+			}
+		});
+
+		return (UINT)(Result.size() - First);
+	}
+
+}// end of Namespace TurboMath
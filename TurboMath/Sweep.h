@@ -0,0 +1,87 @@
+// -------------------------------------------------------------------
+// File			:	Sweep
+//
+// Project		:	TurboMath
+//
+// Description	:	continuous Collision-Tests (Time of Impact) for moving Volumes
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_SWEEP_H_
+#define _TURBOMATH_SWEEP_H_
+
+namespace TurboMath
+{
+	//-----------------------------------------------------------------------------
+	// Result of a Sweep-Test
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) struct SweepHit
+	{
+		Vector4		Normal;		// Contact-Normal, points from the hit Volume to the moving Volume
+		Vector4		Point;		// Contact-Point at the Time of Impact
+		float		Time;		// Time of Impact [0..1] as Fraction of the Movement
+	};
+
+	//-----------------------------------------------------------------------------
+	// Sweep-Tests move the first Volume by Move (the Displacement of one Step)
+	// and return the first Time of Contact, so fast Objects can't tunnel through
+	// thin Geometry. Volumes overlapping at the Start return Time 0.
+	//
+	// The Sphere-Tests cast the Center against the Minkowski-Sum of the other
+	// Volume with the Sphere (Faces, Edge-Cylinders and Vertex-Spheres). The
+	// OBB-Test uses Conservative Advancement and supports Rotations : the
+	// Boxes are interpolated between their Start- and End-Pose. It reports a
+	// Hit only when the Boxes come within Tolerance, if MaxIterations run out
+	// before, it returns false.
+	//-----------------------------------------------------------------------------
+
+	/// moving Sphere against a Plane
+	XM_INLINE const bool	XM_CALLCONV SweepSpherePlane(const Sphere& theSphere, const Vector4& Move, const Plane& thePlane, SweepHit* pHit = nullptr) noexcept;
+
+	/// 2 moving Spheres
+	XM_INLINE const bool	XM_CALLCONV SweepSphereSphere(const Sphere& SphereA, const Vector4& MoveA, const Sphere& SphereB, const Vector4& MoveB, SweepHit* pHit = nullptr) noexcept;
+
+	/// moving Sphere against a Triangle
+	XM_INLINE const bool	XM_CALLCONV SweepSphereTriangle(const Sphere& theSphere, const Vector4& Move, const Triangle& Tri, SweepHit* pHit = nullptr) noexcept;
+
+	/// moving Sphere against a Box
+	XM_INLINE const bool	XM_CALLCONV SweepSphereAABB(const Sphere& theSphere, const Vector4& Move, const AABB& Box, SweepHit* pHit = nullptr) noexcept;
+
+	/// 2 moving Boxes
+	XM_INLINE const bool	XM_CALLCONV SweepAABBAABB(const AABB& BoxA, const Vector4& MoveA, const AABB& BoxB, const Vector4& MoveB, SweepHit* pHit = nullptr) noexcept;
+
+	/// 2 moving and rotating oriented Boxes, given by their Start- and End-Pose (Conservative Advancement)
+	XM_INLINE const bool	XM_CALLCONV SweepOBBOBB(const OBB& StartA, const OBB& EndA, const OBB& StartB, const OBB& EndB, SweepHit* pHit = nullptr, const float Tolerance = 1e-3f, const UINT MaxIterations = 32) noexcept;
+
+	//-----------------------------------------------------------------------------
+	// Point-Casts against rounded Features (Building-Blocks of the Sphere-Tests)
+	//-----------------------------------------------------------------------------
+
+	/// first Time t [0..1] the Point O + V * t enters the Sphere (Center, Radius)
+	XM_INLINE const bool	XM_CALLCONV SweepPointSphere(FXMVECTOR O, FXMVECTOR V, FXMVECTOR Center, const float Radius, float& t) noexcept;
+
+	/// first Time t [0..1] the Point O + V * t enters the Cylinder around [P0, P1], Normal on the Cylinder
+	XM_INLINE const bool	XM_CALLCONV SweepPointCylinder(FXMVECTOR O, FXMVECTOR V, FXMVECTOR P0, GXMVECTOR P1, const float Radius, float& t, XMVECTOR& Normal) noexcept;
+
+	/// largest Separation of 2 oriented Boxes over the 15 separating Axes (<= their Distance), Axis points from B to A
+	XM_INLINE const float	XM_CALLCONV OBBSeparation(FXMVECTOR CenterA, FXMVECTOR ExtentsA, FXMVECTOR OrientationA, GXMVECTOR CenterB, HXMVECTOR ExtentsB, HXMVECTOR OrientationB, XMVECTOR& Axis) noexcept;
+
+}; // end of namespace
+
+#endif
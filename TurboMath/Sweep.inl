@@ -0,0 +1,622 @@
+// -------------------------------------------------------------------
+// File			:	Sweep
+//
+// Project		:	TurboMath
+//
+// Description	:	continuous Collision-Tests (Time of Impact) for moving Volumes
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+namespace TurboMath
+{
+	//------------------------------------------------------------------------------
+	// Point-Casts
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV SweepPointSphere(FXMVECTOR O, FXMVECTOR V, FXMVECTOR Center, const float Radius, float& t) noexcept
+	{
+		const XMVECTOR M = XMVectorSubtract(O, Center);
+
+		const float a = XMVectorGetX(XMVector3LengthSq(V));
+		const float b = XMVectorGetX(XMVector3Dot(M, V));
+		const float c = XMVectorGetX(XMVector3LengthSq(M)) - Radius * Radius;
+
+		// outside and moving away, or not moving
+		if ((c > 0.0f && b > 0.0f) || a < FLT_EPSILON)
+			return false;
+
+		const float Disc = b * b - a * c;
+		if (Disc < 0.0f)
+			return false;
+
+		t = (-b - sqrtf(Disc)) / a;
+
+		return (t >= 0.0f && t <= 1.0f);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV SweepPointCylinder(FXMVECTOR O, FXMVECTOR V, FXMVECTOR P0, GXMVECTOR P1, const float Radius, float& t, XMVECTOR& Normal) noexcept
+	{
+		const XMVECTOR D = XMVectorSubtract(P1, P0);
+		const float dd = XMVectorGetX(XMVector3LengthSq(D));
+
+		if (dd < FLT_EPSILON)
+			return false;
+
+		// remove the Components along the Axis
+		const XMVECTOR M = XMVectorSubtract(O, P0);
+		const XMVECTOR MPerp = XMVectorNegativeMultiplySubtract(D, XMVectorReplicate(XMVectorGetX(XMVector3Dot(M, D)) / dd), M);
+		const XMVECTOR VPerp = XMVectorNegativeMultiplySubtract(D, XMVectorReplicate(XMVectorGetX(XMVector3Dot(V, D)) / dd), V);
+
+		const float a = XMVectorGetX(XMVector3LengthSq(VPerp));
+		const float b = XMVectorGetX(XMVector3Dot(MPerp, VPerp));
+		const float c = XMVectorGetX(XMVector3LengthSq(MPerp)) - Radius * Radius;
+
+		// parallel to the Axis (the Caps are the Vertex-Spheres) or already inside
+		if (a < FLT_EPSILON || c < 0.0f)
+			return false;
+
+		const float Disc = b * b - a * c;
+		if (Disc < 0.0f)
+			return false;
+
+		t = (-b - sqrtf(Disc)) / a;
+
+		if (t < 0.0f || t > 1.0f)
+			return false;
+
+		// inside the finite Cylinder ?
+		const XMVECTOR X = XMVectorMultiplyAdd(V, XMVectorReplicate(t), O);
+		const float s = XMVectorGetX(XMVector3Dot(XMVectorSubtract(X, P0), D)) / dd;
+
+		if (s < 0.0f || s > 1.0f)
+			return false;
+
+		Normal = XMVector3Normalize(XMVectorSubtract(X, XMVectorMultiplyAdd(D, XMVectorReplicate(s), P0)));
+
+		return true;
+	}
+
+	//------------------------------------------------------------------------------
+	// Sphere-Tests
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV SweepSpherePlane(const Sphere& theSphere, const Vector4& Move, const Plane& thePlane, SweepHit* pHit) noexcept
+	{
+		const XMVECTOR P = XMPlaneNormalize(thePlane.Get());
+		const XMVECTOR N = XMVectorSetW(P, 0.0f);
+		const XMVECTOR C = XMVectorSetW(theSphere.GetCenter(), 1.0f);
+		const float r = theSphere.GetRadius();
+
+		const float Dist = XMVectorGetX(XMPlaneDot(P, C));
+		const float Speed = XMVectorGetX(XMVector3Dot(N, Move));
+
+		float t = 0.0f;
+		float Side = (Dist >= 0.0f) ? 1.0f : -1.0f;
+
+		if (fabsf(Dist) > r)
+		{
+			// must move towards the Plane
+			if (Speed * Side >= 0.0f)
+				return false;
+
+			t = (Dist - Side * r) / -Speed;
+
+			if (t > 1.0f)
+				return false;
+		}
+
+		if (pHit != nullptr)
+		{
+			const XMVECTOR Normal = XMVectorScale(N, Side);
+			const XMVECTOR Center = XMVectorMultiplyAdd(Move, XMVectorReplicate(t), XMVectorSetW(C, 0.0f));
+
+			pHit->Time = t;
+			pHit->Normal = Normal;
+			pHit->Point = XMVectorNegativeMultiplySubtract(Normal, XMVectorReplicate((Dist + Speed * t) * Side), Center);
+		}
+
+		return true;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV SweepSphereSphere(const Sphere& SphereA, const Vector4& MoveA, const Sphere& SphereB, const Vector4& MoveB, SweepHit* pHit) noexcept
+	{
+		const XMVECTOR CA = XMVectorSetW(SphereA.GetCenter(), 0.0f);
+		const XMVECTOR CB = XMVectorSetW(SphereB.GetCenter(), 0.0f);
+		const float rA = SphereA.GetRadius();
+		const float rB = SphereB.GetRadius();
+
+		// B stands still, A moves relative to B
+		const XMVECTOR V = XMVectorSubtract(MoveA, MoveB);
+
+		float t = 0.0f;
+
+		const float DistSq = XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(CA, CB)));
+
+		if (DistSq > (rA + rB) * (rA + rB))
+		{
+			if (!SweepPointSphere(CA, V, CB, rA + rB, t))
+				return false;
+		}
+
+		if (pHit != nullptr)
+		{
+			const XMVECTOR HitA = XMVectorMultiplyAdd(MoveA, XMVectorReplicate(t), CA);
+			const XMVECTOR HitB = XMVectorMultiplyAdd(MoveB, XMVectorReplicate(t), CB);
+
+			XMVECTOR Normal = XMVectorSubtract(HitA, HitB);
+			Normal = (XMVectorGetX(XMVector3LengthSq(Normal)) > FLT_EPSILON) ? XMVector3Normalize(Normal) : XMVector3Normalize(XMVectorNegate(V));
+
+			pHit->Time = t;
+			pHit->Normal = Normal;
+			pHit->Point = XMVectorMultiplyAdd(Normal, XMVectorReplicate(rB), HitB);
+		}
+
+		return true;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV SweepSphereTriangle(const Sphere& theSphere, const Vector4& Move, const Triangle& Tri, SweepHit* pHit) noexcept
+	{
+		const XMVECTOR C = XMVectorSetW(theSphere.GetCenter(), 0.0f);
+		const float r = theSphere.GetRadius();
+		const XMVECTOR V = Move;
+
+		const XMVECTOR Vertex[3] = { Tri.GetVector1(), Tri.GetVector2(), Tri.GetVector3() };
+
+		XMVECTOR TriNormal = XMVector3Cross(XMVectorSubtract(Vertex[1], Vertex[0]), XMVectorSubtract(Vertex[2], Vertex[0]));
+		if (XMVectorGetX(XMVector3LengthSq(TriNormal)) < FLT_EPSILON)
+			return false;
+		TriNormal = XMVector3Normalize(TriNormal);
+
+		// overlapping at the Start
+		const XMVECTOR Closest = ClosestPointOnTriangle(C, Vertex[0], Vertex[1], Vertex[2]);
+		const XMVECTOR Delta = XMVectorSubtract(C, Closest);
+		const float DistSq = XMVectorGetX(XMVector3LengthSq(Delta));
+
+		if (DistSq <= r * r)
+		{
+			if (pHit != nullptr)
+			{
+				XMVECTOR Normal = TriNormal;
+				if (DistSq > FLT_EPSILON)
+					Normal = XMVector3Normalize(Delta);
+				else if (XMVectorGetX(XMVector3Dot(Normal, V)) > 0.0f)
+					Normal = XMVectorNegate(Normal);
+
+				pHit->Time = 0.0f;
+				pHit->Normal = Normal;
+				pHit->Point = Closest;
+			}
+
+			return true;
+		}
+
+		float BestTime = FLT_MAX;
+		XMVECTOR BestNormal = TriNormal;
+
+		// Face, moved by r to the Side of the Sphere
+		XMVECTOR N = TriNormal;
+		float Dist = XMVectorGetX(XMVector3Dot(N, XMVectorSubtract(C, Vertex[0])));
+		if (Dist < 0.0f)
+		{
+			N = XMVectorNegate(N);
+			Dist = -Dist;
+		}
+
+		const float Speed = XMVectorGetX(XMVector3Dot(N, V));
+		if (Speed < -FLT_EPSILON)
+		{
+			const float t = (Dist - r) / -Speed;
+
+			if (t >= 0.0f && t <= 1.0f)
+			{
+				// Contact-Point inside the Triangle ?
+				const XMVECTOR P = XMVectorNegativeMultiplySubtract(N, XMVectorReplicate(r), XMVectorMultiplyAdd(V, XMVectorReplicate(t), C));
+
+				bool bInside = true;
+				for (UINT i = 0; i < 3 && bInside; i++)
+				{
+					const XMVECTOR Edge = XMVectorSubtract(Vertex[(i + 1) % 3], Vertex[i]);
+					const XMVECTOR ToP = XMVectorSubtract(P, Vertex[i]);
+					bInside = XMVectorGetX(XMVector3Dot(XMVector3Cross(Edge, ToP), TriNormal)) >= 0.0f;
+				}
+
+				if (bInside)
+				{
+					BestTime = t;
+					BestNormal = N;
+				}
+			}
+		}
+
+		// Edges and Vertices (only needed if the Face isn't hit)
+		if (BestTime == FLT_MAX)
+		{
+			for (UINT i = 0; i < 3; i++)
+			{
+				float t;
+				XMVECTOR Normal;
+
+				if (SweepPointCylinder(C, V, Vertex[i], Vertex[(i + 1) % 3], r, t, Normal) && t < BestTime)
+				{
+					BestTime = t;
+					BestNormal = Normal;
+				}
+
+				if (SweepPointSphere(C, V, Vertex[i], r, t) && t < BestTime)
+				{
+					BestTime = t;
+					BestNormal = XMVector3Normalize(XMVectorSubtract(XMVectorMultiplyAdd(V, XMVectorReplicate(t), C), Vertex[i]));
+				}
+			}
+		}
+
+		if (BestTime == FLT_MAX)
+			return false;
+
+		if (pHit != nullptr)
+		{
+			pHit->Time = BestTime;
+			pHit->Normal = BestNormal;
+			pHit->Point = XMVectorNegativeMultiplySubtract(BestNormal, XMVectorReplicate(r), XMVectorMultiplyAdd(V, XMVectorReplicate(BestTime), C));
+		}
+
+		return true;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV SweepSphereAABB(const Sphere& theSphere, const Vector4& Move, const AABB& Box, SweepHit* pHit) noexcept
+	{
+		const XMVECTOR C = XMVectorSetW(theSphere.GetCenter(), 0.0f);
+		const float r = theSphere.GetRadius();
+		const XMVECTOR V = Move;
+		const XMVECTOR vMin = Box.GetMinExtents();
+		const XMVECTOR vMax = Box.GetMaxExtents();
+
+		// overlapping at the Start
+		const XMVECTOR Closest = XMVectorClamp(C, vMin, vMax);
+		const XMVECTOR Delta = XMVectorSubtract(C, Closest);
+		const float DistSq = XMVectorGetX(XMVector3LengthSq(Delta));
+
+		if (DistSq <= r * r)
+		{
+			if (pHit != nullptr)
+			{
+				XMVECTOR Normal;
+
+				if (DistSq > FLT_EPSILON)
+				{
+					Normal = XMVector3Normalize(Delta);
+				}
+				else
+				{
+					// Center inside : Face with the smallest Penetration
+					XMFLOAT4A ToMin, ToMax;
+					XMStoreFloat4A(&ToMin, XMVectorSubtract(C, vMin));
+					XMStoreFloat4A(&ToMax, XMVectorSubtract(vMax, C));
+
+					const float Pen[6] = { ToMax.x, ToMax.y, ToMax.z, ToMin.x, ToMin.y, ToMin.z };
+
+					UINT Best = 0;
+					for (UINT i = 1; i < 6; i++)
+					{
+						if (Pen[i] < Pen[Best])
+							Best = i;
+					}
+
+					XMFLOAT4A n(0.0f, 0.0f, 0.0f, 0.0f);
+					(&n.x)[Best % 3] = (Best < 3) ? 1.0f : -1.0f;
+					Normal = XMLoadFloat4A(&n);
+				}
+
+				pHit->Time = 0.0f;
+				pHit->Normal = Normal;
+				pHit->Point = Closest;
+			}
+
+			return true;
+		}
+
+		XMFLOAT4A c, v, mn, mx;
+		XMStoreFloat4A(&c, C);
+		XMStoreFloat4A(&v, V);
+		XMStoreFloat4A(&mn, vMin);
+		XMStoreFloat4A(&mx, vMax);
+
+		float BestTime = FLT_MAX;
+		XMFLOAT4A BestNormal(0.0f, 0.0f, 0.0f, 0.0f);
+
+		// Faces, moved by r
+		for (UINT i = 0; i < 3; i++)
+		{
+			const float vi = (&v.x)[i];
+			if (fabsf(vi) < FLT_EPSILON)
+				continue;
+
+			const float Side = (vi < 0.0f) ? 1.0f : -1.0f;
+			const float Face = (vi < 0.0f) ? (&mx.x)[i] + r : (&mn.x)[i] - r;
+			const float t = (Face - (&c.x)[i]) / vi;
+
+			if (t < 0.0f || t > 1.0f || t >= BestTime)
+				continue;
+
+			// Contact inside the Face ?
+			bool bInside = true;
+			for (UINT j = 0; j < 3 && bInside; j++)
+			{
+				if (j == i)
+					continue;
+
+				const float p = (&c.x)[j] + (&v.x)[j] * t;
+				bInside = (p >= (&mn.x)[j] && p <= (&mx.x)[j]);
+			}
+
+			if (bInside)
+			{
+				BestTime = t;
+				BestNormal = XMFLOAT4A(0.0f, 0.0f, 0.0f, 0.0f);
+				(&BestNormal.x)[i] = Side;
+			}
+		}
+
+		XMVECTOR vBestNormal = XMLoadFloat4A(&BestNormal);
+
+		// Edges and Corners (only needed if no Face is hit)
+		if (BestTime == FLT_MAX)
+		{
+			XMVECTOR Corner[8];
+			for (UINT i = 0; i < 8; i++)
+				Corner[i] = XMVectorSelect(vMin, vMax, XMVectorSelectControl(i & 1, (i >> 1) & 1, (i >> 2) & 1, 0));
+
+			for (UINT i = 0; i < 8; i++)
+			{
+				float t;
+				XMVECTOR Normal;
+
+				// 12 Edges : from every Corner along the Axes where its Bit is 0
+				for (UINT Bit = 1; Bit < 8; Bit <<= 1)
+				{
+					if ((i & Bit) == 0 && SweepPointCylinder(C, V, Corner[i], Corner[i | Bit], r, t, Normal) && t < BestTime)
+					{
+						BestTime = t;
+						vBestNormal = Normal;
+					}
+				}
+
+				if (SweepPointSphere(C, V, Corner[i], r, t) && t < BestTime)
+				{
+					BestTime = t;
+					vBestNormal = XMVector3Normalize(XMVectorSubtract(XMVectorMultiplyAdd(V, XMVectorReplicate(t), C), Corner[i]));
+				}
+			}
+		}
+
+		if (BestTime == FLT_MAX)
+			return false;
+
+		if (pHit != nullptr)
+		{
+			pHit->Time = BestTime;
+			pHit->Normal = vBestNormal;
+			pHit->Point = XMVectorNegativeMultiplySubtract(vBestNormal, XMVectorReplicate(r), XMVectorMultiplyAdd(V, XMVectorReplicate(BestTime), C));
+		}
+
+		return true;
+	}
+
+	//------------------------------------------------------------------------------
+	// Box-Tests
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV SweepAABBAABB(const AABB& BoxA, const Vector4& MoveA, const AABB& BoxB, const Vector4& MoveB, SweepHit* pHit) noexcept
+	{
+		XMFLOAT4A MinA, MaxA, MinB, MaxB, v;
+		XMStoreFloat4A(&MinA, BoxA.GetMinExtents());
+		XMStoreFloat4A(&MaxA, BoxA.GetMaxExtents());
+		XMStoreFloat4A(&MinB, BoxB.GetMinExtents());
+		XMStoreFloat4A(&MaxB, BoxB.GetMaxExtents());
+
+		// B stands still, A moves relative to B
+		XMStoreFloat4A(&v, XMVectorSubtract(MoveA, MoveB));
+
+		float Enter = 0.0f;
+		float Exit = 1.0f;
+		int EnterAxis = -1;
+		float EnterSide = 0.0f;
+
+		// smallest Penetration for Boxes overlapping at the Start
+		float MinPen = FLT_MAX;
+		int PenAxis = 0;
+		float PenSide = 1.0f;
+
+		// Slabs per Axis
+		for (int i = 0; i < 3; i++)
+		{
+			const float aMin = (&MinA.x)[i], aMax = (&MaxA.x)[i];
+			const float bMin = (&MinB.x)[i], bMax = (&MaxB.x)[i];
+			const float vi = (&v.x)[i];
+
+			const float PenPos = bMax - aMin;		// push A to +
+			const float PenNeg = aMax - bMin;		// push A to -
+			if (PenPos < MinPen) { MinPen = PenPos; PenAxis = i; PenSide = 1.0f; }
+			if (PenNeg < MinPen) { MinPen = PenNeg; PenAxis = i; PenSide = -1.0f; }
+
+			if (fabsf(vi) < FLT_EPSILON)
+			{
+				if (aMax < bMin || aMin > bMax)
+					return false;
+				continue;
+			}
+
+			const float t0 = (vi > 0.0f) ? (bMin - aMax) / vi : (bMax - aMin) / vi;
+			const float t1 = (vi > 0.0f) ? (bMax - aMin) / vi : (bMin - aMax) / vi;
+
+			if (t0 > Enter)
+			{
+				Enter = t0;
+				EnterAxis = i;
+				EnterSide = (vi > 0.0f) ? -1.0f : 1.0f;
+			}
+
+			Exit = XMMin(Exit, t1);
+
+			if (Enter > Exit)
+				return false;
+		}
+
+		if (pHit != nullptr)
+		{
+			XMFLOAT4A n(0.0f, 0.0f, 0.0f, 0.0f);
+
+			if (EnterAxis >= 0)
+				(&n.x)[EnterAxis] = EnterSide;
+			else
+				(&n.x)[PenAxis] = PenSide;
+
+			// Center of A at the Time of Impact, clamped onto B
+			const XMVECTOR CenterA = XMVectorMultiplyAdd(XMLoadFloat4A(&v), XMVectorReplicate(Enter), BoxA.GetCenter());
+			const XMVECTOR vMinB = XMLoadFloat4A(&MinB);
+			const XMVECTOR vMaxB = XMLoadFloat4A(&MaxB);
+
+			pHit->Time = Enter;
+			pHit->Normal = XMLoadFloat4A(&n);
+			pHit->Point = XMVectorClamp(CenterA, vMinB, vMaxB);
+		}
+
+		return true;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const float XM_CALLCONV OBBSeparation(FXMVECTOR CenterA, FXMVECTOR ExtentsA, FXMVECTOR OrientationA, GXMVECTOR CenterB, HXMVECTOR ExtentsB, HXMVECTOR OrientationB, XMVECTOR& Axis) noexcept
+	{
+		const XMMATRIX RotA = XMMatrixRotationQuaternion(OrientationA);
+		const XMMATRIX RotB = XMMatrixRotationQuaternion(OrientationB);
+
+		const XMVECTOR T = XMVectorSubtract(CenterA, CenterB);
+
+		XMFLOAT4A eA, eB;
+		XMStoreFloat4A(&eA, ExtentsA);
+		XMStoreFloat4A(&eB, ExtentsB);
+
+		float Best = -FLT_MAX;
+		Axis = RotA.r[0];
+
+		// projected Radius of both Boxes and the Separation along one Axis
+		auto TestAxis = [&](FXMVECTOR L)
+		{
+			const float LengthSq = XMVectorGetX(XMVector3LengthSq(L));
+			if (LengthSq < 1e-6f)
+				return;
+
+			const XMVECTOR N = XMVectorScale(L, 1.0f / sqrtf(LengthSq));
+
+			float rA = 0.0f, rB = 0.0f;
+			for (UINT i = 0; i < 3; i++)
+			{
+				rA += (&eA.x)[i] * fabsf(XMVectorGetX(XMVector3Dot(RotA.r[i], N)));
+				rB += (&eB.x)[i] * fabsf(XMVectorGetX(XMVector3Dot(RotB.r[i], N)));
+			}
+
+			const float Dist = XMVectorGetX(XMVector3Dot(T, N));
+			const float Sep = fabsf(Dist) - rA - rB;
+
+			if (Sep > Best)
+			{
+				Best = Sep;
+				Axis = (Dist >= 0.0f) ? N : XMVectorNegate(N);
+			}
+		};
+
+		for (UINT i = 0; i < 3; i++)
+		{
+			TestAxis(RotA.r[i]);
+			TestAxis(RotB.r[i]);
+		}
+
+		for (UINT i = 0; i < 3; i++)
+		{
+			for (UINT j = 0; j < 3; j++)
+				TestAxis(XMVector3Cross(RotA.r[i], RotB.r[j]));
+		}
+
+		return Best;
+	}
+
+	//------------------------------------------------------------------------------
+	// Conservative Advancement : the SAT-Separation is a lower Bound of the
+	// Distance and no Point of the Boxes moves faster than MaxSpeed, so the
+	// Boxes can't touch before Time + Separation / MaxSpeed.
+	XM_INLINE const bool XM_CALLCONV SweepOBBOBB(const OBB& StartA, const OBB& EndA, const OBB& StartB, const OBB& EndB, SweepHit* pHit, const float Tolerance, const UINT MaxIterations) noexcept
+	{
+		const XMVECTOR CenterA0 = StartA.GetCenter(), CenterA1 = EndA.GetCenter();
+		const XMVECTOR CenterB0 = StartB.GetCenter(), CenterB1 = EndB.GetCenter();
+		const XMVECTOR QuatA0 = StartA.GetOrientation().Get(), QuatA1 = EndA.GetOrientation().Get();
+		const XMVECTOR QuatB0 = StartB.GetOrientation().Get(), QuatB1 = EndB.GetOrientation().Get();
+		const XMVECTOR ExtentsA = StartA.GetExtents();
+		const XMVECTOR ExtentsB = StartB.GetExtents();
+
+		// max. Speed of any Point relative to the other Box (per Step)
+		const float AngleA = 2.0f * acosf(XMMin(fabsf(XMVectorGetX(XMQuaternionDot(QuatA0, QuatA1))), 1.0f));
+		const float AngleB = 2.0f * acosf(XMMin(fabsf(XMVectorGetX(XMQuaternionDot(QuatB0, QuatB1))), 1.0f));
+
+		const XMVECTOR Linear = XMVectorSubtract(XMVectorSubtract(CenterA1, CenterA0), XMVectorSubtract(CenterB1, CenterB0));
+
+		const float MaxSpeed =	XMVectorGetX(XMVector3Length(Linear)) +
+								AngleA * XMVectorGetX(XMVector3Length(ExtentsA)) +
+								AngleB * XMVectorGetX(XMVector3Length(ExtentsB));
+
+		float t = 0.0f;
+		XMVECTOR Axis;
+		XMVECTOR CenterA, CenterB, QuatA, QuatB;
+
+		for (UINT Iteration = 0; ; Iteration++)
+		{
+			const XMVECTOR vt = XMVectorReplicate(t);
+
+			CenterA = XMVectorLerpV(CenterA0, CenterA1, vt);
+			CenterB = XMVectorLerpV(CenterB0, CenterB1, vt);
+			QuatA = XMQuaternionSlerpV(QuatA0, QuatA1, vt);
+			QuatB = XMQuaternionSlerpV(QuatB0, QuatB1, vt);
+
+			const float Sep = OBBSeparation(CenterA, ExtentsA, QuatA, CenterB, ExtentsB, QuatB, Axis);
+
+			// touching (or overlapping at the Start)
+			if (Sep <= Tolerance)
+				break;
+
+			// no Motion or too far for this Step
+			if (MaxSpeed < FLT_EPSILON)
+				return false;
+
+			t += Sep / MaxSpeed;
+
+			if (t > 1.0f)
+				return false;
+
+			// out of Iterations : not converged, the Boxes are still apart at t (e.g. a slow near Miss)
+			if (Iteration + 1 >= MaxIterations)
+				return false;
+		}
+
+		if (pHit != nullptr)
+		{
+			pHit->Time = t;
+			pHit->Normal = Axis;
+			pHit->Point = ClosestPointOnOBB(CenterA, CenterB, ExtentsB, QuatB);
+		}
+
+		return true;
+	}
+
+}// end of Namespace TurboMath
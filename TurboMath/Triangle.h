@@ -64,6 +64,11 @@ namespace TurboMath
 		void		 XM_CALLCONV 		SetUserData(const UINT& UData) noexcept;
 		const UINT	 XM_CALLCONV 		GetUserData() const noexcept;
 
+		// Distance
+		const Vector4	 XM_CALLCONV 		ClosestPoint(const Vector4& p) const noexcept;
+		const float	 XM_CALLCONV 		DistanceSq(const Vector4& p) const noexcept;
+		const float	 XM_CALLCONV 		DistanceSq(const Triangle& t, Vector4* pa = nullptr, Vector4* pb = nullptr) const noexcept;
+
 		// Triangle-Matrix product
 		const Triangle  XM_CALLCONV operator * (const Matrix& m) const noexcept;
 		/// muliply by a Matrix component-wise
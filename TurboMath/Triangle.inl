@@ -165,6 +165,31 @@ namespace TurboMath
 		return (UINT)tmp;
 	}
 
+	XM_INLINE const Vector4  XM_CALLCONV Triangle::ClosestPoint(const Vector4& p) const noexcept
+	{
+		return ClosestPointOnTriangle(p, v[0], v[1], v[2]);
+	}
+
+	XM_INLINE const float  XM_CALLCONV Triangle::DistanceSq(const Vector4& p) const noexcept
+	{
+		const XMVECTOR Closest = ClosestPointOnTriangle(p, v[0], v[1], v[2]);
+
+		return XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(p, Closest)));
+	}
+
+	XM_INLINE const float  XM_CALLCONV Triangle::DistanceSq(const Triangle& t, Vector4* pa, Vector4* pb) const noexcept
+	{
+		XMVECTOR Ca, Cb;
+		const float d = DistanceSqTriangleTriangle(v[0], v[1], v[2], t.v[0], t.v[1], t.v[2], &Ca, &Cb);
+
+		if (pa != nullptr)
+			*pa = Ca;
+		if (pb != nullptr)
+			*pb = Cb;
+
+		return d;
+	}
+
 
 	
 }// end of Namespace TurboMath
\ No newline at end of file
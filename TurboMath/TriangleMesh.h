@@ -0,0 +1,210 @@
+// -------------------------------------------------------------------
+// File			:	TriangleMesh
+//
+// Project		:	TurboMath
+//
+// Description	:	Indexed Triangle-Mesh with SoA-Vertex-Streams
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef _TURBOMATH_TRIANGLEMESH_H_
+#define _TURBOMATH_TRIANGLEMESH_H_
+
+#include <vector>
+
+namespace TurboMath
+{
+
+	//-----------------------------------------------------------------------------
+	// Result of a Ray-Mesh-Query
+	//-----------------------------------------------------------------------------
+	struct RayHit
+	{
+		float	Distance;		// Distance along the Ray (in Units of the Ray-Direction)
+		float	U;				// Barycentric Coordinate of the second Vertex
+		float	V;				// Barycentric Coordinate of the third Vertex
+		UINT	TriIndex;		// Index of the Triangle
+	};
+
+	//-----------------------------------------------------------------------------
+	// Indexed Triangle-Mesh. The Positions (and optional Vertex-Normals) are
+	// stored as separate X/Y/Z-Streams (SoA), so the Bulk-Operations
+	// (Transform, GetAABB, Normal-Generation) process 4 Vertices per Instruction.
+	//
+	// Optional precomputed Triangle-Data (exact Copies of V0, V1, V2 per
+	// Triangle) is stored in SoA-Streams too and is used by the watertight
+	// Intersection-Routines.
+	//
+	// Editing the Vertices (AddVertex, SetVertex) or Triangles invalidates the
+	// derived Data (Normals, Triangle-Data). Rebuild it after the last Edit, and
+	// refit a BVH built over the Mesh (BVH::Refit).
+	//-----------------------------------------------------------------------------
+	CACHE_ALIGN(16) class TriangleMesh
+	{
+	public:
+
+		typedef std::vector<float, AAllocator<float> >	FloatStream;
+		typedef std::vector<UINT>						IndexStream;
+
+		//-----------------------------------------------------------------------------
+		// Constructor / Destructor
+		//-----------------------------------------------------------------------------
+		TriangleMesh() noexcept;
+		~TriangleMesh() noexcept;
+
+		/// remove all Vertices and Triangles
+		void			XM_CALLCONV Clear() noexcept;
+
+		/// reserve Memory for Vertices and Triangles
+		void			XM_CALLCONV Reserve(const UINT NumVertices, const UINT NumTriangles);
+
+		//-----------------------------------------------------------------------------
+		// Vertices
+		//-----------------------------------------------------------------------------
+
+		/// add a Vertex, returns the Index of the Vertex
+		const UINT		XM_CALLCONV AddVertex(const Vector4& Pos);
+
+		/// set the Position of a Vertex (releases Normals and Triangle-Data)
+		void			XM_CALLCONV SetVertex(const UINT Index, const Vector4& Pos) noexcept;
+
+		/// get the Position of a Vertex
+		const Vector4	XM_CALLCONV GetVertex(const UINT Index) const noexcept;
+
+		/// get the Normal of a Vertex (valid after ComputeVertexNormals)
+		const Vector4	XM_CALLCONV GetVertexNormal(const UINT Index) const noexcept;
+
+		/// get Number of Vertices
+		const UINT		XM_CALLCONV GetNumVertices() const noexcept;
+
+		//-----------------------------------------------------------------------------
+		// Triangles
+		//-----------------------------------------------------------------------------
+
+		/// add a Triangle from 3 Vertex-Indices, returns the Index of the Triangle
+		const UINT		XM_CALLCONV AddTriangle(const UINT i0, const UINT i1, const UINT i2, const UINT UserData = 0);
+
+		/// add a Triangle (and its 3 Vertices), returns the Index of the Triangle
+		const UINT		XM_CALLCONV AddTriangle(const Triangle& Tri, const UINT UserData = 0);
+
+		/// get Number of Triangles
+		const UINT		XM_CALLCONV GetNumTriangles() const noexcept;
+
+		/// get the 3 Vertex-Indices of a Triangle
+		void			XM_CALLCONV GetTriangleIndices(const UINT Tri, UINT& i0, UINT& i1, UINT& i2) const noexcept;
+
+		/// get a Triangle as Triangle-Class
+		const Triangle	XM_CALLCONV GetTriangle(const UINT Tri) const noexcept;
+
+		/// get the Face-Normal of a Triangle (valid after ComputeFaceNormals)
+		const Vector4	XM_CALLCONV GetFaceNormal(const UINT Tri) const noexcept;
+
+		/// set the User-Data of a Triangle
+		void			XM_CALLCONV SetUserData(const UINT Tri, const UINT UserData) noexcept;
+
+		/// get the User-Data of a Triangle
+		const UINT		XM_CALLCONV GetUserData(const UINT Tri) const noexcept;
+
+		//-----------------------------------------------------------------------------
+		// Raw Streams
+		//-----------------------------------------------------------------------------
+		const float*	XM_CALLCONV GetPositionsX() const noexcept		{ return m_PosX.data(); }
+		const float*	XM_CALLCONV GetPositionsY() const noexcept		{ return m_PosY.data(); }
+		const float*	XM_CALLCONV GetPositionsZ() const noexcept		{ return m_PosZ.data(); }
+		const float*	XM_CALLCONV GetNormalsX() const noexcept		{ return m_NrmX.data(); }
+		const float*	XM_CALLCONV GetNormalsY() const noexcept		{ return m_NrmY.data(); }
+		const float*	XM_CALLCONV GetNormalsZ() const noexcept		{ return m_NrmZ.data(); }
+		const UINT*		XM_CALLCONV GetIndices() const noexcept			{ return m_Indices.data(); }
+
+		//-----------------------------------------------------------------------------
+		// Bulk-Operations (Streaming SIMD-Kernels)
+		//-----------------------------------------------------------------------------
+
+		/// transform all Vertices (and Normals) by a Matrix
+		void			XM_CALLCONV Transform(const Matrix& m) noexcept;
+
+		/// get the Bounding-Box of all Vertices
+		const AABB		XM_CALLCONV GetAABB() const noexcept;
+
+		/// write the Bounding-Box of every Triangle to pBoxes (GetNumTriangles() Entries)
+		void			XM_CALLCONV ComputeTriangleAABBs(AABB* pBoxes) const noexcept;
+
+		/// compute the (normalized) Face-Normal of every Triangle
+		void			XM_CALLCONV ComputeFaceNormals();
+
+		/// compute area weighted Vertex-Normals
+		void			XM_CALLCONV ComputeVertexNormals();
+
+		/// has the Mesh Vertex-Normals ?
+		const bool		XM_CALLCONV HasVertexNormals() const noexcept;
+
+		/// has the Mesh Face-Normals ?
+		const bool		XM_CALLCONV HasFaceNormals() const noexcept;
+
+		//-----------------------------------------------------------------------------
+		// Precomputed Triangle-Data for fast Intersection-Tests
+		//-----------------------------------------------------------------------------
+
+		/// copy the 3 Vertices of every Triangle into padded SoA-Streams
+		void			XM_CALLCONV BuildTriangleData();
+
+		/// free the precomputed Triangle-Data
+		void			XM_CALLCONV ReleaseTriangleData() noexcept;
+
+		/// is the precomputed Triangle-Data available ?
+		const bool		XM_CALLCONV HasTriangleData() const noexcept;
+
+		//-----------------------------------------------------------------------------
+		// Ray-Queries (watertight, need the precomputed Triangle-Data)
+		//-----------------------------------------------------------------------------
+
+		/// find the closest Hit of a Ray with all Triangles
+		const bool		XM_CALLCONV IntersectRay(const Ray& theRay, RayHit& Hit, const float MaxDist = FLT_MAX) const noexcept;
+
+		/// find the closest Hit with the Triangles [FirstTri, FirstTri + NumTris), only Hits closer than Hit.Distance are accepted
+		/// (needs the Triangle-Data for NumTris > 0)
+		const bool		XM_CALLCONV IntersectRay(const WatertightRay& theRay, const UINT FirstTri, const UINT NumTris, RayHit& Hit) const noexcept;
+
+	protected:
+
+		/// load the 3 Vertices of 4 Triangles as SoA (missing Triangles are degenerated)
+		void			XM_CALLCONV GatherTriangles4(const UINT FirstTri, XMVECTOR* pV0, XMVECTOR* pV1, XMVECTOR* pV2) const noexcept;
+
+		/// recompute the scaled Barycentrics U, V, W of the Lanes in LaneMask in double Precision
+		static void		XM_CALLCONV EdgeFunctionsDouble(const float* pAx, const float* pAy, const float* pBx, const float* pBy, const float* pCx, const float* pCy,
+														float* pU, float* pV, float* pW, const UINT NumLanes, const int LaneMask) noexcept;
+
+		// Vertex-Streams
+		FloatStream		m_PosX, m_PosY, m_PosZ;			// Positions
+		FloatStream		m_NrmX, m_NrmY, m_NrmZ;			// Vertex-Normals (optional)
+
+		// Triangle-Streams
+		IndexStream		m_Indices;						// 3 Indices per Triangle
+		IndexStream		m_UserData;						// User-Data per Triangle
+		FloatStream		m_FaceNX, m_FaceNY, m_FaceNZ;	// Face-Normals (optional)
+
+		// precomputed Triangle-Data (optional), padded to a Multiple of 8
+		FloatStream		m_TriV0X, m_TriV0Y, m_TriV0Z;	// first Vertex
+		FloatStream		m_TriV1X, m_TriV1Y, m_TriV1Z;	// second Vertex
+		FloatStream		m_TriV2X, m_TriV2Y, m_TriV2Z;	// third Vertex
+	};
+
+}; // end of namespace
+
+#endif
@@ -0,0 +1,877 @@
+// -------------------------------------------------------------------
+// File			:	TriangleMesh.inl
+//
+// Project		:	TurboMath
+//
+// Description	:	Inline-Code for the TriangleMesh-Class
+//
+// Author		:	Thorsten Polte
+// -------------------------------------------------------------------
+// (c) 2011-2020 by Innovation3D-Studios
+// --------------------------------------------------------------------
+// THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF
+// ANY KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+// PARTICULAR PURPOSE.
+//---------------------------------------------------------------------
+// https://github.com/toasti1973/TurboMath
+//
+// Contact : thorsten.polte@innovation3d.de
+//---------------------------------------------------------------------
+
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+namespace TurboMath
+{
+
+	//------------------------------------------------------------------------------
+	XM_INLINE TriangleMesh::TriangleMesh() noexcept
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE TriangleMesh::~TriangleMesh() noexcept
+	{
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV TriangleMesh::Clear() noexcept
+	{
+		m_PosX.clear(); m_PosY.clear(); m_PosZ.clear();
+		m_NrmX.clear(); m_NrmY.clear(); m_NrmZ.clear();
+
+		m_Indices.clear();
+		m_UserData.clear();
+		m_FaceNX.clear(); m_FaceNY.clear(); m_FaceNZ.clear();
+
+		ReleaseTriangleData();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV TriangleMesh::Reserve(const UINT NumVertices, const UINT NumTriangles)
+	{
+		m_PosX.reserve(NumVertices);
+		m_PosY.reserve(NumVertices);
+		m_PosZ.reserve(NumVertices);
+
+		m_Indices.reserve(NumTriangles * 3);
+		m_UserData.reserve(NumTriangles);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV TriangleMesh::AddVertex(const Vector4& Pos)
+	{
+		const UINT Index = (UINT)m_PosX.size();
+
+		m_PosX.push_back(Pos.GetX());
+		m_PosY.push_back(Pos.GetY());
+		m_PosZ.push_back(Pos.GetZ());
+
+		// Normals are no longer valid
+		m_NrmX.clear(); m_NrmY.clear(); m_NrmZ.clear();
+
+		return Index;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV TriangleMesh::SetVertex(const UINT Index, const Vector4& Pos) noexcept
+	{
+		assert(Index < GetNumVertices());
+
+		m_PosX[Index] = Pos.GetX();
+		m_PosY[Index] = Pos.GetY();
+		m_PosZ[Index] = Pos.GetZ();
+
+		// derived Data is no longer valid (the Memory is kept for the Rebuild)
+		m_NrmX.clear(); m_NrmY.clear(); m_NrmZ.clear();
+		m_FaceNX.clear(); m_FaceNY.clear(); m_FaceNZ.clear();
+		ReleaseTriangleData();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const Vector4 XM_CALLCONV TriangleMesh::GetVertex(const UINT Index) const noexcept
+	{
+		assert(Index < GetNumVertices());
+
+		return Vector4(m_PosX[Index], m_PosY[Index], m_PosZ[Index], 1.0f);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const Vector4 XM_CALLCONV TriangleMesh::GetVertexNormal(const UINT Index) const noexcept
+	{
+		assert(HasVertexNormals());
+		assert(Index < GetNumVertices());
+
+		return Vector4(m_NrmX[Index], m_NrmY[Index], m_NrmZ[Index]);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV TriangleMesh::GetNumVertices() const noexcept
+	{
+		return (UINT)m_PosX.size();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV TriangleMesh::AddTriangle(const UINT i0, const UINT i1, const UINT i2, const UINT UserData)
+	{
+		assert(i0 < GetNumVertices());
+		assert(i1 < GetNumVertices());
+		assert(i2 < GetNumVertices());
+
+		const UINT Index = GetNumTriangles();
+
+		m_Indices.push_back(i0);
+		m_Indices.push_back(i1);
+		m_Indices.push_back(i2);
+
+		m_UserData.push_back(UserData);
+
+		// derived Data is no longer valid
+		m_FaceNX.clear(); m_FaceNY.clear(); m_FaceNZ.clear();
+		ReleaseTriangleData();
+
+		return Index;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV TriangleMesh::AddTriangle(const Triangle& Tri, const UINT UserData)
+	{
+		const UINT i0 = AddVertex(Tri.GetVector1());
+		const UINT i1 = AddVertex(Tri.GetVector2());
+		const UINT i2 = AddVertex(Tri.GetVector3());
+
+		return AddTriangle(i0, i1, i2, UserData);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV TriangleMesh::GetNumTriangles() const noexcept
+	{
+		return (UINT)m_UserData.size();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV TriangleMesh::GetTriangleIndices(const UINT Tri, UINT& i0, UINT& i1, UINT& i2) const noexcept
+	{
+		assert(Tri < GetNumTriangles());
+
+		i0 = m_Indices[Tri * 3 + 0];
+		i1 = m_Indices[Tri * 3 + 1];
+		i2 = m_Indices[Tri * 3 + 2];
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const Triangle XM_CALLCONV TriangleMesh::GetTriangle(const UINT Tri) const noexcept
+	{
+		UINT i0, i1, i2;
+
+		GetTriangleIndices(Tri, i0, i1, i2);
+
+		return Triangle(GetVertex(i0), GetVertex(i1), GetVertex(i2));
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const Vector4 XM_CALLCONV TriangleMesh::GetFaceNormal(const UINT Tri) const noexcept
+	{
+		assert(HasFaceNormals());
+		assert(Tri < GetNumTriangles());
+
+		return Vector4(m_FaceNX[Tri], m_FaceNY[Tri], m_FaceNZ[Tri]);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV TriangleMesh::SetUserData(const UINT Tri, const UINT UserData) noexcept
+	{
+		assert(Tri < GetNumTriangles());
+
+		m_UserData[Tri] = UserData;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const UINT XM_CALLCONV TriangleMesh::GetUserData(const UINT Tri) const noexcept
+	{
+		assert(Tri < GetNumTriangles());
+
+		return m_UserData[Tri];
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV TriangleMesh::HasVertexNormals() const noexcept
+	{
+		return !m_NrmX.empty() && m_NrmX.size() == m_PosX.size();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV TriangleMesh::HasFaceNormals() const noexcept
+	{
+		return !m_FaceNX.empty() && m_FaceNX.size() >= m_UserData.size();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV TriangleMesh::HasTriangleData() const noexcept
+	{
+		return !m_TriV0X.empty() && m_TriV0X.size() >= m_UserData.size();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV TriangleMesh::Transform(const Matrix& m) noexcept
+	{
+		const float* pM = m;
+
+		// Rows of the Matrix, every Element splatted
+		const XMVECTOR m00 = XMVectorReplicate(pM[0]),  m01 = XMVectorReplicate(pM[1]),  m02 = XMVectorReplicate(pM[2]);
+		const XMVECTOR m10 = XMVectorReplicate(pM[4]),  m11 = XMVectorReplicate(pM[5]),  m12 = XMVectorReplicate(pM[6]);
+		const XMVECTOR m20 = XMVectorReplicate(pM[8]),  m21 = XMVectorReplicate(pM[9]),  m22 = XMVectorReplicate(pM[10]);
+		const XMVECTOR m30 = XMVectorReplicate(pM[12]), m31 = XMVectorReplicate(pM[13]), m32 = XMVectorReplicate(pM[14]);
+
+		float* pX = m_PosX.data();
+		float* pY = m_PosY.data();
+		float* pZ = m_PosZ.data();
+
+		const UINT Count = GetNumVertices();
+		const UINT Count4 = Count & ~3u;
+
+		UINT i = 0;
+
+		// 4 Vertices per Iteration
+		for (; i < Count4; i += 4)
+		{
+			XM_PREFETCH(pX + i + 16);
+			XM_PREFETCH(pY + i + 16);
+			XM_PREFETCH(pZ + i + 16);
+
+			const XMVECTOR X = XMLoadFloat4((const XMFLOAT4*)(pX + i));
+			const XMVECTOR Y = XMLoadFloat4((const XMFLOAT4*)(pY + i));
+			const XMVECTOR Z = XMLoadFloat4((const XMFLOAT4*)(pZ + i));
+
+			XMVECTOR RX = XMVectorMultiplyAdd(X, m00, m30);
+			XMVECTOR RY = XMVectorMultiplyAdd(X, m01, m31);
+			XMVECTOR RZ = XMVectorMultiplyAdd(X, m02, m32);
+
+			RX = XMVectorMultiplyAdd(Y, m10, RX);
+			RY = XMVectorMultiplyAdd(Y, m11, RY);
+			RZ = XMVectorMultiplyAdd(Y, m12, RZ);
+
+			RX = XMVectorMultiplyAdd(Z, m20, RX);
+			RY = XMVectorMultiplyAdd(Z, m21, RY);
+			RZ = XMVectorMultiplyAdd(Z, m22, RZ);
+
+			XMStoreFloat4((XMFLOAT4*)(pX + i), RX);
+			XMStoreFloat4((XMFLOAT4*)(pY + i), RY);
+			XMStoreFloat4((XMFLOAT4*)(pZ + i), RZ);
+		}
+
+		// the Rest
+		for (; i < Count; i++)
+		{
+			const float x = pX[i], y = pY[i], z = pZ[i];
+
+			pX[i] = x * pM[0] + y * pM[4] + z * pM[8]  + pM[12];
+			pY[i] = x * pM[1] + y * pM[5] + z * pM[9]  + pM[13];
+			pZ[i] = x * pM[2] + y * pM[6] + z * pM[10] + pM[14];
+		}
+
+		// Normals are transformed with the Inverse-Transpose
+		if (HasVertexNormals())
+		{
+			const Matrix	N = Matrix::Transpose(Matrix::Inverse(m));
+			const float*	pN = N;
+
+			float* pNX = m_NrmX.data();
+			float* pNY = m_NrmY.data();
+			float* pNZ = m_NrmZ.data();
+
+			for (i = 0; i < Count; i++)
+			{
+				const float x = pNX[i], y = pNY[i], z = pNZ[i];
+
+				const float nx = x * pN[0] + y * pN[4] + z * pN[8];
+				const float ny = x * pN[1] + y * pN[5] + z * pN[9];
+				const float nz = x * pN[2] + y * pN[6] + z * pN[10];
+
+				const float Len = sqrtf(nx * nx + ny * ny + nz * nz);
+				const float InvLen = (Len > 0.0f) ? 1.0f / Len : 0.0f;
+
+				pNX[i] = nx * InvLen;
+				pNY[i] = ny * InvLen;
+				pNZ[i] = nz * InvLen;
+			}
+		}
+
+		// rebuild the derived Data
+		if (HasFaceNormals())
+		{
+			ComputeFaceNormals();
+		}
+
+		if (HasTriangleData())
+		{
+			BuildTriangleData();
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const AABB XM_CALLCONV TriangleMesh::GetAABB() const noexcept
+	{
+		AABB Box;
+
+		const UINT Count = GetNumVertices();
+
+		if (Count == 0)
+		{
+			Box.Reset();
+			return Box;
+		}
+
+		const float* pX = m_PosX.data();
+		const float* pY = m_PosY.data();
+		const float* pZ = m_PosZ.data();
+
+		XMVECTOR MinX = XMVectorReplicate(pX[0]), MaxX = MinX;
+		XMVECTOR MinY = XMVectorReplicate(pY[0]), MaxY = MinY;
+		XMVECTOR MinZ = XMVectorReplicate(pZ[0]), MaxZ = MinZ;
+
+		const UINT Count4 = Count & ~3u;
+
+		UINT i = 0;
+
+		// Streaming Min/Max over 4 Vertices
+		for (; i < Count4; i += 4)
+		{
+			XM_PREFETCH(pX + i + 16);
+			XM_PREFETCH(pY + i + 16);
+			XM_PREFETCH(pZ + i + 16);
+
+			const XMVECTOR X = XMLoadFloat4((const XMFLOAT4*)(pX + i));
+			const XMVECTOR Y = XMLoadFloat4((const XMFLOAT4*)(pY + i));
+			const XMVECTOR Z = XMLoadFloat4((const XMFLOAT4*)(pZ + i));
+
+			MinX = XMVectorMin(MinX, X); MaxX = XMVectorMax(MaxX, X);
+			MinY = XMVectorMin(MinY, Y); MaxY = XMVectorMax(MaxY, Y);
+			MinZ = XMVectorMin(MinZ, Z); MaxZ = XMVectorMax(MaxZ, Z);
+		}
+
+		XMFLOAT4A fMinX, fMaxX, fMinY, fMaxY, fMinZ, fMaxZ;
+
+		XMStoreFloat4A(&fMinX, MinX); XMStoreFloat4A(&fMaxX, MaxX);
+		XMStoreFloat4A(&fMinY, MinY); XMStoreFloat4A(&fMaxY, MaxY);
+		XMStoreFloat4A(&fMinZ, MinZ); XMStoreFloat4A(&fMaxZ, MaxZ);
+
+		// horizontal Reduction
+		float mnX = XMMin(XMMin(fMinX.x, fMinX.y), XMMin(fMinX.z, fMinX.w));
+		float mnY = XMMin(XMMin(fMinY.x, fMinY.y), XMMin(fMinY.z, fMinY.w));
+		float mnZ = XMMin(XMMin(fMinZ.x, fMinZ.y), XMMin(fMinZ.z, fMinZ.w));
+		float mxX = XMMax(XMMax(fMaxX.x, fMaxX.y), XMMax(fMaxX.z, fMaxX.w));
+		float mxY = XMMax(XMMax(fMaxY.x, fMaxY.y), XMMax(fMaxY.z, fMaxY.w));
+		float mxZ = XMMax(XMMax(fMaxZ.x, fMaxZ.y), XMMax(fMaxZ.z, fMaxZ.w));
+
+		// the Rest
+		for (; i < Count; i++)
+		{
+			mnX = XMMin(mnX, pX[i]); mxX = XMMax(mxX, pX[i]);
+			mnY = XMMin(mnY, pY[i]); mxY = XMMax(mxY, pY[i]);
+			mnZ = XMMin(mnZ, pZ[i]); mxZ = XMMax(mxZ, pZ[i]);
+		}
+
+		Box.SetMinMaxExtents(Vector4(mnX, mnY, mnZ), Vector4(mxX, mxY, mxZ));
+
+		return Box;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV TriangleMesh::GatherTriangles4(const UINT FirstTri, XMVECTOR* pV0, XMVECTOR* pV1, XMVECTOR* pV2) const noexcept
+	{
+		const UINT NumTris = GetNumTriangles();
+
+		XMFLOAT4A V[3][3];	// [Vertex][Component] -> 4 Lanes
+
+		for (UINT l = 0; l < 4; l++)
+		{
+			// missing Triangles use the last valid one
+			const UINT Tri = XMMin(FirstTri + l, NumTris - 1);
+
+			for (UINT c = 0; c < 3; c++)
+			{
+				const UINT Idx = m_Indices[Tri * 3 + c];
+
+				(&V[c][0].x)[l] = m_PosX[Idx];
+				(&V[c][1].x)[l] = m_PosY[Idx];
+				(&V[c][2].x)[l] = m_PosZ[Idx];
+			}
+		}
+
+		for (UINT k = 0; k < 3; k++)
+		{
+			pV0[k] = XMLoadFloat4A(&V[0][k]);
+			pV1[k] = XMLoadFloat4A(&V[1][k]);
+			pV2[k] = XMLoadFloat4A(&V[2][k]);
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV TriangleMesh::ComputeTriangleAABBs(AABB* pBoxes) const noexcept
+	{
+		assert(pBoxes);
+
+		const UINT NumTris = GetNumTriangles();
+
+		for (UINT t = 0; t < NumTris; t += 4)
+		{
+			XMVECTOR V0[3], V1[3], V2[3];
+
+			GatherTriangles4(t, V0, V1, V2);
+
+			XMVECTOR Min[3], Max[3];
+
+			for (UINT k = 0; k < 3; k++)
+			{
+				Min[k] = XMVectorMin(XMVectorMin(V0[k], V1[k]), V2[k]);
+				Max[k] = XMVectorMax(XMVectorMax(V0[k], V1[k]), V2[k]);
+			}
+
+			// back to AoS
+			const XMMATRIX TMin = XMMatrixTranspose(XMMATRIX(Min[0], Min[1], Min[2], XMVectorZero()));
+			const XMMATRIX TMax = XMMatrixTranspose(XMMATRIX(Max[0], Max[1], Max[2], XMVectorZero()));
+
+			const UINT Num = XMMin(4u, NumTris - t);
+
+			for (UINT l = 0; l < Num; l++)
+			{
+				pBoxes[t + l].SetMinMaxExtents(TMin.r[l], TMax.r[l]);
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV TriangleMesh::ComputeFaceNormals()
+	{
+		const UINT NumTris = GetNumTriangles();
+		const UINT NumPadded = (NumTris + 3) & ~3u;
+
+		m_FaceNX.resize(NumPadded);
+		m_FaceNY.resize(NumPadded);
+		m_FaceNZ.resize(NumPadded);
+
+		const XMVECTOR Epsilon = XMVectorReplicate(1e-30f);
+
+		for (UINT t = 0; t < NumTris; t += 4)
+		{
+			XMVECTOR V0[3], V1[3], V2[3];
+
+			GatherTriangles4(t, V0, V1, V2);
+
+			const XMVECTOR E1x = XMVectorSubtract(V1[0], V0[0]);
+			const XMVECTOR E1y = XMVectorSubtract(V1[1], V0[1]);
+			const XMVECTOR E1z = XMVectorSubtract(V1[2], V0[2]);
+			const XMVECTOR E2x = XMVectorSubtract(V2[0], V0[0]);
+			const XMVECTOR E2y = XMVectorSubtract(V2[1], V0[1]);
+			const XMVECTOR E2z = XMVectorSubtract(V2[2], V0[2]);
+
+			// Cross-Product E1 x E2
+			const XMVECTOR Nx = XMVectorNegativeMultiplySubtract(E1z, E2y, XMVectorMultiply(E1y, E2z));
+			const XMVECTOR Ny = XMVectorNegativeMultiplySubtract(E1x, E2z, XMVectorMultiply(E1z, E2x));
+			const XMVECTOR Nz = XMVectorNegativeMultiplySubtract(E1y, E2x, XMVectorMultiply(E1x, E2y));
+
+			// Normalize
+			XMVECTOR LenSq = XMVectorMultiply(Nx, Nx);
+			LenSq = XMVectorMultiplyAdd(Ny, Ny, LenSq);
+			LenSq = XMVectorMultiplyAdd(Nz, Nz, LenSq);
+
+			const XMVECTOR InvLen = XMVectorReciprocalSqrt(XMVectorMax(LenSq, Epsilon));
+
+			XMStoreFloat4A((XMFLOAT4A*)&m_FaceNX[t], XMVectorMultiply(Nx, InvLen));
+			XMStoreFloat4A((XMFLOAT4A*)&m_FaceNY[t], XMVectorMultiply(Ny, InvLen));
+			XMStoreFloat4A((XMFLOAT4A*)&m_FaceNZ[t], XMVectorMultiply(Nz, InvLen));
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV TriangleMesh::ComputeVertexNormals()
+	{
+		const UINT NumVerts = GetNumVertices();
+		const UINT NumTris = GetNumTriangles();
+
+		m_NrmX.assign(NumVerts, 0.0f);
+		m_NrmY.assign(NumVerts, 0.0f);
+		m_NrmZ.assign(NumVerts, 0.0f);
+
+		// Scatter the unnormalized Face-Normals (Length = 2 * Area)
+		for (UINT t = 0; t < NumTris; t++)
+		{
+			const UINT i0 = m_Indices[t * 3 + 0];
+			const UINT i1 = m_Indices[t * 3 + 1];
+			const UINT i2 = m_Indices[t * 3 + 2];
+
+			const float e1x = m_PosX[i1] - m_PosX[i0], e1y = m_PosY[i1] - m_PosY[i0], e1z = m_PosZ[i1] - m_PosZ[i0];
+			const float e2x = m_PosX[i2] - m_PosX[i0], e2y = m_PosY[i2] - m_PosY[i0], e2z = m_PosZ[i2] - m_PosZ[i0];
+
+			const float nx = e1y * e2z - e1z * e2y;
+			const float ny = e1z * e2x - e1x * e2z;
+			const float nz = e1x * e2y - e1y * e2x;
+
+			m_NrmX[i0] += nx; m_NrmY[i0] += ny; m_NrmZ[i0] += nz;
+			m_NrmX[i1] += nx; m_NrmY[i1] += ny; m_NrmZ[i1] += nz;
+			m_NrmX[i2] += nx; m_NrmY[i2] += ny; m_NrmZ[i2] += nz;
+		}
+
+		// Normalize 4 Normals per Iteration
+		float* pX = m_NrmX.data();
+		float* pY = m_NrmY.data();
+		float* pZ = m_NrmZ.data();
+
+		const XMVECTOR Epsilon = XMVectorReplicate(1e-30f);
+		const UINT Count4 = NumVerts & ~3u;
+
+		UINT i = 0;
+
+		for (; i < Count4; i += 4)
+		{
+			const XMVECTOR X = XMLoadFloat4((const XMFLOAT4*)(pX + i));
+			const XMVECTOR Y = XMLoadFloat4((const XMFLOAT4*)(pY + i));
+			const XMVECTOR Z = XMLoadFloat4((const XMFLOAT4*)(pZ + i));
+
+			XMVECTOR LenSq = XMVectorMultiply(X, X);
+			LenSq = XMVectorMultiplyAdd(Y, Y, LenSq);
+			LenSq = XMVectorMultiplyAdd(Z, Z, LenSq);
+
+			const XMVECTOR InvLen = XMVectorReciprocalSqrt(XMVectorMax(LenSq, Epsilon));
+
+			XMStoreFloat4((XMFLOAT4*)(pX + i), XMVectorMultiply(X, InvLen));
+			XMStoreFloat4((XMFLOAT4*)(pY + i), XMVectorMultiply(Y, InvLen));
+			XMStoreFloat4((XMFLOAT4*)(pZ + i), XMVectorMultiply(Z, InvLen));
+		}
+
+		for (; i < NumVerts; i++)
+		{
+			const float Len = sqrtf(pX[i] * pX[i] + pY[i] * pY[i] + pZ[i] * pZ[i]);
+			const float InvLen = (Len > 0.0f) ? 1.0f / Len : 0.0f;
+
+			pX[i] *= InvLen;
+			pY[i] *= InvLen;
+			pZ[i] *= InvLen;
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV TriangleMesh::BuildTriangleData()
+	{
+		const UINT NumTris = GetNumTriangles();
+		const UINT NumPadded = (NumTris + 7) & ~7u;
+
+		m_TriV0X.resize(NumPadded); m_TriV0Y.resize(NumPadded); m_TriV0Z.resize(NumPadded);
+		m_TriV1X.resize(NumPadded); m_TriV1Y.resize(NumPadded); m_TriV1Z.resize(NumPadded);
+		m_TriV2X.resize(NumPadded); m_TriV2Y.resize(NumPadded); m_TriV2Z.resize(NumPadded);
+
+		for (UINT t = 0; t < NumTris; t += 4)
+		{
+			XMVECTOR V0[3], V1[3], V2[3];
+
+			GatherTriangles4(t, V0, V1, V2);
+
+			// exact Copies of the Vertices for the watertight Ray-Test
+			XMStoreFloat4A((XMFLOAT4A*)&m_TriV0X[t], V0[0]);
+			XMStoreFloat4A((XMFLOAT4A*)&m_TriV0Y[t], V0[1]);
+			XMStoreFloat4A((XMFLOAT4A*)&m_TriV0Z[t], V0[2]);
+
+			XMStoreFloat4A((XMFLOAT4A*)&m_TriV1X[t], V1[0]);
+			XMStoreFloat4A((XMFLOAT4A*)&m_TriV1Y[t], V1[1]);
+			XMStoreFloat4A((XMFLOAT4A*)&m_TriV1Z[t], V1[2]);
+
+			XMStoreFloat4A((XMFLOAT4A*)&m_TriV2X[t], V2[0]);
+			XMStoreFloat4A((XMFLOAT4A*)&m_TriV2Y[t], V2[1]);
+			XMStoreFloat4A((XMFLOAT4A*)&m_TriV2Z[t], V2[2]);
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV TriangleMesh::ReleaseTriangleData() noexcept
+	{
+		m_TriV0X.clear(); m_TriV0Y.clear(); m_TriV0Z.clear();
+		m_TriV1X.clear(); m_TriV1Y.clear(); m_TriV1Z.clear();
+		m_TriV2X.clear(); m_TriV2Y.clear(); m_TriV2Z.clear();
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV TriangleMesh::IntersectRay(const Ray& theRay, RayHit& Hit, const float MaxDist) const noexcept
+	{
+		// the Shear of the Ray is computed once for all Triangles
+		const WatertightRay R(theRay);
+
+		Hit.Distance = MaxDist;
+		Hit.U = Hit.V = 0.0f;
+		Hit.TriIndex = (UINT)-1;
+
+		return IntersectRay(R, 0, GetNumTriangles(), Hit);
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE const bool XM_CALLCONV TriangleMesh::IntersectRay(const WatertightRay& R, const UINT FirstTri, const UINT NumTris, RayHit& Hit) const noexcept
+	{
+		if (NumTris == 0) return false;
+
+		assert(HasTriangleData());
+		assert(FirstTri + NumTris <= GetNumTriangles());
+
+		const UINT End = FirstTri + NumTris;
+
+		// Vertex-Streams, permuted into the Space of the Ray-Shear
+		const float* pV0[3] = { m_TriV0X.data(), m_TriV0Y.data(), m_TriV0Z.data() };
+		const float* pV1[3] = { m_TriV1X.data(), m_TriV1Y.data(), m_TriV1Z.data() };
+		const float* pV2[3] = { m_TriV2X.data(), m_TriV2Y.data(), m_TriV2Z.data() };
+
+		const float* pAx = pV0[R.Kx]; const float* pAy = pV0[R.Ky]; const float* pAz = pV0[R.Kz];
+		const float* pBx = pV1[R.Kx]; const float* pBy = pV1[R.Ky]; const float* pBz = pV1[R.Kz];
+		const float* pCx = pV2[R.Kx]; const float* pCy = pV2[R.Ky]; const float* pCz = pV2[R.Kz];
+
+		bool bHit = false;
+
+#ifdef XM_AVX_INTRINSICS
+
+		// 8 Triangles per Iteration
+		const __m256 Ox = _mm256_set1_ps(R.Org[R.Kx]);
+		const __m256 Oy = _mm256_set1_ps(R.Org[R.Ky]);
+		const __m256 Oz = _mm256_set1_ps(R.Org[R.Kz]);
+		const __m256 Sx = _mm256_set1_ps(R.Sx);
+		const __m256 Sy = _mm256_set1_ps(R.Sy);
+		const __m256 Sz = _mm256_set1_ps(R.Sz);
+		const __m256 Zero = _mm256_setzero_ps();
+		const __m256 SignMask = _mm256_set1_ps(-0.0f);
+
+		__m256 BestT = _mm256_set1_ps(Hit.Distance);
+
+		for (UINT i = FirstTri & ~7u; i < End; i += 8)
+		{
+			// mask out the Lanes outside of the Range
+			int LaneMask = 0xFF;
+
+			if (i < FirstTri || i + 8 > End)
+			{
+				LaneMask = 0;
+
+				for (UINT l = 0; l < 8; l++)
+				{
+					if (i + l >= FirstTri && i + l < End) LaneMask |= 1 << l;
+				}
+			}
+
+			// Vertices relative to the Ray-Origin
+			const __m256 az = _mm256_sub_ps(_mm256_loadu_ps(pAz + i), Oz);
+			const __m256 bz = _mm256_sub_ps(_mm256_loadu_ps(pBz + i), Oz);
+			const __m256 cz = _mm256_sub_ps(_mm256_loadu_ps(pCz + i), Oz);
+
+			// Shear and Scale
+			const __m256 Ax = _mm256_sub_ps(_mm256_sub_ps(_mm256_loadu_ps(pAx + i), Ox), _mm256_mul_ps(Sx, az));
+			const __m256 Ay = _mm256_sub_ps(_mm256_sub_ps(_mm256_loadu_ps(pAy + i), Oy), _mm256_mul_ps(Sy, az));
+			const __m256 Bx = _mm256_sub_ps(_mm256_sub_ps(_mm256_loadu_ps(pBx + i), Ox), _mm256_mul_ps(Sx, bz));
+			const __m256 By = _mm256_sub_ps(_mm256_sub_ps(_mm256_loadu_ps(pBy + i), Oy), _mm256_mul_ps(Sy, bz));
+			const __m256 Cx = _mm256_sub_ps(_mm256_sub_ps(_mm256_loadu_ps(pCx + i), Ox), _mm256_mul_ps(Sx, cz));
+			const __m256 Cy = _mm256_sub_ps(_mm256_sub_ps(_mm256_loadu_ps(pCy + i), Oy), _mm256_mul_ps(Sy, cz));
+
+			// scaled Barycentrics
+			__m256 U = _mm256_sub_ps(_mm256_mul_ps(Cx, By), _mm256_mul_ps(Cy, Bx));
+			__m256 V = _mm256_sub_ps(_mm256_mul_ps(Ax, Cy), _mm256_mul_ps(Ay, Cx));
+			__m256 W = _mm256_sub_ps(_mm256_mul_ps(Bx, Ay), _mm256_mul_ps(By, Ax));
+
+			// fall back to double Precision on Edges (only the Lanes with a Barycentric of 0)
+			const __m256 OnEdge = _mm256_or_ps(_mm256_or_ps(_mm256_cmp_ps(U, Zero, _CMP_EQ_OQ), _mm256_cmp_ps(V, Zero, _CMP_EQ_OQ)), _mm256_cmp_ps(W, Zero, _CMP_EQ_OQ));
+			const int EdgeMask = LaneMask & _mm256_movemask_ps(OnEdge);
+
+			if (EdgeMask)
+			{
+				CACHE_ALIGN(32) float fAx[8], fAy[8], fBx[8], fBy[8], fCx[8], fCy[8];
+				CACHE_ALIGN(32) float fU[8], fV[8], fW[8];
+
+				_mm256_store_ps(fAx, Ax); _mm256_store_ps(fAy, Ay);
+				_mm256_store_ps(fBx, Bx); _mm256_store_ps(fBy, By);
+				_mm256_store_ps(fCx, Cx); _mm256_store_ps(fCy, Cy);
+				_mm256_store_ps(fU, U); _mm256_store_ps(fV, V); _mm256_store_ps(fW, W);
+
+				EdgeFunctionsDouble(fAx, fAy, fBx, fBy, fCx, fCy, fU, fV, fW, 8, EdgeMask);
+
+				U = _mm256_load_ps(fU);
+				V = _mm256_load_ps(fV);
+				W = _mm256_load_ps(fW);
+			}
+
+			const __m256 AnyNeg = _mm256_or_ps(_mm256_or_ps(_mm256_cmp_ps(U, Zero, _CMP_LT_OQ), _mm256_cmp_ps(V, Zero, _CMP_LT_OQ)), _mm256_cmp_ps(W, Zero, _CMP_LT_OQ));
+			const __m256 AnyPos = _mm256_or_ps(_mm256_or_ps(_mm256_cmp_ps(U, Zero, _CMP_GT_OQ), _mm256_cmp_ps(V, Zero, _CMP_GT_OQ)), _mm256_cmp_ps(W, Zero, _CMP_GT_OQ));
+
+			const __m256 Det = _mm256_add_ps(_mm256_add_ps(U, V), W);
+
+			// scaled Distance
+			__m256 T = _mm256_mul_ps(U, _mm256_mul_ps(Sz, az));
+			T = _mm256_add_ps(T, _mm256_mul_ps(V, _mm256_mul_ps(Sz, bz)));
+			T = _mm256_add_ps(T, _mm256_mul_ps(W, _mm256_mul_ps(Sz, cz)));
+
+			const __m256 SignT = _mm256_xor_ps(T, _mm256_and_ps(Det, SignMask));
+			const __m256 AbsDet = _mm256_andnot_ps(SignMask, Det);
+
+			__m256 Miss = _mm256_and_ps(AnyNeg, AnyPos);
+			Miss = _mm256_or_ps(Miss, _mm256_cmp_ps(Det, Zero, _CMP_EQ_OQ));
+			Miss = _mm256_or_ps(Miss, _mm256_cmp_ps(SignT, Zero, _CMP_LT_OQ));
+			Miss = _mm256_or_ps(Miss, _mm256_cmp_ps(SignT, _mm256_mul_ps(BestT, AbsDet), _CMP_GT_OQ));
+
+			LaneMask &= ~_mm256_movemask_ps(Miss);
+
+			if (LaneMask == 0) continue;
+
+			// at least one Hit -> resolve the closest
+			const __m256 RcpDet = _mm256_div_ps(_mm256_set1_ps(1.0f), Det);
+
+			CACHE_ALIGN(32) float fT[8];
+			CACHE_ALIGN(32) float fU[8];
+			CACHE_ALIGN(32) float fV[8];
+
+			_mm256_store_ps(fT, _mm256_mul_ps(T, RcpDet));
+			_mm256_store_ps(fU, _mm256_mul_ps(V, RcpDet));
+			_mm256_store_ps(fV, _mm256_mul_ps(W, RcpDet));
+
+			for (UINT l = 0; l < 8; l++)
+			{
+				if ((LaneMask & (1 << l)) && fT[l] <= Hit.Distance)
+				{
+					Hit.Distance = fT[l];
+					Hit.U = fU[l];
+					Hit.V = fV[l];
+					Hit.TriIndex = i + l;
+					bHit = true;
+				}
+			}
+
+			BestT = _mm256_set1_ps(Hit.Distance);
+		}
+
+#else
+
+		// 4 Triangles per Iteration
+		const XMVECTOR Ox = XMVectorReplicate(R.Org[R.Kx]);
+		const XMVECTOR Oy = XMVectorReplicate(R.Org[R.Ky]);
+		const XMVECTOR Oz = XMVectorReplicate(R.Org[R.Kz]);
+		const XMVECTOR Sx = XMVectorReplicate(R.Sx);
+		const XMVECTOR Sy = XMVectorReplicate(R.Sy);
+		const XMVECTOR Sz = XMVectorReplicate(R.Sz);
+		const XMVECTOR Zero = XMVectorZero();
+		const XMVECTOR SignMask = XMVectorSplatSignMask();
+
+		XMVECTOR BestT = XMVectorReplicate(Hit.Distance);
+
+		for (UINT i = FirstTri & ~3u; i < End; i += 4)
+		{
+			// mask out the Lanes outside of the Range
+			XMVECTOR Valid = XMVectorTrueInt();
+
+			if (i < FirstTri || i + 4 > End)
+			{
+				Valid = XMVectorSetInt(	(i + 0 >= FirstTri && i + 0 < End) ? 0xFFFFFFFF : 0,
+										(i + 1 >= FirstTri && i + 1 < End) ? 0xFFFFFFFF : 0,
+										(i + 2 >= FirstTri && i + 2 < End) ? 0xFFFFFFFF : 0,
+										(i + 3 >= FirstTri && i + 3 < End) ? 0xFFFFFFFF : 0 );
+			}
+
+			// Vertices relative to the Ray-Origin
+			const XMVECTOR az = XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)(pAz + i)), Oz);
+			const XMVECTOR bz = XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)(pBz + i)), Oz);
+			const XMVECTOR cz = XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)(pCz + i)), Oz);
+
+			// Shear and Scale
+			const XMVECTOR Ax = XMVectorNegativeMultiplySubtract(Sx, az, XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)(pAx + i)), Ox));
+			const XMVECTOR Ay = XMVectorNegativeMultiplySubtract(Sy, az, XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)(pAy + i)), Oy));
+			const XMVECTOR Bx = XMVectorNegativeMultiplySubtract(Sx, bz, XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)(pBx + i)), Ox));
+			const XMVECTOR By = XMVectorNegativeMultiplySubtract(Sy, bz, XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)(pBy + i)), Oy));
+			const XMVECTOR Cx = XMVectorNegativeMultiplySubtract(Sx, cz, XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)(pCx + i)), Ox));
+			const XMVECTOR Cy = XMVectorNegativeMultiplySubtract(Sy, cz, XMVectorSubtract(XMLoadFloat4((const XMFLOAT4*)(pCy + i)), Oy));
+
+			// scaled Barycentrics
+			XMVECTOR U = XMVectorNegativeMultiplySubtract(Cy, Bx, XMVectorMultiply(Cx, By));
+			XMVECTOR V = XMVectorNegativeMultiplySubtract(Ay, Cx, XMVectorMultiply(Ax, Cy));
+			XMVECTOR W = XMVectorNegativeMultiplySubtract(By, Ax, XMVectorMultiply(Bx, Ay));
+
+			// fall back to double Precision on Edges (only the Lanes with a Barycentric of 0)
+			const XMVECTOR OnEdge = XMVectorOrInt(XMVectorOrInt(XMVectorEqual(U, Zero), XMVectorEqual(V, Zero)), XMVectorEqual(W, Zero));
+			const int EdgeMask = _mm_movemask_ps(XMVectorAndInt(OnEdge, Valid));
+
+			if (EdgeMask)
+			{
+				XMFLOAT4A fAx, fAy, fBx, fBy, fCx, fCy, fU, fV, fW;
+
+				XMStoreFloat4A(&fAx, Ax); XMStoreFloat4A(&fAy, Ay);
+				XMStoreFloat4A(&fBx, Bx); XMStoreFloat4A(&fBy, By);
+				XMStoreFloat4A(&fCx, Cx); XMStoreFloat4A(&fCy, Cy);
+				XMStoreFloat4A(&fU, U); XMStoreFloat4A(&fV, V); XMStoreFloat4A(&fW, W);
+
+				EdgeFunctionsDouble(&fAx.x, &fAy.x, &fBx.x, &fBy.x, &fCx.x, &fCy.x, &fU.x, &fV.x, &fW.x, 4, EdgeMask);
+
+				U = XMLoadFloat4A(&fU);
+				V = XMLoadFloat4A(&fV);
+				W = XMLoadFloat4A(&fW);
+			}
+
+			const XMVECTOR AnyNeg = XMVectorOrInt(XMVectorOrInt(XMVectorLess(U, Zero), XMVectorLess(V, Zero)), XMVectorLess(W, Zero));
+			const XMVECTOR AnyPos = XMVectorOrInt(XMVectorOrInt(XMVectorGreater(U, Zero), XMVectorGreater(V, Zero)), XMVectorGreater(W, Zero));
+
+			const XMVECTOR Det = XMVectorAdd(XMVectorAdd(U, V), W);
+
+			// scaled Distance
+			XMVECTOR T = XMVectorMultiply(U, XMVectorMultiply(Sz, az));
+			T = XMVectorMultiplyAdd(V, XMVectorMultiply(Sz, bz), T);
+			T = XMVectorMultiplyAdd(W, XMVectorMultiply(Sz, cz), T);
+
+			const XMVECTOR SignT = XMVectorXorInt(T, XMVectorAndInt(Det, SignMask));
+			const XMVECTOR AbsDet = XMVectorAbs(Det);
+
+			Valid = XMVectorAndCInt(Valid, XMVectorAndInt(AnyNeg, AnyPos));
+			Valid = XMVectorAndCInt(Valid, XMVectorEqual(Det, Zero));
+			Valid = XMVectorAndCInt(Valid, XMVectorLess(SignT, Zero));
+			Valid = XMVectorAndCInt(Valid, XMVectorGreater(SignT, XMVectorMultiply(BestT, AbsDet)));
+
+			if (XMVector4EqualInt(Valid, XMVectorFalseInt())) continue;
+
+			// at least one Hit -> resolve the closest
+			const XMVECTOR RcpDet = XMVectorReciprocal(Det);
+
+			XMFLOAT4A fT, fU, fV;
+			CACHE_ALIGN(16) uint32_t Mask[4];
+
+			XMStoreFloat4A(&fT, XMVectorMultiply(T, RcpDet));
+			XMStoreFloat4A(&fU, XMVectorMultiply(V, RcpDet));
+			XMStoreFloat4A(&fV, XMVectorMultiply(W, RcpDet));
+			XMStoreInt4A(Mask, Valid);
+
+			for (UINT l = 0; l < 4; l++)
+			{
+				if (Mask[l] && (&fT.x)[l] <= Hit.Distance)
+				{
+					Hit.Distance = (&fT.x)[l];
+					Hit.U = (&fU.x)[l];
+					Hit.V = (&fV.x)[l];
+					Hit.TriIndex = i + l;
+					bHit = true;
+				}
+			}
+
+			BestT = XMVectorReplicate(Hit.Distance);
+		}
+
+#endif
+
+		return bHit;
+	}
+
+	//------------------------------------------------------------------------------
+	XM_INLINE void XM_CALLCONV TriangleMesh::EdgeFunctionsDouble(	const float* pAx, const float* pAy, const float* pBx, const float* pBy, const float* pCx, const float* pCy,
+																	float* pU, float* pV, float* pW, const UINT NumLanes, const int LaneMask) noexcept
+	{
+		// same Evaluation as WatertightRay::IntersectTriangle
+		for (UINT l = 0; l < NumLanes; l++)
+		{
+			if ((LaneMask & (1 << l)) == 0) continue;
+
+			pU[l] = (float)((double)pCx[l] * (double)pBy[l] - (double)pCy[l] * (double)pBx[l]);
+			pV[l] = (float)((double)pAx[l] * (double)pCy[l] - (double)pAy[l] * (double)pCx[l]);
+			pW[l] = (float)((double)pBx[l] * (double)pAy[l] - (double)pBy[l] * (double)pAx[l]);
+		}
+	}
+
+}// end of Namespace TurboMath
@@ -85,6 +85,10 @@
 #include <pmmintrin.h>
 #endif
 
+#ifdef XM_AVX_INTRINSICS
+#include <immintrin.h>
+#endif
+
 
 using namespace DirectX;
 
@@ -183,6 +187,7 @@ namespace TurboMath
 	class Matrix;
 	class Frustum;
 	class Polygon;
+	class ConvexHull;
 
 	
 
@@ -224,6 +229,28 @@ extern "C"
 	#include "WayPoints.h"
 	#include "MoveController.h"
 	#include "Triangle.h"
+	#include "MultiViewCuller.h"
+	#include "TriangleMesh.h"
+	#include "Parallel.h"
+	#include "BVH.h"
+	#include "Polygon.h"
+	#include "BSPTree.h"
+	#include "MovementSystem.h"
+	#include "PathSystem.h"
+	#include "SpatialHashGrid.h"
+	#include "KdTree.h"
+	#include "Distance.h"
+	#include "Sweep.h"
+	#include "ConvexHull.h"
+	#include "QuatArray.h"
+	#include "Animation.h"
+	#include "DualQuat.h"
+	#include "PackedTypes.h"
+	#include "ColorConvert.h"
+	#include "Random.h"
+	#include "Noise.h"
+	#include "Matrix3.h"
+	#include "DoublePrecision.h"
 
 
 //----------------------------------------------------------------------------------------
@@ -252,6 +279,28 @@ extern "C"
 	#include "WayPoints.inl"
 	#include "MoveController.inl"
 	#include "Triangle.inl"
+	#include "MultiViewCuller.inl"
+	#include "TriangleMesh.inl"
+	#include "Parallel.inl"
+	#include "BVH.inl"
+	#include "Polygon.inl"
+	#include "BSPTree.inl"
+	#include "MovementSystem.inl"
+	#include "PathSystem.inl"
+	#include "SpatialHashGrid.inl"
+	#include "KdTree.inl"
+	#include "Distance.inl"
+	#include "Sweep.inl"
+	#include "ConvexHull.inl"
+	#include "QuatArray.inl"
+	#include "Animation.inl"
+	#include "DualQuat.inl"
+	#include "PackedTypes.inl"
+	#include "ColorConvert.inl"
+	#include "Random.inl"
+	#include "Noise.inl"
+	#include "Matrix3.inl"
+	#include "DoublePrecision.inl"
 	#include "VerifyCPUSupport.inl"
 
 
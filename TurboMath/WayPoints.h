@@ -30,6 +30,7 @@
 
 #include <vector>
 #include <string>
+#include <algorithm>
 
 namespace TurboMath
 {
@@ -86,6 +87,10 @@ namespace TurboMath
 	CACHE_ALIGN(16) class WayPoints
 	{
 	public:
+
+		/// Samples per Segment for the Arc-Length-Table
+		static constexpr size_t ARC_SAMPLES = 16;
+
 		enum PathPointType
 		{
 			PATH_LOCKAT_NONE = 0,			// Only for Lock-AT
@@ -102,7 +107,6 @@ namespace TurboMath
 		Vector4				m_Position;										// Aktuelle Position auf dem Pfad
 		Vector4				m_LockAt;										// act. Lock-At-Vector
 
-		Vector4				m_ComputePoints[4];									// Diese Punkte werden fr die Interpolation benutzt
 
 		double				m_CurrentTime;										// Aktuelle Zeit
 		float				m_Speed;										// Speed
@@ -114,6 +118,14 @@ namespace TurboMath
 
 		std::wstring			m_RouteName;										// Name der Route
 
+		std::vector<float>		m_ArcTable;										// cumulative Arc-Length, ARC_SAMPLES Samples per Segment
+		float				m_PathLength;										// Length of the whole (closed) Path
+		size_t				m_ArcCursor;										// last Interval found in m_ArcTable
+		size_t				m_Segment;										// current Segment
+		float				m_SegmentTime;										// Time inside the current Segment [0..1]
+		bool				m_ConstantSpeed;									// move with constant Speed (Arc-Length)
+		bool				m_ArcTableDirty;									// m_ArcTable must be rebuilt
+
 	public:
 
 		// Ctor / Dtor
@@ -124,6 +136,13 @@ namespace TurboMath
 
 			m_Speed = 0.025f;
 			m_CurrentTime = 0.0f;
+
+			m_PathLength = 0.0f;
+			m_ArcCursor = 0;
+			m_Segment = 0;
+			m_SegmentTime = 0.0f;
+			m_ConstantSpeed = true;
+			m_ArcTableDirty = false;
 		}
 
 		virtual ~WayPoints() noexcept
@@ -134,7 +153,10 @@ namespace TurboMath
 		// Functions
 
 		/// Get num Points in List
-		const size_t XM_CALLCONV	GetNumPathPoints()	 noexcept			{return m_PathPointList.size();}
+		const size_t XM_CALLCONV	GetNumPathPoints() const noexcept			{return m_PathPointList.size();}
+
+		/// Get a Point of the List
+		const PathPoint& XM_CALLCONV	GetPathPoint(const size_t Index) const noexcept	{return m_PathPointList[Index];}
 
 		/// Add Point to List
 		void	XM_CALLCONV		AddPathPoint(PathPoint& newPoint) noexcept;
@@ -143,8 +165,12 @@ namespace TurboMath
 		void	XM_CALLCONV		SetPathTypePosition(const PathPointType& type) noexcept
 		{
 			m_PathTypePosition = type;
+			m_ArcTableDirty = true;
 		}
 
+		/// Get the Path-Type for Position
+		const PathPointType XM_CALLCONV	GetPathTypePosition() const noexcept	{return m_PathTypePosition;}
+
 		/// Set the Path-Type for Lock-At
 		void	XM_CALLCONV		SetPathTypeLockAt(const PathPointType& type) noexcept
 		{
@@ -160,7 +186,14 @@ namespace TurboMath
 			if (m_PathPointList.size() == 0)  return false;							// No Path
 
 			m_CurrentTime += (m_Speed * fTime);
-			if(m_CurrentTime > 1.0f) m_CurrentTime = 0.0f;
+			if(m_CurrentTime > 1.0f)
+			{
+				m_CurrentTime = 0.0f;
+				m_ArcCursor = 0;
+			}
+
+			// Segment for Position and Lock-At
+			FindSegment((float)m_CurrentTime, m_Segment, m_SegmentTime);
 
 			// Calc Position
 			if (m_PathTypePosition == PATH_STRAIGHT) 
@@ -201,6 +234,7 @@ namespace TurboMath
 		void	XM_CALLCONV		Restart() noexcept
 		{
 			m_CurrentTime = 0.0f;
+			m_ArcCursor = 0;
 		}
 
 		void	XM_CALLCONV		SetReverseAble(const bool Status) noexcept		{m_ReverseAble = Status;}			// ReverseAble setzen
@@ -209,8 +243,24 @@ namespace TurboMath
 		void	XM_CALLCONV		SetSpeed(const float fSpeed)	 noexcept		{m_Speed = 1.0f / fSpeed;}			// Set Speed
 		const float XM_CALLCONV		GetSpeed()	 noexcept				{return m_Speed;}					// Get Speed
 
+		/// move with constant Speed along the Path (default) or with constant Time per Segment
+		void	XM_CALLCONV		SetConstantSpeed(const bool Status) noexcept	{m_ConstantSpeed = Status; m_ArcCursor = 0;}
+		const bool XM_CALLCONV		GetConstantSpeed() const noexcept			{return m_ConstantSpeed;}
+
+		/// Length of the whole (closed) Path
+		const float XM_CALLCONV		GetPathLength() noexcept;
+
 	private:
 
+		/// build the cumulative Arc-Length-Table and the Start- / Move-Times of the PathPoints
+		void	XM_CALLCONV		BuildArcLengthTable() noexcept;
+
+		/// map the Path-Time [0..1] to a Segment and the Time inside the Segment
+		void	XM_CALLCONV		FindSegment(const float Time, size_t& Segment, float& SegmentTime) noexcept;
+
+		/// evaluate the Position on a Segment
+		const Vector4 XM_CALLCONV	EvaluateSegment(const size_t Segment, const float SegmentTime, const bool bCurved) const noexcept;
+
 		/// Linerare Interpolation
 		const bool XM_CALLCONV		ExecuteLinearInterpolation( const float fTime,Vector4* pResult = NULL) noexcept;
 
@@ -31,6 +31,7 @@ namespace TurboMath
 		m_PathTypeLockAt = PATH_STRAIGHT;
 
 		m_PathPointList.push_back(newPoint);
+		m_ArcTableDirty = true;
 	}
 
 	/// Delete Path
@@ -40,79 +41,165 @@ namespace TurboMath
 
 		m_PathTypePosition = PATH_STRAIGHT;
 		m_PathTypeLockAt = PATH_STRAIGHT;
+
+		m_ArcTable.clear();
+		m_PathLength = 0.0f;
+		m_ArcCursor = 0;
+		m_ArcTableDirty = false;
 	}
 
-	/// Linerare Interpolation
-	XM_INLINE   const bool  XM_CALLCONV WayPoints::ExecuteLinearInterpolation( const float fTime,Vector4* pResult) noexcept
+	/// Length of the whole (closed) Path
+	XM_INLINE   const float  XM_CALLCONV WayPoints::GetPathLength() noexcept
 	{
-		assert(pResult);
-		if (!pResult) return false;
+		if (m_ArcTableDirty) BuildArcLengthTable();
 
-		const size_t NumPoints = m_PathPointList.size();
-
-		if (NumPoints == 0) return false;
+		return m_PathLength;
+	}
 
-		assert(NumPoints > 0);																		// Have we any Points in the List ?
+	/// Position on a Segment, the Path is closed (the last Segment goes back to the first Point)
+	XM_INLINE   const Vector4  XM_CALLCONV WayPoints::EvaluateSegment(const size_t Segment, const float SegmentTime, const bool bCurved) const noexcept
+	{
+		const size_t NumPoints = m_PathPointList.size();
 
-		const float fCurrentPoint = m_CurrentTime * (float)NumPoints;
-		const size_t CurrentPoint = (size_t)floor(fCurrentPoint);
+		assert(Segment < NumPoints);
 
-		const float segmentLength = (1.0f / (float)NumPoints);
-		const float timeStart = (float)CurrentPoint * segmentLength;
+		const size_t p2 = Segment;
+		const size_t p3 = (Segment + 1) % NumPoints;
 
-		float segmentTime = (m_CurrentTime - timeStart) / segmentLength;
+		if (!bCurved)
+			return Vector4::Lerp(m_PathPointList[p2].GetPoint(), m_PathPointList[p3].GetPoint(), SegmentTime);
 
-		size_t nextPoint = 0;
-		if(CurrentPoint < NumPoints-2) nextPoint = CurrentPoint+1;
+		const size_t p1 = (Segment + NumPoints - 1) % NumPoints;
+		const size_t p4 = (Segment + 2) % NumPoints;
 
-		m_ComputePoints[0] = m_PathPointList[CurrentPoint].GetPoint();
-		m_ComputePoints[1] = m_PathPointList[nextPoint].GetPoint();
+		return Vector4::Catmullrom(	m_PathPointList[p1].GetPoint(), m_PathPointList[p2].GetPoint(),
+									m_PathPointList[p3].GetPoint(), m_PathPointList[p4].GetPoint(), SegmentTime);
+	}
 
-		*pResult = Vector4::Lerp(m_ComputePoints[0],m_ComputePoints[1],segmentTime);
+	/// sample every Segment ARC_SAMPLES times and sum up the Chord-Lengths
+	XM_INLINE   void  XM_CALLCONV WayPoints::BuildArcLengthTable() noexcept
+	{
+		const size_t NumPoints = m_PathPointList.size();
 
-		// Ready
-		return true;
+		m_ArcTable.clear();
+		m_PathLength = 0.0f;
+		m_ArcCursor = 0;
+		m_ArcTableDirty = false;
+
+		if (NumPoints == 0) return;
+
+		const bool bCurved = (m_PathTypePosition != PATH_STRAIGHT);
+
+		m_ArcTable.resize(NumPoints * ARC_SAMPLES + 1);
+		m_ArcTable[0] = 0.0f;
+
+		float Length = 0.0f;
+		Vector4 Prev = EvaluateSegment(0, 0.0f, bCurved);
+
+		for (size_t Segment = 0; Segment < NumPoints; Segment++)
+		{
+			for (size_t i = 1; i <= ARC_SAMPLES; i++)
+			{
+				const Vector4 Cur = EvaluateSegment(Segment, (float)i / (float)ARC_SAMPLES, bCurved);
+
+				Length += XMVectorGetX(XMVector3Length(XMVectorSubtract(Cur, Prev)));
+				m_ArcTable[Segment * ARC_SAMPLES + i] = Length;
+
+				Prev = Cur;
+			}
+		}
+
+		m_PathLength = Length;
+
+		// Start- / Move-Time of every Point as Part of the Path-Time [0..1]
+		for (size_t Segment = 0; Segment < NumPoints; Segment++)
+		{
+			const float Start = m_ArcTable[Segment * ARC_SAMPLES];
+			const float End = m_ArcTable[(Segment + 1) * ARC_SAMPLES];
+
+			if (Length > 0.0f)
+			{
+				m_PathPointList[Segment].SetStartTime(Start / Length);
+				m_PathPointList[Segment].SetMoveTime((End - Start) / Length);
+			}
+			else
+			{
+				m_PathPointList[Segment].SetStartTime((float)Segment / (float)NumPoints);
+				m_PathPointList[Segment].SetMoveTime(1.0f / (float)NumPoints);
+			}
+		}
 	}
 
-	/// Catmull-Rom Interpolation
-	XM_INLINE   const bool  XM_CALLCONV WayPoints::ExecuteCatmullRomInterpolation(const float fTime,Vector4* pResult) noexcept
+	/// map the Path-Time to a Segment. With constant Speed the Time is a Part of
+	/// the Path-Length, the Table-Interval is found from the last one (monotonic
+	/// Time, O(1)) or by Binary-Search after a Jump.
+	XM_INLINE   void  XM_CALLCONV WayPoints::FindSegment(const float Time, size_t& Segment, float& SegmentTime) noexcept
 	{
-		assert(pResult);
-		if (!pResult) return false;
-
 		const size_t NumPoints = m_PathPointList.size();
 
-		if (NumPoints == 0) return true;
+		Segment = 0;
+		SegmentTime = 0.0f;
+
+		if (NumPoints == 0) return;
 
-		assert(NumPoints > 0);																		// Have we any Points in the List ?
+		float Param = Time * (float)NumPoints;
 
-		const float fCurrentPoint = m_CurrentTime * (float)NumPoints;
-		size_t	CurrentPoint = (size_t)floor(fCurrentPoint);
+		if (m_ConstantSpeed)
+		{
+			if (m_ArcTableDirty) BuildArcLengthTable();
 
-		const float segmentLength = (1.0f / (float)NumPoints);
-		const float timeStart = (float)CurrentPoint * segmentLength;
+			if (m_PathLength <= 0.0f) return;
 
-		float segmentTime = (m_CurrentTime - timeStart) / segmentLength;
+			const float s = Time * m_PathLength;
+			const size_t Last = m_ArcTable.size() - 2;
 
-		size_t p1,p2,p3,p4;
+			size_t k = XMMin(m_ArcCursor, Last);
 
-		if (CurrentPoint > 0) p1 = CurrentPoint -1;
-		else p1 = NumPoints - 1;
+			if (m_ArcTable[k] <= s && (k + 8 > Last || s < m_ArcTable[k + 8]))
+			{
+				while (k < Last && m_ArcTable[k + 1] <= s) k++;
+			}
+			else
+			{
+				k = (size_t)(std::upper_bound(m_ArcTable.begin(), m_ArcTable.end(), s) - m_ArcTable.begin());
+				k = XMMin((k > 0) ? k - 1 : 0, Last);
+			}
 
-		p2 = CurrentPoint;
+			m_ArcCursor = k;
 
-		if (CurrentPoint < NumPoints -1) p3 = CurrentPoint +1;
-		else p3 = 0;
+			const float Interval = m_ArcTable[k + 1] - m_ArcTable[k];
+			const float f = (Interval > 0.0f) ? XMMin((s - m_ArcTable[k]) / Interval, 1.0f) : 0.0f;
 
-		if(CurrentPoint < NumPoints -2) p4 = CurrentPoint +2;
-		else p4 = 1;
+			Param = ((float)k + f) / (float)ARC_SAMPLES;
+		}
+
+		Segment = XMMin((size_t)Param, NumPoints - 1);
+		SegmentTime = Param - (float)Segment;
+	}
+
+	/// Linerare Interpolation
+	XM_INLINE   const bool  XM_CALLCONV WayPoints::ExecuteLinearInterpolation( const float fTime,Vector4* pResult) noexcept
+	{
+		assert(pResult);
+		if (!pResult) return false;
+
+		if (m_PathPointList.empty()) return false;
+
+		*pResult = EvaluateSegment(m_Segment, m_SegmentTime, false);
+
+		// Ready
+		return true;
+	}
+
+	/// Catmull-Rom Interpolation
+	XM_INLINE   const bool  XM_CALLCONV WayPoints::ExecuteCatmullRomInterpolation(const float fTime,Vector4* pResult) noexcept
+	{
+		assert(pResult);
+		if (!pResult) return false;
 
-		m_ComputePoints[0] = m_PathPointList[p1].GetPoint();
-		m_ComputePoints[1] = m_PathPointList[p2].GetPoint();
-		m_ComputePoints[2] = m_PathPointList[p3].GetPoint();
-		m_ComputePoints[3] = m_PathPointList[p4].GetPoint();
+		if (m_PathPointList.empty()) return true;
 
-		*pResult = Vector4::Catmullrom(m_ComputePoints[0], m_ComputePoints[1], m_ComputePoints[2], m_ComputePoints[3], segmentTime);
+		*pResult = EvaluateSegment(m_Segment, m_SegmentTime, true);
 
 		// Ready
 		return true;